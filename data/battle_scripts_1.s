@@ -631,9 +631,7 @@ BattleScript_EffectSteelBeam::
 	attackstring
 	ppreduce
 	accuracycheck BattleScript_SteelBeamMiss, ACC_CURR_MOVE
-	critcalc
-	damagecalc
-	adjustdamage
+	calchitdamage
 	attackanimation
 	waitanimation
 	effectivenesssound
@@ -848,9 +846,7 @@ BattleScript_EffectFling:
 	printstring STRINGID_PKMNFLUNG
 	waitmessage B_WAIT_TIME_SHORT
 	ppreduce
-	critcalc
-	damagecalc
-	adjustdamage
+	calchitdamage
 	attackanimation
 	waitanimation
 	effectivenesssound
@@ -932,9 +928,7 @@ BattleScript_EffectPhotonGeyser:
 	accuracycheck BattleScript_PrintMoveMissed, ACC_CURR_MOVE
 	attackstring
 	ppreduce
-	critcalc
-	damagecalc
-	adjustdamage
+	calchitdamage
 	photongeysercheck BS_ATTACKER
 	attackanimation
 	waitanimation
@@ -1094,9 +1088,7 @@ BattleScript_EffectPlasmaFists:
 	accuracycheck BattleScript_PrintMoveMissed, ACC_CURR_MOVE
 	attackstring
 	ppreduce
-	critcalc
-	damagecalc
-	adjustdamage
+	calchitdamage
 	attackanimation
 	waitanimation
 	effectivenesssound
@@ -1120,9 +1112,7 @@ BattleScript_EffectSparklySwirl:
 	accuracycheck BattleScript_PrintMoveMissed, ACC_CURR_MOVE
 	attackstring
 	ppreduce
-	critcalc
-	damagecalc
-	adjustdamage
+	calchitdamage
 	attackanimation
 	waitanimation
 	effectivenesssound
@@ -1146,9 +1136,7 @@ BattleScript_EffectFreezyFrost:
 	accuracycheck BattleScript_PrintMoveMissed, ACC_CURR_MOVE
 	attackstring
 	ppreduce
-	critcalc
-	damagecalc
-	adjustdamage
+	calchitdamage
 	attackanimation
 	waitanimation
 	effectivenesssound
@@ -1172,9 +1160,7 @@ BattleScript_EffectSappySeed:
 	accuracycheck BattleScript_PrintMoveMissed, ACC_CURR_MOVE
 	attackstring
 	ppreduce
-	critcalc
-	damagecalc
-	adjustdamage
+	calchitdamage
 	attackanimation
 	waitanimation
 	effectivenesssound
@@ -1199,9 +1185,7 @@ BattleScript_EffectBaddyBad:
 	accuracycheck BattleScript_PrintMoveMissed, ACC_CURR_MOVE
 	attackstring
 	ppreduce
-	critcalc
-	damagecalc
-	adjustdamage
+	calchitdamage
 	attackanimation
 	waitanimation
 	effectivenesssound
@@ -1225,9 +1209,7 @@ BattleScript_EffectGlitzyGlow:
 	accuracycheck BattleScript_PrintMoveMissed, ACC_CURR_MOVE
 	attackstring
 	ppreduce
-	critcalc
-	damagecalc
-	adjustdamage
+	calchitdamage
 	attackanimation
 	waitanimation
 	effectivenesssound
@@ -1304,9 +1286,7 @@ BattleScript_EffectRemoveTerrain:
 	attackstring
 	ppreduce
 	jumpifword CMP_NO_COMMON_BITS, gFieldStatuses, STATUS_FIELD_TERRAIN_ANY, BattleScript_ButItFailed
-	critcalc
-	damagecalc
-	adjustdamage
+	calchitdamage
 	attackanimation
 	waitanimation
 	effectivenesssound
@@ -1403,9 +1383,7 @@ BattleScript_EffectRelicSong:
 	accuracycheck BattleScript_PrintMoveMissed, ACC_CURR_MOVE
 	attackstring
 	ppreduce
-	critcalc
-	damagecalc
-	adjustdamage
+	calchitdamage
 	attackanimation
 	waitanimation
 	effectivenesssound
@@ -2019,9 +1997,7 @@ BattleScript_SynchronoiseLoop:
 	movevaluescleanup
 	jumpifcantusesynchronoise BattleScript_SynchronoiseNoEffect
 	accuracycheck BattleScript_SynchronoiseMissed, ACC_CURR_MOVE
-	critcalc
-	damagecalc
-	adjustdamage
+	calchitdamage
 	attackanimation
 	waitanimation
 	effectivenesssound
@@ -2182,9 +2158,7 @@ BattleScript_EffectHitSwitchTarget:
 	accuracycheck BattleScript_PrintMoveMissed, ACC_CURR_MOVE
 	attackstring
 	ppreduce
-	critcalc
-	damagecalc
-	adjustdamage
+	calchitdamage
 	attackanimation
 	waitanimation
 	effectivenesssound
@@ -3159,9 +3133,7 @@ BattleScript_EffectHitEscape:
 	accuracycheck BattleScript_PrintMoveMissed, ACC_CURR_MOVE
 	attackstring
 	ppreduce
-	critcalc
-	damagecalc
-	adjustdamage
+	calchitdamage
 	attackanimation
 	waitanimation
 	effectivenesssound
@@ -3223,9 +3195,7 @@ BattleScript_HitFromAtkString::
 	attackstring
 	ppreduce
 BattleScript_HitFromCritCalc::
-	critcalc
-	damagecalc
-	adjustdamage
+	calchitdamage
 BattleScript_HitFromAtkAnimation::
 	attackanimation
 	waitanimation
@@ -3253,9 +3223,7 @@ BattleScript_EffectNaturalGift:
 	jumpifability BS_ATTACKER, ABILITY_KLUTZ, BattleScript_ButItFailed
 	jumpifstatus3 BS_ATTACKER, STATUS3_EMBARGO, BattleScript_ButItFailed
 	accuracycheck BattleScript_MoveMissedPause, ACC_CURR_MOVE
-	critcalc
-	damagecalc
-	adjustdamage
+	calchitdamage
 	attackanimation
 	waitanimation
 	effectivenesssound
@@ -3439,9 +3407,7 @@ BattleScript_EffectAbsorb::
 	accuracycheck BattleScript_PrintMoveMissed, ACC_CURR_MOVE
 	attackstring
 	ppreduce
-	critcalc
-	damagecalc
-	adjustdamage
+	calchitdamage
 	attackanimation
 	waitanimation
 	effectivenesssound
@@ -3505,9 +3471,7 @@ BattleScript_ExplosionAnimRet:
 	waitanimation
 BattleScript_ExplosionDmgRet:
 	movevaluescleanup
-	critcalc
-	damagecalc
-	adjustdamage
+	calchitdamage
 	accuracycheck BattleScript_ExplosionMissedRet, ACC_CURR_MOVE
 	effectivenesssound
 	hitanimation BS_TARGET
@@ -3589,9 +3553,7 @@ BattleScript_DreamEaterWorked:
 	accuracycheck BattleScript_PrintMoveMissed, ACC_CURR_MOVE
 	attackstring
 	ppreduce
-	critcalc
-	damagecalc
-	adjustdamage
+	calchitdamage
 	attackanimation
 	waitanimation
 	effectivenesssound
@@ -3884,9 +3846,7 @@ BattleScript_EffectFlinchStatus:
 	accuracycheck BattleScript_PrintMoveMissed, ACC_CURR_MOVE
 	attackstring
 	ppreduce
-	critcalc
-	damagecalc
-	adjustdamage
+	calchitdamage
 	attackanimation
 	waitanimation
 	effectivenesssound
@@ -4738,9 +4698,7 @@ BattleScript_EffectEerieSpell::
 	accuracycheck BattleScript_ButItFailed, ACC_CURR_MOVE
 	attackstring
 	ppreduce
-	critcalc
-	damagecalc
-	adjustdamage
+	calchitdamage
 	attackanimation
 	waitanimation
 	effectivenesssound
@@ -5136,9 +5094,7 @@ BattleScript_EffectRapidSpin::
 	accuracycheck BattleScript_PrintMoveMissed, ACC_CURR_MOVE
 	attackstring
 	ppreduce
-	critcalc
-	damagecalc
-	adjustdamage
+	calchitdamage
 	attackanimation
 	waitanimation
 	effectivenesssound
@@ -5454,9 +5410,7 @@ BattleScript_EffectBeatUp::
 .if B_BEAT_UP >= GEN_5
 	attackstring
 	ppreduce
-	critcalc
-	damagecalc
-	adjustdamage
+	calchitdamage
 	trydobeatup
 	goto BattleScript_HitFromAtkAnimation
 .else
@@ -6019,9 +5973,7 @@ BattleScript_EffectBrickBreak::
 	attackstring
 	ppreduce
 	removelightscreenreflect
-	critcalc
-	damagecalc
-	adjustdamage
+	calchitdamage
 	jumpifbyte CMP_EQUAL, sB_ANIM_TURN, 0, BattleScript_BrickBreakAnim
 	bichalfword gMoveResultFlags, MOVE_RESULT_MISSED | MOVE_RESULT_DOESNT_AFFECT_FOE
 BattleScript_BrickBreakAnim::
@@ -6782,9 +6734,7 @@ BattleScript_PursuitDmgOnSwitchOut::
 	pause B_WAIT_TIME_SHORT
 	attackstring
 	ppreduce
-	critcalc
-	damagecalc
-	adjustdamage
+	calchitdamage
 	attackanimation
 	waitanimation
 	effectivenesssound
@@ -7560,9 +7510,7 @@ BattleScript_MonTookFutureAttack::
 BattleScript_CheckDoomDesireMiss::
 	accuracycheck BattleScript_FutureAttackMiss, MOVE_DOOM_DESIRE
 BattleScript_FutureAttackAnimate::
-	critcalc
-	damagecalc
-	adjustdamage
+	calchitdamage
 	jumpifmovehadnoeffect BattleScript_DoFutureAttackResult
 	jumpifbyte CMP_NOT_EQUAL, cMULTISTRING_CHOOSER, B_MSG_FUTURE_SIGHT, BattleScript_FutureHitAnimDoomDesire
 	playanimation BS_ATTACKER, B_ANIM_FUTURE_SIGHT_HIT
@@ -10264,9 +10212,7 @@ BattleScript_EffectHitSetRemoveTerrain:
 	accuracycheck BattleScript_PrintMoveMissed, ACC_CURR_MOVE
 	attackstring
 	ppreduce
-	critcalc
-	damagecalc
-	adjustdamage
+	calchitdamage
 	attackanimation
 	waitanimation
 	effectivenesssound
@@ -46,10 +46,22 @@
 #define Dma3FillLarge16_(value, dest, size) Dma3FillLarge_(value, dest, size, 16)
 #define Dma3FillLarge32_(value, dest, size) Dma3FillLarge_(value, dest, size, 32)
 
+struct Dma3Stats
+{
+    u32 bytesQueued;
+    u32 bytesSent;
+    u16 requestsQueued;
+    u16 requestsSent;
+    u16 requestsMerged;
+    u16 requestsSuperseded;
+    u16 requestsDeferred;
+};
+
 void ClearDma3Requests(void);
 void ProcessDma3Requests(void);
 s16 RequestDma3Copy(const void *src, void *dest, u16 size, u8 mode);
 s16 RequestDma3Fill(s32 value, void *dest, u16 size, u8 mode);
 s16 CheckForSpaceForDma3Request(s16 index);
+void GetDma3Stats(struct Dma3Stats *stats);
 
 #endif // GUARD_DMA3_H
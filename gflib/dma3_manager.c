@@ -8,113 +8,196 @@
 #define DMA_REQUEST_COPY16 3
 #define DMA_REQUEST_FILL16 4
 
+#define DMA_REQUEST_NONE 0xFF
+
+#define MAX_DMA_BYTES_PER_FRAME (40 * 1024)
+
+// Requests are drained one priority class at a time. The classes are chosen
+// by destination so that requests in different classes can never overlap,
+// which makes it safe to send them out of submission order.
+enum {
+    DMA_PRIORITY_PLTT_OAM,  // palette and OAM, latency sensitive and tiny
+    DMA_PRIORITY_OBJ_VRAM,  // sprite frame and sheet copies
+    DMA_PRIORITY_BULK,      // background tiles, tilemaps and everything else
+    DMA_PRIORITY_COUNT,
+};
+
 struct Dma3Request
 {
     const u8 *src;
     u8 *dest;
     u16 size;
-    u16 mode;
+    u8 mode;
+    u8 next;
     u32 value;
 };
 
 static struct Dma3Request sDma3Requests[MAX_DMA_REQUESTS];
+static u8 sDma3QueueHead[DMA_PRIORITY_COUNT];
+static u8 sDma3QueueTail[DMA_PRIORITY_COUNT];
+static struct Dma3Stats sDma3Stats;
+static struct Dma3Stats sDma3LastFrameStats;
 
 static vbool8 sDma3ManagerLocked;
 static u8 sDma3RequestCursor;
 
-void ClearDma3Requests(void)
+static bool32 IsDestInRange(const u8 *dest, u32 size, u32 start, u32 end)
 {
-    int i;
+    return (u32)dest >= start && (u32)dest + size <= end;
+}
 
-    sDma3ManagerLocked = TRUE;
-    sDma3RequestCursor = 0;
+static u32 GetDma3RequestPriority(const u8 *dest, u32 size)
+{
+    if (IsDestInRange(dest, size, PLTT, PLTT + PLTT_SIZE)
+     || IsDestInRange(dest, size, OAM, OAM + OAM_SIZE))
+        return DMA_PRIORITY_PLTT_OAM;
+    if (IsDestInRange(dest, size, OBJ_VRAM0, OBJ_VRAM0 + OBJ_VRAM0_SIZE))
+        return DMA_PRIORITY_OBJ_VRAM;
+    return DMA_PRIORITY_BULK;
+}
 
-    for (i = 0; i < MAX_DMA_REQUESTS; i++)
+static bool32 DoDma3RequestsOverlap(const struct Dma3Request *request, const u8 *dest, u32 size)
+{
+    return request->dest < dest + size && dest < request->dest + request->size;
+}
+
+static bool32 DoesDma3QueueOverlap(u32 priority, const u8 *dest, u32 size)
+{
+    u32 i;
+
+    for (i = sDma3QueueHead[priority]; i != DMA_REQUEST_NONE; i = sDma3Requests[i].next)
     {
-        sDma3Requests[i].size = 0;
-        sDma3Requests[i].src = NULL;
-        sDma3Requests[i].dest = NULL;
+        if (DoDma3RequestsOverlap(&sDma3Requests[i], dest, size))
+            return TRUE;
     }
+    return FALSE;
+}
 
-    sDma3ManagerLocked = FALSE;
+static bool32 IsDma3RequestFill(u32 mode)
+{
+    return mode == DMA_REQUEST_FILL32 || mode == DMA_REQUEST_FILL16;
 }
 
-void ProcessDma3Requests(void)
+// Tries to fold a new request into one that is already queued in the same
+// class. Only the last queued request touching the new range is considered,
+// since anything queued after it must still be written after it.
+static s32 TryCoalesceDma3Request(u32 priority, const u8 *src, u8 *dest, u32 size, u32 mode, u32 value)
 {
-    u16 bytesTransferred;
+    struct Dma3Request *request;
+    s32 i, found = -1;
 
-    if (sDma3ManagerLocked)
-        return;
+    for (i = sDma3QueueHead[priority]; i != DMA_REQUEST_NONE; i = sDma3Requests[i].next)
+    {
+        // Adjacent requests count as touching so that they can be merged.
+        if (sDma3Requests[i].dest <= dest + size && dest <= sDma3Requests[i].dest + sDma3Requests[i].size)
+            found = i;
+    }
+    if (found == -1)
+        return -1;
 
-    bytesTransferred = 0;
+    request = &sDma3Requests[found];
 
-    // as long as there are DMA requests to process (unless size or vblank is an issue), do not exit
-    while (sDma3Requests[sDma3RequestCursor].size != 0)
+    // The new request completely overwrites the old one; reuse its slot.
+    if (dest <= request->dest && dest + size >= request->dest + request->size)
     {
-        bytesTransferred += sDma3Requests[sDma3RequestCursor].size;
+        sDma3Stats.requestsSuperseded++;
+        request->src = src;
+        request->dest = dest;
+        request->size = size;
+        request->mode = mode;
+        request->value = value;
+        return found;
+    }
 
-        if (bytesTransferred > 40 * 1024)
-            return; // don't transfer more than 40 KiB
-        if (*(u8 *)REG_ADDR_VCOUNT > 224)
-            return; // we're about to leave vblank, stop
+    if (request->mode != mode || request->size + size > MAX_DMA_BYTES_PER_FRAME)
+        return -1;
 
-        switch (sDma3Requests[sDma3RequestCursor].mode)
+    if (IsDma3RequestFill(mode))
+    {
+        if (request->value != value)
+            return -1;
+        if (request->dest + request->size == dest)
         {
-        case DMA_REQUEST_COPY32: // regular 32-bit copy
-            Dma3CopyLarge32_(sDma3Requests[sDma3RequestCursor].src,
-                             sDma3Requests[sDma3RequestCursor].dest,
-                             sDma3Requests[sDma3RequestCursor].size);
-            break;
-        case DMA_REQUEST_FILL32: // repeat a single 32-bit value across RAM
-            Dma3FillLarge32_(sDma3Requests[sDma3RequestCursor].value,
-                             sDma3Requests[sDma3RequestCursor].dest,
-                             sDma3Requests[sDma3RequestCursor].size);
-            break;
-        case DMA_REQUEST_COPY16:    // regular 16-bit copy
-            Dma3CopyLarge16_(sDma3Requests[sDma3RequestCursor].src,
-                             sDma3Requests[sDma3RequestCursor].dest,
-                             sDma3Requests[sDma3RequestCursor].size);
-            break;
-        case DMA_REQUEST_FILL16: // repeat a single 16-bit value across RAM
-            Dma3FillLarge16_(sDma3Requests[sDma3RequestCursor].value,
-                             sDma3Requests[sDma3RequestCursor].dest,
-                             sDma3Requests[sDma3RequestCursor].size);
-            break;
+            request->size += size;
+        }
+        else if (dest + size == request->dest)
+        {
+            request->dest = dest;
+            request->size += size;
+        }
+        else
+        {
+            return -1;
         }
-
-        // Free the request
-        sDma3Requests[sDma3RequestCursor].src = NULL;
-        sDma3Requests[sDma3RequestCursor].dest = NULL;
-        sDma3Requests[sDma3RequestCursor].size = 0;
-        sDma3Requests[sDma3RequestCursor].mode = 0;
-        sDma3Requests[sDma3RequestCursor].value = 0;
-        sDma3RequestCursor++;
-
-        if (sDma3RequestCursor >= MAX_DMA_REQUESTS) // loop back to the first DMA request
-            sDma3RequestCursor = 0;
     }
+    else
+    {
+        if (request->dest + request->size == dest && request->src + request->size == src)
+        {
+            request->size += size;
+        }
+        else if (dest + size == request->dest && src + size == request->src)
+        {
+            request->src = src;
+            request->dest = dest;
+            request->size += size;
+        }
+        else
+        {
+            return -1;
+        }
+    }
+    sDma3Stats.requestsMerged++;
+    return found;
 }
 
-s16 RequestDma3Copy(const void *src, void *dest, u16 size, u8 mode)
+static s16 QueueDma3Request(const void *src, void *dest, u16 size, u32 mode, u32 value)
 {
-    int cursor;
+    u32 priority;
+    s32 cursor;
     int i = 0;
 
     sDma3ManagerLocked = TRUE;
-    cursor = sDma3RequestCursor;
 
+    priority = GetDma3RequestPriority(dest, size);
+    // A bulk request reaching into a prioritized region would be sent after
+    // this one, so keep submission order by queuing this one as bulk too.
+    if (priority != DMA_PRIORITY_BULK && DoesDma3QueueOverlap(DMA_PRIORITY_BULK, dest, size))
+        priority = DMA_PRIORITY_BULK;
+
+    sDma3Stats.requestsQueued++;
+    sDma3Stats.bytesQueued += size;
+
+    if (size != 0)
+    {
+        cursor = TryCoalesceDma3Request(priority, src, dest, size, mode, value);
+        if (cursor != -1)
+        {
+            sDma3ManagerLocked = FALSE;
+            return cursor;
+        }
+    }
+
+    cursor = sDma3RequestCursor;
     while (i < MAX_DMA_REQUESTS)
     {
         if (sDma3Requests[cursor].size == 0) // an empty request was found.
         {
-            sDma3Requests[cursor].src = src;
-            sDma3Requests[cursor].dest = dest;
-            sDma3Requests[cursor].size = size;
+            if (size != 0)
+            {
+                sDma3Requests[cursor].src = src;
+                sDma3Requests[cursor].dest = dest;
+                sDma3Requests[cursor].size = size;
+                sDma3Requests[cursor].mode = mode;
+                sDma3Requests[cursor].value = value;
+                sDma3Requests[cursor].next = DMA_REQUEST_NONE;
 
-            if (mode == 1)
-                sDma3Requests[cursor].mode = DMA_REQUEST_COPY32;
-            else
-                sDma3Requests[cursor].mode = DMA_REQUEST_COPY16;
+                if (sDma3QueueHead[priority] == DMA_REQUEST_NONE)
+                    sDma3QueueHead[priority] = cursor;
+                else
+                    sDma3Requests[sDma3QueueTail[priority]].next = cursor;
+                sDma3QueueTail[priority] = cursor;
+            }
 
             sDma3ManagerLocked = FALSE;
             return cursor;
@@ -123,41 +206,129 @@ s16 RequestDma3Copy(const void *src, void *dest, u16 size, u8 mode)
             cursor = 0;
         i++;
     }
+    sDma3Stats.requestsQueued--;
+    sDma3Stats.bytesQueued -= size;
     sDma3ManagerLocked = FALSE;
     return -1;  // no free DMA request was found
 }
 
-s16 RequestDma3Fill(s32 value, void *dest, u16 size, u8 mode)
+void ClearDma3Requests(void)
 {
-    int cursor;
-    int i = 0;
+    int i;
 
-    cursor = sDma3RequestCursor;
     sDma3ManagerLocked = TRUE;
+    sDma3RequestCursor = 0;
 
-    while (i < MAX_DMA_REQUESTS)
+    for (i = 0; i < MAX_DMA_REQUESTS; i++)
     {
-        if (sDma3Requests[cursor].size == 0) // an empty request was found.
+        sDma3Requests[i].size = 0;
+        sDma3Requests[i].src = NULL;
+        sDma3Requests[i].dest = NULL;
+        sDma3Requests[i].next = DMA_REQUEST_NONE;
+    }
+
+    for (i = 0; i < DMA_PRIORITY_COUNT; i++)
+    {
+        sDma3QueueHead[i] = DMA_REQUEST_NONE;
+        sDma3QueueTail[i] = DMA_REQUEST_NONE;
+    }
+
+    memset(&sDma3Stats, 0, sizeof(sDma3Stats));
+    memset(&sDma3LastFrameStats, 0, sizeof(sDma3LastFrameStats));
+
+    sDma3ManagerLocked = FALSE;
+}
+
+void ProcessDma3Requests(void)
+{
+    u32 bytesTransferred;
+    u32 priority;
+    u8 cursor;
+
+    if (sDma3ManagerLocked)
+        return;
+
+    bytesTransferred = 0;
+
+    for (priority = 0; priority < DMA_PRIORITY_COUNT; priority++)
+    {
+        // as long as there are DMA requests to process (unless size or vblank is an issue), do not exit
+        while ((cursor = sDma3QueueHead[priority]) != DMA_REQUEST_NONE)
         {
-            sDma3Requests[cursor].dest = dest;
-            sDma3Requests[cursor].size = size;
-            sDma3Requests[cursor].mode = mode;
-            sDma3Requests[cursor].value = value;
+            bytesTransferred += sDma3Requests[cursor].size;
 
-            if(mode == 1)
-                sDma3Requests[cursor].mode = DMA_REQUEST_FILL32;
-            else
-                sDma3Requests[cursor].mode = DMA_REQUEST_FILL16;
+            if (bytesTransferred > MAX_DMA_BYTES_PER_FRAME)
+                goto deferred; // don't transfer more than 40 KiB
+            if (*(u8 *)REG_ADDR_VCOUNT > 224)
+                goto deferred; // we're about to leave vblank, stop
 
-            sDma3ManagerLocked = FALSE;
-            return cursor;
+            switch (sDma3Requests[cursor].mode)
+            {
+            case DMA_REQUEST_COPY32: // regular 32-bit copy
+                Dma3CopyLarge32_(sDma3Requests[cursor].src,
+                                 sDma3Requests[cursor].dest,
+                                 sDma3Requests[cursor].size);
+                break;
+            case DMA_REQUEST_FILL32: // repeat a single 32-bit value across RAM
+                Dma3FillLarge32_(sDma3Requests[cursor].value,
+                                 sDma3Requests[cursor].dest,
+                                 sDma3Requests[cursor].size);
+                break;
+            case DMA_REQUEST_COPY16:    // regular 16-bit copy
+                Dma3CopyLarge16_(sDma3Requests[cursor].src,
+                                 sDma3Requests[cursor].dest,
+                                 sDma3Requests[cursor].size);
+                break;
+            case DMA_REQUEST_FILL16: // repeat a single 16-bit value across RAM
+                Dma3FillLarge16_(sDma3Requests[cursor].value,
+                                 sDma3Requests[cursor].dest,
+                                 sDma3Requests[cursor].size);
+                break;
+            }
+
+            sDma3Stats.bytesSent += sDma3Requests[cursor].size;
+            sDma3Stats.requestsSent++;
+
+            // Free the request
+            sDma3QueueHead[priority] = sDma3Requests[cursor].next;
+            sDma3Requests[cursor].src = NULL;
+            sDma3Requests[cursor].dest = NULL;
+            sDma3Requests[cursor].size = 0;
+            sDma3Requests[cursor].mode = 0;
+            sDma3Requests[cursor].value = 0;
+            sDma3Requests[cursor].next = DMA_REQUEST_NONE;
+            sDma3RequestCursor = cursor + 1;
+
+            if (sDma3RequestCursor >= MAX_DMA_REQUESTS) // loop back to the first DMA request
+                sDma3RequestCursor = 0;
         }
-        if (++cursor >= MAX_DMA_REQUESTS) // loop back to start.
-            cursor = 0;
-        i++;
     }
-    sDma3ManagerLocked = FALSE;
-    return -1;  // no free DMA request was found
+
+deferred:
+    for (; priority < DMA_PRIORITY_COUNT; priority++)
+    {
+        for (cursor = sDma3QueueHead[priority]; cursor != DMA_REQUEST_NONE; cursor = sDma3Requests[cursor].next)
+            sDma3Stats.requestsDeferred++;
+    }
+
+    sDma3LastFrameStats = sDma3Stats;
+    memset(&sDma3Stats, 0, sizeof(sDma3Stats));
+}
+
+s16 RequestDma3Copy(const void *src, void *dest, u16 size, u8 mode)
+{
+    if (mode == 1)
+        return QueueDma3Request(src, dest, size, DMA_REQUEST_COPY32, 0);
+    else
+        return QueueDma3Request(src, dest, size, DMA_REQUEST_COPY16, 0);
+}
+
+s16 RequestDma3Fill(s32 value, void *dest, u16 size, u8 mode)
+{
+    if (mode == 1)
+        return QueueDma3Request(NULL, dest, size, DMA_REQUEST_FILL32, value);
+    else
+        return QueueDma3Request(NULL, dest, size, DMA_REQUEST_FILL16, value);
 }
 
 s16 CheckForSpaceForDma3Request(s16 index)
@@ -181,3 +352,9 @@ s16 CheckForSpaceForDma3Request(s16 index)
         return 0;
     }
 }
+
+// Returns the counters of the last frame's ProcessDma3Requests call.
+void GetDma3Stats(struct Dma3Stats *stats)
+{
+    *stats = sDma3LastFrameStats;
+}
@@ -4,6 +4,15 @@
 static void *sHeapStart;
 static u32 sHeapSize;
 
+#if DEBUG_HEAP_STATS
+static EWRAM_DATA struct HeapStats sHeapStats = {0};
+static EWRAM_DATA struct HeapLocationStats sHeapLocationStats[DEBUG_HEAP_STATS_LOCATIONS] = {0};
+static EWRAM_DATA u32 sHeapLocationStatsCount = 0;
+
+static void RecordAlloc(void *pointer);
+static void RecordFree(void *pointer);
+#endif
+
 void PutMemBlockHeader(void *block, struct MemBlock *prev, struct MemBlock *next, u32 size)
 {
     struct MemBlock *header = (struct MemBlock *)block;
@@ -157,20 +166,35 @@ void InitHeap(void *heapStart, u32 heapSize)
     sHeapStart = heapStart;
     sHeapSize = heapSize;
     PutFirstMemBlockHeader(heapStart, heapSize);
+#if DEBUG_HEAP_STATS
+    memset(&sHeapStats, 0, sizeof(sHeapStats));
+    sHeapLocationStatsCount = 0;
+#endif
 }
 
 void *Alloc_(u32 size, const char *location)
 {
-    return AllocInternal(sHeapStart, size, location);
+    void *pointer = AllocInternal(sHeapStart, size, location);
+#if DEBUG_HEAP_STATS
+    RecordAlloc(pointer);
+#endif
+    return pointer;
 }
 
 void *AllocZeroed_(u32 size, const char *location)
 {
-    return AllocZeroedInternal(sHeapStart, size, location);
+    void *pointer = AllocZeroedInternal(sHeapStart, size, location);
+#if DEBUG_HEAP_STATS
+    RecordAlloc(pointer);
+#endif
+    return pointer;
 }
 
 void Free(void *pointer)
 {
+#if DEBUG_HEAP_STATS
+    RecordFree(pointer);
+#endif
     FreeInternal(sHeapStart, pointer);
 }
 
@@ -204,3 +228,148 @@ const char *MemBlockLocation(const struct MemBlock *block)
 
     return (const char *)(ROM_START | (block->locationHi << 14) | block->locationLo);
 }
+
+#if DEBUG_HEAP_STATS
+static struct HeapLocationStats *FindHeapLocationStats(const char *location, bool32 create)
+{
+    u32 i;
+    struct HeapLocationStats *stats;
+
+    for (i = 0; i < sHeapLocationStatsCount; i++) {
+        if (sHeapLocationStats[i].location == location)
+            return &sHeapLocationStats[i];
+    }
+
+    if (!create)
+        return NULL;
+
+    if (sHeapLocationStatsCount < DEBUG_HEAP_STATS_LOCATIONS - 1) {
+        stats = &sHeapLocationStats[sHeapLocationStatsCount++];
+        stats->location = location;
+        stats->allocs = 0;
+        stats->liveBlocks = 0;
+        stats->liveBytes = 0;
+        return stats;
+    }
+
+    // Out of entries, so every other location is counted in the last one.
+    stats = &sHeapLocationStats[DEBUG_HEAP_STATS_LOCATIONS - 1];
+    if (sHeapLocationStatsCount < DEBUG_HEAP_STATS_LOCATIONS) {
+        stats->location = NULL;
+        stats->allocs = 0;
+        stats->liveBlocks = 0;
+        stats->liveBytes = 0;
+        sHeapLocationStatsCount = DEBUG_HEAP_STATS_LOCATIONS;
+    }
+    return stats;
+}
+
+static void RecordAlloc(void *pointer)
+{
+    const struct MemBlock *block;
+    struct HeapLocationStats *locationStats;
+
+    if (pointer == NULL) {
+        sHeapStats.failedAllocs++;
+        return;
+    }
+
+    block = (const struct MemBlock *)((u8 *)pointer - sizeof(struct MemBlock));
+    sHeapStats.allocs++;
+    sHeapStats.bytesAllocated += block->size;
+    if (sHeapStats.bytesAllocated > sHeapStats.peakBytesAllocated)
+        sHeapStats.peakBytesAllocated = sHeapStats.bytesAllocated;
+
+    locationStats = FindHeapLocationStats(MemBlockLocation(block), TRUE);
+    locationStats->allocs++;
+    locationStats->liveBlocks++;
+    locationStats->liveBytes += block->size;
+}
+
+static void RecordFree(void *pointer)
+{
+    const struct MemBlock *block;
+    struct HeapLocationStats *locationStats;
+
+    if (pointer == NULL)
+        return;
+
+    block = (const struct MemBlock *)((u8 *)pointer - sizeof(struct MemBlock));
+    sHeapStats.frees++;
+    sHeapStats.bytesAllocated -= block->size;
+
+    locationStats = FindHeapLocationStats(MemBlockLocation(block), FALSE);
+    if (locationStats == NULL && sHeapLocationStatsCount == DEBUG_HEAP_STATS_LOCATIONS)
+        locationStats = &sHeapLocationStats[DEBUG_HEAP_STATS_LOCATIONS - 1];
+    if (locationStats != NULL) {
+        locationStats->liveBlocks--;
+        locationStats->liveBytes -= block->size;
+    }
+}
+#endif
+
+void GetHeapStats(struct HeapStats *stats)
+{
+    const struct MemBlock *head = HeapHead();
+    const struct MemBlock *block = head;
+
+#if DEBUG_HEAP_STATS
+    *stats = sHeapStats;
+#else
+    memset(stats, 0, sizeof(*stats));
+#endif
+    stats->bytesFree = 0;
+    stats->largestFreeBlock = 0;
+    stats->blocks = 0;
+    stats->freeBlocks = 0;
+    do {
+        stats->blocks++;
+        if (!block->allocated) {
+            stats->freeBlocks++;
+            stats->bytesFree += block->size;
+            if (block->size > stats->largestFreeBlock)
+                stats->largestFreeBlock = block->size;
+        }
+        block = block->next;
+    } while (block != head);
+}
+
+// Returns the number of entries in stats.
+u32 GetHeapLocationStats(const struct HeapLocationStats **stats)
+{
+#if DEBUG_HEAP_STATS
+    *stats = sHeapLocationStats;
+    return sHeapLocationStatsCount;
+#else
+    *stats = NULL;
+    return 0;
+#endif
+}
+
+// Restarts the peak from the current usage, e.g. when entering a new screen.
+void ResetHeapPeak(void)
+{
+#if DEBUG_HEAP_STATS
+    sHeapStats.peakBytesAllocated = sHeapStats.bytesAllocated;
+#endif
+}
+
+void DumpHeapStats(void)
+{
+#if DEBUG_HEAP_STATS && !defined(NDEBUG)
+    u32 i, count;
+    struct HeapStats stats;
+    const struct HeapLocationStats *locationStats;
+
+    GetHeapStats(&stats);
+    DebugPrintf("heap: %d bytes allocated (%d peak), %d free", stats.bytesAllocated, stats.peakBytesAllocated, stats.bytesFree);
+    DebugPrintf("heap: %d blocks, %d free, largest free block %d bytes", stats.blocks, stats.freeBlocks, stats.largestFreeBlock);
+    DebugPrintf("heap: %d allocs, %d frees, %d failed", stats.allocs, stats.frees, stats.failedAllocs);
+    count = GetHeapLocationStats(&locationStats);
+    for (i = 0; i < count; i++) {
+        DebugPrintf("  %s: %d allocs, %d live (%d bytes)",
+                    locationStats[i].location != NULL ? locationStats[i].location : "<other>",
+                    locationStats[i].allocs, locationStats[i].liveBlocks, locationStats[i].liveBytes);
+    }
+#endif
+}
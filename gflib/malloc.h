@@ -44,6 +44,28 @@ struct MemBlock
 
 extern u8 gHeap[];
 
+struct HeapStats
+{
+    u32 bytesAllocated; // Not including block headers.
+    u32 peakBytesAllocated;
+    u32 allocs;
+    u32 frees;
+    u32 failedAllocs;
+    // The following are measured when GetHeapStats is called.
+    u32 bytesFree;
+    u32 largestFreeBlock;
+    u16 blocks;
+    u16 freeBlocks;
+};
+
+struct HeapLocationStats
+{
+    const char *location; // NULL for the entry that counts all locations that didn't fit.
+    u32 allocs;
+    u32 liveBlocks;
+    u32 liveBytes;
+};
+
 #define Alloc(size) Alloc_(size, __FILE__ ":" STR(__LINE__))
 #define AllocZeroed(size) AllocZeroed_(size, __FILE__ ":" STR(__LINE__))
 
@@ -55,4 +77,9 @@ void InitHeap(void *pointer, u32 size);
 const struct MemBlock *HeapHead(void);
 const char *MemBlockLocation(const struct MemBlock *block);
 
+void GetHeapStats(struct HeapStats *stats);
+u32 GetHeapLocationStats(const struct HeapLocationStats **stats);
+void ResetHeapPeak(void);
+void DumpHeapStats(void);
+
 #endif // GUARD_ALLOC_H
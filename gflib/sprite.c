@@ -2,6 +2,7 @@
 #include "sprite.h"
 #include "main.h"
 #include "palette.h"
+#include "frame_profiler.h"
 
 #define MAX_SPRITE_COPY_REQUESTS 64
 
@@ -310,6 +311,7 @@ void ResetSpriteData(void)
 void AnimateSprites(void)
 {
     u8 i;
+    PROFILE_BEGIN(PROFILE_PHASE_ANIMATE_SPRITES);
     for (i = 0; i < MAX_SPRITES; i++)
     {
         struct Sprite *sprite = &gSprites[i];
@@ -322,11 +324,13 @@ void AnimateSprites(void)
                 AnimateSprite(sprite);
         }
     }
+    PROFILE_END(PROFILE_PHASE_ANIMATE_SPRITES);
 }
 
 void BuildOamBuffer(void)
 {
     u8 temp;
+    PROFILE_BEGIN(PROFILE_PHASE_BUILD_OAM);
     UpdateOamCoords();
     BuildSpritePriorities();
     SortSprites();
@@ -336,6 +340,7 @@ void BuildOamBuffer(void)
     CopyMatricesToOamBuffer();
     gMain.oamLoadDisabled = temp;
     sShouldProcessSpriteCopyRequests = TRUE;
+    PROFILE_END(PROFILE_PHASE_BUILD_OAM);
 }
 
 void UpdateOamCoords(void)
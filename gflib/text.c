@@ -29,6 +29,9 @@ static void DecompressGlyph_Short(u16, bool32);
 static void DecompressGlyph_Narrow(u16, bool32);
 static void DecompressGlyph_SmallNarrow(u16, bool32);
 static void DecompressGlyph_Bold(u16);
+static void DecompressGlyph(u8, u16, bool32);
+static bool32 TryPrintPrerenderedText(const struct TextPrinter *);
+static void TryPrerenderText(const struct TextPrinterTemplate *, bool32, const struct TextPrinterTemplate *);
 static u32 GetGlyphWidth_Small(u16, bool32);
 static u32 GetGlyphWidth_Normal(u16, bool32);
 static u32 GetGlyphWidth_Short(u16, bool32);
@@ -43,6 +46,45 @@ static u16 sLastTextBgColor;
 static u16 sLastTextFgColor;
 static u16 sLastTextShadowColor;
 
+// Recently decompressed glyphs, with the text colors already applied.
+// Direct mapped, so a lookup is a single compare against the entry's key.
+#if TEXT_GLYPH_CACHE_SIZE != 0
+struct GlyphCacheEntry
+{
+    u32 key;
+    struct TextGlyph glyph;
+};
+
+static EWRAM_DATA struct GlyphCacheEntry sGlyphCache[TEXT_GLYPH_CACHE_SIZE] = {0};
+#endif
+
+// Pixels of constant single-line labels printed instantly with opaque colors. Such a label always
+// overwrites exactly the same rectangle of the window with the same pixels, so after it has been
+// rendered once it can be copied back a tile row at a time instead of running the text printer.
+#if TEXT_PRERENDERED_TEXT_SIZE != 0
+#define PRERENDERED_TEXT_COUNT 16
+#define PRERENDERED_TEXT_POOL_SIZE (TEXT_PRERENDERED_TEXT_SIZE / 4) // in words
+
+struct PrerenderedText
+{
+    const u8 *str;
+    u8 fontId;
+    u8 fgColor;
+    u8 bgColor;
+    u8 shadowColor;
+    u8 letterSpacing;
+    bool8 japanese;
+    u8 width;
+    u8 height;
+    u16 offset;
+};
+
+static EWRAM_DATA struct PrerenderedText sPrerenderedTexts[PRERENDERED_TEXT_COUNT] = {0};
+static EWRAM_DATA u32 sPrerenderedTextPixels[PRERENDERED_TEXT_POOL_SIZE] = {0};
+static EWRAM_DATA u16 sPrerenderedTextPoolEnd = 0;
+static EWRAM_DATA u8 sPrerenderedTextNext = 0;
+#endif
+
 const struct FontInfo *gFonts;
 bool8 gDisableTextPrinters;
 struct TextGlyph gCurGlyph;
@@ -300,11 +342,18 @@ bool16 AddTextPrinter(struct TextPrinterTemplate *printerTemplate, u8 speed, voi
     {
         sTempTextPrinter.textSpeed = 0;
 
-        // Render all text (up to limit) at once
-        for (j = 0; j < 0x400; ++j)
+        if (callback != NULL || !TryPrintPrerenderedText(&sTempTextPrinter))
         {
-            if (RenderFont(&sTempTextPrinter) == RENDER_FINISH)
-                break;
+            bool32 japanese = sTempTextPrinter.japanese;
+
+            // Render all text (up to limit) at once
+            for (j = 0; j < 0x400; ++j)
+            {
+                if (RenderFont(&sTempTextPrinter) == RENDER_FINISH)
+                    break;
+            }
+            if (callback == NULL)
+                TryPrerenderText(printerTemplate, japanese, &sTempTextPrinter.printerTemplate);
         }
 
         // All the text is rendered to the window but don't draw it yet.
@@ -316,6 +365,159 @@ bool16 AddTextPrinter(struct TextPrinterTemplate *printerTemplate, u8 speed, voi
     return TRUE;
 }
 
+#if TEXT_PRERENDERED_TEXT_SIZE != 0
+static bool32 IsPrerenderedTextMatch(const struct PrerenderedText *text, const struct TextPrinter *printer)
+{
+    const struct TextPrinterTemplate *printerTemplate = &printer->printerTemplate;
+
+    return text->str == printerTemplate->currentChar
+        && text->fontId == printerTemplate->fontId
+        && text->fgColor == printerTemplate->fgColor
+        && text->bgColor == printerTemplate->bgColor
+        && text->shadowColor == printerTemplate->shadowColor
+        && text->letterSpacing == printerTemplate->letterSpacing
+        && text->japanese == printer->japanese;
+}
+
+// Pixels are stored a row at a time, with the first pixel of the label at the bottom of the first word.
+static void CopyWindowRectToPrerenderedText(u8 windowId, u32 *dest, u32 x, u32 y, u32 width, u32 height)
+{
+    const u32 *tiles = (const u32 *)gWindows[windowId].tileData;
+    u32 windowWidth = gWindows[windowId].window.width;
+    u32 shift = (x & 7) * 4;
+    u32 words = (width + 7) / 8;
+    u32 row, i;
+
+    for (row = y; row < y + height; row++)
+    {
+        const u32 *tileRow = tiles + (row / 8) * windowWidth * 8 + (row & 7);
+
+        for (i = 0; i < words; i++)
+        {
+            u32 tile = x / 8 + i;
+            u32 pixels = tileRow[tile * 8] >> shift;
+
+            if (shift != 0 && tile + 1 < windowWidth)
+                pixels |= tileRow[(tile + 1) * 8] << (32 - shift);
+            *dest++ = pixels;
+        }
+    }
+}
+
+static void CopyPrerenderedTextToWindowRect(u8 windowId, const u32 *src, u32 x, u32 y, u32 width, u32 height)
+{
+    u32 *tiles = (u32 *)gWindows[windowId].tileData;
+    u32 windowWidth = gWindows[windowId].window.width;
+    u32 shift = (x & 7) * 4;
+    u32 words = (width + 7) / 8;
+    u32 lastMask = (width & 7) ? (1 << ((width & 7) * 4)) - 1 : 0xFFFFFFFF;
+    u32 row, i;
+
+    for (row = y; row < y + height; row++)
+    {
+        u32 *tileRow = tiles + (row / 8) * windowWidth * 8 + (row & 7);
+
+        for (i = 0; i < words; i++)
+        {
+            u32 tile = x / 8 + i;
+            u32 pixels = *src++;
+            u32 mask = (i == words - 1) ? lastMask : 0xFFFFFFFF;
+
+            tileRow[tile * 8] = (tileRow[tile * 8] & ~(mask << shift)) | ((pixels & mask) << shift);
+            if (shift != 0 && tile + 1 < windowWidth)
+                tileRow[(tile + 1) * 8] = (tileRow[(tile + 1) * 8] & ~(mask >> (32 - shift))) | ((pixels & mask) >> (32 - shift));
+        }
+    }
+}
+
+static bool32 TryPrintPrerenderedText(const struct TextPrinter *printer)
+{
+    const struct TextPrinterTemplate *printerTemplate = &printer->printerTemplate;
+    u32 i;
+
+    for (i = 0; i < PRERENDERED_TEXT_COUNT; i++)
+    {
+        const struct PrerenderedText *text = &sPrerenderedTexts[i];
+
+        if (IsPrerenderedTextMatch(text, printer))
+        {
+            struct WindowTemplate *window = &gWindows[printerTemplate->windowId].window;
+
+            if (printerTemplate->currentX + text->width > window->width * 8
+             || printerTemplate->currentY + text->height > window->height * 8)
+                return FALSE;
+            CopyPrerenderedTextToWindowRect(printerTemplate->windowId, &sPrerenderedTextPixels[text->offset],
+                                            printerTemplate->currentX, printerTemplate->currentY, text->width, text->height);
+            return TRUE;
+        }
+    }
+    return FALSE;
+}
+
+// Called after a string was printed instantly from start to end. Keeps its pixels if the string
+// is a constant plain single line and every pixel it covered was drawn with an opaque color.
+static void TryPrerenderText(const struct TextPrinterTemplate *start, bool32 japanese, const struct TextPrinterTemplate *end)
+{
+    struct PrerenderedText *text;
+    const struct WindowTemplate *window = &gWindows[start->windowId].window;
+    const u8 *str = start->currentChar;
+    u32 width = end->currentX - start->currentX;
+    u32 height = gCurGlyph.height;
+    u32 size;
+
+    if ((u32)str < ROM_START || start->fontId == FONT_BRAILLE || width == 0 || width > 0xFF
+     || start->fgColor == TEXT_COLOR_TRANSPARENT || start->bgColor == TEXT_COLOR_TRANSPARENT || start->shadowColor == TEXT_COLOR_TRANSPARENT
+     || start->currentX + width > window->width * 8 || start->currentY + height > window->height * 8)
+        return;
+
+    for (; *str != EOS; str++)
+    {
+        if (*str >= CHAR_DYNAMIC)
+            return;
+    }
+
+    size = ((width + 7) / 8) * height;
+    if (size > PRERENDERED_TEXT_POOL_SIZE)
+        return;
+
+    // The pool is used as a ring buffer, dropping the labels that get overwritten.
+    if (sPrerenderedTextPoolEnd + size > PRERENDERED_TEXT_POOL_SIZE)
+        sPrerenderedTextPoolEnd = 0;
+    for (text = sPrerenderedTexts; text < &sPrerenderedTexts[PRERENDERED_TEXT_COUNT]; text++)
+    {
+        if (text->str != NULL && text->offset < sPrerenderedTextPoolEnd + size && text->offset + ((text->width + 7) / 8) * text->height > sPrerenderedTextPoolEnd)
+            text->str = NULL;
+    }
+
+    text = &sPrerenderedTexts[sPrerenderedTextNext];
+    sPrerenderedTextNext = (sPrerenderedTextNext + 1) % PRERENDERED_TEXT_COUNT;
+    text->str = start->currentChar;
+    text->fontId = start->fontId;
+    text->fgColor = start->fgColor;
+    text->bgColor = start->bgColor;
+    text->shadowColor = start->shadowColor;
+    text->letterSpacing = start->letterSpacing;
+    text->japanese = japanese;
+    text->width = width;
+    text->height = height;
+    text->offset = sPrerenderedTextPoolEnd;
+    CopyWindowRectToPrerenderedText(start->windowId, &sPrerenderedTextPixels[text->offset], start->currentX, start->currentY, width, height);
+    sPrerenderedTextPoolEnd += size;
+}
+
+#else
+
+static bool32 TryPrintPrerenderedText(const struct TextPrinter *printer)
+{
+    return FALSE;
+}
+
+static void TryPrerenderText(const struct TextPrinterTemplate *start, bool32 japanese, const struct TextPrinterTemplate *end)
+{
+}
+
+#endif // TEXT_PRERENDERED_TEXT_SIZE
+
 void RunTextPrinters(void)
 {
     int i;
@@ -932,6 +1134,52 @@ void DrawDownArrow(u8 windowId, u16 x, u16 y, u8 bgColor, bool8 drawArrow, u8 *c
     }
 }
 
+// Loads the glyph into gCurGlyph, from the glyph cache if it was decompressed with the current colors before.
+static void DecompressGlyph(u8 fontId, u16 glyphId, bool32 isJapanese)
+{
+#if TEXT_GLYPH_CACHE_SIZE != 0
+    u32 colors = (sLastTextFgColor << 8) | (sLastTextBgColor << 4) | sLastTextShadowColor;
+    u32 key = 0x80000000 | (fontId << 25) | ((isJapanese != FALSE) << 24) | (colors << 12) | glyphId;
+    struct GlyphCacheEntry *entry = &sGlyphCache[(glyphId ^ (fontId << 3) ^ sLastTextFgColor) % TEXT_GLYPH_CACHE_SIZE];
+
+    if (entry->key == key)
+    {
+        gCurGlyph = entry->glyph;
+        return;
+    }
+#endif
+
+    switch (fontId)
+    {
+    case FONT_SMALL:
+        DecompressGlyph_Small(glyphId, isJapanese);
+        break;
+    case FONT_NORMAL:
+        DecompressGlyph_Normal(glyphId, isJapanese);
+        break;
+    case FONT_SHORT:
+    case FONT_SHORT_COPY_1:
+    case FONT_SHORT_COPY_2:
+    case FONT_SHORT_COPY_3:
+        DecompressGlyph_Short(glyphId, isJapanese);
+        break;
+    case FONT_NARROW:
+        DecompressGlyph_Narrow(glyphId, isJapanese);
+        break;
+    case FONT_SMALL_NARROW:
+        DecompressGlyph_SmallNarrow(glyphId, isJapanese);
+        break;
+    case FONT_BRAILLE:
+    default:
+        return;
+    }
+
+#if TEXT_GLYPH_CACHE_SIZE != 0
+    entry->key = key;
+    entry->glyph = gCurGlyph;
+#endif
+}
+
 static u16 RenderText(struct TextPrinter *textPrinter)
 {
     struct TextPrinterSubStruct *subStruct = (struct TextPrinterSubStruct *)(&textPrinter->subStructFields);
@@ -1121,30 +1369,7 @@ static u16 RenderText(struct TextPrinter *textPrinter)
             return RENDER_FINISH;
         }
 
-        switch (subStruct->fontId)
-        {
-        case FONT_SMALL:
-            DecompressGlyph_Small(currChar, textPrinter->japanese);
-            break;
-        case FONT_NORMAL:
-            DecompressGlyph_Normal(currChar, textPrinter->japanese);
-            break;
-        case FONT_SHORT:
-        case FONT_SHORT_COPY_1:
-        case FONT_SHORT_COPY_2:
-        case FONT_SHORT_COPY_3:
-            DecompressGlyph_Short(currChar, textPrinter->japanese);
-            break;
-        case FONT_NARROW:
-            DecompressGlyph_Narrow(currChar, textPrinter->japanese);
-            break;
-        case FONT_SMALL_NARROW:
-            DecompressGlyph_SmallNarrow(currChar, textPrinter->japanese);
-            break;
-        case FONT_BRAILLE:
-            break;
-        }
-
+        DecompressGlyph(subStruct->fontId, currChar, textPrinter->japanese);
         CopyGlyphToWindow(textPrinter);
 
         if (textPrinter->minLetterSpacing)
@@ -1327,7 +1552,48 @@ static u32 (*GetFontWidthFunc(u8 fontId))(u16, bool32)
     return NULL;
 }
 
+// Widths of recently measured constant strings (species, move and item names, menu labels...),
+// keyed by their address in ROM. Strings that print string vars or dynamic placeholders
+// depend on RAM, so they are never cached.
+#define STRING_WIDTH_CACHE_SIZE 64
+
+struct StringWidthCacheEntry
+{
+    const u8 *str;
+    s16 letterSpacing;
+    u8 fontId;
+    s16 width;
+};
+
+static EWRAM_DATA struct StringWidthCacheEntry sStringWidthCache[STRING_WIDTH_CACHE_SIZE] = {0};
+
+static s32 CalcStringWidth(u8 fontId, const u8 *str, s16 letterSpacing, bool32 *usesPlaceholders);
+
 s32 GetStringWidth(u8 fontId, const u8 *str, s16 letterSpacing)
+{
+    struct StringWidthCacheEntry *entry;
+    bool32 usesPlaceholders = FALSE;
+    s32 width;
+
+    if ((u32)str < ROM_START)
+        return CalcStringWidth(fontId, str, letterSpacing, &usesPlaceholders);
+
+    entry = &sStringWidthCache[((u32)str ^ ((u32)str >> 6) ^ fontId) % STRING_WIDTH_CACHE_SIZE];
+    if (entry->str == str && entry->fontId == fontId && entry->letterSpacing == letterSpacing)
+        return entry->width;
+
+    width = CalcStringWidth(fontId, str, letterSpacing, &usesPlaceholders);
+    if (!usesPlaceholders)
+    {
+        entry->str = str;
+        entry->fontId = fontId;
+        entry->letterSpacing = letterSpacing;
+        entry->width = width;
+    }
+    return width;
+}
+
+static s32 CalcStringWidth(u8 fontId, const u8 *str, s16 letterSpacing, bool32 *usesPlaceholders)
 {
     bool8 isJapanese;
     int minGlyphWidth;
@@ -1379,6 +1645,7 @@ s32 GetStringWidth(u8 fontId, const u8 *str, s16 letterSpacing)
                 return 0;
             }
         case CHAR_DYNAMIC:
+            *usesPlaceholders = TRUE;
             if (bufferPointer == NULL)
                 bufferPointer = DynamicPlaceholderTextUtil_GetPlaceholderPtr(*++str);
             while (*bufferPointer != EOS)
@@ -25,6 +25,17 @@ struct MultiPartnerMenuPokemon
     /*0x1D*/ u8 language;
 };
 
+// Per-battler inputs of the turn order comparison, see GetBattlerTurnOrderData
+struct BattlerTurnOrderData
+{
+    u32 speed;
+    u16 ability;
+    u16 holdEffect;
+    s8 priority;
+    bool8 quickDraw;
+    bool8 usedCustapBerry; // also quick claw
+};
+
 // defines for the 'DoBounceEffect' function
 #define BOUNCE_MON          0x0
 #define BOUNCE_HEALTHBOX    0x1
@@ -62,6 +73,8 @@ void SwapTurnOrder(u8 id1, u8 id2);
 u32 GetBattlerTotalSpeedStat(u8 battlerId);
 s8 GetChosenMovePriority(u32 battlerId);
 s8 GetMovePriority(u32 battlerId, u16 move);
+void GetBattlerTurnOrderData(u32 battler, bool32 ignoreChosenMoves, bool32 applyRandomEffects, struct BattlerTurnOrderData *data);
+u32 CompareBattlersTurnOrder(const struct BattlerTurnOrderData *data1, const struct BattlerTurnOrderData *data2);
 u8 GetWhoStrikesFirst(u8 battlerId1, u8 battlerId2, bool8 ignoreChosenMoves);
 void RunBattleScriptCommands_PopCallbacksStack(void);
 void RunBattleScriptCommands(void);
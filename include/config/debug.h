@@ -13,4 +13,12 @@
 // Pokémon Debug
 #define DEBUG_POKEMON_MENU              TRUE    // Enables a debug menu for pokemon sprites and icons, accessed by pressing SELECT in the summary screen.
 
+// Frame Profiler
+#define DEBUG_FRAME_PROFILER            FALSE   // Times the main loop and VBlank phases with hardware timer 1. Results are printed through the debug log handler (requires NDEBUG to be undefined) and can be asserted by BENCHMARK tests with EXPECT_MAX_CYCLES.
+#define DEBUG_FRAME_PROFILER_FRAMES     60      // Number of frames the min/avg/max are accumulated over before they are printed and reset. Benchmarks accumulate over all of their measured frames instead.
+
+// Heap
+#define DEBUG_HEAP_STATS                FALSE   // Tracks current and peak heap usage, allocation counts per source location and fragmentation of gHeap. Dumped with DumpHeapStats (requires NDEBUG to be undefined) and reported by the test runner after every test.
+#define DEBUG_HEAP_STATS_LOCATIONS      64      // Number of source locations whose allocations are counted separately. Allocations from any further locations are counted together.
+
 #endif // GUARD_CONFIG_DEBUG_H
@@ -6,6 +6,8 @@
 
 // Other settings
 #define OW_POISON_DAMAGE            GEN_LATEST // In Gen4, Pokémon no longer faint from Poison in the overworld. In Gen5+, they no longer take damage at all.
+#define OW_DECOMPRESSION_CACHE_SIZE 0x2000     // Bytes of EWRAM used to keep recently decompressed graphics, so returning to the field or reopening a menu doesn't decompress them again. Costs this many bytes plus 0x114 of EWRAM, of which vanilla has only about 16 KB free. 0 disables it.
+#define OW_WEATHER_COLOR_MAP_CACHE_SLOTS 1     // Number of weather color maps whose remapped palettes are kept, so weather flashing between the same maps doesn't remap them again. Costs 1,036 bytes of EWRAM per slot plus 1,028 shared. 0 disables it.
 
 // Overworld flags
 // To use the following features in scripting, replace the 0s with the flag ID you're assigning it to.
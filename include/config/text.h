@@ -0,0 +1,8 @@
+#ifndef GUARD_CONFIG_TEXT_H
+#define GUARD_CONFIG_TEXT_H
+
+// Text printer caches
+#define TEXT_GLYPH_CACHE_SIZE           16      // Number of decompressed text glyphs kept with their colors applied, so printing the same characters again doesn't decompress them. Each one costs 136 bytes of EWRAM. 0 disables it.
+#define TEXT_PRERENDERED_TEXT_SIZE      0x400   // Bytes of EWRAM used to keep the pixels of constant labels printed instantly, so printing them again is a copy. Costs this many bytes plus 0x104 of EWRAM. 0 disables it.
+
+#endif // GUARD_CONFIG_TEXT_H
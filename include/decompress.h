@@ -5,8 +5,21 @@
 
 extern u8 gDecompressionBuffer[0x4000];
 
+struct DecompressionCacheStats
+{
+    u32 hits;
+    u32 misses;
+    u32 evictions;
+    u32 bytesUsed;
+};
+
 void LZDecompressWram(const u32 *src, void *dest);
 void LZDecompressVram(const u32 *src, void *dest);
+void LZDecompressWramCached(const u32 *src, void *dest);
+bool32 TryCopyCachedDecompressedData(const u32 *src, void *dest);
+void AddDecompressedDataToCache(const u32 *src, const void *data);
+void ClearDecompressionCache(void);
+void GetDecompressionCacheStats(struct DecompressionCacheStats *stats);
 
 u16 LoadCompressedSpriteSheet(const struct CompressedSpriteSheet *src);
 void LoadCompressedSpriteSheetOverrideBuffer(const struct CompressedSpriteSheet *src, void *buffer);
@@ -48,6 +48,9 @@ void LoadSecondaryTilesetPalette(struct MapLayout const *mapLayout);
 void CopySecondaryTilesetToVramUsingHeap(struct MapLayout const *mapLayout);
 void CopyPrimaryTilesetToVram(const struct MapLayout *);
 void CopySecondaryTilesetToVram(const struct MapLayout *);
+bool32 StreamPrimaryTilesetToVram(const struct MapLayout *mapLayout);
+bool32 StreamSecondaryTilesetToVram(const struct MapLayout *mapLayout);
+bool32 IsTilesetStreamUploading(void);
 const struct MapHeader *const GetMapHeaderFromConnection(const struct MapConnection *connection);
 const struct MapConnection *GetMapConnectionAtPos(s16 x, s16 y);
 void MapGridSetMetatileImpassabilityAt(int x, int y, bool32 impassable);
@@ -0,0 +1,45 @@
+#ifndef GUARD_FRAME_PROFILER_H
+#define GUARD_FRAME_PROFILER_H
+
+// Phases may nest (e.g. tasks run inside the main callbacks) and a phase that
+// is interrupted by VBlank also counts the time spent in the interrupt.
+enum FrameProfilerPhase
+{
+    PROFILE_PHASE_FRAME,
+    PROFILE_PHASE_MAIN_CALLBACKS,
+    PROFILE_PHASE_TASKS,
+    PROFILE_PHASE_ANIMATE_SPRITES,
+    PROFILE_PHASE_BUILD_OAM,
+    PROFILE_PHASE_VBLANK_INTR,
+    PROFILE_PHASE_DMA3,
+    PROFILE_PHASE_PLTT_TRANSFER,
+    PROFILE_PHASE_SOUND,
+    PROFILE_PHASE_COUNT,
+};
+
+struct FrameProfilerStats
+{
+    u32 frames;
+    u32 minCycles;
+    u32 avgCycles;
+    u32 maxCycles;
+};
+
+#if DEBUG_FRAME_PROFILER
+#define PROFILE_BEGIN(phase) BeginProfilerPhase(phase)
+#define PROFILE_END(phase) EndProfilerPhase(phase)
+#define PROFILE_END_FRAME() EndProfilerFrame()
+
+void BeginProfilerPhase(enum FrameProfilerPhase phase);
+void EndProfilerPhase(enum FrameProfilerPhase phase);
+void EndProfilerFrame(void);
+void ResetFrameProfiler(void);
+void GetFrameProfilerStats(enum FrameProfilerPhase phase, struct FrameProfilerStats *stats);
+const char *GetFrameProfilerPhaseName(enum FrameProfilerPhase phase);
+#else
+#define PROFILE_BEGIN(phase)
+#define PROFILE_END(phase)
+#define PROFILE_END_FRAME()
+#endif
+
+#endif // GUARD_FRAME_PROFILER_H
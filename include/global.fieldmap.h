@@ -126,6 +126,11 @@ struct MapEvents
     const struct WarpEvent *warps;
     const struct CoordEvent *coordEvents;
     const struct BgEvent *bgEvents;
+    // Event indices sorted by position (y, then x), events on the same tile in their original order.
+    // NULL if mapjson couldn't sort the events, in which case they are scanned linearly.
+    const u8 *warpsByPosition;
+    const u8 *coordEventsByPosition;
+    const u8 *bgEventsByPosition;
 };
 
 struct MapConnection
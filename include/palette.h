@@ -62,6 +62,9 @@ extern u16 gPlttBufferFaded[PLTT_BUFFER_SIZE];
 void LoadCompressedPalette(const u32 *src, u16 offset, u16 size);
 void LoadPalette(const void *src, u16 offset, u16 size);
 void FillPalette(u16 value, u16 offset, u16 size);
+void MarkPlttBufferDirty(u16 offset, u16 size);
+void MarkPlttBufferRowsDirty(u32 selectedPalettes);
+void SetPlttBufferDirtyRowTracking(bool32 enabled);
 void TransferPlttBuffer(void);
 u8 UpdatePaletteFade(void);
 void ResetPaletteFade(void);
@@ -334,19 +334,20 @@ struct SpeciesInfo /*0x24*/
  /* 0x20 */ u16 flags;
 };
 
+// Fields read by damage calc and the AI come first, and the members are ordered to avoid padding (20 bytes per move).
 struct BattleMove
 {
     u16 effect;
     u16 power;  //higher than 255 for z moves
     u8 type;
-    u8 accuracy;
-    u8 pp;
-    u8 secondaryEffectChance;
-    u16 target;
+    u8 split;
     s8 priority;
+    u8 accuracy;
     u32 flags;
-    u8 split;
+    u16 target;
     u16 argument;
+    u8 pp;
+    u8 secondaryEffectChance;
     u8 zMoveEffect;
 };
 
@@ -365,6 +366,12 @@ struct LevelUpMove
     u16 level;
 };
 
+struct TeachableLearnset
+{
+    const u16 *moves; // Sorted by move id and terminated by MOVE_UNAVAILABLE
+    u16 count;
+};
+
 struct Evolution
 {
     u16 method;
@@ -405,7 +412,7 @@ extern const struct SpeciesInfo gSpeciesInfo[];
 extern const u8 *const gItemEffectTable[ITEMS_COUNT];
 extern const u32 gExperienceTables[][MAX_LEVEL + 1];
 extern const struct LevelUpMove *const gLevelUpLearnsets[];
-extern const u16 *const gTeachableLearnsets[];
+extern const struct TeachableLearnset gTeachableLearnsets[];
 extern const u8 gPPUpGetMask[];
 extern const u8 gPPUpClearMask[];
 extern const u8 gPPUpAddValues[];
@@ -7,6 +7,16 @@
 #define IN_BOX_COUNT            (IN_BOX_ROWS * IN_BOX_COLUMNS)
 #define BOX_NAME_LENGTH         8
 
+// PC main menu options
+enum {
+    OPTION_WITHDRAW,
+    OPTION_DEPOSIT,
+    OPTION_MOVE_MONS,
+    OPTION_MOVE_ITEMS,
+    OPTION_EXIT,
+    OPTIONS_COUNT
+};
+
 /*
             COLUMNS
 ROWS        0   1   2   3   4   5
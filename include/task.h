@@ -26,6 +26,8 @@ void ResetTasks(void);
 u8 CreateTask(TaskFunc func, u8 priority);
 void DestroyTask(u8 taskId);
 void RunTasks(void);
+void DelayTask(u8 taskId, u16 frames);
+void SetTaskPeriod(u8 taskId, u16 frames);
 void TaskDummy(u8 taskId);
 void SetTaskFuncWithFollowupFunc(u8 taskId, TaskFunc func, TaskFunc followupFunc);
 void SwitchTaskToFollowupFunc(u8 taskId);
@@ -1091,6 +1091,7 @@ u8 AI_WhoStrikesFirst(u8 battlerAI, u8 battler2, u16 moveConsidered)
     s8 prioPlayer = 0;
     s8 prioBattler2 = 0;
     u16 *battler2Moves = GetMovesArray(battler2);
+    struct BattlerTurnOrderData turnOrderAI, turnOrderBattler2;
 
     // Check move priorities first.
     prioAI = GetMovePriority(battlerAI, moveConsidered);
@@ -1119,7 +1120,10 @@ u8 AI_WhoStrikesFirst(u8 battlerAI, u8 battler2, u16 moveConsidered)
         if (prioAI > prioBattler2)
             return AI_IS_FASTER;    // if we didn't know any of battler 2's moves to compare priorities, assume they don't have a prio+ move
         // Priorities are the same(at least comparing to moves the AI is aware of), decide by speed.
-        if (GetWhoStrikesFirst(battlerAI, battler2, TRUE) == 0)
+        // Only predict the order here, the Quick Claw and Custap Berry flags are set when the real turn order is decided.
+        GetBattlerTurnOrderData(battlerAI, TRUE, FALSE, &turnOrderAI);
+        GetBattlerTurnOrderData(battler2, TRUE, FALSE, &turnOrderBattler2);
+        if (CompareBattlersTurnOrder(&turnOrderAI, &turnOrderBattler2) == 0)
             return AI_IS_FASTER;
         else
             return AI_IS_SLOWER;
@@ -1788,7 +1788,6 @@ static void Cmd_panse_adjustall(void)
 #define tPanning        data[1]
 #define tFramesToWait   data[2]
 #define tNumberOfPlays  data[3]
-#define tFrameCounter   data[8]
 
 static void Cmd_loopsewithpan(void)
 {
@@ -1809,7 +1808,6 @@ static void Cmd_loopsewithpan(void)
     gTasks[taskId].tPanning = panning;
     gTasks[taskId].tFramesToWait = framesToWait;
     gTasks[taskId].tNumberOfPlays = numberOfPlays;
-    gTasks[taskId].tFrameCounter = framesToWait;
     gTasks[taskId].func(taskId);
 
     gAnimSoundTaskCount++;
@@ -1818,22 +1816,22 @@ static void Cmd_loopsewithpan(void)
 
 static void Task_LoopAndPlaySE(u8 taskId)
 {
-    if (gTasks[taskId].tFrameCounter++ >= gTasks[taskId].tFramesToWait)
-    {
-        u16 songId;
-        s8 panning;
-        u8 numberOfPlays;
+    u16 songId;
+    s8 panning;
+    u8 numberOfPlays;
 
-        gTasks[taskId].tFrameCounter = 0;
-        songId = gTasks[taskId].tSongId;
-        panning = gTasks[taskId].tPanning;
-        numberOfPlays = --gTasks[taskId].tNumberOfPlays;
-        PlaySE12WithPanning(songId, panning);
-        if (numberOfPlays == 0)
-        {
-            DestroyTask(taskId);
-            gAnimSoundTaskCount--;
-        }
+    songId = gTasks[taskId].tSongId;
+    panning = gTasks[taskId].tPanning;
+    numberOfPlays = --gTasks[taskId].tNumberOfPlays;
+    PlaySE12WithPanning(songId, panning);
+    if (numberOfPlays == 0)
+    {
+        DestroyTask(taskId);
+        gAnimSoundTaskCount--;
+    }
+    else
+    {
+        DelayTask(taskId, gTasks[taskId].tFramesToWait + 1);
     }
 }
 
@@ -1841,11 +1839,9 @@ static void Task_LoopAndPlaySE(u8 taskId)
 #undef tPanning
 #undef tFramesToWait
 #undef tNumberOfPlays
-#undef tFrameCounter
 
 #define tSongId         data[0]
 #define tPanning        data[1]
-#define tFramesToWait   data[2]
 
 static void Cmd_waitplaysewithpan(void)
 {
@@ -1863,7 +1859,7 @@ static void Cmd_waitplaysewithpan(void)
     taskId = CreateTask(Task_WaitAndPlaySE, 1);
     gTasks[taskId].tSongId = songId;
     gTasks[taskId].tPanning = panning;
-    gTasks[taskId].tFramesToWait = framesToWait;
+    DelayTask(taskId, framesToWait + 1);
 
     gAnimSoundTaskCount++;
     sBattleAnimScriptPtr += 4;
@@ -1871,17 +1867,13 @@ static void Cmd_waitplaysewithpan(void)
 
 static void Task_WaitAndPlaySE(u8 taskId)
 {
-    if (gTasks[taskId].tFramesToWait-- <= 0)
-    {
-        PlaySE12WithPanning(gTasks[taskId].tSongId, gTasks[taskId].tPanning);
-        DestroyTask(taskId);
-        gAnimSoundTaskCount--;
-    }
+    PlaySE12WithPanning(gTasks[taskId].tSongId, gTasks[taskId].tPanning);
+    DestroyTask(taskId);
+    gAnimSoundTaskCount--;
 }
 
 #undef tSongId
 #undef tPanning
-#undef tFramesToWait
 
 static void Cmd_createsoundtask(void)
 {
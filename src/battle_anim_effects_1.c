@@ -131,6 +131,7 @@ static void AnimTask_MoonlightEndFade_Step(u8 taskId);
 static void AnimTask_LeafBlade_Step(u8);
 static void AnimTask_DuplicateAndShrinkToPos_Step1(u8);
 static void AnimTask_DuplicateAndShrinkToPos_Step2(u8);
+static void AnimTask_Conversion2AlphaBlend_Step(u8);
 static s16 LeafBladeGetPosFactor(struct Sprite *);
 static void AnimTask_LeafBlade_Step2(struct Task *, u8);
 static void AnimTask_LeafBlade_Step2_Callback(struct Sprite *);
@@ -6060,14 +6061,17 @@ static void AnimConversion2_Step(struct Sprite *sprite)
 
 void AnimTask_Conversion2AlphaBlend(u8 taskId)
 {
-    if (++gTasks[taskId].data[0] == 4)
-    {
-        gTasks[taskId].data[0] = 0;
-        gTasks[taskId].data[1]++;
-        SetGpuReg(REG_OFFSET_BLDALPHA, BLDALPHA_BLEND(gTasks[taskId].data[1], 16 - gTasks[taskId].data[1]));
-        if (gTasks[taskId].data[1] == 16)
-            DestroyAnimVisualTask(taskId);
-    }
+    gTasks[taskId].func = AnimTask_Conversion2AlphaBlend_Step;
+    SetTaskPeriod(taskId, 4);
+    DelayTask(taskId, 3);
+}
+
+static void AnimTask_Conversion2AlphaBlend_Step(u8 taskId)
+{
+    gTasks[taskId].data[1]++;
+    SetGpuReg(REG_OFFSET_BLDALPHA, BLDALPHA_BLEND(gTasks[taskId].data[1], 16 - gTasks[taskId].data[1]));
+    if (gTasks[taskId].data[1] == 16)
+        DestroyAnimVisualTask(taskId);
 }
 
 // Unused
@@ -2051,19 +2051,16 @@ void AnimTask_GrowAndGrayscale(u8 taskId)
     PrepareBattlerSpriteForRotScale(spriteId, ST_OAM_OBJ_BLEND);
     SetSpriteRotScale(spriteId, 0xD0, 0xD0, 0);
     SetGrayscaleOrOriginalPalette(gSprites[spriteId].oam.paletteNum + 16, FALSE);
-    gTasks[taskId].data[0] = 80;
     gTasks[taskId].func = AnimTask_GrowAndGrayscale_Step;
+    DelayTask(taskId, 81);
 }
 
 static void AnimTask_GrowAndGrayscale_Step(u8 taskId)
 {
-    if (--gTasks[taskId].data[0] == -1)
-    {
-        u8 spriteId = GetAnimBattlerSpriteId(ANIM_TARGET);
-        ResetSpriteRotScale(spriteId);
-        SetGrayscaleOrOriginalPalette(gSprites[spriteId].oam.paletteNum + 16, TRUE);
-        DestroyAnimVisualTask(taskId);
-    }
+    u8 spriteId = GetAnimBattlerSpriteId(ANIM_TARGET);
+    ResetSpriteRotScale(spriteId);
+    SetGrayscaleOrOriginalPalette(gSprites[spriteId].oam.paletteNum + 16, TRUE);
+    DestroyAnimVisualTask(taskId);
 }
 
 // Shrinks and grows the attacking mon several times. Also creates transparent versions of the
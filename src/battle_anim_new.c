@@ -7731,17 +7731,14 @@ void AnimTask_GrowTarget(u8 taskId)
     u8 spriteId = GetAnimBattlerSpriteId(ANIM_TARGET);
     PrepareBattlerSpriteForRotScale(spriteId, ST_OAM_OBJ_BLEND);
     SetSpriteRotScale(spriteId, 208, 208, 0);
-    gTasks[taskId].data[0] = 120;
     gTasks[taskId].func = AnimTask_GrowStep;
+    DelayTask(taskId, 121);
 }
 static void AnimTask_GrowStep(u8 taskId)
 {
-    if (--gTasks[taskId].data[0] == -1)
-    {
-        u8 spriteId = GetAnimBattlerSpriteId(ANIM_TARGET);
-        ResetSpriteRotScale(spriteId);
-        DestroyAnimVisualTask(taskId);
-    }
+    u8 spriteId = GetAnimBattlerSpriteId(ANIM_TARGET);
+    ResetSpriteRotScale(spriteId);
+    DestroyAnimVisualTask(taskId);
 }
 
 // Uses a spotlight sprite as a light mask to illuminate the attacker. The spotlight grows and shrinks.
@@ -5175,6 +5175,9 @@ static u16 GetWinningMove(int winnerTournamentId, int loserTournamentId, u8 roun
     int i, j, k;
     int moveScores[MAX_MON_MOVES * FRONTIER_PARTY_SIZE];
     u16 moveIds[MAX_MON_MOVES * FRONTIER_PARTY_SIZE];
+    u16 targetSpecies[FRONTIER_PARTY_SIZE];
+    u16 targetAbilities[FRONTIER_PARTY_SIZE];
+    u16 typeMultipliers[FRONTIER_PARTY_SIZE];
     u16 bestScore = 0;
     u16 bestId = 0;
     int movePower = 0;
@@ -5204,22 +5207,23 @@ static u16 GetWinningMove(int winnerTournamentId, int loserTournamentId, u8 roun
             for (k = 0; k < FRONTIER_PARTY_SIZE; k++)
             {
                 u32 personality = 0;
-                u32 targetSpecies = 0;
-                u32 targetAbility = 0;
-                u32 typeMultiplier = 0;
                 do
                 {
                     personality = Random32();
                 } while (gFacilityTrainerMons[DOME_MONS[loserTournamentId][k]].nature != GetNatureFromPersonality(personality));
 
-                targetSpecies = gFacilityTrainerMons[DOME_MONS[loserTournamentId][k]].species;
+                targetSpecies[k] = gFacilityTrainerMons[DOME_MONS[loserTournamentId][k]].species;
 
                 if (personality & 1)
-                    targetAbility = gSpeciesInfo[targetSpecies].abilities[1];
+                    targetAbilities[k] = gSpeciesInfo[targetSpecies[k]].abilities[1];
                 else
-                    targetAbility = gSpeciesInfo[targetSpecies].abilities[0];
+                    targetAbilities[k] = gSpeciesInfo[targetSpecies[k]].abilities[0];
+            }
 
-                typeMultiplier = CalcPartyMonTypeEffectivenessMultiplier(moveIds[i * 4 + j], targetSpecies, targetAbility);
+            CalcPartyTypeEffectivenessMultipliers(moveIds[i * MAX_MON_MOVES + j], targetSpecies, targetAbilities, FRONTIER_PARTY_SIZE, typeMultipliers);
+            for (k = 0; k < FRONTIER_PARTY_SIZE; k++)
+            {
+                u32 typeMultiplier = typeMultipliers[k];
                 if (typeMultiplier == UQ_4_12(0))
                     moveScores[i * MAX_MON_MOVES + j] += 0;
                 else if (typeMultiplier >= UQ_4_12(2))
@@ -118,7 +118,6 @@ static void HandleEndTurn_FinishBattle(void);
 static void SpriteCB_UnusedBattleInit(struct Sprite *sprite);
 static void SpriteCB_UnusedBattleInit_Main(struct Sprite *sprite);
 static void TrySpecialEvolution(void);
-static u32 Crc32B (const u8 *data, u32 size);
 static u32 GeneratePartyHash(const struct Trainer *trainer, u32 i);
 static void CustomTrainerPartyAssignMoves(struct Pokemon *mon, const struct TrainerMonCustomized *partyEntry);
 
@@ -1862,26 +1861,6 @@ static void SpriteCB_UnusedBattleInit_Main(struct Sprite *sprite)
     }
 }
 
-static u32 Crc32B (const u8 *data, u32 size)
-{
-   s32 i, j;
-   u32 byte, crc, mask;
-
-   i = 0;
-   crc = 0xFFFFFFFF;
-   for (i = 0; i < size; ++i)
-   {
-        byte = data[i];
-        crc = crc ^ byte;
-        for (j = 7; j >= 0; --j)
-        {
-            mask = -(crc & 1);
-            crc = (crc >> 1) ^ (0xEDB88320 & mask);
-        }
-   }
-   return ~crc;
-}
-
 static u32 GeneratePartyHash(const struct Trainer *trainer, u32 i)
 {
     const u8 *buffer;
@@ -1911,7 +1890,7 @@ static u32 GeneratePartyHash(const struct Trainer *trainer, u32 i)
         buffer = (const u8 *) &trainer->party.EverythingCustomized[i];
         n = sizeof(*trainer->party.EverythingCustomized);
     }
-    return Crc32B(buffer, n);
+    return CalcCRC32WithTable(buffer, n);
 }
 
 void ModifyPersonalityForNature(u32 *personality, u32 newNature)
@@ -3796,13 +3775,18 @@ static void TryDoEventsBeforeFirstTurn(void)
 
     if (gBattleStruct->switchInAbilitiesCounter == 0)
     {
+        struct BattlerTurnOrderData turnOrderData[MAX_BATTLERS_COUNT];
+
         for (i = 0; i < gBattlersCount; i++)
+        {
             gBattlerByTurnOrder[i] = i;
+            GetBattlerTurnOrderData(i, TRUE, TRUE, &turnOrderData[i]);
+        }
         for (i = 0; i < gBattlersCount - 1; i++)
         {
             for (j = i + 1; j < gBattlersCount; j++)
             {
-                if (GetWhoStrikesFirst(gBattlerByTurnOrder[i], gBattlerByTurnOrder[j], TRUE) != 0)
+                if (CompareBattlersTurnOrder(&turnOrderData[gBattlerByTurnOrder[i]], &turnOrderData[gBattlerByTurnOrder[j]]) != 0)
                     SwapTurnOrder(i, j);
             }
         }
@@ -4760,79 +4744,75 @@ s8 GetMovePriority(u32 battlerId, u16 move)
     return priority;
 }
 
-u8 GetWhoStrikesFirst(u8 battler1, u8 battler2, bool8 ignoreChosenMoves)
+// Gathers everything the turn order comparison needs for one battler.
+// The priority is only that of the chosen move, unless ignoreChosenMoves is TRUE.
+// Quick Draw is only rolled and the Quick Claw/Custap Berry flags are only set when applyRandomEffects is TRUE,
+// so the AI can predict the order without touching the battle state.
+void GetBattlerTurnOrderData(u32 battler, bool32 ignoreChosenMoves, bool32 applyRandomEffects, struct BattlerTurnOrderData *data)
 {
-    u8 strikesFirst = 0;
-    u32 speedBattler1 = 0, speedBattler2 = 0;
-    u32 holdEffectBattler1 = 0, holdEffectBattler2 = 0;
-    s8 priority1 = 0, priority2 = 0;
-    u16 ability1 = GetBattlerAbility(battler1), ability2 = GetBattlerAbility(battler2);
-
-    // Battler 1
-    speedBattler1 = GetBattlerTotalSpeedStat(battler1);
-    holdEffectBattler1 = GetBattlerHoldEffect(battler1, TRUE);
-    // Quick Draw
-    if (!ignoreChosenMoves && ability1 == ABILITY_QUICK_DRAW && !IS_MOVE_STATUS(gChosenMoveByBattler[battler1]) && Random() % 100 < 30)
-        gProtectStructs[battler1].quickDraw = TRUE;
-    // Quick Claw and Custap Berry
-    if (!gProtectStructs[battler1].quickDraw
-     && ((holdEffectBattler1 == HOLD_EFFECT_QUICK_CLAW && gRandomTurnNumber < (0xFFFF * GetBattlerHoldEffectParam(battler1)) / 100)
-     || (holdEffectBattler1 == HOLD_EFFECT_CUSTAP_BERRY && HasEnoughHpToEatBerry(battler1, 4, gBattleMons[battler1].item))))
-        gProtectStructs[battler1].usedCustapBerry = TRUE;
-
-    // Battler 2
-    speedBattler2 = GetBattlerTotalSpeedStat(battler2);
-    holdEffectBattler2 = GetBattlerHoldEffect(battler2, TRUE);
+    data->speed = GetBattlerTotalSpeedStat(battler);
+    data->ability = GetBattlerAbility(battler);
+    data->holdEffect = GetBattlerHoldEffect(battler, TRUE);
+    if (!ignoreChosenMoves && gChosenActionByBattler[battler] == B_ACTION_USE_MOVE)
+        data->priority = GetChosenMovePriority(battler);
+    else
+        data->priority = 0;
+
     // Quick Draw
-    if (!ignoreChosenMoves && ability2 == ABILITY_QUICK_DRAW && !IS_MOVE_STATUS(gChosenMoveByBattler[battler2]) && Random() % 100 < 30)
-        gProtectStructs[battler2].quickDraw = TRUE;
-    // Quick Claw and Custap Berry
-    if (!gProtectStructs[battler2].quickDraw
-     && ((holdEffectBattler2 == HOLD_EFFECT_QUICK_CLAW && gRandomTurnNumber < (0xFFFF * GetBattlerHoldEffectParam(battler2)) / 100)
-     || (holdEffectBattler2 == HOLD_EFFECT_CUSTAP_BERRY && HasEnoughHpToEatBerry(battler2, 4, gBattleMons[battler2].item))))
-        gProtectStructs[battler2].usedCustapBerry = TRUE;
+    if (applyRandomEffects && !ignoreChosenMoves && data->ability == ABILITY_QUICK_DRAW && !IS_MOVE_STATUS(gChosenMoveByBattler[battler]) && Random() % 100 < 30)
+        gProtectStructs[battler].quickDraw = TRUE;
+    data->quickDraw = gProtectStructs[battler].quickDraw;
 
-    if (!ignoreChosenMoves)
+    // Quick Claw and Custap Berry
+    data->usedCustapBerry = gProtectStructs[battler].usedCustapBerry;
+    if (!data->quickDraw
+     && ((data->holdEffect == HOLD_EFFECT_QUICK_CLAW && gRandomTurnNumber < (0xFFFF * GetBattlerHoldEffectParam(battler)) / 100)
+     || (data->holdEffect == HOLD_EFFECT_CUSTAP_BERRY && HasEnoughHpToEatBerry(battler, 4, gBattleMons[battler].item))))
     {
-        if (gChosenActionByBattler[battler1] == B_ACTION_USE_MOVE)
-            priority1 = GetChosenMovePriority(battler1);
-        if (gChosenActionByBattler[battler2] == B_ACTION_USE_MOVE)
-            priority2 = GetChosenMovePriority(battler2);
+        data->usedCustapBerry = TRUE;
+        if (applyRandomEffects)
+            gProtectStructs[battler].usedCustapBerry = TRUE;
     }
+}
 
-    if (priority1 == priority2)
+// Returns 0 if battler1 goes first, 1 if battler2 goes first and 2 on a speed tie that was decided in favor of battler2.
+u32 CompareBattlersTurnOrder(const struct BattlerTurnOrderData *data1, const struct BattlerTurnOrderData *data2)
+{
+    u32 strikesFirst = 0;
+
+    if (data1->priority == data2->priority)
     {
         // QUICK CLAW / CUSTAP - always first
         // LAGGING TAIL - always last
         // STALL - always last
 
-        if (gProtectStructs[battler1].quickDraw && !gProtectStructs[battler2].quickDraw)
+        if (data1->quickDraw && !data2->quickDraw)
             strikesFirst = 0;
-        else if (!gProtectStructs[battler1].quickDraw && gProtectStructs[battler2].quickDraw)
+        else if (!data1->quickDraw && data2->quickDraw)
             strikesFirst = 1;
-        else if (gProtectStructs[battler1].usedCustapBerry && !gProtectStructs[battler2].usedCustapBerry)
+        else if (data1->usedCustapBerry && !data2->usedCustapBerry)
             strikesFirst = 0;
-        else if (gProtectStructs[battler2].usedCustapBerry && !gProtectStructs[battler1].usedCustapBerry)
+        else if (data2->usedCustapBerry && !data1->usedCustapBerry)
             strikesFirst = 1;
-        else if (holdEffectBattler1 == HOLD_EFFECT_LAGGING_TAIL && holdEffectBattler2 != HOLD_EFFECT_LAGGING_TAIL)
+        else if (data1->holdEffect == HOLD_EFFECT_LAGGING_TAIL && data2->holdEffect != HOLD_EFFECT_LAGGING_TAIL)
             strikesFirst = 1;
-        else if (holdEffectBattler2 == HOLD_EFFECT_LAGGING_TAIL && holdEffectBattler1 != HOLD_EFFECT_LAGGING_TAIL)
+        else if (data2->holdEffect == HOLD_EFFECT_LAGGING_TAIL && data1->holdEffect != HOLD_EFFECT_LAGGING_TAIL)
             strikesFirst = 0;
-        else if (ability1 == ABILITY_STALL && ability2 != ABILITY_STALL)
+        else if (data1->ability == ABILITY_STALL && data2->ability != ABILITY_STALL)
             strikesFirst = 1;
-        else if (ability2 == ABILITY_STALL && ability1 != ABILITY_STALL)
+        else if (data2->ability == ABILITY_STALL && data1->ability != ABILITY_STALL)
             strikesFirst = 0;
-        else if (ability1 == ABILITY_MYCELIUM_MIGHT && ability2 != ABILITY_MYCELIUM_MIGHT && IS_MOVE_STATUS(gCurrentMove))
+        else if (data1->ability == ABILITY_MYCELIUM_MIGHT && data2->ability != ABILITY_MYCELIUM_MIGHT && IS_MOVE_STATUS(gCurrentMove))
             strikesFirst = 1;
-        else if (ability2 == ABILITY_MYCELIUM_MIGHT && ability1 != ABILITY_MYCELIUM_MIGHT && IS_MOVE_STATUS(gCurrentMove))
+        else if (data2->ability == ABILITY_MYCELIUM_MIGHT && data1->ability != ABILITY_MYCELIUM_MIGHT && IS_MOVE_STATUS(gCurrentMove))
             strikesFirst = 0;
         else
         {
-            if (speedBattler1 == speedBattler2 && Random() & 1)
+            if (data1->speed == data2->speed && Random() & 1)
             {
                 strikesFirst = 2; // same speeds, same priorities
             }
-            else if (speedBattler1 < speedBattler2)
+            else if (data1->speed < data2->speed)
             {
                 // battler2 has more speed
                 if (gFieldStatuses & STATUS_FIELD_TRICK_ROOM)
@@ -4850,7 +4830,7 @@ u8 GetWhoStrikesFirst(u8 battler1, u8 battler2, bool8 ignoreChosenMoves)
             }
         }
     }
-    else if (priority1 < priority2)
+    else if (data1->priority < data2->priority)
     {
         strikesFirst = 1; // battler2's move has greater priority
     }
@@ -4862,10 +4842,29 @@ u8 GetWhoStrikesFirst(u8 battler1, u8 battler2, bool8 ignoreChosenMoves)
     return strikesFirst;
 }
 
+u8 GetWhoStrikesFirst(u8 battler1, u8 battler2, bool8 ignoreChosenMoves)
+{
+    struct BattlerTurnOrderData data1, data2;
+
+    GetBattlerTurnOrderData(battler1, ignoreChosenMoves, TRUE, &data1);
+    GetBattlerTurnOrderData(battler2, ignoreChosenMoves, TRUE, &data2);
+
+    return CompareBattlersTurnOrder(&data1, &data2);
+}
+
+// Items, switches and Poké Balls are used before any move.
+static bool32 IsActionBeforeMoves(u32 action)
+{
+    return action == B_ACTION_USE_ITEM
+        || action == B_ACTION_SWITCH
+        || action == B_ACTION_THROW_BALL;
+}
+
 static void SetActionsAndBattlersTurnOrder(void)
 {
     s32 turnOrderId = 0;
-    s32 i, j;
+    s32 i, j, movingBattlers, firstMover;
+    struct BattlerTurnOrderData turnOrderData[MAX_BATTLERS_COUNT];
 
     if (gBattleTypeFlags & BATTLE_TYPE_SAFARI)
     {
@@ -4922,42 +4921,36 @@ static void SetActionsAndBattlersTurnOrder(void)
         {
             for (gActiveBattler = 0; gActiveBattler < gBattlersCount; gActiveBattler++)
             {
-                if (gChosenActionByBattler[gActiveBattler] == B_ACTION_USE_ITEM
-                  || gChosenActionByBattler[gActiveBattler] == B_ACTION_SWITCH
-                  || gChosenActionByBattler[gActiveBattler] == B_ACTION_THROW_BALL)
+                if (IsActionBeforeMoves(gChosenActionByBattler[gActiveBattler]))
                 {
                     gActionsByTurnOrder[turnOrderId] = gChosenActionByBattler[gActiveBattler];
                     gBattlerByTurnOrder[turnOrderId] = gActiveBattler;
                     turnOrderId++;
                 }
             }
+            firstMover = turnOrderId;
             for (gActiveBattler = 0; gActiveBattler < gBattlersCount; gActiveBattler++)
             {
-                if (gChosenActionByBattler[gActiveBattler] != B_ACTION_USE_ITEM
-                  && gChosenActionByBattler[gActiveBattler] != B_ACTION_SWITCH
-                  && gChosenActionByBattler[gActiveBattler] != B_ACTION_THROW_BALL)
+                if (!IsActionBeforeMoves(gChosenActionByBattler[gActiveBattler]))
                 {
                     gActionsByTurnOrder[turnOrderId] = gChosenActionByBattler[gActiveBattler];
                     gBattlerByTurnOrder[turnOrderId] = gActiveBattler;
                     turnOrderId++;
                 }
             }
-            for (i = 0; i < gBattlersCount - 1; i++)
+            // Speed, priority and the Quick Draw/Quick Claw rolls are computed once per battler, then the battlers
+            // from firstMover on are sorted. The rolls only matter if there is someone to go first against.
+            movingBattlers = turnOrderId - firstMover;
+            for (i = firstMover; i < turnOrderId; i++)
+                GetBattlerTurnOrderData(gBattlerByTurnOrder[i], FALSE, movingBattlers > 1, &turnOrderData[gBattlerByTurnOrder[i]]);
+            for (i = firstMover; i < turnOrderId - 1; i++)
             {
-                for (j = i + 1; j < gBattlersCount; j++)
+                for (j = i + 1; j < turnOrderId; j++)
                 {
                     u8 battler1 = gBattlerByTurnOrder[i];
                     u8 battler2 = gBattlerByTurnOrder[j];
-                    if (gActionsByTurnOrder[i] != B_ACTION_USE_ITEM
-                        && gActionsByTurnOrder[j] != B_ACTION_USE_ITEM
-                        && gActionsByTurnOrder[i] != B_ACTION_SWITCH
-                        && gActionsByTurnOrder[j] != B_ACTION_SWITCH
-                        && gActionsByTurnOrder[i] != B_ACTION_THROW_BALL
-                        && gActionsByTurnOrder[j] != B_ACTION_THROW_BALL)
-                    {
-                        if (GetWhoStrikesFirst(battler1, battler2, FALSE))
-                            SwapTurnOrder(i, j);
-                    }
+                    if (CompareBattlersTurnOrder(&turnOrderData[battler1], &turnOrderData[battler2]))
+                        SwapTurnOrder(i, j);
                 }
             }
         }
@@ -5096,7 +5089,19 @@ static bool32 TryDoMoveEffectsBeforeMoves(void)
 // In gen7, priority and speed are recalculated during the turn in which a pokemon mega evolves
 static void TryChangeTurnOrder(void)
 {
-    u32 i, j;
+    u32 i, j, movingBattlers = 0;
+    struct BattlerTurnOrderData turnOrderData[MAX_BATTLERS_COUNT];
+
+    for (i = 0; i < gBattlersCount; i++)
+    {
+        if (gActionsByTurnOrder[i] == B_ACTION_USE_MOVE)
+            movingBattlers++;
+    }
+    for (i = 0; i < gBattlersCount; i++)
+    {
+        if (gActionsByTurnOrder[i] == B_ACTION_USE_MOVE)
+            GetBattlerTurnOrderData(gBattlerByTurnOrder[i], FALSE, movingBattlers > 1, &turnOrderData[gBattlerByTurnOrder[i]]);
+    }
     for (i = 0; i < gBattlersCount - 1; i++)
     {
         for (j = i + 1; j < gBattlersCount; j++)
@@ -5107,7 +5112,7 @@ static void TryChangeTurnOrder(void)
             if (gActionsByTurnOrder[i] == B_ACTION_USE_MOVE
                 && gActionsByTurnOrder[j] == B_ACTION_USE_MOVE)
             {
-                if (GetWhoStrikesFirst(battler1, battler2, FALSE))
+                if (CompareBattlersTurnOrder(&turnOrderData[battler1], &turnOrderData[battler2]))
                     SwapTurnOrder(i, j);
             }
         }
@@ -2141,10 +2141,8 @@ s8 GetInverseCritChance(u8 battlerAtk, u8 battlerDef, u32 move)
         return sCriticalHitChance[critChanceIndex];
 }
 
-static void Cmd_critcalc(void)
+static void CalcCriticalHit(void)
 {
-    CMD_ARGS();
-
     u16 partySlot;
     s32 critChance = CalcCritChanceStage(gBattlerAttacker, gBattlerTarget, gCurrentMove, TRUE);
     gPotentialItemEffectBattler = gBattlerAttacker;
@@ -2163,18 +2161,29 @@ static void Cmd_critcalc(void)
     if (gIsCriticalHit && GetBattlerSide(gBattlerAttacker) == B_SIDE_PLAYER
         && !(gBattleTypeFlags & BATTLE_TYPE_MULTI && GetBattlerPosition(gBattlerAttacker) == B_POSITION_PLAYER_LEFT))
         gPartyCriticalHits[partySlot]++;
-
-    gBattlescriptCurrInstr = cmd->nextInstr;
 }
 
-static void Cmd_damagecalc(void)
+static void Cmd_critcalc(void)
 {
     CMD_ARGS();
 
+    CalcCriticalHit();
+    gBattlescriptCurrInstr = cmd->nextInstr;
+}
+
+static void CalcMoveDamage(void)
+{
     u8 moveType;
 
     GET_MOVE_TYPE(gCurrentMove, moveType);
     gBattleMoveDamage = CalculateMoveDamage(gCurrentMove, gBattlerAttacker, gBattlerTarget, moveType, 0, gIsCriticalHit, TRUE, TRUE);
+}
+
+static void Cmd_damagecalc(void)
+{
+    CMD_ARGS();
+
+    CalcMoveDamage();
     gBattlescriptCurrInstr = cmd->nextInstr;
 }
 
@@ -2190,10 +2199,9 @@ static void Cmd_typecalc(void)
     gBattlescriptCurrInstr = cmd->nextInstr;
 }
 
-static void Cmd_adjustdamage(void)
+// Sets the script cursor to nextInstr, unless a berry, gem or Strong Winds script has to run first.
+static void AdjustDamage(const u8 *nextInstr)
 {
-    CMD_ARGS();
-
     u8 holdEffect, param;
     u32 moveType;
     u32 friendshipScore = GetBattlerFriendshipScore(gBattlerTarget);
@@ -2276,7 +2284,7 @@ static void Cmd_adjustdamage(void)
 #endif
 
 END:
-    gBattlescriptCurrInstr = cmd->nextInstr;
+    gBattlescriptCurrInstr = nextInstr;
 
     if (!(gMoveResultFlags & MOVE_RESULT_NO_EFFECT) && gBattleMoveDamage >= 1)
         gSpecialStatuses[gBattlerAttacker].damagedMons |= gBitTable[gBattlerTarget];
@@ -2317,6 +2325,13 @@ END:
     }
 }
 
+static void Cmd_adjustdamage(void)
+{
+    CMD_ARGS();
+
+    AdjustDamage(cmd->nextInstr);
+}
+
 static void Cmd_multihitresultmessage(void)
 {
     CMD_ARGS();
@@ -16121,6 +16136,16 @@ static void Cmd_callnative(void)
 }
 
 // Callnative Funcs
+// Fused critcalc, damagecalc and adjustdamage, so the most common hit sequence takes one command instead of three.
+void BS_CalcHitDamage(void)
+{
+    NATIVE_ARGS();
+
+    CalcCriticalHit();
+    CalcMoveDamage();
+    AdjustDamage(cmd->nextInstr);
+}
+
 void BS_CalcMetalBurstDmg(void)
 {
     NATIVE_ARGS(const u8 *failInstr);
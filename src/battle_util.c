@@ -9770,17 +9770,62 @@ static void UpdateMoveResultFlags(u16 modifier)
     }
 }
 
+// The per-type overrides in MulByTypeEffectiveness only matter when a type is immune, or for Freeze-Dry, Tar Shot and Strong Winds.
+// When none of those can apply, the plain table product is the same result without the per-type checks.
+static bool32 CanUseFastTypeEffectiveness(u16 move, u8 moveType, u8 battlerDef, u16 tableModifier)
+{
+    if (tableModifier == UQ_4_12(0.0))
+        return FALSE;
+    if (gBattleMoves[move].effect == EFFECT_FREEZE_DRY)
+        return FALSE;
+    if (moveType == TYPE_FIRE && gDisableStructs[battlerDef].tarShot)
+        return FALSE;
+    if (gBattleWeather & B_WEATHER_STRONG_WINDS)
+        return FALSE;
+    return TRUE;
+}
+
+static void MulBySpeciesTypeEffectiveness(u16 *modifier, u16 move, u8 moveType, u16 speciesDef)
+{
+    u8 defType1 = gSpeciesInfo[speciesDef].types[0];
+    u8 defType2 = gSpeciesInfo[speciesDef].types[1];
+    u16 tableModifier = GetDualTypeModifier(moveType, defType1, defType2);
+
+    if (CanUseFastTypeEffectiveness(move, moveType, 0, tableModifier))
+    {
+        MulModifier(modifier, tableModifier);
+        return;
+    }
+
+    MulByTypeEffectiveness(modifier, move, moveType, 0, defType1, 0, FALSE);
+    if (defType2 != defType1)
+        MulByTypeEffectiveness(modifier, move, moveType, 0, defType2, 0, FALSE);
+}
+
 static u16 CalcTypeEffectivenessMultiplierInternal(u16 move, u8 moveType, u8 battlerAtk, u8 battlerDef, bool32 recordAbilities, u16 modifier)
 {
     u32 illusionSpecies;
     u16 defAbility = GetBattlerAbility(battlerDef);
+    u8 defType1 = gBattleMons[battlerDef].type1;
+    u8 defType2 = gBattleMons[battlerDef].type2;
+    u8 defType3 = gBattleMons[battlerDef].type3;
+    u16 tableModifier = GetDualTypeModifier(moveType, defType1, defType2);
+
+    if (defType3 != TYPE_MYSTERY && defType3 != defType2 && defType3 != defType1)
+        MulModifier(&tableModifier, GetTypeModifier(moveType, defType3));
 
-    MulByTypeEffectiveness(&modifier, move, moveType, battlerDef, gBattleMons[battlerDef].type1, battlerAtk, recordAbilities);
-    if (gBattleMons[battlerDef].type2 != gBattleMons[battlerDef].type1)
-        MulByTypeEffectiveness(&modifier, move, moveType, battlerDef, gBattleMons[battlerDef].type2, battlerAtk, recordAbilities);
-    if (gBattleMons[battlerDef].type3 != TYPE_MYSTERY && gBattleMons[battlerDef].type3 != gBattleMons[battlerDef].type2
-        && gBattleMons[battlerDef].type3 != gBattleMons[battlerDef].type1)
-        MulByTypeEffectiveness(&modifier, move, moveType, battlerDef, gBattleMons[battlerDef].type3, battlerAtk, recordAbilities);
+    if (CanUseFastTypeEffectiveness(move, moveType, battlerDef, tableModifier))
+    {
+        MulModifier(&modifier, tableModifier);
+    }
+    else
+    {
+        MulByTypeEffectiveness(&modifier, move, moveType, battlerDef, defType1, battlerAtk, recordAbilities);
+        if (defType2 != defType1)
+            MulByTypeEffectiveness(&modifier, move, moveType, battlerDef, defType2, battlerAtk, recordAbilities);
+        if (defType3 != TYPE_MYSTERY && defType3 != defType2 && defType3 != defType1)
+            MulByTypeEffectiveness(&modifier, move, moveType, battlerDef, defType3, battlerAtk, recordAbilities);
+    }
 
     if (recordAbilities && (illusionSpecies = GetIllusionMonSpecies(battlerDef)))
         TryNoticeIllusionInTypeEffectiveness(move, moveType, battlerAtk, battlerDef, modifier, illusionSpecies);
@@ -9815,7 +9860,7 @@ static u16 CalcTypeEffectivenessMultiplierInternal(u16 move, u8 moveType, u8 bat
 #endif
 
     // Thousand Arrows ignores type modifiers for flying mons
-    if (!IsBattlerGrounded(battlerDef) && (gBattleMoves[move].flags & FLAG_DMG_UNGROUNDED_IGNORE_TYPE_IF_FLYING)
+    if ((gBattleMoves[move].flags & FLAG_DMG_UNGROUNDED_IGNORE_TYPE_IF_FLYING) && !IsBattlerGrounded(battlerDef)
         && (gBattleMons[battlerDef].type1 == TYPE_FLYING || gBattleMons[battlerDef].type2 == TYPE_FLYING || gBattleMons[battlerDef].type3 == TYPE_FLYING))
     {
         modifier = UQ_4_12(1.0);
@@ -9859,16 +9904,13 @@ u16 CalcTypeEffectivenessMultiplier(u16 move, u8 moveType, u8 battlerAtk, u8 bat
     return modifier;
 }
 
-u16 CalcPartyMonTypeEffectivenessMultiplier(u16 move, u16 speciesDef, u16 abilityDef)
+static u16 CalcSpeciesTypeEffectivenessMultiplier(u16 move, u8 moveType, u16 speciesDef, u16 abilityDef)
 {
     u16 modifier = UQ_4_12(1.0);
-    u8 moveType = gBattleMoves[move].type;
 
     if (move != MOVE_STRUGGLE && moveType != TYPE_MYSTERY)
     {
-        MulByTypeEffectiveness(&modifier, move, moveType, 0, gSpeciesInfo[speciesDef].types[0], 0, FALSE);
-        if (gSpeciesInfo[speciesDef].types[1] != gSpeciesInfo[speciesDef].types[0])
-            MulByTypeEffectiveness(&modifier, move, moveType, 0, gSpeciesInfo[speciesDef].types[1], 0, FALSE);
+        MulBySpeciesTypeEffectiveness(&modifier, move, moveType, speciesDef);
 
         if (moveType == TYPE_GROUND && abilityDef == ABILITY_LEVITATE && !(gFieldStatuses & STATUS_FIELD_GRAVITY))
             modifier = UQ_4_12(0.0);
@@ -9876,10 +9918,27 @@ u16 CalcPartyMonTypeEffectivenessMultiplier(u16 move, u16 speciesDef, u16 abilit
             modifier = UQ_4_12(0.0);
     }
 
+    return modifier;
+}
+
+u16 CalcPartyMonTypeEffectivenessMultiplier(u16 move, u16 speciesDef, u16 abilityDef)
+{
+    u16 modifier = CalcSpeciesTypeEffectivenessMultiplier(move, gBattleMoves[move].type, speciesDef, abilityDef);
+
     UpdateMoveResultFlags(modifier);
     return modifier;
 }
 
+// Scores one move against several species at once, e.g. a whole party. Unlike CalcPartyMonTypeEffectivenessMultiplier, gMoveResultFlags is left untouched.
+void CalcPartyTypeEffectivenessMultipliers(u16 move, const u16 *speciesDef, const u16 *abilitiesDef, u32 count, u16 *modifiers)
+{
+    u32 i;
+    u8 moveType = gBattleMoves[move].type;
+
+    for (i = 0; i < count; i++)
+        modifiers[i] = CalcSpeciesTypeEffectivenessMultiplier(move, moveType, speciesDef[i], abilitiesDef[i]);
+}
+
 static u16 GetInverseTypeMultiplier(u16 multiplier)
 {
     switch (multiplier)
@@ -9904,14 +9963,32 @@ u16 GetTypeModifier(u8 atkType, u8 defType)
     return sTypeEffectivenessTable[atkType][defType];
 }
 
+// Combined table multiplier against a (possibly mono-typed) type pair, without any battle overrides.
+u16 GetDualTypeModifier(u8 atkType, u8 defType1, u8 defType2)
+{
+    u16 modifier;
+
+#if B_FLAG_INVERSE_BATTLE != 0
+    if (FlagGet(B_FLAG_INVERSE_BATTLE))
+    {
+        modifier = GetInverseTypeMultiplier(sTypeEffectivenessTable[atkType][defType1]);
+        if (defType2 != defType1)
+            MulModifier(&modifier, GetInverseTypeMultiplier(sTypeEffectivenessTable[atkType][defType2]));
+        return modifier;
+    }
+#endif
+    modifier = sTypeEffectivenessTable[atkType][defType1];
+    if (defType2 != defType1)
+        MulModifier(&modifier, sTypeEffectivenessTable[atkType][defType2]);
+    return modifier;
+}
+
 s32 GetStealthHazardDamageByTypesAndHP(u8 hazardType, u8 type1, u8 type2, u32 maxHp)
 {
     s32 dmg = 0;
     u16 modifier = UQ_4_12(1.0);
 
-    MulModifier(&modifier, GetTypeModifier(hazardType, type1));
-    if (type2 != type1)
-        MulModifier(&modifier, GetTypeModifier(hazardType, type2));
+    MulModifier(&modifier, GetDualTypeModifier(hazardType, type1, type2));
 
     switch (modifier)
     {
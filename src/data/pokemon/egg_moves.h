@@ -1,4426 +1,5545 @@
-#define EGG_MOVES_SPECIES_OFFSET 20000
-#define EGG_MOVES_TERMINATOR 0xFFFF
-#define egg_moves(species, moves...) (SPECIES_##species + EGG_MOVES_SPECIES_OFFSET), moves
-
-const u16 gEggMoves[] = {
-    egg_moves(BULBASAUR,
-        MOVE_SKULL_BASH,
-        MOVE_CHARM,
-        MOVE_PETAL_DANCE,
-        MOVE_MAGICAL_LEAF,
-        MOVE_GRASS_WHISTLE,
-        MOVE_CURSE,
-        MOVE_INGRAIN,
-        MOVE_NATURE_POWER,
-        MOVE_AMNESIA,
-        MOVE_LEAF_STORM,
-        MOVE_POWER_WHIP,
-        MOVE_SLUDGE,
-        MOVE_ENDURE,
-        MOVE_GIGA_DRAIN,
-        MOVE_GRASSY_TERRAIN),
-
-    egg_moves(CHARMANDER,
-        MOVE_BELLY_DRUM,
-        MOVE_ANCIENT_POWER,
-        MOVE_BITE,
-        MOVE_OUTRAGE,
-        MOVE_BEAT_UP,
-        MOVE_DRAGON_DANCE,
-        MOVE_CRUNCH,
-        MOVE_DRAGON_RUSH,
-        MOVE_METAL_CLAW,
-        MOVE_FLARE_BLITZ,
-        MOVE_COUNTER,
-        MOVE_DRAGON_PULSE,
-        MOVE_FOCUS_PUNCH,
-        MOVE_AIR_CUTTER),
-
-    egg_moves(SQUIRTLE,
-        MOVE_MIRROR_COAT,
-        MOVE_HAZE,
-        MOVE_MIST,
-        MOVE_FORESIGHT,
-        MOVE_FLAIL,
-        MOVE_REFRESH,
-        MOVE_MUD_SPORT,
-        MOVE_YAWN,
-        MOVE_MUDDY_WATER,
-        MOVE_FAKE_OUT,
-        MOVE_AQUA_RING,
-        MOVE_AQUA_JET,
-        MOVE_WATER_SPOUT,
-        MOVE_BRINE,
-        MOVE_DRAGON_PULSE,
-        MOVE_AURA_SPHERE),
-
-    egg_moves(PIDGEY,
-        MOVE_PURSUIT,
-        MOVE_FEINT_ATTACK,
-        MOVE_FORESIGHT,
-        MOVE_STEEL_WING,
-        MOVE_AIR_CUTTER,
-        MOVE_AIR_SLASH,
-        MOVE_BRAVE_BIRD,
-        MOVE_UPROAR,
-        MOVE_DEFOG),
-
-    egg_moves(RATTATA,
-        MOVE_SCREECH,
-        MOVE_FLAME_WHEEL,
-        MOVE_FURY_SWIPES,
-        MOVE_BITE,
-        MOVE_COUNTER,
-        MOVE_REVERSAL,
-        MOVE_UPROAR,
-        MOVE_LAST_RESORT,
-        MOVE_ME_FIRST,
-        MOVE_REVENGE,
-        MOVE_FINAL_GAMBIT),
-
-    egg_moves(SPEAROW,
-        MOVE_FEINT_ATTACK,
-        MOVE_SCARY_FACE,
-        MOVE_QUICK_ATTACK,
-        MOVE_TRI_ATTACK,
-        MOVE_ASTONISH,
-        MOVE_SKY_ATTACK,
-        MOVE_WHIRLWIND,
-        MOVE_UPROAR,
-        MOVE_FEATHER_DANCE,
-        MOVE_STEEL_WING,
-        MOVE_RAZOR_WIND),
-
-    egg_moves(EKANS,
-        MOVE_PURSUIT,
-        MOVE_SLAM,
-        MOVE_SPITE,
-        MOVE_BEAT_UP,
-        MOVE_POISON_FANG,
-        MOVE_SCARY_FACE,
-        MOVE_POISON_TAIL,
-        MOVE_DISABLE,
-        MOVE_SWITCHEROO,
-        MOVE_IRON_TAIL,
-        MOVE_SUCKER_PUNCH,
-        MOVE_SNATCH),
-
-    egg_moves(SANDSHREW,
-        MOVE_FLAIL,
-        MOVE_COUNTER,
-        MOVE_RAPID_SPIN,
-        MOVE_METAL_CLAW,
-        MOVE_CRUSH_CLAW,
-        MOVE_NIGHT_SLASH,
-        MOVE_MUD_SHOT,
-        MOVE_ENDURE,
-        MOVE_CHIP_AWAY,
-        MOVE_ROCK_CLIMB,
-        MOVE_ROTOTILLER,
-        MOVE_HONE_CLAWS),
-
-    egg_moves(NIDORAN_F,
-        MOVE_SUPERSONIC,
-        MOVE_DISABLE,
-        MOVE_TAKE_DOWN,
-        MOVE_FOCUS_ENERGY,
-        MOVE_CHARM,
-        MOVE_COUNTER,
-        MOVE_BEAT_UP,
-        MOVE_PURSUIT,
-        MOVE_SKULL_BASH,
-        MOVE_IRON_TAIL,
-        MOVE_POISON_TAIL,
-        MOVE_ENDURE,
-        MOVE_CHIP_AWAY,
-        MOVE_VENOM_DRENCH),
-
-    egg_moves(NIDORAN_M,
-        MOVE_COUNTER,
-        MOVE_DISABLE,
-        MOVE_SUPERSONIC,
-        MOVE_TAKE_DOWN,
-        MOVE_AMNESIA,
-        MOVE_CONFUSION,
-        MOVE_BEAT_UP,
-        MOVE_SUCKER_PUNCH,
-        MOVE_HEAD_SMASH,
-        MOVE_IRON_TAIL,
-        MOVE_POISON_TAIL,
-        MOVE_ENDURE,
-        MOVE_CHIP_AWAY,
-        MOVE_VENOM_DRENCH),
-
-    egg_moves(VULPIX,
-        MOVE_FEINT_ATTACK,
-        MOVE_HYPNOSIS,
-        MOVE_FLAIL,
-        MOVE_SPITE,
-        MOVE_DISABLE,
-        MOVE_HOWL,
-        MOVE_HEAT_WAVE,
-        MOVE_FLARE_BLITZ,
-        MOVE_EXTRASENSORY,
-        MOVE_POWER_SWAP,
-        MOVE_SECRET_POWER,
-        MOVE_HEX,
-        MOVE_TAIL_SLAP,
-        MOVE_CAPTIVATE),
-
-    egg_moves(ZUBAT,
-        MOVE_QUICK_ATTACK,
-        MOVE_PURSUIT,
-        MOVE_FEINT_ATTACK,
-        MOVE_GUST,
-        MOVE_WHIRLWIND,
-        MOVE_CURSE,
-        MOVE_NASTY_PLOT,
-        MOVE_HYPNOSIS,
-        MOVE_ZEN_HEADBUTT,
-        MOVE_BRAVE_BIRD,
-        MOVE_GIGA_DRAIN,
-        MOVE_STEEL_WING,
-        MOVE_DEFOG,
-        MOVE_VENOM_DRENCH),
-
-    egg_moves(ODDISH,
-        MOVE_RAZOR_LEAF,
-        MOVE_FLAIL,
-        MOVE_SYNTHESIS,
-        MOVE_CHARM,
-        MOVE_INGRAIN,
-        MOVE_TICKLE,
-        MOVE_TEETER_DANCE,
-        MOVE_SECRET_POWER,
-        MOVE_NATURE_POWER,
-        MOVE_AFTER_YOU,
-        MOVE_STRENGTH_SAP),
-
-    egg_moves(PARAS,
-        MOVE_SCREECH,
-        MOVE_COUNTER,
-        MOVE_PSYBEAM,
-        MOVE_FLAIL,
-        MOVE_SWEET_SCENT,
-        MOVE_PURSUIT,
-        MOVE_METAL_CLAW,
-        MOVE_BUG_BITE,
-        MOVE_CROSS_POISON,
-        MOVE_AGILITY,
-        MOVE_ENDURE,
-        MOVE_NATURAL_GIFT,
-        MOVE_LEECH_SEED,
-        MOVE_WIDE_GUARD,
-        MOVE_ROTOTILLER,
-        MOVE_FELL_STINGER,
-        MOVE_GRASSY_TERRAIN),
-
-    egg_moves(VENONAT,
-        MOVE_BATON_PASS,
-        MOVE_SCREECH,
-        MOVE_GIGA_DRAIN,
-        MOVE_SIGNAL_BEAM,
-        MOVE_AGILITY,
-        MOVE_MORNING_SUN,
-        MOVE_TOXIC_SPIKES,
-        MOVE_BUG_BITE,
-        MOVE_SECRET_POWER,
-        MOVE_SKILL_SWAP,
-        MOVE_RAGE_POWDER),
-
-    egg_moves(DIGLETT,
-        MOVE_FEINT_ATTACK,
-        MOVE_SCREECH,
-        MOVE_ANCIENT_POWER,
-        MOVE_PURSUIT,
-        MOVE_BEAT_UP,
-        MOVE_UPROAR,
-        MOVE_MUD_BOMB,
-        MOVE_ASTONISH,
-        MOVE_REVERSAL,
-        MOVE_HEADBUTT,
-        MOVE_ENDURE,
-        MOVE_FINAL_GAMBIT,
-        MOVE_MEMENTO),
-
-    egg_moves(MEOWTH,
-        MOVE_SPITE,
-        MOVE_CHARM,
-        MOVE_HYPNOSIS,
-        MOVE_AMNESIA,
-        MOVE_ASSIST,
-        MOVE_ODOR_SLEUTH,
-        MOVE_FLAIL,
-        MOVE_LAST_RESORT,
-        MOVE_PUNISHMENT,
-        MOVE_TAIL_WHIP,
-        MOVE_SNATCH,
-        MOVE_IRON_TAIL,
-        MOVE_FOUL_PLAY),
-
-    egg_moves(PSYDUCK,
-        MOVE_HYPNOSIS,
-        MOVE_PSYBEAM,
-        MOVE_FORESIGHT,
-        MOVE_FUTURE_SIGHT,
-        MOVE_CROSS_CHOP,
-        MOVE_REFRESH,
-        MOVE_CONFUSE_RAY,
-        MOVE_YAWN,
-        MOVE_MUD_BOMB,
-        MOVE_ENCORE,
-        MOVE_SECRET_POWER,
-        MOVE_SLEEP_TALK,
-        MOVE_SYNCHRONOISE,
-        MOVE_SIMPLE_BEAM,
-        MOVE_CLEAR_SMOG),
-
-    egg_moves(MANKEY,
-        MOVE_FORESIGHT,
-        MOVE_MEDITATE,
-        MOVE_COUNTER,
-        MOVE_REVERSAL,
-        MOVE_BEAT_UP,
-        MOVE_REVENGE,
-        MOVE_SMELLING_SALTS,
-        MOVE_CLOSE_COMBAT,
-        MOVE_ENCORE,
-        MOVE_FOCUS_PUNCH,
-        MOVE_SLEEP_TALK,
-        MOVE_NIGHT_SLASH,
-        MOVE_POWER_TRIP),
-
-    egg_moves(GROWLITHE,
-        MOVE_BODY_SLAM,
-        MOVE_CRUNCH,
-        MOVE_THRASH,
-        MOVE_FIRE_SPIN,
-        MOVE_HOWL,
-        MOVE_HEAT_WAVE,
-        MOVE_DOUBLE_EDGE,
-        MOVE_FLARE_BLITZ,
-        MOVE_MORNING_SUN,
-        MOVE_COVET,
-        MOVE_IRON_TAIL,
-        MOVE_DOUBLE_KICK,
-        MOVE_CLOSE_COMBAT,
-        MOVE_BURN_UP),
-
-    egg_moves(POLIWAG,
-        MOVE_MIST,
-        MOVE_SPLASH,
-        MOVE_BUBBLE_BEAM,
-        MOVE_HAZE,
-        MOVE_MIND_READER,
-        MOVE_WATER_SPORT,
-        MOVE_ICE_BALL,
-        MOVE_MUD_SHOT,
-        MOVE_REFRESH,
-        MOVE_ENDEAVOR,
-        MOVE_ENCORE,
-        MOVE_ENDURE,
-        MOVE_WATER_PULSE),
-
-    egg_moves(ABRA,
-        MOVE_ENCORE,
-        MOVE_BARRIER,
-        MOVE_KNOCK_OFF,
-        MOVE_FIRE_PUNCH,
-        MOVE_THUNDER_PUNCH,
-        MOVE_ICE_PUNCH,
-        MOVE_POWER_TRICK,
-        MOVE_GUARD_SWAP,
-        MOVE_SKILL_SWAP,
-        MOVE_GUARD_SPLIT,
-        MOVE_PSYCHO_SHIFT,
-        MOVE_ALLY_SWITCH,
-        MOVE_PSYCHIC_TERRAIN),
-
-    egg_moves(MACHOP,
-        MOVE_MEDITATE,
-        MOVE_ROLLING_KICK,
-        MOVE_ENCORE,
-        MOVE_SMELLING_SALTS,
-        MOVE_COUNTER,
-        MOVE_CLOSE_COMBAT,
-        MOVE_FIRE_PUNCH,
-        MOVE_THUNDER_PUNCH,
-        MOVE_ICE_PUNCH,
-        MOVE_BULLET_PUNCH,
-        MOVE_POWER_TRICK,
-        MOVE_HEAVY_SLAM,
-        MOVE_KNOCK_OFF,
-        MOVE_TICKLE,
-        MOVE_QUICK_GUARD),
-
-    egg_moves(BELLSPROUT,
-        MOVE_ENCORE,
-        MOVE_SYNTHESIS,
-        MOVE_LEECH_LIFE,
-        MOVE_INGRAIN,
-        MOVE_MAGICAL_LEAF,
-        MOVE_WORRY_SEED,
-        MOVE_TICKLE,
-        MOVE_WEATHER_BALL,
-        MOVE_BULLET_SEED,
-        MOVE_NATURAL_GIFT,
-        MOVE_GIGA_DRAIN,
-        MOVE_CLEAR_SMOG,
-        MOVE_POWER_WHIP,
-        MOVE_ACID_SPRAY,
-        MOVE_BELCH,
-        MOVE_STRENGTH_SAP),
-
-    egg_moves(TENTACOOL,
-        MOVE_AURORA_BEAM,
-        MOVE_MIRROR_COAT,
-        MOVE_RAPID_SPIN,
-        MOVE_HAZE,
-        MOVE_CONFUSE_RAY,
-        MOVE_KNOCK_OFF,
-        MOVE_ACUPRESSURE,
-        MOVE_MUDDY_WATER,
-        MOVE_BUBBLE,
-        MOVE_AQUA_RING,
-        MOVE_TICKLE),
-
-    egg_moves(GEODUDE,
-        MOVE_MEGA_PUNCH,
-        MOVE_BLOCK,
-        MOVE_HAMMER_ARM,
-        MOVE_FLAIL,
-        MOVE_CURSE,
-        MOVE_FOCUS_PUNCH,
-        MOVE_ROCK_CLIMB,
-        MOVE_ENDURE,
-        MOVE_AUTOTOMIZE,
-        MOVE_WIDE_GUARD),
-
-    egg_moves(PONYTA,
-        MOVE_FLAME_WHEEL,
-        MOVE_THRASH,
-        MOVE_DOUBLE_KICK,
-        MOVE_HYPNOSIS,
-        MOVE_CHARM,
-        MOVE_DOUBLE_EDGE,
-        MOVE_HORN_DRILL,
-        MOVE_MORNING_SUN,
-        MOVE_LOW_KICK,
-        MOVE_CAPTIVATE,
-        MOVE_ALLY_SWITCH,
-        MOVE_HIGH_HORSEPOWER),
-
-    egg_moves(SLOWPOKE,
-        MOVE_BELLY_DRUM,
-        MOVE_FUTURE_SIGHT,
-        MOVE_STOMP,
-        MOVE_MUD_SPORT,
-        MOVE_SLEEP_TALK,
-        MOVE_SNORE,
-        MOVE_ME_FIRST,
-        MOVE_BLOCK,
-        MOVE_ZEN_HEADBUTT,
-        MOVE_WONDER_ROOM,
-        MOVE_BELCH),
-
-    egg_moves(FARFETCHD,
-        MOVE_STEEL_WING,
-        MOVE_FORESIGHT,
-        MOVE_MIRROR_MOVE,
-        MOVE_GUST,
-        MOVE_QUICK_ATTACK,
-        MOVE_FLAIL,
-        MOVE_FEATHER_DANCE,
-        MOVE_CURSE,
-        MOVE_COVET,
-        MOVE_MUD_SLAP,
-        MOVE_NIGHT_SLASH,
-        MOVE_LEAF_BLADE,
-        MOVE_REVENGE,
-        MOVE_ROOST,
-        MOVE_TRUMP_CARD,
-        MOVE_SIMPLE_BEAM,
-        MOVE_FIRST_IMPRESSION,
-        MOVE_FINAL_GAMBIT),
-
-    egg_moves(DODUO,
-        MOVE_QUICK_ATTACK,
-        MOVE_SUPERSONIC,
-        MOVE_HAZE,
-        MOVE_FEINT_ATTACK,
-        MOVE_FLAIL,
-        MOVE_ENDEAVOR,
-        MOVE_MIRROR_MOVE,
-        MOVE_BRAVE_BIRD,
-        MOVE_NATURAL_GIFT,
-        MOVE_ASSURANCE),
-
-    egg_moves(SEEL,
-        MOVE_LICK,
-        MOVE_PERISH_SONG,
-        MOVE_DISABLE,
-        MOVE_HORN_DRILL,
-        MOVE_SLAM,
-        MOVE_ENCORE,
-        MOVE_FAKE_OUT,
-        MOVE_ICICLE_SPEAR,
-        MOVE_SIGNAL_BEAM,
-        MOVE_STOCKPILE,
-        MOVE_SWALLOW,
-        MOVE_SPIT_UP,
-        MOVE_WATER_PULSE,
-        MOVE_IRON_TAIL,
-        MOVE_SLEEP_TALK,
-        MOVE_BELCH,
-        MOVE_ENTRAINMENT),
-
-    egg_moves(GRIMER,
-        MOVE_HAZE,
-        MOVE_MEAN_LOOK,
-        MOVE_LICK,
-        MOVE_IMPRISON,
-        MOVE_CURSE,
-        MOVE_SHADOW_PUNCH,
-        MOVE_SHADOW_SNEAK,
-        MOVE_STOCKPILE,
-        MOVE_SWALLOW,
-        MOVE_SPIT_UP,
-        MOVE_SCARY_FACE,
-        MOVE_ACID_SPRAY,
-        MOVE_POWER_UP_PUNCH),
-
-    egg_moves(SHELLDER,
-        MOVE_BUBBLE_BEAM,
-        MOVE_TAKE_DOWN,
-        MOVE_BARRIER,
-        MOVE_RAPID_SPIN,
-        MOVE_SCREECH,
-        MOVE_ICICLE_SPEAR,
-        MOVE_MUD_SHOT,
-        MOVE_ROCK_BLAST,
-        MOVE_WATER_PULSE,
-        MOVE_AQUA_RING,
-        MOVE_AVALANCHE,
-        MOVE_TWINEEDLE),
-
-    egg_moves(GASTLY,
-        MOVE_PSYWAVE,
-        MOVE_PERISH_SONG,
-        MOVE_HAZE,
-        MOVE_ASTONISH,
-        MOVE_GRUDGE,
-        MOVE_FIRE_PUNCH,
-        MOVE_ICE_PUNCH,
-        MOVE_THUNDER_PUNCH,
-        MOVE_DISABLE,
-        MOVE_SCARY_FACE,
-        MOVE_CLEAR_SMOG,
-        MOVE_SMOG,
-        MOVE_REFLECT_TYPE),
-
-    egg_moves(ONIX,
-        MOVE_FLAIL,
-        MOVE_BLOCK,
-        MOVE_DEFENSE_CURL,
-        MOVE_ROLLOUT,
-        MOVE_ROCK_BLAST,
-        MOVE_ROCK_CLIMB,
-        MOVE_HEAVY_SLAM,
-        MOVE_STEALTH_ROCK,
-        MOVE_ROTOTILLER,
-        MOVE_WIDE_GUARD),
-
-    egg_moves(DROWZEE,
-        MOVE_BARRIER,
-        MOVE_ASSIST,
-        MOVE_ROLE_PLAY,
-        MOVE_FIRE_PUNCH,
-        MOVE_THUNDER_PUNCH,
-        MOVE_ICE_PUNCH,
-        MOVE_NASTY_PLOT,
-        MOVE_FLATTER,
-        MOVE_PSYCHO_CUT,
-        MOVE_GUARD_SWAP,
-        MOVE_SECRET_POWER,
-        MOVE_SKILL_SWAP,
-        MOVE_POWER_SPLIT,
-        MOVE_PSYCHIC_TERRAIN),
-
-    egg_moves(KRABBY,
-        MOVE_HAZE,
-        MOVE_AMNESIA,
-        MOVE_FLAIL,
-        MOVE_SLAM,
-        MOVE_KNOCK_OFF,
-        MOVE_TICKLE,
-        MOVE_ANCIENT_POWER,
-        MOVE_AGILITY,
-        MOVE_ENDURE,
-        MOVE_CHIP_AWAY,
-        MOVE_BIDE,
-        MOVE_ALLY_SWITCH),
-
-    egg_moves(EXEGGCUTE,
-        MOVE_SYNTHESIS,
-        MOVE_MOONLIGHT,
-        MOVE_ANCIENT_POWER,
-        MOVE_INGRAIN,
-        MOVE_CURSE,
-        MOVE_NATURE_POWER,
-        MOVE_LUCKY_CHANT,
-        MOVE_LEAF_STORM,
-        MOVE_POWER_SWAP,
-        MOVE_GIGA_DRAIN,
-        MOVE_SKILL_SWAP,
-        MOVE_NATURAL_GIFT,
-        MOVE_BLOCK,
-        MOVE_GRASSY_TERRAIN),
-
-    egg_moves(CUBONE,
-        MOVE_ANCIENT_POWER,
-        MOVE_BELLY_DRUM,
-        MOVE_SCREECH,
-        MOVE_SKULL_BASH,
-        MOVE_PERISH_SONG,
-        MOVE_DOUBLE_KICK,
-        MOVE_IRON_HEAD,
-        MOVE_DETECT,
-        MOVE_ENDURE,
-        MOVE_CHIP_AWAY,
-        MOVE_CURSE),
-
-    egg_moves(LICKITUNG,
-        MOVE_BELLY_DRUM,
-        MOVE_MAGNITUDE,
-        MOVE_BODY_SLAM,
-        MOVE_CURSE,
-        MOVE_SMELLING_SALTS,
-        MOVE_SLEEP_TALK,
-        MOVE_SNORE,
-        MOVE_AMNESIA,
-        MOVE_HAMMER_ARM,
-        MOVE_MUDDY_WATER,
-        MOVE_ZEN_HEADBUTT,
-        MOVE_BELCH,
-        MOVE_THRASH),
-
-    egg_moves(KOFFING,
-        MOVE_SCREECH,
-        MOVE_PSYWAVE,
-        MOVE_PSYBEAM,
-        MOVE_DESTINY_BOND,
-        MOVE_PAIN_SPLIT,
-        MOVE_GRUDGE,
-        MOVE_SPITE,
-        MOVE_CURSE,
-        MOVE_STOCKPILE,
-        MOVE_SWALLOW,
-        MOVE_SPIT_UP,
-        MOVE_TOXIC_SPIKES,
-        MOVE_VENOM_DRENCH),
-
-    egg_moves(RHYHORN,
-        MOVE_CRUNCH,
-        MOVE_REVERSAL,
-        MOVE_COUNTER,
-        MOVE_MAGNITUDE,
-        MOVE_CURSE,
-        MOVE_CRUSH_CLAW,
-        MOVE_DRAGON_RUSH,
-        MOVE_ICE_FANG,
-        MOVE_FIRE_FANG,
-        MOVE_THUNDER_FANG,
-        MOVE_SKULL_BASH,
-        MOVE_IRON_TAIL,
-        MOVE_ROCK_CLIMB,
-        MOVE_ROTOTILLER,
-        MOVE_METAL_BURST,
-        MOVE_GUARD_SPLIT),
-
-    egg_moves(CHANSEY,
-        MOVE_PRESENT,
-        MOVE_METRONOME,
-        MOVE_HEAL_BELL,
-        MOVE_AROMATHERAPY,
-        MOVE_COUNTER,
-        MOVE_HELPING_HAND,
-        MOVE_GRAVITY,
-        MOVE_MUD_BOMB,
-        MOVE_NATURAL_GIFT,
-        MOVE_ENDURE,
-        MOVE_SEISMIC_TOSS),
-
-    egg_moves(TANGELA,
-        MOVE_FLAIL,
-        MOVE_CONFUSION,
-        MOVE_MEGA_DRAIN,
-        MOVE_AMNESIA,
-        MOVE_LEECH_SEED,
-        MOVE_NATURE_POWER,
-        MOVE_ENDEAVOR,
-        MOVE_LEAF_STORM,
-        MOVE_POWER_SWAP,
-        MOVE_GIGA_DRAIN,
-        MOVE_RAGE_POWDER,
-        MOVE_NATURAL_GIFT,
-        MOVE_WAKE_UP_SLAP),
-
-    egg_moves(KANGASKHAN,
-        MOVE_STOMP,
-        MOVE_FORESIGHT,
-        MOVE_FOCUS_ENERGY,
-        MOVE_DISABLE,
-        MOVE_COUNTER,
-        MOVE_CRUSH_CLAW,
-        MOVE_DOUBLE_EDGE,
-        MOVE_ENDEAVOR,
-        MOVE_HAMMER_ARM,
-        MOVE_FOCUS_PUNCH,
-        MOVE_TRUMP_CARD,
-        MOVE_UPROAR,
-        MOVE_CIRCLE_THROW),
-
-    egg_moves(HORSEA,
-        MOVE_FLAIL,
-        MOVE_AURORA_BEAM,
-        MOVE_OCTAZOOKA,
-        MOVE_DISABLE,
-        MOVE_SPLASH,
-        MOVE_DRAGON_RAGE,
-        MOVE_DRAGON_BREATH,
-        MOVE_SIGNAL_BEAM,
-        MOVE_RAZOR_WIND,
-        MOVE_MUDDY_WATER,
-        MOVE_WATER_PULSE,
-        MOVE_CLEAR_SMOG,
-        MOVE_OUTRAGE),
-
-    egg_moves(GOLDEEN,
-        MOVE_PSYBEAM,
-        MOVE_HAZE,
-        MOVE_HYDRO_PUMP,
-        MOVE_SLEEP_TALK,
-        MOVE_MUD_SPORT,
-        MOVE_MUD_SLAP,
-        MOVE_AQUA_TAIL,
-        MOVE_BODY_SLAM,
-        MOVE_MUD_SHOT,
-        MOVE_SKULL_BASH,
-        MOVE_SIGNAL_BEAM),
-
-    egg_moves(MR_MIME,
-        MOVE_FUTURE_SIGHT,
-        MOVE_HYPNOSIS,
-        MOVE_MIMIC,
-        MOVE_FAKE_OUT,
-        MOVE_TRICK,
-        MOVE_CONFUSE_RAY,
-        MOVE_WAKE_UP_SLAP,
-        MOVE_TEETER_DANCE,
-        MOVE_NASTY_PLOT,
-        MOVE_POWER_SPLIT,
-        MOVE_MAGIC_ROOM,
-        MOVE_ICY_WIND,
-        MOVE_PSYCHIC_TERRAIN),
-
-    egg_moves(SCYTHER,
-        MOVE_COUNTER,
-        MOVE_BATON_PASS,
-        MOVE_RAZOR_WIND,
-        MOVE_REVERSAL,
-        MOVE_ENDURE,
-        MOVE_SILVER_WIND,
-        MOVE_BUG_BUZZ,
-        MOVE_NIGHT_SLASH,
-        MOVE_DEFOG,
-        MOVE_STEEL_WING,
-        MOVE_QUICK_GUARD),
-
-    egg_moves(PINSIR,
-        MOVE_FURY_ATTACK,
-        MOVE_FLAIL,
-        MOVE_FEINT_ATTACK,
-        MOVE_QUICK_ATTACK,
-        MOVE_CLOSE_COMBAT,
-        MOVE_FEINT,
-        MOVE_ME_FIRST,
-        MOVE_BUG_BITE,
-        MOVE_SUPERPOWER),
-
-    egg_moves(LAPRAS,
-        MOVE_FORESIGHT,
-        MOVE_TICKLE,
-        MOVE_REFRESH,
-        MOVE_DRAGON_DANCE,
-        MOVE_CURSE,
-        MOVE_SLEEP_TALK,
-        MOVE_HORN_DRILL,
-        MOVE_ANCIENT_POWER,
-        MOVE_WHIRLPOOL,
-        MOVE_FISSURE,
-        MOVE_DRAGON_PULSE,
-        MOVE_AVALANCHE,
-        MOVE_FUTURE_SIGHT,
-        MOVE_FREEZE_DRY),
-
-    egg_moves(EEVEE,
-        MOVE_CHARM,
-        MOVE_FLAIL,
-        MOVE_ENDURE,
-        MOVE_CURSE,
-        MOVE_TICKLE,
-        MOVE_WISH,
-        MOVE_YAWN,
-        MOVE_FAKE_TEARS,
-        MOVE_COVET,
-        MOVE_DETECT,
-        MOVE_NATURAL_GIFT,
-        MOVE_STORED_POWER,
-        MOVE_SYNCHRONOISE,
-        MOVE_CAPTIVATE),
-
-    egg_moves(OMANYTE,
-        MOVE_BUBBLE_BEAM,
-        MOVE_AURORA_BEAM,
-        MOVE_SLAM,
-        MOVE_SUPERSONIC,
-        MOVE_HAZE,
-        MOVE_SPIKES,
-        MOVE_KNOCK_OFF,
-        MOVE_WRING_OUT,
-        MOVE_TOXIC_SPIKES,
-        MOVE_MUDDY_WATER,
-        MOVE_BIDE,
-        MOVE_WATER_PULSE,
-        MOVE_WHIRLPOOL,
-        MOVE_REFLECT_TYPE),
-
-    egg_moves(KABUTO,
-        MOVE_BUBBLE_BEAM,
-        MOVE_AURORA_BEAM,
-        MOVE_RAPID_SPIN,
-        MOVE_FLAIL,
-        MOVE_KNOCK_OFF,
-        MOVE_CONFUSE_RAY,
-        MOVE_MUD_SHOT,
-        MOVE_ICY_WIND,
-        MOVE_SCREECH,
-        MOVE_GIGA_DRAIN,
-        MOVE_FORESIGHT,
-        MOVE_TAKE_DOWN),
-
-    egg_moves(AERODACTYL,
-        MOVE_WHIRLWIND,
-        MOVE_PURSUIT,
-        MOVE_FORESIGHT,
-        MOVE_STEEL_WING,
-        MOVE_DRAGON_BREATH,
-        MOVE_CURSE,
-        MOVE_ASSURANCE,
-        MOVE_ROOST,
-        MOVE_TAILWIND,
-        MOVE_WIDE_GUARD),
-
-    egg_moves(SNORLAX,
-        MOVE_LICK,
-        MOVE_CHARM,
-        MOVE_DOUBLE_EDGE,
-        MOVE_CURSE,
-        MOVE_FISSURE,
-        MOVE_WHIRLWIND,
-        MOVE_PURSUIT,
-        MOVE_COUNTER,
-        MOVE_NATURAL_GIFT,
-        MOVE_AFTER_YOU,
-        MOVE_BELCH,
-        MOVE_POWER_UP_PUNCH),
-
-    egg_moves(DRATINI,
-        MOVE_MIST,
-        MOVE_HAZE,
-        MOVE_SUPERSONIC,
-        MOVE_DRAGON_BREATH,
-        MOVE_DRAGON_DANCE,
-        MOVE_DRAGON_RUSH,
-        MOVE_EXTREME_SPEED,
-        MOVE_WATER_PULSE,
-        MOVE_AQUA_JET,
-        MOVE_DRAGON_PULSE,
-        MOVE_IRON_TAIL),
-
-    egg_moves(CHIKORITA,
-        MOVE_VINE_WHIP,
-        MOVE_LEECH_SEED,
-        MOVE_COUNTER,
-        MOVE_ANCIENT_POWER,
-        MOVE_FLAIL,
-        MOVE_NATURE_POWER,
-        MOVE_INGRAIN,
-        MOVE_GRASS_WHISTLE,
-        MOVE_LEAF_STORM,
-        MOVE_AROMATHERAPY,
-        MOVE_WRING_OUT,
-        MOVE_BODY_SLAM,
-        MOVE_REFRESH,
-        MOVE_HEAL_PULSE,
-        MOVE_GRASSY_TERRAIN),
-
-    egg_moves(CYNDAQUIL,
-        MOVE_FURY_SWIPES,
-        MOVE_QUICK_ATTACK,
-        MOVE_REVERSAL,
-        MOVE_THRASH,
-        MOVE_FORESIGHT,
-        MOVE_COVET,
-        MOVE_HOWL,
-        MOVE_CRUSH_CLAW,
-        MOVE_DOUBLE_EDGE,
-        MOVE_DOUBLE_KICK,
-        MOVE_FLARE_BLITZ,
-        MOVE_EXTRASENSORY,
-        MOVE_NATURE_POWER,
-        MOVE_FLAME_BURST),
-
-    egg_moves(TOTODILE,
-        MOVE_CRUNCH,
-        MOVE_THRASH,
-        MOVE_HYDRO_PUMP,
-        MOVE_ANCIENT_POWER,
-        MOVE_MUD_SPORT,
-        MOVE_WATER_SPORT,
-        MOVE_ICE_PUNCH,
-        MOVE_METAL_CLAW,
-        MOVE_DRAGON_DANCE,
-        MOVE_AQUA_JET,
-        MOVE_FAKE_TEARS,
-        MOVE_BLOCK,
-        MOVE_WATER_PULSE,
-        MOVE_FLATTER),
-
-    egg_moves(SENTRET,
-        MOVE_DOUBLE_EDGE,
-        MOVE_PURSUIT,
-        MOVE_SLASH,
-        MOVE_FOCUS_ENERGY,
-        MOVE_REVERSAL,
-        MOVE_TRICK,
-        MOVE_ASSIST,
-        MOVE_LAST_RESORT,
-        MOVE_CHARM,
-        MOVE_COVET,
-        MOVE_NATURAL_GIFT,
-        MOVE_IRON_TAIL,
-        MOVE_CAPTIVATE,
-        MOVE_BABY_DOLL_EYES),
-
-    egg_moves(HOOTHOOT,
-        MOVE_MIRROR_MOVE,
-        MOVE_SUPERSONIC,
-        MOVE_FEINT_ATTACK,
-        MOVE_WING_ATTACK,
-        MOVE_WHIRLWIND,
-        MOVE_SKY_ATTACK,
-        MOVE_FEATHER_DANCE,
-        MOVE_AGILITY,
-        MOVE_NIGHT_SHADE,
-        MOVE_DEFOG,
-        MOVE_MEAN_LOOK,
-        MOVE_HURRICANE),
-
-    egg_moves(LEDYBA,
-        MOVE_PSYBEAM,
-        MOVE_BIDE,
-        MOVE_SILVER_WIND,
-        MOVE_BUG_BUZZ,
-        MOVE_SCREECH,
-        MOVE_ENCORE,
-        MOVE_KNOCK_OFF,
-        MOVE_BUG_BITE,
-        MOVE_FOCUS_PUNCH,
-        MOVE_DRAIN_PUNCH,
-        MOVE_DIZZY_PUNCH,
-        MOVE_TAILWIND,
-        MOVE_ENDURE,
-        MOVE_COUNTER),
-
-    egg_moves(SPINARAK,
-        MOVE_PSYBEAM,
-        MOVE_DISABLE,
-        MOVE_SONIC_BOOM,
-        MOVE_BATON_PASS,
-        MOVE_PURSUIT,
-        MOVE_SIGNAL_BEAM,
-        MOVE_TOXIC_SPIKES,
-        MOVE_TWINEEDLE,
-        MOVE_ELECTROWEB,
-        MOVE_RAGE_POWDER,
-        MOVE_NIGHT_SLASH,
-        MOVE_MEGAHORN,
-        MOVE_LUNGE),
-
-    egg_moves(CHINCHOU,
-        MOVE_FLAIL,
-        MOVE_SCREECH,
-        MOVE_AMNESIA,
-        MOVE_PSYBEAM,
-        MOVE_WHIRLPOOL,
-        MOVE_AGILITY,
-        MOVE_MIST,
-        MOVE_SHOCK_WAVE,
-        MOVE_BRINE,
-        MOVE_WATER_PULSE,
-        MOVE_SOAK),
-
-    egg_moves(PICHU,
-        MOVE_REVERSAL,
-        MOVE_BIDE,
-        MOVE_PRESENT,
-        MOVE_ENCORE,
-        MOVE_DOUBLE_SLAP,
-        MOVE_WISH,
-        MOVE_CHARGE,
-        MOVE_FAKE_OUT,
-        MOVE_THUNDER_PUNCH,
-        MOVE_TICKLE,
-        MOVE_FLAIL,
-        MOVE_ENDURE,
-        MOVE_LUCKY_CHANT,
-        MOVE_BESTOW,
-        MOVE_DISARMING_VOICE,
-        MOVE_ELECTRIC_TERRAIN),
-
-    egg_moves(CLEFFA,
-        MOVE_PRESENT,
-        MOVE_METRONOME,
-        MOVE_AMNESIA,
-        MOVE_BELLY_DRUM,
-        MOVE_SPLASH,
-        MOVE_MIMIC,
-        MOVE_WISH,
-        MOVE_FAKE_TEARS,
-        MOVE_COVET,
-        MOVE_AROMATHERAPY,
-        MOVE_STORED_POWER,
-        MOVE_TICKLE,
-        MOVE_MISTY_TERRAIN,
-        MOVE_HEAL_PULSE),
-
-    egg_moves(IGGLYBUFF,
-        MOVE_PERISH_SONG,
-        MOVE_PRESENT,
-        MOVE_FEINT_ATTACK,
-        MOVE_WISH,
-        MOVE_FAKE_TEARS,
-        MOVE_LAST_RESORT,
-        MOVE_COVET,
-        MOVE_GRAVITY,
-        MOVE_SLEEP_TALK,
-        MOVE_CAPTIVATE,
-        MOVE_PUNISHMENT,
-        MOVE_MISTY_TERRAIN,
-        MOVE_HEAL_PULSE),
-
-    egg_moves(TOGEPI,
-        MOVE_PRESENT,
-        MOVE_MIRROR_MOVE,
-        MOVE_PECK,
-        MOVE_FORESIGHT,
-        MOVE_FUTURE_SIGHT,
-        MOVE_NASTY_PLOT,
-        MOVE_PSYCHO_SHIFT,
-        MOVE_LUCKY_CHANT,
-        MOVE_EXTRASENSORY,
-        MOVE_SECRET_POWER,
-        MOVE_STORED_POWER,
-        MOVE_MORNING_SUN),
-
-    egg_moves(NATU,
-        MOVE_HAZE,
-        MOVE_DRILL_PECK,
-        MOVE_QUICK_ATTACK,
-        MOVE_FEINT_ATTACK,
-        MOVE_STEEL_WING,
-        MOVE_FEATHER_DANCE,
-        MOVE_REFRESH,
-        MOVE_ZEN_HEADBUTT,
-        MOVE_SUCKER_PUNCH,
-        MOVE_SYNCHRONOISE,
-        MOVE_ROOST,
-        MOVE_SKILL_SWAP,
-        MOVE_SIMPLE_BEAM,
-        MOVE_ALLY_SWITCH),
-
-    egg_moves(MAREEP,
-        MOVE_TAKE_DOWN,
-        MOVE_BODY_SLAM,
-        MOVE_SCREECH,
-        MOVE_ODOR_SLEUTH,
-        MOVE_CHARGE,
-        MOVE_FLATTER,
-        MOVE_SAND_ATTACK,
-        MOVE_IRON_TAIL,
-        MOVE_AFTER_YOU,
-        MOVE_AGILITY,
-        MOVE_EERIE_IMPULSE,
-        MOVE_ELECTRIC_TERRAIN),
-
-    egg_moves(MARILL,
-        MOVE_PRESENT,
-        MOVE_AMNESIA,
-        MOVE_FUTURE_SIGHT,
-        MOVE_BELLY_DRUM,
-        MOVE_PERISH_SONG,
-        MOVE_SUPERSONIC,
-        MOVE_AQUA_JET,
-        MOVE_SUPERPOWER,
-        MOVE_REFRESH,
-        MOVE_BODY_SLAM,
-        MOVE_WATER_SPORT,
-        MOVE_MUDDY_WATER,
-        MOVE_CAMOUFLAGE),
-
-    egg_moves(SUDOWOODO,
-        MOVE_SELF_DESTRUCT,
-        MOVE_HEADBUTT,
-        MOVE_HARDEN,
-        MOVE_DEFENSE_CURL,
-        MOVE_ROLLOUT,
-        MOVE_SAND_TOMB,
-        MOVE_STEALTH_ROCK,
-        MOVE_CURSE,
-        MOVE_ENDURE),
-
-    egg_moves(HOPPIP,
-        MOVE_CONFUSION,
-        MOVE_ENCORE,
-        MOVE_DOUBLE_EDGE,
-        MOVE_AMNESIA,
-        MOVE_HELPING_HAND,
-        MOVE_AROMATHERAPY,
-        MOVE_WORRY_SEED,
-        MOVE_COTTON_GUARD,
-        MOVE_SEED_BOMB,
-        MOVE_ENDURE,
-        MOVE_GRASSY_TERRAIN,
-        MOVE_STRENGTH_SAP),
-
-    egg_moves(AIPOM,
-        MOVE_COUNTER,
-        MOVE_SCREECH,
-        MOVE_PURSUIT,
-        MOVE_AGILITY,
-        MOVE_SPITE,
-        MOVE_SLAM,
-        MOVE_DOUBLE_SLAP,
-        MOVE_BEAT_UP,
-        MOVE_FAKE_OUT,
-        MOVE_COVET,
-        MOVE_BOUNCE,
-        MOVE_REVENGE,
-        MOVE_SWITCHEROO,
-        MOVE_QUICK_GUARD,
-        MOVE_TAIL_SLAP),
-
-    egg_moves(SUNKERN,
-        MOVE_GRASS_WHISTLE,
-        MOVE_ENCORE,
-        MOVE_LEECH_SEED,
-        MOVE_NATURE_POWER,
-        MOVE_CURSE,
-        MOVE_HELPING_HAND,
-        MOVE_INGRAIN,
-        MOVE_SWEET_SCENT,
-        MOVE_ENDURE,
-        MOVE_BIDE,
-        MOVE_NATURAL_GIFT,
-        MOVE_MORNING_SUN,
-        MOVE_GRASSY_TERRAIN),
-
-    egg_moves(YANMA,
-        MOVE_WHIRLWIND,
-        MOVE_REVERSAL,
-        MOVE_LEECH_LIFE,
-        MOVE_SIGNAL_BEAM,
-        MOVE_SILVER_WIND,
-        MOVE_FEINT,
-        MOVE_FEINT_ATTACK,
-        MOVE_PURSUIT,
-        MOVE_DOUBLE_EDGE,
-        MOVE_SECRET_POWER),
-
-    egg_moves(WOOPER,
-        MOVE_BODY_SLAM,
-        MOVE_ANCIENT_POWER,
-        MOVE_CURSE,
-        MOVE_MUD_SPORT,
-        MOVE_STOCKPILE,
-        MOVE_SWALLOW,
-        MOVE_SPIT_UP,
-        MOVE_COUNTER,
-        MOVE_ENCORE,
-        MOVE_DOUBLE_KICK,
-        MOVE_RECOVER,
-        MOVE_AFTER_YOU,
-        MOVE_SLEEP_TALK,
-        MOVE_ACID_SPRAY,
-        MOVE_GUARD_SWAP,
-        MOVE_EERIE_IMPULSE,
-        MOVE_POWER_UP_PUNCH),
-
-    egg_moves(MURKROW,
-        MOVE_WHIRLWIND,
-        MOVE_DRILL_PECK,
-        MOVE_MIRROR_MOVE,
-        MOVE_WING_ATTACK,
-        MOVE_SKY_ATTACK,
-        MOVE_CONFUSE_RAY,
-        MOVE_FEATHER_DANCE,
-        MOVE_PERISH_SONG,
-        MOVE_PSYCHO_SHIFT,
-        MOVE_SCREECH,
-        MOVE_FEINT_ATTACK,
-        MOVE_BRAVE_BIRD,
-        MOVE_ROOST,
-        MOVE_ASSURANCE,
-        MOVE_FLATTER,
-        MOVE_PUNISHMENT),
-
-    egg_moves(MISDREAVUS,
-        MOVE_SCREECH,
-        MOVE_DESTINY_BOND,
-        MOVE_IMPRISON,
-        MOVE_MEMENTO,
-        MOVE_SUCKER_PUNCH,
-        MOVE_SHADOW_SNEAK,
-        MOVE_CURSE,
-        MOVE_SPITE,
-        MOVE_OMINOUS_WIND,
-        MOVE_NASTY_PLOT,
-        MOVE_SKILL_SWAP,
-        MOVE_WONDER_ROOM,
-        MOVE_ME_FIRST),
-
-    egg_moves(GIRAFARIG,
-        MOVE_TAKE_DOWN,
-        MOVE_AMNESIA,
-        MOVE_FORESIGHT,
-        MOVE_FUTURE_SIGHT,
-        MOVE_BEAT_UP,
-        MOVE_WISH,
-        MOVE_MAGIC_COAT,
-        MOVE_DOUBLE_KICK,
-        MOVE_MIRROR_COAT,
-        MOVE_RAZOR_WIND,
-        MOVE_SKILL_SWAP,
-        MOVE_SECRET_POWER,
-        MOVE_MEAN_LOOK,
-        MOVE_PSYCHIC_TERRAIN,
-        MOVE_PSYCHIC_FANGS),
-
-    egg_moves(PINECO,
-        MOVE_PIN_MISSILE,
-        MOVE_FLAIL,
-        MOVE_SWIFT,
-        MOVE_COUNTER,
-        MOVE_SAND_TOMB,
-        MOVE_REVENGE,
-        MOVE_DOUBLE_EDGE,
-        MOVE_TOXIC_SPIKES,
-        MOVE_POWER_TRICK,
-        MOVE_ENDURE,
-        MOVE_STEALTH_ROCK),
-
-    egg_moves(DUNSPARCE,
-        MOVE_BIDE,
-        MOVE_ANCIENT_POWER,
-        MOVE_BITE,
-        MOVE_HEADBUTT,
-        MOVE_ASTONISH,
-        MOVE_CURSE,
-        MOVE_TRUMP_CARD,
-        MOVE_MAGIC_COAT,
-        MOVE_SNORE,
-        MOVE_AGILITY,
-        MOVE_SECRET_POWER,
-        MOVE_SLEEP_TALK,
-        MOVE_HEX),
-
-    egg_moves(GLIGAR,
-        MOVE_METAL_CLAW,
-        MOVE_WING_ATTACK,
-        MOVE_RAZOR_WIND,
-        MOVE_COUNTER,
-        MOVE_SAND_TOMB,
-        MOVE_AGILITY,
-        MOVE_BATON_PASS,
-        MOVE_DOUBLE_EDGE,
-        MOVE_FEINT,
-        MOVE_NIGHT_SLASH,
-        MOVE_CROSS_POISON,
-        MOVE_POWER_TRICK,
-        MOVE_ROCK_CLIMB,
-        MOVE_POISON_TAIL),
-
-    egg_moves(SNUBBULL,
-        MOVE_METRONOME,
-        MOVE_FEINT_ATTACK,
-        MOVE_PRESENT,
-        MOVE_CRUNCH,
-        MOVE_HEAL_BELL,
-        MOVE_SNORE,
-        MOVE_SMELLING_SALTS,
-        MOVE_CLOSE_COMBAT,
-        MOVE_ICE_FANG,
-        MOVE_FIRE_FANG,
-        MOVE_THUNDER_FANG,
-        MOVE_FOCUS_PUNCH,
-        MOVE_DOUBLE_EDGE,
-        MOVE_MIMIC,
-        MOVE_FAKE_TEARS),
-
-    egg_moves(QWILFISH,
-        MOVE_FLAIL,
-        MOVE_HAZE,
-        MOVE_BUBBLE_BEAM,
-        MOVE_SUPERSONIC,
-        MOVE_ASTONISH,
-        MOVE_SIGNAL_BEAM,
-        MOVE_AQUA_JET,
-        MOVE_WATER_PULSE,
-        MOVE_BRINE,
-        MOVE_ACID_SPRAY),
-
-    egg_moves(SHUCKLE,
-        MOVE_SWEET_SCENT,
-        MOVE_KNOCK_OFF,
-        MOVE_HELPING_HAND,
-        MOVE_ACUPRESSURE,
-        MOVE_SAND_TOMB,
-        MOVE_MUD_SLAP,
-        MOVE_ACID,
-        MOVE_ROCK_BLAST,
-        MOVE_FINAL_GAMBIT),
-
-    egg_moves(HERACROSS,
-        MOVE_HARDEN,
-        MOVE_BIDE,
-        MOVE_FLAIL,
-        MOVE_REVENGE,
-        MOVE_PURSUIT,
-        MOVE_DOUBLE_EDGE,
-        MOVE_SEISMIC_TOSS,
-        MOVE_FOCUS_PUNCH,
-        MOVE_MEGAHORN,
-        MOVE_ROCK_BLAST),
-
-    egg_moves(SNEASEL,
-        MOVE_COUNTER,
-        MOVE_SPITE,
-        MOVE_FORESIGHT,
-        MOVE_BITE,
-        MOVE_CRUSH_CLAW,
-        MOVE_FAKE_OUT,
-        MOVE_DOUBLE_HIT,
-        MOVE_PUNISHMENT,
-        MOVE_PURSUIT,
-        MOVE_ICE_SHARD,
-        MOVE_ICE_PUNCH,
-        MOVE_ASSIST,
-        MOVE_AVALANCHE,
-        MOVE_FEINT,
-        MOVE_ICICLE_CRASH,
-        MOVE_THROAT_CHOP),
-
-    egg_moves(TEDDIURSA,
-        MOVE_CRUNCH,
-        MOVE_TAKE_DOWN,
-        MOVE_SEISMIC_TOSS,
-        MOVE_COUNTER,
-        MOVE_METAL_CLAW,
-        MOVE_FAKE_TEARS,
-        MOVE_YAWN,
-        MOVE_SLEEP_TALK,
-        MOVE_CROSS_CHOP,
-        MOVE_DOUBLE_EDGE,
-        MOVE_CLOSE_COMBAT,
-        MOVE_NIGHT_SLASH,
-        MOVE_BELLY_DRUM,
-        MOVE_CHIP_AWAY,
-        MOVE_PLAY_ROUGH),
-
-    egg_moves(SLUGMA,
-        MOVE_ACID_ARMOR,
-        MOVE_HEAT_WAVE,
-        MOVE_CURSE,
-        MOVE_SMOKESCREEN,
-        MOVE_MEMENTO,
-        MOVE_STOCKPILE,
-        MOVE_SPIT_UP,
-        MOVE_SWALLOW,
-        MOVE_ROLLOUT,
-        MOVE_INFERNO,
-        MOVE_EARTH_POWER,
-        MOVE_GUARD_SWAP),
-
-    egg_moves(SWINUB,
-        MOVE_TAKE_DOWN,
-        MOVE_BITE,
-        MOVE_BODY_SLAM,
-        MOVE_ANCIENT_POWER,
-        MOVE_MUD_SHOT,
-        MOVE_ICICLE_SPEAR,
-        MOVE_DOUBLE_EDGE,
-        MOVE_FISSURE,
-        MOVE_CURSE,
-        MOVE_MUD_SHOT,
-        MOVE_AVALANCHE,
-        MOVE_STEALTH_ROCK,
-        MOVE_ICICLE_CRASH,
-        MOVE_FREEZE_DRY),
-
-    egg_moves(CORSOLA,
-        MOVE_SCREECH,
-        MOVE_MIST,
-        MOVE_AMNESIA,
-        MOVE_BARRIER,
-        MOVE_INGRAIN,
-        MOVE_CONFUSE_RAY,
-        MOVE_ICICLE_SPEAR,
-        MOVE_NATURE_POWER,
-        MOVE_AQUA_RING,
-        MOVE_CURSE,
-        MOVE_BIDE,
-        MOVE_WATER_PULSE,
-        MOVE_HEAD_SMASH,
-        MOVE_CAMOUFLAGE,
-        MOVE_LIQUIDATION),
-
-    egg_moves(REMORAID,
-        MOVE_AURORA_BEAM,
-        MOVE_OCTAZOOKA,
-        MOVE_SUPERSONIC,
-        MOVE_HAZE,
-        MOVE_SCREECH,
-        MOVE_ROCK_BLAST,
-        MOVE_SNORE,
-        MOVE_FLAIL,
-        MOVE_WATER_SPOUT,
-        MOVE_MUD_SHOT,
-        MOVE_SWIFT,
-        MOVE_ACID_SPRAY,
-        MOVE_WATER_PULSE,
-        MOVE_ENTRAINMENT),
-
-    egg_moves(DELIBIRD,
-        MOVE_AURORA_BEAM,
-        MOVE_QUICK_ATTACK,
-        MOVE_FUTURE_SIGHT,
-        MOVE_SPLASH,
-        MOVE_RAPID_SPIN,
-        MOVE_ICE_BALL,
-        MOVE_ICE_SHARD,
-        MOVE_ICE_PUNCH,
-        MOVE_FAKE_OUT,
-        MOVE_BESTOW,
-        MOVE_ICY_WIND,
-        MOVE_FREEZE_DRY,
-        MOVE_DESTINY_BOND,
-        MOVE_SPIKES,
-        MOVE_COUNTER),
-
-    egg_moves(MANTINE,
-        MOVE_TWISTER,
-        MOVE_HYDRO_PUMP,
-        MOVE_HAZE,
-        MOVE_SLAM,
-        MOVE_MUD_SPORT,
-        MOVE_MIRROR_COAT,
-        MOVE_WATER_SPORT,
-        MOVE_SPLASH,
-        MOVE_WIDE_GUARD,
-        MOVE_AMNESIA),
-
-    egg_moves(SKARMORY,
-        MOVE_DRILL_PECK,
-        MOVE_PURSUIT,
-        MOVE_WHIRLWIND,
-        MOVE_SKY_ATTACK,
-        MOVE_CURSE,
-        MOVE_BRAVE_BIRD,
-        MOVE_ASSURANCE,
-        MOVE_GUARD_SWAP,
-        MOVE_STEALTH_ROCK,
-        MOVE_ENDURE),
-
-    egg_moves(HOUNDOUR,
-        MOVE_FIRE_SPIN,
-        MOVE_RAGE,
-        MOVE_PURSUIT,
-        MOVE_COUNTER,
-        MOVE_SPITE,
-        MOVE_REVERSAL,
-        MOVE_BEAT_UP,
-        MOVE_FIRE_FANG,
-        MOVE_THUNDER_FANG,
-        MOVE_NASTY_PLOT,
-        MOVE_PUNISHMENT,
-        MOVE_FEINT,
-        MOVE_SUCKER_PUNCH,
-        MOVE_DESTINY_BOND),
-
-    egg_moves(PHANPY,
-        MOVE_FOCUS_ENERGY,
-        MOVE_BODY_SLAM,
-        MOVE_ANCIENT_POWER,
-        MOVE_SNORE,
-        MOVE_COUNTER,
-        MOVE_FISSURE,
-        MOVE_ENDEAVOR,
-        MOVE_ICE_SHARD,
-        MOVE_HEAD_SMASH,
-        MOVE_MUD_SLAP,
-        MOVE_HEAVY_SLAM,
-        MOVE_PLAY_ROUGH,
-        MOVE_HIGH_HORSEPOWER),
-
-    egg_moves(STANTLER,
-        MOVE_SPITE,
-        MOVE_DISABLE,
-        MOVE_BITE,
-        MOVE_EXTRASENSORY,
-        MOVE_THRASH,
-        MOVE_DOUBLE_KICK,
-        MOVE_ZEN_HEADBUTT,
-        MOVE_MEGAHORN,
-        MOVE_MUD_SPORT,
-        MOVE_RAGE,
-        MOVE_ME_FIRST),
-
-    egg_moves(TYROGUE,
-        MOVE_RAPID_SPIN,
-        MOVE_HIGH_JUMP_KICK,
-        MOVE_MACH_PUNCH,
-        MOVE_MIND_READER,
-        MOVE_HELPING_HAND,
-        MOVE_COUNTER,
-        MOVE_VACUUM_WAVE,
-        MOVE_BULLET_PUNCH,
-        MOVE_ENDURE,
-        MOVE_PURSUIT,
-        MOVE_FEINT),
-
-    egg_moves(SMOOCHUM,
-        MOVE_MEDITATE,
-        MOVE_FAKE_OUT,
-        MOVE_WISH,
-        MOVE_ICE_PUNCH,
-        MOVE_MIRACLE_EYE,
-        MOVE_NASTY_PLOT,
-        MOVE_WAKE_UP_SLAP,
-        MOVE_CAPTIVATE),
-
-    egg_moves(ELEKID,
-        MOVE_KARATE_CHOP,
-        MOVE_BARRIER,
-        MOVE_ROLLING_KICK,
-        MOVE_MEDITATE,
-        MOVE_CROSS_CHOP,
-        MOVE_FIRE_PUNCH,
-        MOVE_ICE_PUNCH,
-        MOVE_DYNAMIC_PUNCH,
-        MOVE_FEINT,
-        MOVE_HAMMER_ARM,
-        MOVE_FOCUS_PUNCH),
-
-    egg_moves(MAGBY,
-        MOVE_KARATE_CHOP,
-        MOVE_MEGA_PUNCH,
-        MOVE_BARRIER,
-        MOVE_SCREECH,
-        MOVE_CROSS_CHOP,
-        MOVE_THUNDER_PUNCH,
-        MOVE_MACH_PUNCH,
-        MOVE_DYNAMIC_PUNCH,
-        MOVE_FLARE_BLITZ,
-        MOVE_BELLY_DRUM,
-        MOVE_IRON_TAIL,
-        MOVE_FOCUS_ENERGY,
-        MOVE_POWER_SWAP,
-        MOVE_BELCH),
-
-    egg_moves(MILTANK,
-        MOVE_PRESENT,
-        MOVE_REVERSAL,
-        MOVE_SEISMIC_TOSS,
-        MOVE_ENDURE,
-        MOVE_CURSE,
-        MOVE_HELPING_HAND,
-        MOVE_SLEEP_TALK,
-        MOVE_DIZZY_PUNCH,
-        MOVE_HAMMER_ARM,
-        MOVE_DOUBLE_EDGE,
-        MOVE_PUNISHMENT,
-        MOVE_NATURAL_GIFT,
-        MOVE_HEART_STAMP,
-        MOVE_BELCH),
-
-    egg_moves(LARVITAR,
-        MOVE_PURSUIT,
-        MOVE_STOMP,
-        MOVE_OUTRAGE,
-        MOVE_FOCUS_ENERGY,
-        MOVE_ANCIENT_POWER,
-        MOVE_DRAGON_DANCE,
-        MOVE_CURSE,
-        MOVE_IRON_DEFENSE,
-        MOVE_ASSURANCE,
-        MOVE_IRON_HEAD,
-        MOVE_STEALTH_ROCK,
-        MOVE_IRON_TAIL),
-
-    egg_moves(TREECKO,
-        MOVE_CRUNCH,
-        MOVE_MUD_SPORT,
-        MOVE_ENDEAVOR,
-        MOVE_LEECH_SEED,
-        MOVE_DRAGON_BREATH,
-        MOVE_CRUSH_CLAW,
-        MOVE_WORRY_SEED,
-        MOVE_DOUBLE_KICK,
-        MOVE_GRASS_WHISTLE,
-        MOVE_SYNTHESIS,
-        MOVE_MAGICAL_LEAF,
-        MOVE_LEAF_STORM,
-        MOVE_RAZOR_WIND,
-        MOVE_BULLET_SEED,
-        MOVE_NATURAL_GIFT,
-        MOVE_GRASSY_TERRAIN),
-
-    egg_moves(TORCHIC,
-        MOVE_COUNTER,
-        MOVE_REVERSAL,
-        MOVE_ENDURE,
-        MOVE_SMELLING_SALTS,
-        MOVE_CRUSH_CLAW,
-        MOVE_BATON_PASS,
-        MOVE_AGILITY,
-        MOVE_NIGHT_SLASH,
-        MOVE_LAST_RESORT,
-        MOVE_FEINT,
-        MOVE_FEATHER_DANCE,
-        MOVE_CURSE,
-        MOVE_FLAME_BURST,
-        MOVE_LOW_KICK),
-
-    egg_moves(MUDKIP,
-        MOVE_REFRESH,
-        MOVE_UPROAR,
-        MOVE_CURSE,
-        MOVE_STOMP,
-        MOVE_ICE_BALL,
-        MOVE_MIRROR_COAT,
-        MOVE_COUNTER,
-        MOVE_ANCIENT_POWER,
-        MOVE_WHIRLPOOL,
-        MOVE_BITE,
-        MOVE_DOUBLE_EDGE,
-        MOVE_MUD_BOMB,
-        MOVE_YAWN,
-        MOVE_SLUDGE,
-        MOVE_AVALANCHE,
-        MOVE_WIDE_GUARD,
-        MOVE_BARRIER),
-
-    egg_moves(POOCHYENA,
-        MOVE_ASTONISH,
-        MOVE_POISON_FANG,
-        MOVE_COVET,
-        MOVE_LEER,
-        MOVE_YAWN,
-        MOVE_SUCKER_PUNCH,
-        MOVE_ICE_FANG,
-        MOVE_FIRE_FANG,
-        MOVE_THUNDER_FANG,
-        MOVE_ME_FIRST,
-        MOVE_SNATCH,
-        MOVE_SLEEP_TALK,
-        MOVE_PLAY_ROUGH),
-
-    egg_moves(ZIGZAGOON,
-        MOVE_CHARM,
-        MOVE_PURSUIT,
-        MOVE_TICKLE,
-        MOVE_TRICK,
-        MOVE_HELPING_HAND,
-        MOVE_MUD_SLAP,
-        MOVE_SLEEP_TALK,
-        MOVE_ROCK_CLIMB,
-        MOVE_SIMPLE_BEAM,
-        MOVE_EXTREME_SPEED),
-
-    egg_moves(LOTAD,
-        MOVE_SYNTHESIS,
-        MOVE_RAZOR_LEAF,
-        MOVE_SWEET_SCENT,
-        MOVE_LEECH_SEED,
-        MOVE_FLAIL,
-        MOVE_WATER_GUN,
-        MOVE_TICKLE,
-        MOVE_COUNTER,
-        MOVE_GIGA_DRAIN,
-        MOVE_TEETER_DANCE),
-
-    egg_moves(SEEDOT,
-        MOVE_LEECH_SEED,
-        MOVE_AMNESIA,
-        MOVE_QUICK_ATTACK,
-        MOVE_RAZOR_WIND,
-        MOVE_TAKE_DOWN,
-        MOVE_WORRY_SEED,
-        MOVE_NASTY_PLOT,
-        MOVE_POWER_SWAP,
-        MOVE_DEFOG,
-        MOVE_FOUL_PLAY,
-        MOVE_BEAT_UP,
-        MOVE_BULLET_SEED,
-        MOVE_GRASSY_TERRAIN),
-
-    egg_moves(TAILLOW,
-        MOVE_PURSUIT,
-        MOVE_SUPERSONIC,
-        MOVE_REFRESH,
-        MOVE_MIRROR_MOVE,
-        MOVE_RAGE,
-        MOVE_SKY_ATTACK,
-        MOVE_WHIRLWIND,
-        MOVE_BRAVE_BIRD,
-        MOVE_ROOST,
-        MOVE_STEEL_WING,
-        MOVE_DEFOG,
-        MOVE_BOOMBURST,
-        MOVE_HURRICANE),
-
-    egg_moves(WINGULL,
-        MOVE_MIST,
-        MOVE_TWISTER,
-        MOVE_AGILITY,
-        MOVE_GUST,
-        MOVE_WATER_SPORT,
-        MOVE_AQUA_RING,
-        MOVE_KNOCK_OFF,
-        MOVE_BRINE,
-        MOVE_ROOST,
-        MOVE_SOAK,
-        MOVE_WIDE_GUARD),
-
-    egg_moves(RALTS,
-        MOVE_DISABLE,
-        MOVE_MEAN_LOOK,
-        MOVE_MEMENTO,
-        MOVE_DESTINY_BOND,
-        MOVE_GRUDGE,
-        MOVE_SHADOW_SNEAK,
-        MOVE_CONFUSE_RAY,
-        MOVE_ENCORE,
-        MOVE_SYNCHRONOISE,
-        MOVE_SKILL_SWAP,
-        MOVE_MISTY_TERRAIN,
-        MOVE_ALLY_SWITCH),
-
-    egg_moves(SURSKIT,
-        MOVE_FORESIGHT,
-        MOVE_MUD_SHOT,
-        MOVE_PSYBEAM,
-        MOVE_HYDRO_PUMP,
-        MOVE_MIND_READER,
-        MOVE_SIGNAL_BEAM,
-        MOVE_BUG_BITE,
-        MOVE_AQUA_JET,
-        MOVE_ENDURE,
-        MOVE_FELL_STINGER,
-        MOVE_POWER_SPLIT,
-        MOVE_LUNGE),
-
-    egg_moves(SHROOMISH,
-        MOVE_FAKE_TEARS,
-        MOVE_CHARM,
-        MOVE_HELPING_HAND,
-        MOVE_WORRY_SEED,
-        MOVE_WAKE_UP_SLAP,
-        MOVE_SEED_BOMB,
-        MOVE_BULLET_SEED,
-        MOVE_FOCUS_PUNCH,
-        MOVE_NATURAL_GIFT,
-        MOVE_DRAIN_PUNCH),
-
-    egg_moves(SLAKOTH,
-        MOVE_PURSUIT,
-        MOVE_SLASH,
-        MOVE_BODY_SLAM,
-        MOVE_SNORE,
-        MOVE_CRUSH_CLAW,
-        MOVE_CURSE,
-        MOVE_SLEEP_TALK,
-        MOVE_HAMMER_ARM,
-        MOVE_NIGHT_SLASH,
-        MOVE_AFTER_YOU,
-        MOVE_TICKLE),
-
-    egg_moves(NINCADA,
-        MOVE_ENDURE,
-        MOVE_FEINT_ATTACK,
-        MOVE_GUST,
-        MOVE_SILVER_WIND,
-        MOVE_BUG_BUZZ,
-        MOVE_NIGHT_SLASH,
-        MOVE_BUG_BITE,
-        MOVE_FINAL_GAMBIT),
-
-    egg_moves(WHISMUR,
-        MOVE_TAKE_DOWN,
-        MOVE_SNORE,
-        MOVE_EXTRASENSORY,
-        MOVE_SMELLING_SALTS,
-        MOVE_SMOKESCREEN,
-        MOVE_ENDEAVOR,
-        MOVE_HAMMER_ARM,
-        MOVE_FAKE_TEARS,
-        MOVE_CIRCLE_THROW,
-        MOVE_DISARMING_VOICE,
-        MOVE_WHIRLWIND),
-
-    egg_moves(MAKUHITA,
-        MOVE_FEINT_ATTACK,
-        MOVE_DETECT,
-        MOVE_FORESIGHT,
-        MOVE_HELPING_HAND,
-        MOVE_CROSS_CHOP,
-        MOVE_REVENGE,
-        MOVE_DYNAMIC_PUNCH,
-        MOVE_COUNTER,
-        MOVE_WAKE_UP_SLAP,
-        MOVE_BULLET_PUNCH,
-        MOVE_FEINT,
-        MOVE_WIDE_GUARD,
-        MOVE_FOCUS_PUNCH,
-        MOVE_CHIP_AWAY),
-
-    egg_moves(AZURILL,
-        MOVE_ENCORE,
-        MOVE_SING,
-        MOVE_REFRESH,
-        MOVE_SLAM,
-        MOVE_TICKLE,
-        MOVE_FAKE_TEARS,
-        MOVE_BODY_SLAM,
-        MOVE_WATER_SPORT,
-        MOVE_SOAK,
-        MOVE_MUDDY_WATER,
-        MOVE_COPYCAT,
-        MOVE_CAMOUFLAGE),
-
-    egg_moves(NOSEPASS,
-        MOVE_MAGNITUDE,
-        MOVE_ROLLOUT,
-        MOVE_DOUBLE_EDGE,
-        MOVE_BLOCK,
-        MOVE_STEALTH_ROCK,
-        MOVE_ENDURE,
-        MOVE_WIDE_GUARD),
-
-    egg_moves(SKITTY,
-        MOVE_HELPING_HAND,
-        MOVE_UPROAR,
-        MOVE_FAKE_TEARS,
-        MOVE_WISH,
-        MOVE_BATON_PASS,
-        MOVE_TICKLE,
-        MOVE_LAST_RESORT,
-        MOVE_FAKE_OUT,
-        MOVE_ZEN_HEADBUTT,
-        MOVE_SUCKER_PUNCH,
-        MOVE_MUD_BOMB,
-        MOVE_SIMPLE_BEAM,
-        MOVE_CAPTIVATE,
-        MOVE_COSMIC_POWER),
-
-    egg_moves(SABLEYE,
-        MOVE_RECOVER,
-        MOVE_MOONLIGHT,
-        MOVE_NASTY_PLOT,
-        MOVE_FLATTER,
-        MOVE_FEINT,
-        MOVE_SUCKER_PUNCH,
-        MOVE_TRICK,
-        MOVE_CAPTIVATE,
-        MOVE_MEAN_LOOK,
-        MOVE_METAL_BURST,
-        MOVE_IMPRISON),
-
-    egg_moves(MAWILE,
-        MOVE_POISON_FANG,
-        MOVE_ANCIENT_POWER,
-        MOVE_TICKLE,
-        MOVE_SUCKER_PUNCH,
-        MOVE_ICE_FANG,
-        MOVE_FIRE_FANG,
-        MOVE_THUNDER_FANG,
-        MOVE_PUNISHMENT,
-        MOVE_GUARD_SWAP,
-        MOVE_CAPTIVATE,
-        MOVE_SLAM,
-        MOVE_METAL_BURST,
-        MOVE_MISTY_TERRAIN,
-        MOVE_SEISMIC_TOSS,
-        MOVE_POWER_UP_PUNCH),
-
-    egg_moves(ARON,
-        MOVE_ENDEAVOR,
-        MOVE_BODY_SLAM,
-        MOVE_STOMP,
-        MOVE_SMELLING_SALTS,
-        MOVE_CURSE,
-        MOVE_SCREECH,
-        MOVE_IRON_HEAD,
-        MOVE_DRAGON_RUSH,
-        MOVE_HEAD_SMASH,
-        MOVE_SUPERPOWER,
-        MOVE_STEALTH_ROCK,
-        MOVE_REVERSAL),
-
-    egg_moves(MEDITITE,
-        MOVE_FIRE_PUNCH,
-        MOVE_THUNDER_PUNCH,
-        MOVE_ICE_PUNCH,
-        MOVE_FORESIGHT,
-        MOVE_FAKE_OUT,
-        MOVE_BATON_PASS,
-        MOVE_DYNAMIC_PUNCH,
-        MOVE_POWER_SWAP,
-        MOVE_GUARD_SWAP,
-        MOVE_PSYCHO_CUT,
-        MOVE_BULLET_PUNCH,
-        MOVE_DRAIN_PUNCH,
-        MOVE_SECRET_POWER,
-        MOVE_QUICK_GUARD),
-
-    egg_moves(ELECTRIKE,
-        MOVE_CRUNCH,
-        MOVE_HEADBUTT,
-        MOVE_UPROAR,
-        MOVE_CURSE,
-        MOVE_SWIFT,
-        MOVE_DISCHARGE,
-        MOVE_ICE_FANG,
-        MOVE_FIRE_FANG,
-        MOVE_THUNDER_FANG,
-        MOVE_SWITCHEROO,
-        MOVE_ELECTRO_BALL,
-        MOVE_SHOCK_WAVE,
-        MOVE_FLAME_BURST,
-        MOVE_EERIE_IMPULSE),
-
-    egg_moves(PLUSLE,
-        MOVE_WISH,
-        MOVE_SING,
-        MOVE_SWEET_KISS,
-        MOVE_DISCHARGE,
-        MOVE_LUCKY_CHANT,
-        MOVE_CHARM,
-        MOVE_FAKE_TEARS,
-        MOVE_TEARFUL_LOOK),
-
-    egg_moves(MINUN,
-        MOVE_WISH,
-        MOVE_SING,
-        MOVE_SWEET_KISS,
-        MOVE_DISCHARGE,
-        MOVE_LUCKY_CHANT,
-        MOVE_CHARM,
-        MOVE_FAKE_TEARS,
-        MOVE_TEARFUL_LOOK),
-
-    egg_moves(VOLBEAT,
-        MOVE_BATON_PASS,
-        MOVE_SILVER_WIND,
-        MOVE_TRICK,
-        MOVE_ENCORE,
-        MOVE_BUG_BUZZ,
-        MOVE_DIZZY_PUNCH,
-        MOVE_SEISMIC_TOSS,
-        MOVE_LUNGE),
-
-    egg_moves(ILLUMISE,
-        MOVE_BATON_PASS,
-        MOVE_SILVER_WIND,
-        MOVE_GROWTH,
-        MOVE_ENCORE,
-        MOVE_BUG_BUZZ,
-        MOVE_CAPTIVATE,
-        MOVE_FAKE_TEARS,
-        MOVE_CONFUSE_RAY,
-        MOVE_AROMATHERAPY),
-
-    egg_moves(ROSELIA,
-        MOVE_SPIKES,
-        MOVE_SYNTHESIS,
-        MOVE_PIN_MISSILE,
-        MOVE_COTTON_SPORE,
-        MOVE_SLEEP_POWDER,
-        MOVE_RAZOR_LEAF,
-        MOVE_MIND_READER,
-        MOVE_LEAF_STORM,
-        MOVE_SEED_BOMB,
-        MOVE_GIGA_DRAIN,
-        MOVE_NATURAL_GIFT,
-        MOVE_GRASS_WHISTLE,
-        MOVE_BULLET_SEED,
-        MOVE_POWER_WHIP),
-
-    egg_moves(GULPIN,
-        MOVE_ACID_ARMOR,
-        MOVE_SMOG,
-        MOVE_PAIN_SPLIT,
-        MOVE_CURSE,
-        MOVE_DESTINY_BOND,
-        MOVE_MUD_SLAP,
-        MOVE_GUNK_SHOT,
-        MOVE_VENOM_DRENCH),
-
-    egg_moves(CARVANHA,
-        MOVE_HYDRO_PUMP,
-        MOVE_DOUBLE_EDGE,
-        MOVE_THRASH,
-        MOVE_ANCIENT_POWER,
-        MOVE_SWIFT,
-        MOVE_BRINE,
-        MOVE_DESTINY_BOND,
-        MOVE_PSYCHIC_FANGS),
-
-    egg_moves(WAILMER,
-        MOVE_DOUBLE_EDGE,
-        MOVE_THRASH,
-        MOVE_SNORE,
-        MOVE_SLEEP_TALK,
-        MOVE_CURSE,
-        MOVE_FISSURE,
-        MOVE_TICKLE,
-        MOVE_DEFENSE_CURL,
-        MOVE_BODY_SLAM,
-        MOVE_AQUA_RING,
-        MOVE_SOAK,
-        MOVE_ZEN_HEADBUTT,
-        MOVE_CLEAR_SMOG),
-
-    egg_moves(NUMEL,
-        MOVE_HOWL,
-        MOVE_SCARY_FACE,
-        MOVE_BODY_SLAM,
-        MOVE_ROLLOUT,
-        MOVE_DEFENSE_CURL,
-        MOVE_STOMP,
-        MOVE_YAWN,
-        MOVE_ANCIENT_POWER,
-        MOVE_MUD_BOMB,
-        MOVE_HEAT_WAVE,
-        MOVE_STOCKPILE,
-        MOVE_SWALLOW,
-        MOVE_SPIT_UP,
-        MOVE_ENDURE,
-        MOVE_IRON_HEAD,
-        MOVE_GROWTH,
-        MOVE_HEAVY_SLAM),
-
-    egg_moves(TORKOAL,
-        MOVE_ERUPTION,
-        MOVE_ENDURE,
-        MOVE_SLEEP_TALK,
-        MOVE_YAWN,
-        MOVE_FISSURE,
-        MOVE_SKULL_BASH,
-        MOVE_FLAME_BURST,
-        MOVE_CLEAR_SMOG,
-        MOVE_SUPERPOWER),
-
-    egg_moves(SPOINK,
-        MOVE_FUTURE_SIGHT,
-        MOVE_EXTRASENSORY,
-        MOVE_TRICK,
-        MOVE_ZEN_HEADBUTT,
-        MOVE_AMNESIA,
-        MOVE_MIRROR_COAT,
-        MOVE_SKILL_SWAP,
-        MOVE_WHIRLWIND,
-        MOVE_LUCKY_CHANT,
-        MOVE_ENDURE,
-        MOVE_SIMPLE_BEAM),
-
-    egg_moves(SPINDA,
-        MOVE_ENCORE,
-        MOVE_ASSIST,
-        MOVE_DISABLE,
-        MOVE_BATON_PASS,
-        MOVE_WISH,
-        MOVE_TRICK,
-        MOVE_SMELLING_SALTS,
-        MOVE_FAKE_OUT,
-        MOVE_ROLE_PLAY,
-        MOVE_PSYCHO_CUT,
-        MOVE_FAKE_TEARS,
-        MOVE_RAPID_SPIN,
-        MOVE_ICY_WIND,
-        MOVE_WATER_PULSE,
-        MOVE_PSYCHO_SHIFT,
-        MOVE_GUARD_SPLIT,
-        MOVE_SPOTLIGHT),
-
-    egg_moves(TRAPINCH,
-        MOVE_FOCUS_ENERGY,
-        MOVE_QUICK_ATTACK,
-        MOVE_GUST,
-        MOVE_FLAIL,
-        MOVE_FURY_CUTTER,
-        MOVE_MUD_SHOT,
-        MOVE_ENDURE,
-        MOVE_EARTH_POWER,
-        MOVE_BUG_BITE,
-        MOVE_SIGNAL_BEAM),
-
-    egg_moves(CACNEA,
-        MOVE_GRASS_WHISTLE,
-        MOVE_ACID,
-        MOVE_TEETER_DANCE,
-        MOVE_DYNAMIC_PUNCH,
-        MOVE_COUNTER,
-        MOVE_LOW_KICK,
-        MOVE_SMELLING_SALTS,
-        MOVE_MAGICAL_LEAF,
-        MOVE_SEED_BOMB,
-        MOVE_NASTY_PLOT,
-        MOVE_DISABLE,
-        MOVE_BLOCK,
-        MOVE_WORRY_SEED,
-        MOVE_SWITCHEROO,
-        MOVE_FELL_STINGER,
-        MOVE_BELCH,
-        MOVE_ROTOTILLER,
-        MOVE_POWER_UP_PUNCH),
-
-    egg_moves(SWABLU,
-        MOVE_AGILITY,
-        MOVE_HAZE,
-        MOVE_PURSUIT,
-        MOVE_RAGE,
-        MOVE_FEATHER_DANCE,
-        MOVE_DRAGON_RUSH,
-        MOVE_POWER_SWAP,
-        MOVE_ROOST,
-        MOVE_HYPER_VOICE,
-        MOVE_STEEL_WING,
-        MOVE_PLAY_ROUGH),
-
-    egg_moves(ZANGOOSE,
-        MOVE_FLAIL,
-        MOVE_DOUBLE_KICK,
-        MOVE_RAZOR_WIND,
-        MOVE_COUNTER,
-        MOVE_CURSE,
-        MOVE_FURY_SWIPES,
-        MOVE_NIGHT_SLASH,
-        MOVE_METAL_CLAW,
-        MOVE_DOUBLE_HIT,
-        MOVE_DISABLE,
-        MOVE_IRON_TAIL,
-        MOVE_FINAL_GAMBIT,
-        MOVE_FEINT,
-        MOVE_QUICK_GUARD,
-        MOVE_BELLY_DRUM),
-
-    egg_moves(SEVIPER,
-        MOVE_STOCKPILE,
-        MOVE_SWALLOW,
-        MOVE_SPIT_UP,
-        MOVE_BODY_SLAM,
-        MOVE_SCARY_FACE,
-        MOVE_ASSURANCE,
-        MOVE_NIGHT_SLASH,
-        MOVE_SWITCHEROO,
-        MOVE_IRON_TAIL,
-        MOVE_WRING_OUT,
-        MOVE_PUNISHMENT,
-        MOVE_FINAL_GAMBIT),
-
-    egg_moves(BARBOACH,
-        MOVE_THRASH,
-        MOVE_WHIRLPOOL,
-        MOVE_SPARK,
-        MOVE_HYDRO_PUMP,
-        MOVE_FLAIL,
-        MOVE_TAKE_DOWN,
-        MOVE_DRAGON_DANCE,
-        MOVE_EARTH_POWER,
-        MOVE_MUD_SHOT,
-        MOVE_MUDDY_WATER),
-
-    egg_moves(CORPHISH,
-        MOVE_MUD_SPORT,
-        MOVE_ENDEAVOR,
-        MOVE_BODY_SLAM,
-        MOVE_ANCIENT_POWER,
-        MOVE_KNOCK_OFF,
-        MOVE_SUPERPOWER,
-        MOVE_METAL_CLAW,
-        MOVE_DRAGON_DANCE,
-        MOVE_TRUMP_CARD,
-        MOVE_CHIP_AWAY,
-        MOVE_DOUBLE_EDGE,
-        MOVE_AQUA_JET,
-        MOVE_SWITCHEROO),
-
-    egg_moves(LILEEP,
-        MOVE_BARRIER,
-        MOVE_RECOVER,
-        MOVE_MIRROR_COAT,
-        MOVE_WRING_OUT,
-        MOVE_TICKLE,
-        MOVE_CURSE,
-        MOVE_MEGA_DRAIN,
-        MOVE_ENDURE,
-        MOVE_STEALTH_ROCK),
-
-    egg_moves(ANORITH,
-        MOVE_RAPID_SPIN,
-        MOVE_KNOCK_OFF,
-        MOVE_SCREECH,
-        MOVE_SAND_ATTACK,
-        MOVE_CROSS_POISON,
-        MOVE_CURSE,
-        MOVE_IRON_DEFENSE,
-        MOVE_WATER_PULSE,
-        MOVE_AQUA_JET),
-
-    egg_moves(FEEBAS,
-        MOVE_MIRROR_COAT,
-        MOVE_DRAGON_BREATH,
-        MOVE_MUD_SPORT,
-        MOVE_HYPNOSIS,
-        MOVE_CONFUSE_RAY,
-        MOVE_MIST,
-        MOVE_HAZE,
-        MOVE_TICKLE,
-        MOVE_BRINE,
-        MOVE_IRON_TAIL,
-        MOVE_DRAGON_PULSE,
-        MOVE_CAPTIVATE),
-
-    egg_moves(CASTFORM,
-        MOVE_FUTURE_SIGHT,
-        MOVE_LUCKY_CHANT,
-        MOVE_DISABLE,
-        MOVE_AMNESIA,
-        MOVE_OMINOUS_WIND,
-        MOVE_HEX,
-        MOVE_CLEAR_SMOG,
-        MOVE_REFLECT_TYPE,
-        MOVE_GUARD_SWAP,
-        MOVE_COSMIC_POWER),
-
-    egg_moves(KECLEON,
-        MOVE_DISABLE,
-        MOVE_MAGIC_COAT,
-        MOVE_TRICK,
-        MOVE_FAKE_OUT,
-        MOVE_NASTY_PLOT,
-        MOVE_DIZZY_PUNCH,
-        MOVE_RECOVER,
-        MOVE_SKILL_SWAP,
-        MOVE_SNATCH,
-        MOVE_FOUL_PLAY,
-        MOVE_CAMOUFLAGE,
-        MOVE_POWER_UP_PUNCH),
-
-    egg_moves(SHUPPET,
-        MOVE_DISABLE,
-        MOVE_DESTINY_BOND,
-        MOVE_FORESIGHT,
-        MOVE_ASTONISH,
-        MOVE_IMPRISON,
-        MOVE_PURSUIT,
-        MOVE_SHADOW_SNEAK,
-        MOVE_CONFUSE_RAY,
-        MOVE_OMINOUS_WIND,
-        MOVE_GUNK_SHOT,
-        MOVE_PHANTOM_FORCE),
-
-    egg_moves(DUSKULL,
-        MOVE_IMPRISON,
-        MOVE_DESTINY_BOND,
-        MOVE_PAIN_SPLIT,
-        MOVE_GRUDGE,
-        MOVE_MEMENTO,
-        MOVE_FEINT_ATTACK,
-        MOVE_OMINOUS_WIND,
-        MOVE_DARK_PULSE,
-        MOVE_SKILL_SWAP,
-        MOVE_HAZE),
-
-    egg_moves(TROPIUS,
-        MOVE_HEADBUTT,
-        MOVE_SLAM,
-        MOVE_RAZOR_WIND,
-        MOVE_LEECH_SEED,
-        MOVE_NATURE_POWER,
-        MOVE_LEAF_STORM,
-        MOVE_SYNTHESIS,
-        MOVE_CURSE,
-        MOVE_LEAF_BLADE,
-        MOVE_DRAGON_DANCE,
-        MOVE_BULLET_SEED,
-        MOVE_NATURAL_GIFT,
-        MOVE_DRAGON_HAMMER),
-
-    egg_moves(CHIMECHO,
-        MOVE_DISABLE,
-        MOVE_CURSE,
-        MOVE_HYPNOSIS,
-        MOVE_WISH,
-        MOVE_FUTURE_SIGHT,
-        MOVE_RECOVER,
-        MOVE_STORED_POWER,
-        MOVE_SKILL_SWAP,
-        MOVE_COSMIC_POWER,
-        MOVE_CRAFTY_SHIELD,
-        MOVE_PERISH_SONG),
-
-    egg_moves(ABSOL,
-        MOVE_BATON_PASS,
-        MOVE_FEINT_ATTACK,
-        MOVE_DOUBLE_EDGE,
-        MOVE_MAGIC_COAT,
-        MOVE_CURSE,
-        MOVE_MEAN_LOOK,
-        MOVE_ZEN_HEADBUTT,
-        MOVE_PUNISHMENT,
-        MOVE_SUCKER_PUNCH,
-        MOVE_ASSURANCE,
-        MOVE_ME_FIRST,
-        MOVE_MEGAHORN,
-        MOVE_HEX,
-        MOVE_PERISH_SONG,
-        MOVE_PLAY_ROUGH),
-
-    egg_moves(SNORUNT,
-        MOVE_BLOCK,
-        MOVE_SPIKES,
-        MOVE_ROLLOUT,
-        MOVE_DISABLE,
-        MOVE_BIDE,
-        MOVE_WEATHER_BALL,
-        MOVE_AVALANCHE,
-        MOVE_HEX,
-        MOVE_FAKE_TEARS,
-        MOVE_SWITCHEROO),
-
-    egg_moves(SPHEAL,
-        MOVE_WATER_SPORT,
-        MOVE_STOCKPILE,
-        MOVE_SWALLOW,
-        MOVE_SPIT_UP,
-        MOVE_YAWN,
-        MOVE_CURSE,
-        MOVE_FISSURE,
-        MOVE_SIGNAL_BEAM,
-        MOVE_AQUA_RING,
-        MOVE_ROLLOUT,
-        MOVE_SLEEP_TALK,
-        MOVE_WATER_PULSE,
-        MOVE_BELLY_DRUM),
-
-    egg_moves(CLAMPERL,
-        MOVE_REFRESH,
-        MOVE_MUD_SPORT,
-        MOVE_BODY_SLAM,
-        MOVE_SUPERSONIC,
-        MOVE_BARRIER,
-        MOVE_CONFUSE_RAY,
-        MOVE_AQUA_RING,
-        MOVE_MUDDY_WATER,
-        MOVE_WATER_PULSE,
-        MOVE_BRINE,
-        MOVE_ENDURE),
-
-    egg_moves(RELICANTH,
-        MOVE_MAGNITUDE,
-        MOVE_SKULL_BASH,
-        MOVE_WATER_SPORT,
-        MOVE_AMNESIA,
-        MOVE_SLEEP_TALK,
-        MOVE_AQUA_TAIL,
-        MOVE_SNORE,
-        MOVE_MUD_SLAP,
-        MOVE_MUDDY_WATER,
-        MOVE_MUD_SHOT,
-        MOVE_BRINE,
-        MOVE_ZEN_HEADBUTT),
-
-    egg_moves(LUVDISC,
-        MOVE_SPLASH,
-        MOVE_SUPERSONIC,
-        MOVE_WATER_SPORT,
-        MOVE_MUD_SPORT,
-        MOVE_CAPTIVATE,
-        MOVE_AQUA_RING,
-        MOVE_AQUA_JET,
-        MOVE_HEAL_PULSE,
-        MOVE_BRINE,
-        MOVE_ENTRAINMENT),
-
-    egg_moves(BAGON,
-        MOVE_HYDRO_PUMP,
-        MOVE_THRASH,
-        MOVE_DRAGON_RAGE,
-        MOVE_TWISTER,
-        MOVE_DRAGON_DANCE,
-        MOVE_FIRE_FANG,
-        MOVE_DRAGON_RUSH,
-        MOVE_DRAGON_PULSE,
-        MOVE_ENDURE,
-        MOVE_DEFENSE_CURL),
+static const u16 sBulbasaurEggMoveLearnset[] = {
+    MOVE_SKULL_BASH,
+    MOVE_CHARM,
+    MOVE_PETAL_DANCE,
+    MOVE_MAGICAL_LEAF,
+    MOVE_GRASS_WHISTLE,
+    MOVE_CURSE,
+    MOVE_INGRAIN,
+    MOVE_NATURE_POWER,
+    MOVE_AMNESIA,
+    MOVE_LEAF_STORM,
+    MOVE_POWER_WHIP,
+    MOVE_SLUDGE,
+    MOVE_ENDURE,
+    MOVE_GIGA_DRAIN,
+    MOVE_GRASSY_TERRAIN,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sCharmanderEggMoveLearnset[] = {
+    MOVE_BELLY_DRUM,
+    MOVE_ANCIENT_POWER,
+    MOVE_BITE,
+    MOVE_OUTRAGE,
+    MOVE_BEAT_UP,
+    MOVE_DRAGON_DANCE,
+    MOVE_CRUNCH,
+    MOVE_DRAGON_RUSH,
+    MOVE_METAL_CLAW,
+    MOVE_FLARE_BLITZ,
+    MOVE_COUNTER,
+    MOVE_DRAGON_PULSE,
+    MOVE_FOCUS_PUNCH,
+    MOVE_AIR_CUTTER,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sSquirtleEggMoveLearnset[] = {
+    MOVE_MIRROR_COAT,
+    MOVE_HAZE,
+    MOVE_MIST,
+    MOVE_FORESIGHT,
+    MOVE_FLAIL,
+    MOVE_REFRESH,
+    MOVE_MUD_SPORT,
+    MOVE_YAWN,
+    MOVE_MUDDY_WATER,
+    MOVE_FAKE_OUT,
+    MOVE_AQUA_RING,
+    MOVE_AQUA_JET,
+    MOVE_WATER_SPOUT,
+    MOVE_BRINE,
+    MOVE_DRAGON_PULSE,
+    MOVE_AURA_SPHERE,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sPidgeyEggMoveLearnset[] = {
+    MOVE_PURSUIT,
+    MOVE_FEINT_ATTACK,
+    MOVE_FORESIGHT,
+    MOVE_STEEL_WING,
+    MOVE_AIR_CUTTER,
+    MOVE_AIR_SLASH,
+    MOVE_BRAVE_BIRD,
+    MOVE_UPROAR,
+    MOVE_DEFOG,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sRattataEggMoveLearnset[] = {
+    MOVE_SCREECH,
+    MOVE_FLAME_WHEEL,
+    MOVE_FURY_SWIPES,
+    MOVE_BITE,
+    MOVE_COUNTER,
+    MOVE_REVERSAL,
+    MOVE_UPROAR,
+    MOVE_LAST_RESORT,
+    MOVE_ME_FIRST,
+    MOVE_REVENGE,
+    MOVE_FINAL_GAMBIT,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sSpearowEggMoveLearnset[] = {
+    MOVE_FEINT_ATTACK,
+    MOVE_SCARY_FACE,
+    MOVE_QUICK_ATTACK,
+    MOVE_TRI_ATTACK,
+    MOVE_ASTONISH,
+    MOVE_SKY_ATTACK,
+    MOVE_WHIRLWIND,
+    MOVE_UPROAR,
+    MOVE_FEATHER_DANCE,
+    MOVE_STEEL_WING,
+    MOVE_RAZOR_WIND,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sEkansEggMoveLearnset[] = {
+    MOVE_PURSUIT,
+    MOVE_SLAM,
+    MOVE_SPITE,
+    MOVE_BEAT_UP,
+    MOVE_POISON_FANG,
+    MOVE_SCARY_FACE,
+    MOVE_POISON_TAIL,
+    MOVE_DISABLE,
+    MOVE_SWITCHEROO,
+    MOVE_IRON_TAIL,
+    MOVE_SUCKER_PUNCH,
+    MOVE_SNATCH,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sSandshrewEggMoveLearnset[] = {
+    MOVE_FLAIL,
+    MOVE_COUNTER,
+    MOVE_RAPID_SPIN,
+    MOVE_METAL_CLAW,
+    MOVE_CRUSH_CLAW,
+    MOVE_NIGHT_SLASH,
+    MOVE_MUD_SHOT,
+    MOVE_ENDURE,
+    MOVE_CHIP_AWAY,
+    MOVE_ROCK_CLIMB,
+    MOVE_ROTOTILLER,
+    MOVE_HONE_CLAWS,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sNidoranFEggMoveLearnset[] = {
+    MOVE_SUPERSONIC,
+    MOVE_DISABLE,
+    MOVE_TAKE_DOWN,
+    MOVE_FOCUS_ENERGY,
+    MOVE_CHARM,
+    MOVE_COUNTER,
+    MOVE_BEAT_UP,
+    MOVE_PURSUIT,
+    MOVE_SKULL_BASH,
+    MOVE_IRON_TAIL,
+    MOVE_POISON_TAIL,
+    MOVE_ENDURE,
+    MOVE_CHIP_AWAY,
+    MOVE_VENOM_DRENCH,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sNidoranMEggMoveLearnset[] = {
+    MOVE_COUNTER,
+    MOVE_DISABLE,
+    MOVE_SUPERSONIC,
+    MOVE_TAKE_DOWN,
+    MOVE_AMNESIA,
+    MOVE_CONFUSION,
+    MOVE_BEAT_UP,
+    MOVE_SUCKER_PUNCH,
+    MOVE_HEAD_SMASH,
+    MOVE_IRON_TAIL,
+    MOVE_POISON_TAIL,
+    MOVE_ENDURE,
+    MOVE_CHIP_AWAY,
+    MOVE_VENOM_DRENCH,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sVulpixEggMoveLearnset[] = {
+    MOVE_FEINT_ATTACK,
+    MOVE_HYPNOSIS,
+    MOVE_FLAIL,
+    MOVE_SPITE,
+    MOVE_DISABLE,
+    MOVE_HOWL,
+    MOVE_HEAT_WAVE,
+    MOVE_FLARE_BLITZ,
+    MOVE_EXTRASENSORY,
+    MOVE_POWER_SWAP,
+    MOVE_SECRET_POWER,
+    MOVE_HEX,
+    MOVE_TAIL_SLAP,
+    MOVE_CAPTIVATE,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sZubatEggMoveLearnset[] = {
+    MOVE_QUICK_ATTACK,
+    MOVE_PURSUIT,
+    MOVE_FEINT_ATTACK,
+    MOVE_GUST,
+    MOVE_WHIRLWIND,
+    MOVE_CURSE,
+    MOVE_NASTY_PLOT,
+    MOVE_HYPNOSIS,
+    MOVE_ZEN_HEADBUTT,
+    MOVE_BRAVE_BIRD,
+    MOVE_GIGA_DRAIN,
+    MOVE_STEEL_WING,
+    MOVE_DEFOG,
+    MOVE_VENOM_DRENCH,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sOddishEggMoveLearnset[] = {
+    MOVE_RAZOR_LEAF,
+    MOVE_FLAIL,
+    MOVE_SYNTHESIS,
+    MOVE_CHARM,
+    MOVE_INGRAIN,
+    MOVE_TICKLE,
+    MOVE_TEETER_DANCE,
+    MOVE_SECRET_POWER,
+    MOVE_NATURE_POWER,
+    MOVE_AFTER_YOU,
+    MOVE_STRENGTH_SAP,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sParasEggMoveLearnset[] = {
+    MOVE_SCREECH,
+    MOVE_COUNTER,
+    MOVE_PSYBEAM,
+    MOVE_FLAIL,
+    MOVE_SWEET_SCENT,
+    MOVE_PURSUIT,
+    MOVE_METAL_CLAW,
+    MOVE_BUG_BITE,
+    MOVE_CROSS_POISON,
+    MOVE_AGILITY,
+    MOVE_ENDURE,
+    MOVE_NATURAL_GIFT,
+    MOVE_LEECH_SEED,
+    MOVE_WIDE_GUARD,
+    MOVE_ROTOTILLER,
+    MOVE_FELL_STINGER,
+    MOVE_GRASSY_TERRAIN,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sVenonatEggMoveLearnset[] = {
+    MOVE_BATON_PASS,
+    MOVE_SCREECH,
+    MOVE_GIGA_DRAIN,
+    MOVE_SIGNAL_BEAM,
+    MOVE_AGILITY,
+    MOVE_MORNING_SUN,
+    MOVE_TOXIC_SPIKES,
+    MOVE_BUG_BITE,
+    MOVE_SECRET_POWER,
+    MOVE_SKILL_SWAP,
+    MOVE_RAGE_POWDER,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sDiglettEggMoveLearnset[] = {
+    MOVE_FEINT_ATTACK,
+    MOVE_SCREECH,
+    MOVE_ANCIENT_POWER,
+    MOVE_PURSUIT,
+    MOVE_BEAT_UP,
+    MOVE_UPROAR,
+    MOVE_MUD_BOMB,
+    MOVE_ASTONISH,
+    MOVE_REVERSAL,
+    MOVE_HEADBUTT,
+    MOVE_ENDURE,
+    MOVE_FINAL_GAMBIT,
+    MOVE_MEMENTO,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sMeowthEggMoveLearnset[] = {
+    MOVE_SPITE,
+    MOVE_CHARM,
+    MOVE_HYPNOSIS,
+    MOVE_AMNESIA,
+    MOVE_ASSIST,
+    MOVE_ODOR_SLEUTH,
+    MOVE_FLAIL,
+    MOVE_LAST_RESORT,
+    MOVE_PUNISHMENT,
+    MOVE_TAIL_WHIP,
+    MOVE_SNATCH,
+    MOVE_IRON_TAIL,
+    MOVE_FOUL_PLAY,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sPsyduckEggMoveLearnset[] = {
+    MOVE_HYPNOSIS,
+    MOVE_PSYBEAM,
+    MOVE_FORESIGHT,
+    MOVE_FUTURE_SIGHT,
+    MOVE_CROSS_CHOP,
+    MOVE_REFRESH,
+    MOVE_CONFUSE_RAY,
+    MOVE_YAWN,
+    MOVE_MUD_BOMB,
+    MOVE_ENCORE,
+    MOVE_SECRET_POWER,
+    MOVE_SLEEP_TALK,
+    MOVE_SYNCHRONOISE,
+    MOVE_SIMPLE_BEAM,
+    MOVE_CLEAR_SMOG,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sMankeyEggMoveLearnset[] = {
+    MOVE_FORESIGHT,
+    MOVE_MEDITATE,
+    MOVE_COUNTER,
+    MOVE_REVERSAL,
+    MOVE_BEAT_UP,
+    MOVE_REVENGE,
+    MOVE_SMELLING_SALTS,
+    MOVE_CLOSE_COMBAT,
+    MOVE_ENCORE,
+    MOVE_FOCUS_PUNCH,
+    MOVE_SLEEP_TALK,
+    MOVE_NIGHT_SLASH,
+    MOVE_POWER_TRIP,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sGrowlitheEggMoveLearnset[] = {
+    MOVE_BODY_SLAM,
+    MOVE_CRUNCH,
+    MOVE_THRASH,
+    MOVE_FIRE_SPIN,
+    MOVE_HOWL,
+    MOVE_HEAT_WAVE,
+    MOVE_DOUBLE_EDGE,
+    MOVE_FLARE_BLITZ,
+    MOVE_MORNING_SUN,
+    MOVE_COVET,
+    MOVE_IRON_TAIL,
+    MOVE_DOUBLE_KICK,
+    MOVE_CLOSE_COMBAT,
+    MOVE_BURN_UP,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sPoliwagEggMoveLearnset[] = {
+    MOVE_MIST,
+    MOVE_SPLASH,
+    MOVE_BUBBLE_BEAM,
+    MOVE_HAZE,
+    MOVE_MIND_READER,
+    MOVE_WATER_SPORT,
+    MOVE_ICE_BALL,
+    MOVE_MUD_SHOT,
+    MOVE_REFRESH,
+    MOVE_ENDEAVOR,
+    MOVE_ENCORE,
+    MOVE_ENDURE,
+    MOVE_WATER_PULSE,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sAbraEggMoveLearnset[] = {
+    MOVE_ENCORE,
+    MOVE_BARRIER,
+    MOVE_KNOCK_OFF,
+    MOVE_FIRE_PUNCH,
+    MOVE_THUNDER_PUNCH,
+    MOVE_ICE_PUNCH,
+    MOVE_POWER_TRICK,
+    MOVE_GUARD_SWAP,
+    MOVE_SKILL_SWAP,
+    MOVE_GUARD_SPLIT,
+    MOVE_PSYCHO_SHIFT,
+    MOVE_ALLY_SWITCH,
+    MOVE_PSYCHIC_TERRAIN,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sMachopEggMoveLearnset[] = {
+    MOVE_MEDITATE,
+    MOVE_ROLLING_KICK,
+    MOVE_ENCORE,
+    MOVE_SMELLING_SALTS,
+    MOVE_COUNTER,
+    MOVE_CLOSE_COMBAT,
+    MOVE_FIRE_PUNCH,
+    MOVE_THUNDER_PUNCH,
+    MOVE_ICE_PUNCH,
+    MOVE_BULLET_PUNCH,
+    MOVE_POWER_TRICK,
+    MOVE_HEAVY_SLAM,
+    MOVE_KNOCK_OFF,
+    MOVE_TICKLE,
+    MOVE_QUICK_GUARD,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sBellsproutEggMoveLearnset[] = {
+    MOVE_ENCORE,
+    MOVE_SYNTHESIS,
+    MOVE_LEECH_LIFE,
+    MOVE_INGRAIN,
+    MOVE_MAGICAL_LEAF,
+    MOVE_WORRY_SEED,
+    MOVE_TICKLE,
+    MOVE_WEATHER_BALL,
+    MOVE_BULLET_SEED,
+    MOVE_NATURAL_GIFT,
+    MOVE_GIGA_DRAIN,
+    MOVE_CLEAR_SMOG,
+    MOVE_POWER_WHIP,
+    MOVE_ACID_SPRAY,
+    MOVE_BELCH,
+    MOVE_STRENGTH_SAP,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sTentacoolEggMoveLearnset[] = {
+    MOVE_AURORA_BEAM,
+    MOVE_MIRROR_COAT,
+    MOVE_RAPID_SPIN,
+    MOVE_HAZE,
+    MOVE_CONFUSE_RAY,
+    MOVE_KNOCK_OFF,
+    MOVE_ACUPRESSURE,
+    MOVE_MUDDY_WATER,
+    MOVE_BUBBLE,
+    MOVE_AQUA_RING,
+    MOVE_TICKLE,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sGeodudeEggMoveLearnset[] = {
+    MOVE_MEGA_PUNCH,
+    MOVE_BLOCK,
+    MOVE_HAMMER_ARM,
+    MOVE_FLAIL,
+    MOVE_CURSE,
+    MOVE_FOCUS_PUNCH,
+    MOVE_ROCK_CLIMB,
+    MOVE_ENDURE,
+    MOVE_AUTOTOMIZE,
+    MOVE_WIDE_GUARD,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sPonytaEggMoveLearnset[] = {
+    MOVE_FLAME_WHEEL,
+    MOVE_THRASH,
+    MOVE_DOUBLE_KICK,
+    MOVE_HYPNOSIS,
+    MOVE_CHARM,
+    MOVE_DOUBLE_EDGE,
+    MOVE_HORN_DRILL,
+    MOVE_MORNING_SUN,
+    MOVE_LOW_KICK,
+    MOVE_CAPTIVATE,
+    MOVE_ALLY_SWITCH,
+    MOVE_HIGH_HORSEPOWER,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sSlowpokeEggMoveLearnset[] = {
+    MOVE_BELLY_DRUM,
+    MOVE_FUTURE_SIGHT,
+    MOVE_STOMP,
+    MOVE_MUD_SPORT,
+    MOVE_SLEEP_TALK,
+    MOVE_SNORE,
+    MOVE_ME_FIRST,
+    MOVE_BLOCK,
+    MOVE_ZEN_HEADBUTT,
+    MOVE_WONDER_ROOM,
+    MOVE_BELCH,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sFarfetchdEggMoveLearnset[] = {
+    MOVE_STEEL_WING,
+    MOVE_FORESIGHT,
+    MOVE_MIRROR_MOVE,
+    MOVE_GUST,
+    MOVE_QUICK_ATTACK,
+    MOVE_FLAIL,
+    MOVE_FEATHER_DANCE,
+    MOVE_CURSE,
+    MOVE_COVET,
+    MOVE_MUD_SLAP,
+    MOVE_NIGHT_SLASH,
+    MOVE_LEAF_BLADE,
+    MOVE_REVENGE,
+    MOVE_ROOST,
+    MOVE_TRUMP_CARD,
+    MOVE_SIMPLE_BEAM,
+    MOVE_FIRST_IMPRESSION,
+    MOVE_FINAL_GAMBIT,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sDoduoEggMoveLearnset[] = {
+    MOVE_QUICK_ATTACK,
+    MOVE_SUPERSONIC,
+    MOVE_HAZE,
+    MOVE_FEINT_ATTACK,
+    MOVE_FLAIL,
+    MOVE_ENDEAVOR,
+    MOVE_MIRROR_MOVE,
+    MOVE_BRAVE_BIRD,
+    MOVE_NATURAL_GIFT,
+    MOVE_ASSURANCE,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sSeelEggMoveLearnset[] = {
+    MOVE_LICK,
+    MOVE_PERISH_SONG,
+    MOVE_DISABLE,
+    MOVE_HORN_DRILL,
+    MOVE_SLAM,
+    MOVE_ENCORE,
+    MOVE_FAKE_OUT,
+    MOVE_ICICLE_SPEAR,
+    MOVE_SIGNAL_BEAM,
+    MOVE_STOCKPILE,
+    MOVE_SWALLOW,
+    MOVE_SPIT_UP,
+    MOVE_WATER_PULSE,
+    MOVE_IRON_TAIL,
+    MOVE_SLEEP_TALK,
+    MOVE_BELCH,
+    MOVE_ENTRAINMENT,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sGrimerEggMoveLearnset[] = {
+    MOVE_HAZE,
+    MOVE_MEAN_LOOK,
+    MOVE_LICK,
+    MOVE_IMPRISON,
+    MOVE_CURSE,
+    MOVE_SHADOW_PUNCH,
+    MOVE_SHADOW_SNEAK,
+    MOVE_STOCKPILE,
+    MOVE_SWALLOW,
+    MOVE_SPIT_UP,
+    MOVE_SCARY_FACE,
+    MOVE_ACID_SPRAY,
+    MOVE_POWER_UP_PUNCH,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sShellderEggMoveLearnset[] = {
+    MOVE_BUBBLE_BEAM,
+    MOVE_TAKE_DOWN,
+    MOVE_BARRIER,
+    MOVE_RAPID_SPIN,
+    MOVE_SCREECH,
+    MOVE_ICICLE_SPEAR,
+    MOVE_MUD_SHOT,
+    MOVE_ROCK_BLAST,
+    MOVE_WATER_PULSE,
+    MOVE_AQUA_RING,
+    MOVE_AVALANCHE,
+    MOVE_TWINEEDLE,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sGastlyEggMoveLearnset[] = {
+    MOVE_PSYWAVE,
+    MOVE_PERISH_SONG,
+    MOVE_HAZE,
+    MOVE_ASTONISH,
+    MOVE_GRUDGE,
+    MOVE_FIRE_PUNCH,
+    MOVE_ICE_PUNCH,
+    MOVE_THUNDER_PUNCH,
+    MOVE_DISABLE,
+    MOVE_SCARY_FACE,
+    MOVE_CLEAR_SMOG,
+    MOVE_SMOG,
+    MOVE_REFLECT_TYPE,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sOnixEggMoveLearnset[] = {
+    MOVE_FLAIL,
+    MOVE_BLOCK,
+    MOVE_DEFENSE_CURL,
+    MOVE_ROLLOUT,
+    MOVE_ROCK_BLAST,
+    MOVE_ROCK_CLIMB,
+    MOVE_HEAVY_SLAM,
+    MOVE_STEALTH_ROCK,
+    MOVE_ROTOTILLER,
+    MOVE_WIDE_GUARD,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sDrowzeeEggMoveLearnset[] = {
+    MOVE_BARRIER,
+    MOVE_ASSIST,
+    MOVE_ROLE_PLAY,
+    MOVE_FIRE_PUNCH,
+    MOVE_THUNDER_PUNCH,
+    MOVE_ICE_PUNCH,
+    MOVE_NASTY_PLOT,
+    MOVE_FLATTER,
+    MOVE_PSYCHO_CUT,
+    MOVE_GUARD_SWAP,
+    MOVE_SECRET_POWER,
+    MOVE_SKILL_SWAP,
+    MOVE_POWER_SPLIT,
+    MOVE_PSYCHIC_TERRAIN,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sKrabbyEggMoveLearnset[] = {
+    MOVE_HAZE,
+    MOVE_AMNESIA,
+    MOVE_FLAIL,
+    MOVE_SLAM,
+    MOVE_KNOCK_OFF,
+    MOVE_TICKLE,
+    MOVE_ANCIENT_POWER,
+    MOVE_AGILITY,
+    MOVE_ENDURE,
+    MOVE_CHIP_AWAY,
+    MOVE_BIDE,
+    MOVE_ALLY_SWITCH,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sExeggcuteEggMoveLearnset[] = {
+    MOVE_SYNTHESIS,
+    MOVE_MOONLIGHT,
+    MOVE_ANCIENT_POWER,
+    MOVE_INGRAIN,
+    MOVE_CURSE,
+    MOVE_NATURE_POWER,
+    MOVE_LUCKY_CHANT,
+    MOVE_LEAF_STORM,
+    MOVE_POWER_SWAP,
+    MOVE_GIGA_DRAIN,
+    MOVE_SKILL_SWAP,
+    MOVE_NATURAL_GIFT,
+    MOVE_BLOCK,
+    MOVE_GRASSY_TERRAIN,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sCuboneEggMoveLearnset[] = {
+    MOVE_ANCIENT_POWER,
+    MOVE_BELLY_DRUM,
+    MOVE_SCREECH,
+    MOVE_SKULL_BASH,
+    MOVE_PERISH_SONG,
+    MOVE_DOUBLE_KICK,
+    MOVE_IRON_HEAD,
+    MOVE_DETECT,
+    MOVE_ENDURE,
+    MOVE_CHIP_AWAY,
+    MOVE_CURSE,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sLickitungEggMoveLearnset[] = {
+    MOVE_BELLY_DRUM,
+    MOVE_MAGNITUDE,
+    MOVE_BODY_SLAM,
+    MOVE_CURSE,
+    MOVE_SMELLING_SALTS,
+    MOVE_SLEEP_TALK,
+    MOVE_SNORE,
+    MOVE_AMNESIA,
+    MOVE_HAMMER_ARM,
+    MOVE_MUDDY_WATER,
+    MOVE_ZEN_HEADBUTT,
+    MOVE_BELCH,
+    MOVE_THRASH,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sKoffingEggMoveLearnset[] = {
+    MOVE_SCREECH,
+    MOVE_PSYWAVE,
+    MOVE_PSYBEAM,
+    MOVE_DESTINY_BOND,
+    MOVE_PAIN_SPLIT,
+    MOVE_GRUDGE,
+    MOVE_SPITE,
+    MOVE_CURSE,
+    MOVE_STOCKPILE,
+    MOVE_SWALLOW,
+    MOVE_SPIT_UP,
+    MOVE_TOXIC_SPIKES,
+    MOVE_VENOM_DRENCH,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sRhyhornEggMoveLearnset[] = {
+    MOVE_CRUNCH,
+    MOVE_REVERSAL,
+    MOVE_COUNTER,
+    MOVE_MAGNITUDE,
+    MOVE_CURSE,
+    MOVE_CRUSH_CLAW,
+    MOVE_DRAGON_RUSH,
+    MOVE_ICE_FANG,
+    MOVE_FIRE_FANG,
+    MOVE_THUNDER_FANG,
+    MOVE_SKULL_BASH,
+    MOVE_IRON_TAIL,
+    MOVE_ROCK_CLIMB,
+    MOVE_ROTOTILLER,
+    MOVE_METAL_BURST,
+    MOVE_GUARD_SPLIT,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sChanseyEggMoveLearnset[] = {
+    MOVE_PRESENT,
+    MOVE_METRONOME,
+    MOVE_HEAL_BELL,
+    MOVE_AROMATHERAPY,
+    MOVE_COUNTER,
+    MOVE_HELPING_HAND,
+    MOVE_GRAVITY,
+    MOVE_MUD_BOMB,
+    MOVE_NATURAL_GIFT,
+    MOVE_ENDURE,
+    MOVE_SEISMIC_TOSS,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sTangelaEggMoveLearnset[] = {
+    MOVE_FLAIL,
+    MOVE_CONFUSION,
+    MOVE_MEGA_DRAIN,
+    MOVE_AMNESIA,
+    MOVE_LEECH_SEED,
+    MOVE_NATURE_POWER,
+    MOVE_ENDEAVOR,
+    MOVE_LEAF_STORM,
+    MOVE_POWER_SWAP,
+    MOVE_GIGA_DRAIN,
+    MOVE_RAGE_POWDER,
+    MOVE_NATURAL_GIFT,
+    MOVE_WAKE_UP_SLAP,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sKangaskhanEggMoveLearnset[] = {
+    MOVE_STOMP,
+    MOVE_FORESIGHT,
+    MOVE_FOCUS_ENERGY,
+    MOVE_DISABLE,
+    MOVE_COUNTER,
+    MOVE_CRUSH_CLAW,
+    MOVE_DOUBLE_EDGE,
+    MOVE_ENDEAVOR,
+    MOVE_HAMMER_ARM,
+    MOVE_FOCUS_PUNCH,
+    MOVE_TRUMP_CARD,
+    MOVE_UPROAR,
+    MOVE_CIRCLE_THROW,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sHorseaEggMoveLearnset[] = {
+    MOVE_FLAIL,
+    MOVE_AURORA_BEAM,
+    MOVE_OCTAZOOKA,
+    MOVE_DISABLE,
+    MOVE_SPLASH,
+    MOVE_DRAGON_RAGE,
+    MOVE_DRAGON_BREATH,
+    MOVE_SIGNAL_BEAM,
+    MOVE_RAZOR_WIND,
+    MOVE_MUDDY_WATER,
+    MOVE_WATER_PULSE,
+    MOVE_CLEAR_SMOG,
+    MOVE_OUTRAGE,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sGoldeenEggMoveLearnset[] = {
+    MOVE_PSYBEAM,
+    MOVE_HAZE,
+    MOVE_HYDRO_PUMP,
+    MOVE_SLEEP_TALK,
+    MOVE_MUD_SPORT,
+    MOVE_MUD_SLAP,
+    MOVE_AQUA_TAIL,
+    MOVE_BODY_SLAM,
+    MOVE_MUD_SHOT,
+    MOVE_SKULL_BASH,
+    MOVE_SIGNAL_BEAM,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sMrMimeEggMoveLearnset[] = {
+    MOVE_FUTURE_SIGHT,
+    MOVE_HYPNOSIS,
+    MOVE_MIMIC,
+    MOVE_FAKE_OUT,
+    MOVE_TRICK,
+    MOVE_CONFUSE_RAY,
+    MOVE_WAKE_UP_SLAP,
+    MOVE_TEETER_DANCE,
+    MOVE_NASTY_PLOT,
+    MOVE_POWER_SPLIT,
+    MOVE_MAGIC_ROOM,
+    MOVE_ICY_WIND,
+    MOVE_PSYCHIC_TERRAIN,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sScytherEggMoveLearnset[] = {
+    MOVE_COUNTER,
+    MOVE_BATON_PASS,
+    MOVE_RAZOR_WIND,
+    MOVE_REVERSAL,
+    MOVE_ENDURE,
+    MOVE_SILVER_WIND,
+    MOVE_BUG_BUZZ,
+    MOVE_NIGHT_SLASH,
+    MOVE_DEFOG,
+    MOVE_STEEL_WING,
+    MOVE_QUICK_GUARD,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sPinsirEggMoveLearnset[] = {
+    MOVE_FURY_ATTACK,
+    MOVE_FLAIL,
+    MOVE_FEINT_ATTACK,
+    MOVE_QUICK_ATTACK,
+    MOVE_CLOSE_COMBAT,
+    MOVE_FEINT,
+    MOVE_ME_FIRST,
+    MOVE_BUG_BITE,
+    MOVE_SUPERPOWER,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sLaprasEggMoveLearnset[] = {
+    MOVE_FORESIGHT,
+    MOVE_TICKLE,
+    MOVE_REFRESH,
+    MOVE_DRAGON_DANCE,
+    MOVE_CURSE,
+    MOVE_SLEEP_TALK,
+    MOVE_HORN_DRILL,
+    MOVE_ANCIENT_POWER,
+    MOVE_WHIRLPOOL,
+    MOVE_FISSURE,
+    MOVE_DRAGON_PULSE,
+    MOVE_AVALANCHE,
+    MOVE_FUTURE_SIGHT,
+    MOVE_FREEZE_DRY,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sEeveeEggMoveLearnset[] = {
+    MOVE_CHARM,
+    MOVE_FLAIL,
+    MOVE_ENDURE,
+    MOVE_CURSE,
+    MOVE_TICKLE,
+    MOVE_WISH,
+    MOVE_YAWN,
+    MOVE_FAKE_TEARS,
+    MOVE_COVET,
+    MOVE_DETECT,
+    MOVE_NATURAL_GIFT,
+    MOVE_STORED_POWER,
+    MOVE_SYNCHRONOISE,
+    MOVE_CAPTIVATE,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sOmanyteEggMoveLearnset[] = {
+    MOVE_BUBBLE_BEAM,
+    MOVE_AURORA_BEAM,
+    MOVE_SLAM,
+    MOVE_SUPERSONIC,
+    MOVE_HAZE,
+    MOVE_SPIKES,
+    MOVE_KNOCK_OFF,
+    MOVE_WRING_OUT,
+    MOVE_TOXIC_SPIKES,
+    MOVE_MUDDY_WATER,
+    MOVE_BIDE,
+    MOVE_WATER_PULSE,
+    MOVE_WHIRLPOOL,
+    MOVE_REFLECT_TYPE,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sKabutoEggMoveLearnset[] = {
+    MOVE_BUBBLE_BEAM,
+    MOVE_AURORA_BEAM,
+    MOVE_RAPID_SPIN,
+    MOVE_FLAIL,
+    MOVE_KNOCK_OFF,
+    MOVE_CONFUSE_RAY,
+    MOVE_MUD_SHOT,
+    MOVE_ICY_WIND,
+    MOVE_SCREECH,
+    MOVE_GIGA_DRAIN,
+    MOVE_FORESIGHT,
+    MOVE_TAKE_DOWN,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sAerodactylEggMoveLearnset[] = {
+    MOVE_WHIRLWIND,
+    MOVE_PURSUIT,
+    MOVE_FORESIGHT,
+    MOVE_STEEL_WING,
+    MOVE_DRAGON_BREATH,
+    MOVE_CURSE,
+    MOVE_ASSURANCE,
+    MOVE_ROOST,
+    MOVE_TAILWIND,
+    MOVE_WIDE_GUARD,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sSnorlaxEggMoveLearnset[] = {
+    MOVE_LICK,
+    MOVE_CHARM,
+    MOVE_DOUBLE_EDGE,
+    MOVE_CURSE,
+    MOVE_FISSURE,
+    MOVE_WHIRLWIND,
+    MOVE_PURSUIT,
+    MOVE_COUNTER,
+    MOVE_NATURAL_GIFT,
+    MOVE_AFTER_YOU,
+    MOVE_BELCH,
+    MOVE_POWER_UP_PUNCH,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sDratiniEggMoveLearnset[] = {
+    MOVE_MIST,
+    MOVE_HAZE,
+    MOVE_SUPERSONIC,
+    MOVE_DRAGON_BREATH,
+    MOVE_DRAGON_DANCE,
+    MOVE_DRAGON_RUSH,
+    MOVE_EXTREME_SPEED,
+    MOVE_WATER_PULSE,
+    MOVE_AQUA_JET,
+    MOVE_DRAGON_PULSE,
+    MOVE_IRON_TAIL,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sChikoritaEggMoveLearnset[] = {
+    MOVE_VINE_WHIP,
+    MOVE_LEECH_SEED,
+    MOVE_COUNTER,
+    MOVE_ANCIENT_POWER,
+    MOVE_FLAIL,
+    MOVE_NATURE_POWER,
+    MOVE_INGRAIN,
+    MOVE_GRASS_WHISTLE,
+    MOVE_LEAF_STORM,
+    MOVE_AROMATHERAPY,
+    MOVE_WRING_OUT,
+    MOVE_BODY_SLAM,
+    MOVE_REFRESH,
+    MOVE_HEAL_PULSE,
+    MOVE_GRASSY_TERRAIN,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sCyndaquilEggMoveLearnset[] = {
+    MOVE_FURY_SWIPES,
+    MOVE_QUICK_ATTACK,
+    MOVE_REVERSAL,
+    MOVE_THRASH,
+    MOVE_FORESIGHT,
+    MOVE_COVET,
+    MOVE_HOWL,
+    MOVE_CRUSH_CLAW,
+    MOVE_DOUBLE_EDGE,
+    MOVE_DOUBLE_KICK,
+    MOVE_FLARE_BLITZ,
+    MOVE_EXTRASENSORY,
+    MOVE_NATURE_POWER,
+    MOVE_FLAME_BURST,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sTotodileEggMoveLearnset[] = {
+    MOVE_CRUNCH,
+    MOVE_THRASH,
+    MOVE_HYDRO_PUMP,
+    MOVE_ANCIENT_POWER,
+    MOVE_MUD_SPORT,
+    MOVE_WATER_SPORT,
+    MOVE_ICE_PUNCH,
+    MOVE_METAL_CLAW,
+    MOVE_DRAGON_DANCE,
+    MOVE_AQUA_JET,
+    MOVE_FAKE_TEARS,
+    MOVE_BLOCK,
+    MOVE_WATER_PULSE,
+    MOVE_FLATTER,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sSentretEggMoveLearnset[] = {
+    MOVE_DOUBLE_EDGE,
+    MOVE_PURSUIT,
+    MOVE_SLASH,
+    MOVE_FOCUS_ENERGY,
+    MOVE_REVERSAL,
+    MOVE_TRICK,
+    MOVE_ASSIST,
+    MOVE_LAST_RESORT,
+    MOVE_CHARM,
+    MOVE_COVET,
+    MOVE_NATURAL_GIFT,
+    MOVE_IRON_TAIL,
+    MOVE_CAPTIVATE,
+    MOVE_BABY_DOLL_EYES,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sHoothootEggMoveLearnset[] = {
+    MOVE_MIRROR_MOVE,
+    MOVE_SUPERSONIC,
+    MOVE_FEINT_ATTACK,
+    MOVE_WING_ATTACK,
+    MOVE_WHIRLWIND,
+    MOVE_SKY_ATTACK,
+    MOVE_FEATHER_DANCE,
+    MOVE_AGILITY,
+    MOVE_NIGHT_SHADE,
+    MOVE_DEFOG,
+    MOVE_MEAN_LOOK,
+    MOVE_HURRICANE,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sLedybaEggMoveLearnset[] = {
+    MOVE_PSYBEAM,
+    MOVE_BIDE,
+    MOVE_SILVER_WIND,
+    MOVE_BUG_BUZZ,
+    MOVE_SCREECH,
+    MOVE_ENCORE,
+    MOVE_KNOCK_OFF,
+    MOVE_BUG_BITE,
+    MOVE_FOCUS_PUNCH,
+    MOVE_DRAIN_PUNCH,
+    MOVE_DIZZY_PUNCH,
+    MOVE_TAILWIND,
+    MOVE_ENDURE,
+    MOVE_COUNTER,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sSpinarakEggMoveLearnset[] = {
+    MOVE_PSYBEAM,
+    MOVE_DISABLE,
+    MOVE_SONIC_BOOM,
+    MOVE_BATON_PASS,
+    MOVE_PURSUIT,
+    MOVE_SIGNAL_BEAM,
+    MOVE_TOXIC_SPIKES,
+    MOVE_TWINEEDLE,
+    MOVE_ELECTROWEB,
+    MOVE_RAGE_POWDER,
+    MOVE_NIGHT_SLASH,
+    MOVE_MEGAHORN,
+    MOVE_LUNGE,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sChinchouEggMoveLearnset[] = {
+    MOVE_FLAIL,
+    MOVE_SCREECH,
+    MOVE_AMNESIA,
+    MOVE_PSYBEAM,
+    MOVE_WHIRLPOOL,
+    MOVE_AGILITY,
+    MOVE_MIST,
+    MOVE_SHOCK_WAVE,
+    MOVE_BRINE,
+    MOVE_WATER_PULSE,
+    MOVE_SOAK,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sPichuEggMoveLearnset[] = {
+    MOVE_REVERSAL,
+    MOVE_BIDE,
+    MOVE_PRESENT,
+    MOVE_ENCORE,
+    MOVE_DOUBLE_SLAP,
+    MOVE_WISH,
+    MOVE_CHARGE,
+    MOVE_FAKE_OUT,
+    MOVE_THUNDER_PUNCH,
+    MOVE_TICKLE,
+    MOVE_FLAIL,
+    MOVE_ENDURE,
+    MOVE_LUCKY_CHANT,
+    MOVE_BESTOW,
+    MOVE_DISARMING_VOICE,
+    MOVE_ELECTRIC_TERRAIN,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sCleffaEggMoveLearnset[] = {
+    MOVE_PRESENT,
+    MOVE_METRONOME,
+    MOVE_AMNESIA,
+    MOVE_BELLY_DRUM,
+    MOVE_SPLASH,
+    MOVE_MIMIC,
+    MOVE_WISH,
+    MOVE_FAKE_TEARS,
+    MOVE_COVET,
+    MOVE_AROMATHERAPY,
+    MOVE_STORED_POWER,
+    MOVE_TICKLE,
+    MOVE_MISTY_TERRAIN,
+    MOVE_HEAL_PULSE,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sIgglybuffEggMoveLearnset[] = {
+    MOVE_PERISH_SONG,
+    MOVE_PRESENT,
+    MOVE_FEINT_ATTACK,
+    MOVE_WISH,
+    MOVE_FAKE_TEARS,
+    MOVE_LAST_RESORT,
+    MOVE_COVET,
+    MOVE_GRAVITY,
+    MOVE_SLEEP_TALK,
+    MOVE_CAPTIVATE,
+    MOVE_PUNISHMENT,
+    MOVE_MISTY_TERRAIN,
+    MOVE_HEAL_PULSE,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sTogepiEggMoveLearnset[] = {
+    MOVE_PRESENT,
+    MOVE_MIRROR_MOVE,
+    MOVE_PECK,
+    MOVE_FORESIGHT,
+    MOVE_FUTURE_SIGHT,
+    MOVE_NASTY_PLOT,
+    MOVE_PSYCHO_SHIFT,
+    MOVE_LUCKY_CHANT,
+    MOVE_EXTRASENSORY,
+    MOVE_SECRET_POWER,
+    MOVE_STORED_POWER,
+    MOVE_MORNING_SUN,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sNatuEggMoveLearnset[] = {
+    MOVE_HAZE,
+    MOVE_DRILL_PECK,
+    MOVE_QUICK_ATTACK,
+    MOVE_FEINT_ATTACK,
+    MOVE_STEEL_WING,
+    MOVE_FEATHER_DANCE,
+    MOVE_REFRESH,
+    MOVE_ZEN_HEADBUTT,
+    MOVE_SUCKER_PUNCH,
+    MOVE_SYNCHRONOISE,
+    MOVE_ROOST,
+    MOVE_SKILL_SWAP,
+    MOVE_SIMPLE_BEAM,
+    MOVE_ALLY_SWITCH,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sMareepEggMoveLearnset[] = {
+    MOVE_TAKE_DOWN,
+    MOVE_BODY_SLAM,
+    MOVE_SCREECH,
+    MOVE_ODOR_SLEUTH,
+    MOVE_CHARGE,
+    MOVE_FLATTER,
+    MOVE_SAND_ATTACK,
+    MOVE_IRON_TAIL,
+    MOVE_AFTER_YOU,
+    MOVE_AGILITY,
+    MOVE_EERIE_IMPULSE,
+    MOVE_ELECTRIC_TERRAIN,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sMarillEggMoveLearnset[] = {
+    MOVE_PRESENT,
+    MOVE_AMNESIA,
+    MOVE_FUTURE_SIGHT,
+    MOVE_BELLY_DRUM,
+    MOVE_PERISH_SONG,
+    MOVE_SUPERSONIC,
+    MOVE_AQUA_JET,
+    MOVE_SUPERPOWER,
+    MOVE_REFRESH,
+    MOVE_BODY_SLAM,
+    MOVE_WATER_SPORT,
+    MOVE_MUDDY_WATER,
+    MOVE_CAMOUFLAGE,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sSudowoodoEggMoveLearnset[] = {
+    MOVE_SELF_DESTRUCT,
+    MOVE_HEADBUTT,
+    MOVE_HARDEN,
+    MOVE_DEFENSE_CURL,
+    MOVE_ROLLOUT,
+    MOVE_SAND_TOMB,
+    MOVE_STEALTH_ROCK,
+    MOVE_CURSE,
+    MOVE_ENDURE,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sHoppipEggMoveLearnset[] = {
+    MOVE_CONFUSION,
+    MOVE_ENCORE,
+    MOVE_DOUBLE_EDGE,
+    MOVE_AMNESIA,
+    MOVE_HELPING_HAND,
+    MOVE_AROMATHERAPY,
+    MOVE_WORRY_SEED,
+    MOVE_COTTON_GUARD,
+    MOVE_SEED_BOMB,
+    MOVE_ENDURE,
+    MOVE_GRASSY_TERRAIN,
+    MOVE_STRENGTH_SAP,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sAipomEggMoveLearnset[] = {
+    MOVE_COUNTER,
+    MOVE_SCREECH,
+    MOVE_PURSUIT,
+    MOVE_AGILITY,
+    MOVE_SPITE,
+    MOVE_SLAM,
+    MOVE_DOUBLE_SLAP,
+    MOVE_BEAT_UP,
+    MOVE_FAKE_OUT,
+    MOVE_COVET,
+    MOVE_BOUNCE,
+    MOVE_REVENGE,
+    MOVE_SWITCHEROO,
+    MOVE_QUICK_GUARD,
+    MOVE_TAIL_SLAP,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sSunkernEggMoveLearnset[] = {
+    MOVE_GRASS_WHISTLE,
+    MOVE_ENCORE,
+    MOVE_LEECH_SEED,
+    MOVE_NATURE_POWER,
+    MOVE_CURSE,
+    MOVE_HELPING_HAND,
+    MOVE_INGRAIN,
+    MOVE_SWEET_SCENT,
+    MOVE_ENDURE,
+    MOVE_BIDE,
+    MOVE_NATURAL_GIFT,
+    MOVE_MORNING_SUN,
+    MOVE_GRASSY_TERRAIN,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sYanmaEggMoveLearnset[] = {
+    MOVE_WHIRLWIND,
+    MOVE_REVERSAL,
+    MOVE_LEECH_LIFE,
+    MOVE_SIGNAL_BEAM,
+    MOVE_SILVER_WIND,
+    MOVE_FEINT,
+    MOVE_FEINT_ATTACK,
+    MOVE_PURSUIT,
+    MOVE_DOUBLE_EDGE,
+    MOVE_SECRET_POWER,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sWooperEggMoveLearnset[] = {
+    MOVE_BODY_SLAM,
+    MOVE_ANCIENT_POWER,
+    MOVE_CURSE,
+    MOVE_MUD_SPORT,
+    MOVE_STOCKPILE,
+    MOVE_SWALLOW,
+    MOVE_SPIT_UP,
+    MOVE_COUNTER,
+    MOVE_ENCORE,
+    MOVE_DOUBLE_KICK,
+    MOVE_RECOVER,
+    MOVE_AFTER_YOU,
+    MOVE_SLEEP_TALK,
+    MOVE_ACID_SPRAY,
+    MOVE_GUARD_SWAP,
+    MOVE_EERIE_IMPULSE,
+    MOVE_POWER_UP_PUNCH,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sMurkrowEggMoveLearnset[] = {
+    MOVE_WHIRLWIND,
+    MOVE_DRILL_PECK,
+    MOVE_MIRROR_MOVE,
+    MOVE_WING_ATTACK,
+    MOVE_SKY_ATTACK,
+    MOVE_CONFUSE_RAY,
+    MOVE_FEATHER_DANCE,
+    MOVE_PERISH_SONG,
+    MOVE_PSYCHO_SHIFT,
+    MOVE_SCREECH,
+    MOVE_FEINT_ATTACK,
+    MOVE_BRAVE_BIRD,
+    MOVE_ROOST,
+    MOVE_ASSURANCE,
+    MOVE_FLATTER,
+    MOVE_PUNISHMENT,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sMisdreavusEggMoveLearnset[] = {
+    MOVE_SCREECH,
+    MOVE_DESTINY_BOND,
+    MOVE_IMPRISON,
+    MOVE_MEMENTO,
+    MOVE_SUCKER_PUNCH,
+    MOVE_SHADOW_SNEAK,
+    MOVE_CURSE,
+    MOVE_SPITE,
+    MOVE_OMINOUS_WIND,
+    MOVE_NASTY_PLOT,
+    MOVE_SKILL_SWAP,
+    MOVE_WONDER_ROOM,
+    MOVE_ME_FIRST,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sGirafarigEggMoveLearnset[] = {
+    MOVE_TAKE_DOWN,
+    MOVE_AMNESIA,
+    MOVE_FORESIGHT,
+    MOVE_FUTURE_SIGHT,
+    MOVE_BEAT_UP,
+    MOVE_WISH,
+    MOVE_MAGIC_COAT,
+    MOVE_DOUBLE_KICK,
+    MOVE_MIRROR_COAT,
+    MOVE_RAZOR_WIND,
+    MOVE_SKILL_SWAP,
+    MOVE_SECRET_POWER,
+    MOVE_MEAN_LOOK,
+    MOVE_PSYCHIC_TERRAIN,
+    MOVE_PSYCHIC_FANGS,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sPinecoEggMoveLearnset[] = {
+    MOVE_PIN_MISSILE,
+    MOVE_FLAIL,
+    MOVE_SWIFT,
+    MOVE_COUNTER,
+    MOVE_SAND_TOMB,
+    MOVE_REVENGE,
+    MOVE_DOUBLE_EDGE,
+    MOVE_TOXIC_SPIKES,
+    MOVE_POWER_TRICK,
+    MOVE_ENDURE,
+    MOVE_STEALTH_ROCK,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sDunsparceEggMoveLearnset[] = {
+    MOVE_BIDE,
+    MOVE_ANCIENT_POWER,
+    MOVE_BITE,
+    MOVE_HEADBUTT,
+    MOVE_ASTONISH,
+    MOVE_CURSE,
+    MOVE_TRUMP_CARD,
+    MOVE_MAGIC_COAT,
+    MOVE_SNORE,
+    MOVE_AGILITY,
+    MOVE_SECRET_POWER,
+    MOVE_SLEEP_TALK,
+    MOVE_HEX,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sGligarEggMoveLearnset[] = {
+    MOVE_METAL_CLAW,
+    MOVE_WING_ATTACK,
+    MOVE_RAZOR_WIND,
+    MOVE_COUNTER,
+    MOVE_SAND_TOMB,
+    MOVE_AGILITY,
+    MOVE_BATON_PASS,
+    MOVE_DOUBLE_EDGE,
+    MOVE_FEINT,
+    MOVE_NIGHT_SLASH,
+    MOVE_CROSS_POISON,
+    MOVE_POWER_TRICK,
+    MOVE_ROCK_CLIMB,
+    MOVE_POISON_TAIL,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sSnubbullEggMoveLearnset[] = {
+    MOVE_METRONOME,
+    MOVE_FEINT_ATTACK,
+    MOVE_PRESENT,
+    MOVE_CRUNCH,
+    MOVE_HEAL_BELL,
+    MOVE_SNORE,
+    MOVE_SMELLING_SALTS,
+    MOVE_CLOSE_COMBAT,
+    MOVE_ICE_FANG,
+    MOVE_FIRE_FANG,
+    MOVE_THUNDER_FANG,
+    MOVE_FOCUS_PUNCH,
+    MOVE_DOUBLE_EDGE,
+    MOVE_MIMIC,
+    MOVE_FAKE_TEARS,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sQwilfishEggMoveLearnset[] = {
+    MOVE_FLAIL,
+    MOVE_HAZE,
+    MOVE_BUBBLE_BEAM,
+    MOVE_SUPERSONIC,
+    MOVE_ASTONISH,
+    MOVE_SIGNAL_BEAM,
+    MOVE_AQUA_JET,
+    MOVE_WATER_PULSE,
+    MOVE_BRINE,
+    MOVE_ACID_SPRAY,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sShuckleEggMoveLearnset[] = {
+    MOVE_SWEET_SCENT,
+    MOVE_KNOCK_OFF,
+    MOVE_HELPING_HAND,
+    MOVE_ACUPRESSURE,
+    MOVE_SAND_TOMB,
+    MOVE_MUD_SLAP,
+    MOVE_ACID,
+    MOVE_ROCK_BLAST,
+    MOVE_FINAL_GAMBIT,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sHeracrossEggMoveLearnset[] = {
+    MOVE_HARDEN,
+    MOVE_BIDE,
+    MOVE_FLAIL,
+    MOVE_REVENGE,
+    MOVE_PURSUIT,
+    MOVE_DOUBLE_EDGE,
+    MOVE_SEISMIC_TOSS,
+    MOVE_FOCUS_PUNCH,
+    MOVE_MEGAHORN,
+    MOVE_ROCK_BLAST,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sSneaselEggMoveLearnset[] = {
+    MOVE_COUNTER,
+    MOVE_SPITE,
+    MOVE_FORESIGHT,
+    MOVE_BITE,
+    MOVE_CRUSH_CLAW,
+    MOVE_FAKE_OUT,
+    MOVE_DOUBLE_HIT,
+    MOVE_PUNISHMENT,
+    MOVE_PURSUIT,
+    MOVE_ICE_SHARD,
+    MOVE_ICE_PUNCH,
+    MOVE_ASSIST,
+    MOVE_AVALANCHE,
+    MOVE_FEINT,
+    MOVE_ICICLE_CRASH,
+    MOVE_THROAT_CHOP,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sTeddiursaEggMoveLearnset[] = {
+    MOVE_CRUNCH,
+    MOVE_TAKE_DOWN,
+    MOVE_SEISMIC_TOSS,
+    MOVE_COUNTER,
+    MOVE_METAL_CLAW,
+    MOVE_FAKE_TEARS,
+    MOVE_YAWN,
+    MOVE_SLEEP_TALK,
+    MOVE_CROSS_CHOP,
+    MOVE_DOUBLE_EDGE,
+    MOVE_CLOSE_COMBAT,
+    MOVE_NIGHT_SLASH,
+    MOVE_BELLY_DRUM,
+    MOVE_CHIP_AWAY,
+    MOVE_PLAY_ROUGH,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sSlugmaEggMoveLearnset[] = {
+    MOVE_ACID_ARMOR,
+    MOVE_HEAT_WAVE,
+    MOVE_CURSE,
+    MOVE_SMOKESCREEN,
+    MOVE_MEMENTO,
+    MOVE_STOCKPILE,
+    MOVE_SPIT_UP,
+    MOVE_SWALLOW,
+    MOVE_ROLLOUT,
+    MOVE_INFERNO,
+    MOVE_EARTH_POWER,
+    MOVE_GUARD_SWAP,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sSwinubEggMoveLearnset[] = {
+    MOVE_TAKE_DOWN,
+    MOVE_BITE,
+    MOVE_BODY_SLAM,
+    MOVE_ANCIENT_POWER,
+    MOVE_MUD_SHOT,
+    MOVE_ICICLE_SPEAR,
+    MOVE_DOUBLE_EDGE,
+    MOVE_FISSURE,
+    MOVE_CURSE,
+    MOVE_MUD_SHOT,
+    MOVE_AVALANCHE,
+    MOVE_STEALTH_ROCK,
+    MOVE_ICICLE_CRASH,
+    MOVE_FREEZE_DRY,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sCorsolaEggMoveLearnset[] = {
+    MOVE_SCREECH,
+    MOVE_MIST,
+    MOVE_AMNESIA,
+    MOVE_BARRIER,
+    MOVE_INGRAIN,
+    MOVE_CONFUSE_RAY,
+    MOVE_ICICLE_SPEAR,
+    MOVE_NATURE_POWER,
+    MOVE_AQUA_RING,
+    MOVE_CURSE,
+    MOVE_BIDE,
+    MOVE_WATER_PULSE,
+    MOVE_HEAD_SMASH,
+    MOVE_CAMOUFLAGE,
+    MOVE_LIQUIDATION,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sRemoraidEggMoveLearnset[] = {
+    MOVE_AURORA_BEAM,
+    MOVE_OCTAZOOKA,
+    MOVE_SUPERSONIC,
+    MOVE_HAZE,
+    MOVE_SCREECH,
+    MOVE_ROCK_BLAST,
+    MOVE_SNORE,
+    MOVE_FLAIL,
+    MOVE_WATER_SPOUT,
+    MOVE_MUD_SHOT,
+    MOVE_SWIFT,
+    MOVE_ACID_SPRAY,
+    MOVE_WATER_PULSE,
+    MOVE_ENTRAINMENT,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sDelibirdEggMoveLearnset[] = {
+    MOVE_AURORA_BEAM,
+    MOVE_QUICK_ATTACK,
+    MOVE_FUTURE_SIGHT,
+    MOVE_SPLASH,
+    MOVE_RAPID_SPIN,
+    MOVE_ICE_BALL,
+    MOVE_ICE_SHARD,
+    MOVE_ICE_PUNCH,
+    MOVE_FAKE_OUT,
+    MOVE_BESTOW,
+    MOVE_ICY_WIND,
+    MOVE_FREEZE_DRY,
+    MOVE_DESTINY_BOND,
+    MOVE_SPIKES,
+    MOVE_COUNTER,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sMantineEggMoveLearnset[] = {
+    MOVE_TWISTER,
+    MOVE_HYDRO_PUMP,
+    MOVE_HAZE,
+    MOVE_SLAM,
+    MOVE_MUD_SPORT,
+    MOVE_MIRROR_COAT,
+    MOVE_WATER_SPORT,
+    MOVE_SPLASH,
+    MOVE_WIDE_GUARD,
+    MOVE_AMNESIA,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sSkarmoryEggMoveLearnset[] = {
+    MOVE_DRILL_PECK,
+    MOVE_PURSUIT,
+    MOVE_WHIRLWIND,
+    MOVE_SKY_ATTACK,
+    MOVE_CURSE,
+    MOVE_BRAVE_BIRD,
+    MOVE_ASSURANCE,
+    MOVE_GUARD_SWAP,
+    MOVE_STEALTH_ROCK,
+    MOVE_ENDURE,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sHoundourEggMoveLearnset[] = {
+    MOVE_FIRE_SPIN,
+    MOVE_RAGE,
+    MOVE_PURSUIT,
+    MOVE_COUNTER,
+    MOVE_SPITE,
+    MOVE_REVERSAL,
+    MOVE_BEAT_UP,
+    MOVE_FIRE_FANG,
+    MOVE_THUNDER_FANG,
+    MOVE_NASTY_PLOT,
+    MOVE_PUNISHMENT,
+    MOVE_FEINT,
+    MOVE_SUCKER_PUNCH,
+    MOVE_DESTINY_BOND,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sPhanpyEggMoveLearnset[] = {
+    MOVE_FOCUS_ENERGY,
+    MOVE_BODY_SLAM,
+    MOVE_ANCIENT_POWER,
+    MOVE_SNORE,
+    MOVE_COUNTER,
+    MOVE_FISSURE,
+    MOVE_ENDEAVOR,
+    MOVE_ICE_SHARD,
+    MOVE_HEAD_SMASH,
+    MOVE_MUD_SLAP,
+    MOVE_HEAVY_SLAM,
+    MOVE_PLAY_ROUGH,
+    MOVE_HIGH_HORSEPOWER,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sStantlerEggMoveLearnset[] = {
+    MOVE_SPITE,
+    MOVE_DISABLE,
+    MOVE_BITE,
+    MOVE_EXTRASENSORY,
+    MOVE_THRASH,
+    MOVE_DOUBLE_KICK,
+    MOVE_ZEN_HEADBUTT,
+    MOVE_MEGAHORN,
+    MOVE_MUD_SPORT,
+    MOVE_RAGE,
+    MOVE_ME_FIRST,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sTyrogueEggMoveLearnset[] = {
+    MOVE_RAPID_SPIN,
+    MOVE_HIGH_JUMP_KICK,
+    MOVE_MACH_PUNCH,
+    MOVE_MIND_READER,
+    MOVE_HELPING_HAND,
+    MOVE_COUNTER,
+    MOVE_VACUUM_WAVE,
+    MOVE_BULLET_PUNCH,
+    MOVE_ENDURE,
+    MOVE_PURSUIT,
+    MOVE_FEINT,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sSmoochumEggMoveLearnset[] = {
+    MOVE_MEDITATE,
+    MOVE_FAKE_OUT,
+    MOVE_WISH,
+    MOVE_ICE_PUNCH,
+    MOVE_MIRACLE_EYE,
+    MOVE_NASTY_PLOT,
+    MOVE_WAKE_UP_SLAP,
+    MOVE_CAPTIVATE,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sElekidEggMoveLearnset[] = {
+    MOVE_KARATE_CHOP,
+    MOVE_BARRIER,
+    MOVE_ROLLING_KICK,
+    MOVE_MEDITATE,
+    MOVE_CROSS_CHOP,
+    MOVE_FIRE_PUNCH,
+    MOVE_ICE_PUNCH,
+    MOVE_DYNAMIC_PUNCH,
+    MOVE_FEINT,
+    MOVE_HAMMER_ARM,
+    MOVE_FOCUS_PUNCH,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sMagbyEggMoveLearnset[] = {
+    MOVE_KARATE_CHOP,
+    MOVE_MEGA_PUNCH,
+    MOVE_BARRIER,
+    MOVE_SCREECH,
+    MOVE_CROSS_CHOP,
+    MOVE_THUNDER_PUNCH,
+    MOVE_MACH_PUNCH,
+    MOVE_DYNAMIC_PUNCH,
+    MOVE_FLARE_BLITZ,
+    MOVE_BELLY_DRUM,
+    MOVE_IRON_TAIL,
+    MOVE_FOCUS_ENERGY,
+    MOVE_POWER_SWAP,
+    MOVE_BELCH,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sMiltankEggMoveLearnset[] = {
+    MOVE_PRESENT,
+    MOVE_REVERSAL,
+    MOVE_SEISMIC_TOSS,
+    MOVE_ENDURE,
+    MOVE_CURSE,
+    MOVE_HELPING_HAND,
+    MOVE_SLEEP_TALK,
+    MOVE_DIZZY_PUNCH,
+    MOVE_HAMMER_ARM,
+    MOVE_DOUBLE_EDGE,
+    MOVE_PUNISHMENT,
+    MOVE_NATURAL_GIFT,
+    MOVE_HEART_STAMP,
+    MOVE_BELCH,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sLarvitarEggMoveLearnset[] = {
+    MOVE_PURSUIT,
+    MOVE_STOMP,
+    MOVE_OUTRAGE,
+    MOVE_FOCUS_ENERGY,
+    MOVE_ANCIENT_POWER,
+    MOVE_DRAGON_DANCE,
+    MOVE_CURSE,
+    MOVE_IRON_DEFENSE,
+    MOVE_ASSURANCE,
+    MOVE_IRON_HEAD,
+    MOVE_STEALTH_ROCK,
+    MOVE_IRON_TAIL,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sTreeckoEggMoveLearnset[] = {
+    MOVE_CRUNCH,
+    MOVE_MUD_SPORT,
+    MOVE_ENDEAVOR,
+    MOVE_LEECH_SEED,
+    MOVE_DRAGON_BREATH,
+    MOVE_CRUSH_CLAW,
+    MOVE_WORRY_SEED,
+    MOVE_DOUBLE_KICK,
+    MOVE_GRASS_WHISTLE,
+    MOVE_SYNTHESIS,
+    MOVE_MAGICAL_LEAF,
+    MOVE_LEAF_STORM,
+    MOVE_RAZOR_WIND,
+    MOVE_BULLET_SEED,
+    MOVE_NATURAL_GIFT,
+    MOVE_GRASSY_TERRAIN,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sTorchicEggMoveLearnset[] = {
+    MOVE_COUNTER,
+    MOVE_REVERSAL,
+    MOVE_ENDURE,
+    MOVE_SMELLING_SALTS,
+    MOVE_CRUSH_CLAW,
+    MOVE_BATON_PASS,
+    MOVE_AGILITY,
+    MOVE_NIGHT_SLASH,
+    MOVE_LAST_RESORT,
+    MOVE_FEINT,
+    MOVE_FEATHER_DANCE,
+    MOVE_CURSE,
+    MOVE_FLAME_BURST,
+    MOVE_LOW_KICK,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sMudkipEggMoveLearnset[] = {
+    MOVE_REFRESH,
+    MOVE_UPROAR,
+    MOVE_CURSE,
+    MOVE_STOMP,
+    MOVE_ICE_BALL,
+    MOVE_MIRROR_COAT,
+    MOVE_COUNTER,
+    MOVE_ANCIENT_POWER,
+    MOVE_WHIRLPOOL,
+    MOVE_BITE,
+    MOVE_DOUBLE_EDGE,
+    MOVE_MUD_BOMB,
+    MOVE_YAWN,
+    MOVE_SLUDGE,
+    MOVE_AVALANCHE,
+    MOVE_WIDE_GUARD,
+    MOVE_BARRIER,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sPoochyenaEggMoveLearnset[] = {
+    MOVE_ASTONISH,
+    MOVE_POISON_FANG,
+    MOVE_COVET,
+    MOVE_LEER,
+    MOVE_YAWN,
+    MOVE_SUCKER_PUNCH,
+    MOVE_ICE_FANG,
+    MOVE_FIRE_FANG,
+    MOVE_THUNDER_FANG,
+    MOVE_ME_FIRST,
+    MOVE_SNATCH,
+    MOVE_SLEEP_TALK,
+    MOVE_PLAY_ROUGH,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sZigzagoonEggMoveLearnset[] = {
+    MOVE_CHARM,
+    MOVE_PURSUIT,
+    MOVE_TICKLE,
+    MOVE_TRICK,
+    MOVE_HELPING_HAND,
+    MOVE_MUD_SLAP,
+    MOVE_SLEEP_TALK,
+    MOVE_ROCK_CLIMB,
+    MOVE_SIMPLE_BEAM,
+    MOVE_EXTREME_SPEED,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sLotadEggMoveLearnset[] = {
+    MOVE_SYNTHESIS,
+    MOVE_RAZOR_LEAF,
+    MOVE_SWEET_SCENT,
+    MOVE_LEECH_SEED,
+    MOVE_FLAIL,
+    MOVE_WATER_GUN,
+    MOVE_TICKLE,
+    MOVE_COUNTER,
+    MOVE_GIGA_DRAIN,
+    MOVE_TEETER_DANCE,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sSeedotEggMoveLearnset[] = {
+    MOVE_LEECH_SEED,
+    MOVE_AMNESIA,
+    MOVE_QUICK_ATTACK,
+    MOVE_RAZOR_WIND,
+    MOVE_TAKE_DOWN,
+    MOVE_WORRY_SEED,
+    MOVE_NASTY_PLOT,
+    MOVE_POWER_SWAP,
+    MOVE_DEFOG,
+    MOVE_FOUL_PLAY,
+    MOVE_BEAT_UP,
+    MOVE_BULLET_SEED,
+    MOVE_GRASSY_TERRAIN,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sTaillowEggMoveLearnset[] = {
+    MOVE_PURSUIT,
+    MOVE_SUPERSONIC,
+    MOVE_REFRESH,
+    MOVE_MIRROR_MOVE,
+    MOVE_RAGE,
+    MOVE_SKY_ATTACK,
+    MOVE_WHIRLWIND,
+    MOVE_BRAVE_BIRD,
+    MOVE_ROOST,
+    MOVE_STEEL_WING,
+    MOVE_DEFOG,
+    MOVE_BOOMBURST,
+    MOVE_HURRICANE,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sWingullEggMoveLearnset[] = {
+    MOVE_MIST,
+    MOVE_TWISTER,
+    MOVE_AGILITY,
+    MOVE_GUST,
+    MOVE_WATER_SPORT,
+    MOVE_AQUA_RING,
+    MOVE_KNOCK_OFF,
+    MOVE_BRINE,
+    MOVE_ROOST,
+    MOVE_SOAK,
+    MOVE_WIDE_GUARD,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sRaltsEggMoveLearnset[] = {
+    MOVE_DISABLE,
+    MOVE_MEAN_LOOK,
+    MOVE_MEMENTO,
+    MOVE_DESTINY_BOND,
+    MOVE_GRUDGE,
+    MOVE_SHADOW_SNEAK,
+    MOVE_CONFUSE_RAY,
+    MOVE_ENCORE,
+    MOVE_SYNCHRONOISE,
+    MOVE_SKILL_SWAP,
+    MOVE_MISTY_TERRAIN,
+    MOVE_ALLY_SWITCH,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sSurskitEggMoveLearnset[] = {
+    MOVE_FORESIGHT,
+    MOVE_MUD_SHOT,
+    MOVE_PSYBEAM,
+    MOVE_HYDRO_PUMP,
+    MOVE_MIND_READER,
+    MOVE_SIGNAL_BEAM,
+    MOVE_BUG_BITE,
+    MOVE_AQUA_JET,
+    MOVE_ENDURE,
+    MOVE_FELL_STINGER,
+    MOVE_POWER_SPLIT,
+    MOVE_LUNGE,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sShroomishEggMoveLearnset[] = {
+    MOVE_FAKE_TEARS,
+    MOVE_CHARM,
+    MOVE_HELPING_HAND,
+    MOVE_WORRY_SEED,
+    MOVE_WAKE_UP_SLAP,
+    MOVE_SEED_BOMB,
+    MOVE_BULLET_SEED,
+    MOVE_FOCUS_PUNCH,
+    MOVE_NATURAL_GIFT,
+    MOVE_DRAIN_PUNCH,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sSlakothEggMoveLearnset[] = {
+    MOVE_PURSUIT,
+    MOVE_SLASH,
+    MOVE_BODY_SLAM,
+    MOVE_SNORE,
+    MOVE_CRUSH_CLAW,
+    MOVE_CURSE,
+    MOVE_SLEEP_TALK,
+    MOVE_HAMMER_ARM,
+    MOVE_NIGHT_SLASH,
+    MOVE_AFTER_YOU,
+    MOVE_TICKLE,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sNincadaEggMoveLearnset[] = {
+    MOVE_ENDURE,
+    MOVE_FEINT_ATTACK,
+    MOVE_GUST,
+    MOVE_SILVER_WIND,
+    MOVE_BUG_BUZZ,
+    MOVE_NIGHT_SLASH,
+    MOVE_BUG_BITE,
+    MOVE_FINAL_GAMBIT,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sWhismurEggMoveLearnset[] = {
+    MOVE_TAKE_DOWN,
+    MOVE_SNORE,
+    MOVE_EXTRASENSORY,
+    MOVE_SMELLING_SALTS,
+    MOVE_SMOKESCREEN,
+    MOVE_ENDEAVOR,
+    MOVE_HAMMER_ARM,
+    MOVE_FAKE_TEARS,
+    MOVE_CIRCLE_THROW,
+    MOVE_DISARMING_VOICE,
+    MOVE_WHIRLWIND,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sMakuhitaEggMoveLearnset[] = {
+    MOVE_FEINT_ATTACK,
+    MOVE_DETECT,
+    MOVE_FORESIGHT,
+    MOVE_HELPING_HAND,
+    MOVE_CROSS_CHOP,
+    MOVE_REVENGE,
+    MOVE_DYNAMIC_PUNCH,
+    MOVE_COUNTER,
+    MOVE_WAKE_UP_SLAP,
+    MOVE_BULLET_PUNCH,
+    MOVE_FEINT,
+    MOVE_WIDE_GUARD,
+    MOVE_FOCUS_PUNCH,
+    MOVE_CHIP_AWAY,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sAzurillEggMoveLearnset[] = {
+    MOVE_ENCORE,
+    MOVE_SING,
+    MOVE_REFRESH,
+    MOVE_SLAM,
+    MOVE_TICKLE,
+    MOVE_FAKE_TEARS,
+    MOVE_BODY_SLAM,
+    MOVE_WATER_SPORT,
+    MOVE_SOAK,
+    MOVE_MUDDY_WATER,
+    MOVE_COPYCAT,
+    MOVE_CAMOUFLAGE,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sNosepassEggMoveLearnset[] = {
+    MOVE_MAGNITUDE,
+    MOVE_ROLLOUT,
+    MOVE_DOUBLE_EDGE,
+    MOVE_BLOCK,
+    MOVE_STEALTH_ROCK,
+    MOVE_ENDURE,
+    MOVE_WIDE_GUARD,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sSkittyEggMoveLearnset[] = {
+    MOVE_HELPING_HAND,
+    MOVE_UPROAR,
+    MOVE_FAKE_TEARS,
+    MOVE_WISH,
+    MOVE_BATON_PASS,
+    MOVE_TICKLE,
+    MOVE_LAST_RESORT,
+    MOVE_FAKE_OUT,
+    MOVE_ZEN_HEADBUTT,
+    MOVE_SUCKER_PUNCH,
+    MOVE_MUD_BOMB,
+    MOVE_SIMPLE_BEAM,
+    MOVE_CAPTIVATE,
+    MOVE_COSMIC_POWER,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sSableyeEggMoveLearnset[] = {
+    MOVE_RECOVER,
+    MOVE_MOONLIGHT,
+    MOVE_NASTY_PLOT,
+    MOVE_FLATTER,
+    MOVE_FEINT,
+    MOVE_SUCKER_PUNCH,
+    MOVE_TRICK,
+    MOVE_CAPTIVATE,
+    MOVE_MEAN_LOOK,
+    MOVE_METAL_BURST,
+    MOVE_IMPRISON,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sMawileEggMoveLearnset[] = {
+    MOVE_POISON_FANG,
+    MOVE_ANCIENT_POWER,
+    MOVE_TICKLE,
+    MOVE_SUCKER_PUNCH,
+    MOVE_ICE_FANG,
+    MOVE_FIRE_FANG,
+    MOVE_THUNDER_FANG,
+    MOVE_PUNISHMENT,
+    MOVE_GUARD_SWAP,
+    MOVE_CAPTIVATE,
+    MOVE_SLAM,
+    MOVE_METAL_BURST,
+    MOVE_MISTY_TERRAIN,
+    MOVE_SEISMIC_TOSS,
+    MOVE_POWER_UP_PUNCH,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sAronEggMoveLearnset[] = {
+    MOVE_ENDEAVOR,
+    MOVE_BODY_SLAM,
+    MOVE_STOMP,
+    MOVE_SMELLING_SALTS,
+    MOVE_CURSE,
+    MOVE_SCREECH,
+    MOVE_IRON_HEAD,
+    MOVE_DRAGON_RUSH,
+    MOVE_HEAD_SMASH,
+    MOVE_SUPERPOWER,
+    MOVE_STEALTH_ROCK,
+    MOVE_REVERSAL,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sMedititeEggMoveLearnset[] = {
+    MOVE_FIRE_PUNCH,
+    MOVE_THUNDER_PUNCH,
+    MOVE_ICE_PUNCH,
+    MOVE_FORESIGHT,
+    MOVE_FAKE_OUT,
+    MOVE_BATON_PASS,
+    MOVE_DYNAMIC_PUNCH,
+    MOVE_POWER_SWAP,
+    MOVE_GUARD_SWAP,
+    MOVE_PSYCHO_CUT,
+    MOVE_BULLET_PUNCH,
+    MOVE_DRAIN_PUNCH,
+    MOVE_SECRET_POWER,
+    MOVE_QUICK_GUARD,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sElectrikeEggMoveLearnset[] = {
+    MOVE_CRUNCH,
+    MOVE_HEADBUTT,
+    MOVE_UPROAR,
+    MOVE_CURSE,
+    MOVE_SWIFT,
+    MOVE_DISCHARGE,
+    MOVE_ICE_FANG,
+    MOVE_FIRE_FANG,
+    MOVE_THUNDER_FANG,
+    MOVE_SWITCHEROO,
+    MOVE_ELECTRO_BALL,
+    MOVE_SHOCK_WAVE,
+    MOVE_FLAME_BURST,
+    MOVE_EERIE_IMPULSE,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sPlusleEggMoveLearnset[] = {
+    MOVE_WISH,
+    MOVE_SING,
+    MOVE_SWEET_KISS,
+    MOVE_DISCHARGE,
+    MOVE_LUCKY_CHANT,
+    MOVE_CHARM,
+    MOVE_FAKE_TEARS,
+    MOVE_TEARFUL_LOOK,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sMinunEggMoveLearnset[] = {
+    MOVE_WISH,
+    MOVE_SING,
+    MOVE_SWEET_KISS,
+    MOVE_DISCHARGE,
+    MOVE_LUCKY_CHANT,
+    MOVE_CHARM,
+    MOVE_FAKE_TEARS,
+    MOVE_TEARFUL_LOOK,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sVolbeatEggMoveLearnset[] = {
+    MOVE_BATON_PASS,
+    MOVE_SILVER_WIND,
+    MOVE_TRICK,
+    MOVE_ENCORE,
+    MOVE_BUG_BUZZ,
+    MOVE_DIZZY_PUNCH,
+    MOVE_SEISMIC_TOSS,
+    MOVE_LUNGE,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sIllumiseEggMoveLearnset[] = {
+    MOVE_BATON_PASS,
+    MOVE_SILVER_WIND,
+    MOVE_GROWTH,
+    MOVE_ENCORE,
+    MOVE_BUG_BUZZ,
+    MOVE_CAPTIVATE,
+    MOVE_FAKE_TEARS,
+    MOVE_CONFUSE_RAY,
+    MOVE_AROMATHERAPY,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sRoseliaEggMoveLearnset[] = {
+    MOVE_SPIKES,
+    MOVE_SYNTHESIS,
+    MOVE_PIN_MISSILE,
+    MOVE_COTTON_SPORE,
+    MOVE_SLEEP_POWDER,
+    MOVE_RAZOR_LEAF,
+    MOVE_MIND_READER,
+    MOVE_LEAF_STORM,
+    MOVE_SEED_BOMB,
+    MOVE_GIGA_DRAIN,
+    MOVE_NATURAL_GIFT,
+    MOVE_GRASS_WHISTLE,
+    MOVE_BULLET_SEED,
+    MOVE_POWER_WHIP,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sGulpinEggMoveLearnset[] = {
+    MOVE_ACID_ARMOR,
+    MOVE_SMOG,
+    MOVE_PAIN_SPLIT,
+    MOVE_CURSE,
+    MOVE_DESTINY_BOND,
+    MOVE_MUD_SLAP,
+    MOVE_GUNK_SHOT,
+    MOVE_VENOM_DRENCH,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sCarvanhaEggMoveLearnset[] = {
+    MOVE_HYDRO_PUMP,
+    MOVE_DOUBLE_EDGE,
+    MOVE_THRASH,
+    MOVE_ANCIENT_POWER,
+    MOVE_SWIFT,
+    MOVE_BRINE,
+    MOVE_DESTINY_BOND,
+    MOVE_PSYCHIC_FANGS,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sWailmerEggMoveLearnset[] = {
+    MOVE_DOUBLE_EDGE,
+    MOVE_THRASH,
+    MOVE_SNORE,
+    MOVE_SLEEP_TALK,
+    MOVE_CURSE,
+    MOVE_FISSURE,
+    MOVE_TICKLE,
+    MOVE_DEFENSE_CURL,
+    MOVE_BODY_SLAM,
+    MOVE_AQUA_RING,
+    MOVE_SOAK,
+    MOVE_ZEN_HEADBUTT,
+    MOVE_CLEAR_SMOG,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sNumelEggMoveLearnset[] = {
+    MOVE_HOWL,
+    MOVE_SCARY_FACE,
+    MOVE_BODY_SLAM,
+    MOVE_ROLLOUT,
+    MOVE_DEFENSE_CURL,
+    MOVE_STOMP,
+    MOVE_YAWN,
+    MOVE_ANCIENT_POWER,
+    MOVE_MUD_BOMB,
+    MOVE_HEAT_WAVE,
+    MOVE_STOCKPILE,
+    MOVE_SWALLOW,
+    MOVE_SPIT_UP,
+    MOVE_ENDURE,
+    MOVE_IRON_HEAD,
+    MOVE_GROWTH,
+    MOVE_HEAVY_SLAM,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sTorkoalEggMoveLearnset[] = {
+    MOVE_ERUPTION,
+    MOVE_ENDURE,
+    MOVE_SLEEP_TALK,
+    MOVE_YAWN,
+    MOVE_FISSURE,
+    MOVE_SKULL_BASH,
+    MOVE_FLAME_BURST,
+    MOVE_CLEAR_SMOG,
+    MOVE_SUPERPOWER,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sSpoinkEggMoveLearnset[] = {
+    MOVE_FUTURE_SIGHT,
+    MOVE_EXTRASENSORY,
+    MOVE_TRICK,
+    MOVE_ZEN_HEADBUTT,
+    MOVE_AMNESIA,
+    MOVE_MIRROR_COAT,
+    MOVE_SKILL_SWAP,
+    MOVE_WHIRLWIND,
+    MOVE_LUCKY_CHANT,
+    MOVE_ENDURE,
+    MOVE_SIMPLE_BEAM,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sSpindaEggMoveLearnset[] = {
+    MOVE_ENCORE,
+    MOVE_ASSIST,
+    MOVE_DISABLE,
+    MOVE_BATON_PASS,
+    MOVE_WISH,
+    MOVE_TRICK,
+    MOVE_SMELLING_SALTS,
+    MOVE_FAKE_OUT,
+    MOVE_ROLE_PLAY,
+    MOVE_PSYCHO_CUT,
+    MOVE_FAKE_TEARS,
+    MOVE_RAPID_SPIN,
+    MOVE_ICY_WIND,
+    MOVE_WATER_PULSE,
+    MOVE_PSYCHO_SHIFT,
+    MOVE_GUARD_SPLIT,
+    MOVE_SPOTLIGHT,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sTrapinchEggMoveLearnset[] = {
+    MOVE_FOCUS_ENERGY,
+    MOVE_QUICK_ATTACK,
+    MOVE_GUST,
+    MOVE_FLAIL,
+    MOVE_FURY_CUTTER,
+    MOVE_MUD_SHOT,
+    MOVE_ENDURE,
+    MOVE_EARTH_POWER,
+    MOVE_BUG_BITE,
+    MOVE_SIGNAL_BEAM,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sCacneaEggMoveLearnset[] = {
+    MOVE_GRASS_WHISTLE,
+    MOVE_ACID,
+    MOVE_TEETER_DANCE,
+    MOVE_DYNAMIC_PUNCH,
+    MOVE_COUNTER,
+    MOVE_LOW_KICK,
+    MOVE_SMELLING_SALTS,
+    MOVE_MAGICAL_LEAF,
+    MOVE_SEED_BOMB,
+    MOVE_NASTY_PLOT,
+    MOVE_DISABLE,
+    MOVE_BLOCK,
+    MOVE_WORRY_SEED,
+    MOVE_SWITCHEROO,
+    MOVE_FELL_STINGER,
+    MOVE_BELCH,
+    MOVE_ROTOTILLER,
+    MOVE_POWER_UP_PUNCH,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sSwabluEggMoveLearnset[] = {
+    MOVE_AGILITY,
+    MOVE_HAZE,
+    MOVE_PURSUIT,
+    MOVE_RAGE,
+    MOVE_FEATHER_DANCE,
+    MOVE_DRAGON_RUSH,
+    MOVE_POWER_SWAP,
+    MOVE_ROOST,
+    MOVE_HYPER_VOICE,
+    MOVE_STEEL_WING,
+    MOVE_PLAY_ROUGH,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sZangooseEggMoveLearnset[] = {
+    MOVE_FLAIL,
+    MOVE_DOUBLE_KICK,
+    MOVE_RAZOR_WIND,
+    MOVE_COUNTER,
+    MOVE_CURSE,
+    MOVE_FURY_SWIPES,
+    MOVE_NIGHT_SLASH,
+    MOVE_METAL_CLAW,
+    MOVE_DOUBLE_HIT,
+    MOVE_DISABLE,
+    MOVE_IRON_TAIL,
+    MOVE_FINAL_GAMBIT,
+    MOVE_FEINT,
+    MOVE_QUICK_GUARD,
+    MOVE_BELLY_DRUM,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sSeviperEggMoveLearnset[] = {
+    MOVE_STOCKPILE,
+    MOVE_SWALLOW,
+    MOVE_SPIT_UP,
+    MOVE_BODY_SLAM,
+    MOVE_SCARY_FACE,
+    MOVE_ASSURANCE,
+    MOVE_NIGHT_SLASH,
+    MOVE_SWITCHEROO,
+    MOVE_IRON_TAIL,
+    MOVE_WRING_OUT,
+    MOVE_PUNISHMENT,
+    MOVE_FINAL_GAMBIT,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sBarboachEggMoveLearnset[] = {
+    MOVE_THRASH,
+    MOVE_WHIRLPOOL,
+    MOVE_SPARK,
+    MOVE_HYDRO_PUMP,
+    MOVE_FLAIL,
+    MOVE_TAKE_DOWN,
+    MOVE_DRAGON_DANCE,
+    MOVE_EARTH_POWER,
+    MOVE_MUD_SHOT,
+    MOVE_MUDDY_WATER,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sCorphishEggMoveLearnset[] = {
+    MOVE_MUD_SPORT,
+    MOVE_ENDEAVOR,
+    MOVE_BODY_SLAM,
+    MOVE_ANCIENT_POWER,
+    MOVE_KNOCK_OFF,
+    MOVE_SUPERPOWER,
+    MOVE_METAL_CLAW,
+    MOVE_DRAGON_DANCE,
+    MOVE_TRUMP_CARD,
+    MOVE_CHIP_AWAY,
+    MOVE_DOUBLE_EDGE,
+    MOVE_AQUA_JET,
+    MOVE_SWITCHEROO,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sLileepEggMoveLearnset[] = {
+    MOVE_BARRIER,
+    MOVE_RECOVER,
+    MOVE_MIRROR_COAT,
+    MOVE_WRING_OUT,
+    MOVE_TICKLE,
+    MOVE_CURSE,
+    MOVE_MEGA_DRAIN,
+    MOVE_ENDURE,
+    MOVE_STEALTH_ROCK,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sAnorithEggMoveLearnset[] = {
+    MOVE_RAPID_SPIN,
+    MOVE_KNOCK_OFF,
+    MOVE_SCREECH,
+    MOVE_SAND_ATTACK,
+    MOVE_CROSS_POISON,
+    MOVE_CURSE,
+    MOVE_IRON_DEFENSE,
+    MOVE_WATER_PULSE,
+    MOVE_AQUA_JET,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sFeebasEggMoveLearnset[] = {
+    MOVE_MIRROR_COAT,
+    MOVE_DRAGON_BREATH,
+    MOVE_MUD_SPORT,
+    MOVE_HYPNOSIS,
+    MOVE_CONFUSE_RAY,
+    MOVE_MIST,
+    MOVE_HAZE,
+    MOVE_TICKLE,
+    MOVE_BRINE,
+    MOVE_IRON_TAIL,
+    MOVE_DRAGON_PULSE,
+    MOVE_CAPTIVATE,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sCastformEggMoveLearnset[] = {
+    MOVE_FUTURE_SIGHT,
+    MOVE_LUCKY_CHANT,
+    MOVE_DISABLE,
+    MOVE_AMNESIA,
+    MOVE_OMINOUS_WIND,
+    MOVE_HEX,
+    MOVE_CLEAR_SMOG,
+    MOVE_REFLECT_TYPE,
+    MOVE_GUARD_SWAP,
+    MOVE_COSMIC_POWER,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sKecleonEggMoveLearnset[] = {
+    MOVE_DISABLE,
+    MOVE_MAGIC_COAT,
+    MOVE_TRICK,
+    MOVE_FAKE_OUT,
+    MOVE_NASTY_PLOT,
+    MOVE_DIZZY_PUNCH,
+    MOVE_RECOVER,
+    MOVE_SKILL_SWAP,
+    MOVE_SNATCH,
+    MOVE_FOUL_PLAY,
+    MOVE_CAMOUFLAGE,
+    MOVE_POWER_UP_PUNCH,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sShuppetEggMoveLearnset[] = {
+    MOVE_DISABLE,
+    MOVE_DESTINY_BOND,
+    MOVE_FORESIGHT,
+    MOVE_ASTONISH,
+    MOVE_IMPRISON,
+    MOVE_PURSUIT,
+    MOVE_SHADOW_SNEAK,
+    MOVE_CONFUSE_RAY,
+    MOVE_OMINOUS_WIND,
+    MOVE_GUNK_SHOT,
+    MOVE_PHANTOM_FORCE,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sDuskullEggMoveLearnset[] = {
+    MOVE_IMPRISON,
+    MOVE_DESTINY_BOND,
+    MOVE_PAIN_SPLIT,
+    MOVE_GRUDGE,
+    MOVE_MEMENTO,
+    MOVE_FEINT_ATTACK,
+    MOVE_OMINOUS_WIND,
+    MOVE_DARK_PULSE,
+    MOVE_SKILL_SWAP,
+    MOVE_HAZE,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sTropiusEggMoveLearnset[] = {
+    MOVE_HEADBUTT,
+    MOVE_SLAM,
+    MOVE_RAZOR_WIND,
+    MOVE_LEECH_SEED,
+    MOVE_NATURE_POWER,
+    MOVE_LEAF_STORM,
+    MOVE_SYNTHESIS,
+    MOVE_CURSE,
+    MOVE_LEAF_BLADE,
+    MOVE_DRAGON_DANCE,
+    MOVE_BULLET_SEED,
+    MOVE_NATURAL_GIFT,
+    MOVE_DRAGON_HAMMER,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sChimechoEggMoveLearnset[] = {
+    MOVE_DISABLE,
+    MOVE_CURSE,
+    MOVE_HYPNOSIS,
+    MOVE_WISH,
+    MOVE_FUTURE_SIGHT,
+    MOVE_RECOVER,
+    MOVE_STORED_POWER,
+    MOVE_SKILL_SWAP,
+    MOVE_COSMIC_POWER,
+    MOVE_CRAFTY_SHIELD,
+    MOVE_PERISH_SONG,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sAbsolEggMoveLearnset[] = {
+    MOVE_BATON_PASS,
+    MOVE_FEINT_ATTACK,
+    MOVE_DOUBLE_EDGE,
+    MOVE_MAGIC_COAT,
+    MOVE_CURSE,
+    MOVE_MEAN_LOOK,
+    MOVE_ZEN_HEADBUTT,
+    MOVE_PUNISHMENT,
+    MOVE_SUCKER_PUNCH,
+    MOVE_ASSURANCE,
+    MOVE_ME_FIRST,
+    MOVE_MEGAHORN,
+    MOVE_HEX,
+    MOVE_PERISH_SONG,
+    MOVE_PLAY_ROUGH,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sSnoruntEggMoveLearnset[] = {
+    MOVE_BLOCK,
+    MOVE_SPIKES,
+    MOVE_ROLLOUT,
+    MOVE_DISABLE,
+    MOVE_BIDE,
+    MOVE_WEATHER_BALL,
+    MOVE_AVALANCHE,
+    MOVE_HEX,
+    MOVE_FAKE_TEARS,
+    MOVE_SWITCHEROO,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sSphealEggMoveLearnset[] = {
+    MOVE_WATER_SPORT,
+    MOVE_STOCKPILE,
+    MOVE_SWALLOW,
+    MOVE_SPIT_UP,
+    MOVE_YAWN,
+    MOVE_CURSE,
+    MOVE_FISSURE,
+    MOVE_SIGNAL_BEAM,
+    MOVE_AQUA_RING,
+    MOVE_ROLLOUT,
+    MOVE_SLEEP_TALK,
+    MOVE_WATER_PULSE,
+    MOVE_BELLY_DRUM,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sClamperlEggMoveLearnset[] = {
+    MOVE_REFRESH,
+    MOVE_MUD_SPORT,
+    MOVE_BODY_SLAM,
+    MOVE_SUPERSONIC,
+    MOVE_BARRIER,
+    MOVE_CONFUSE_RAY,
+    MOVE_AQUA_RING,
+    MOVE_MUDDY_WATER,
+    MOVE_WATER_PULSE,
+    MOVE_BRINE,
+    MOVE_ENDURE,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sRelicanthEggMoveLearnset[] = {
+    MOVE_MAGNITUDE,
+    MOVE_SKULL_BASH,
+    MOVE_WATER_SPORT,
+    MOVE_AMNESIA,
+    MOVE_SLEEP_TALK,
+    MOVE_AQUA_TAIL,
+    MOVE_SNORE,
+    MOVE_MUD_SLAP,
+    MOVE_MUDDY_WATER,
+    MOVE_MUD_SHOT,
+    MOVE_BRINE,
+    MOVE_ZEN_HEADBUTT,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sLuvdiscEggMoveLearnset[] = {
+    MOVE_SPLASH,
+    MOVE_SUPERSONIC,
+    MOVE_WATER_SPORT,
+    MOVE_MUD_SPORT,
+    MOVE_CAPTIVATE,
+    MOVE_AQUA_RING,
+    MOVE_AQUA_JET,
+    MOVE_HEAL_PULSE,
+    MOVE_BRINE,
+    MOVE_ENTRAINMENT,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sBagonEggMoveLearnset[] = {
+    MOVE_HYDRO_PUMP,
+    MOVE_THRASH,
+    MOVE_DRAGON_RAGE,
+    MOVE_TWISTER,
+    MOVE_DRAGON_DANCE,
+    MOVE_FIRE_FANG,
+    MOVE_DRAGON_RUSH,
+    MOVE_DRAGON_PULSE,
+    MOVE_ENDURE,
+    MOVE_DEFENSE_CURL,
+    MOVE_UNAVAILABLE,
+};
+
+#if P_GEN_4_POKEMON == TRUE
+static const u16 sTurtwigEggMoveLearnset[] = {
+    MOVE_WORRY_SEED,
+    MOVE_GROWTH,
+    MOVE_TICKLE,
+    MOVE_BODY_SLAM,
+    MOVE_DOUBLE_EDGE,
+    MOVE_SAND_TOMB,
+    MOVE_SEED_BOMB,
+    MOVE_THRASH,
+    MOVE_AMNESIA,
+    MOVE_SUPERPOWER,
+    MOVE_STOCKPILE,
+    MOVE_SWALLOW,
+    MOVE_SPIT_UP,
+    MOVE_EARTH_POWER,
+    MOVE_WIDE_GUARD,
+    MOVE_GRASSY_TERRAIN,
+    MOVE_HEAVY_SLAM,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sChimcharEggMoveLearnset[] = {
+    MOVE_FIRE_PUNCH,
+    MOVE_THUNDER_PUNCH,
+    MOVE_DOUBLE_KICK,
+    MOVE_ENCORE,
+    MOVE_HEAT_WAVE,
+    MOVE_FOCUS_ENERGY,
+    MOVE_HELPING_HAND,
+    MOVE_FAKE_OUT,
+    MOVE_BLAZE_KICK,
+    MOVE_COUNTER,
+    MOVE_ASSIST,
+    MOVE_QUICK_GUARD,
+    MOVE_FOCUS_PUNCH,
+    MOVE_SUBMISSION,
+    MOVE_POWER_UP_PUNCH,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sPiplupEggMoveLearnset[] = {
+    MOVE_DOUBLE_HIT,
+    MOVE_SUPERSONIC,
+    MOVE_YAWN,
+    MOVE_MUD_SPORT,
+    MOVE_MUD_SLAP,
+    MOVE_SNORE,
+    MOVE_FLAIL,
+    MOVE_AGILITY,
+    MOVE_AQUA_RING,
+    MOVE_HYDRO_PUMP,
+    MOVE_FEATHER_DANCE,
+    MOVE_BIDE,
+    MOVE_ICY_WIND,
+    MOVE_POWER_TRIP,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sStarlyEggMoveLearnset[] = {
+    MOVE_FEATHER_DANCE,
+    MOVE_FURY_ATTACK,
+    MOVE_PURSUIT,
+    MOVE_ASTONISH,
+    MOVE_SAND_ATTACK,
+    MOVE_FORESIGHT,
+    MOVE_DOUBLE_EDGE,
+    MOVE_STEEL_WING,
+    MOVE_UPROAR,
+    MOVE_ROOST,
+    MOVE_DETECT,
+    MOVE_REVENGE,
+    MOVE_MIRROR_MOVE,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sBidoofEggMoveLearnset[] = {
+    MOVE_QUICK_ATTACK,
+    MOVE_WATER_SPORT,
+    MOVE_DOUBLE_EDGE,
+    MOVE_FURY_SWIPES,
+    MOVE_DEFENSE_CURL,
+    MOVE_ROLLOUT,
+    MOVE_ODOR_SLEUTH,
+    MOVE_AQUA_TAIL,
+    MOVE_ROCK_CLIMB,
+    MOVE_SLEEP_TALK,
+    MOVE_ENDURE,
+    MOVE_SKULL_BASH,
+    MOVE_MUD_SPORT,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sShinxEggMoveLearnset[] = {
+    MOVE_ICE_FANG,
+    MOVE_FIRE_FANG,
+    MOVE_THUNDER_FANG,
+    MOVE_QUICK_ATTACK,
+    MOVE_HOWL,
+    MOVE_TAKE_DOWN,
+    MOVE_NIGHT_SLASH,
+    MOVE_SHOCK_WAVE,
+    MOVE_SWIFT,
+    MOVE_DOUBLE_KICK,
+    MOVE_SIGNAL_BEAM,
+    MOVE_HELPING_HAND,
+    MOVE_EERIE_IMPULSE,
+    MOVE_FAKE_TEARS,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sBudewEggMoveLearnset[] = {
+    MOVE_SPIKES,
+    MOVE_SYNTHESIS,
+    MOVE_PIN_MISSILE,
+    MOVE_COTTON_SPORE,
+    MOVE_SLEEP_POWDER,
+    MOVE_RAZOR_LEAF,
+    MOVE_MIND_READER,
+    MOVE_LEAF_STORM,
+    MOVE_EXTRASENSORY,
+    MOVE_SEED_BOMB,
+    MOVE_GIGA_DRAIN,
+    MOVE_NATURAL_GIFT,
+    MOVE_GRASS_WHISTLE,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sCranidosEggMoveLearnset[] = {
+    MOVE_CRUNCH,
+    MOVE_THRASH,
+    MOVE_DOUBLE_EDGE,
+    MOVE_LEER,
+    MOVE_SLAM,
+    MOVE_STOMP,
+    MOVE_WHIRLWIND,
+    MOVE_HAMMER_ARM,
+    MOVE_CURSE,
+    MOVE_IRON_TAIL,
+    MOVE_IRON_HEAD,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sShieldonEggMoveLearnset[] = {
+    MOVE_HEADBUTT,
+    MOVE_SCARY_FACE,
+    MOVE_FOCUS_ENERGY,
+    MOVE_DOUBLE_EDGE,
+    MOVE_ROCK_BLAST,
+    MOVE_BODY_SLAM,
+    MOVE_SCREECH,
+    MOVE_CURSE,
+    MOVE_FISSURE,
+    MOVE_COUNTER,
+    MOVE_STEALTH_ROCK,
+    MOVE_WIDE_GUARD,
+    MOVE_GUARD_SPLIT,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sPachirisuEggMoveLearnset[] = {
+    MOVE_COVET,
+    MOVE_BITE,
+    MOVE_FAKE_TEARS,
+    MOVE_DEFENSE_CURL,
+    MOVE_ROLLOUT,
+    MOVE_FLATTER,
+    MOVE_FLAIL,
+    MOVE_IRON_TAIL,
+    MOVE_TAIL_WHIP,
+    MOVE_FOLLOW_ME,
+    MOVE_CHARGE,
+    MOVE_BESTOW,
+    MOVE_ION_DELUGE,
+    MOVE_BABY_DOLL_EYES,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sBuizelEggMoveLearnset[] = {
+    MOVE_MUD_SLAP,
+    MOVE_HEADBUTT,
+    MOVE_FURY_SWIPES,
+    MOVE_SLASH,
+    MOVE_ODOR_SLEUTH,
+    MOVE_DOUBLE_SLAP,
+    MOVE_FURY_CUTTER,
+    MOVE_BATON_PASS,
+    MOVE_AQUA_TAIL,
+    MOVE_AQUA_RING,
+    MOVE_ME_FIRST,
+    MOVE_SWITCHEROO,
+    MOVE_TAIL_SLAP,
+    MOVE_SOAK,
+    MOVE_HELPING_HAND,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sCherubiEggMoveLearnset[] = {
+    MOVE_RAZOR_LEAF,
+    MOVE_SWEET_SCENT,
+    MOVE_TICKLE,
+    MOVE_NATURE_POWER,
+    MOVE_GRASS_WHISTLE,
+    MOVE_AROMATHERAPY,
+    MOVE_WEATHER_BALL,
+    MOVE_HEAL_PULSE,
+    MOVE_HEALING_WISH,
+    MOVE_SEED_BOMB,
+    MOVE_NATURAL_GIFT,
+    MOVE_DEFENSE_CURL,
+    MOVE_ROLLOUT,
+    MOVE_FLOWER_SHIELD,
+    MOVE_GRASSY_TERRAIN,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sShellosEggMoveLearnset[] = {
+    MOVE_COUNTER,
+    MOVE_MIRROR_COAT,
+    MOVE_STOCKPILE,
+    MOVE_SWALLOW,
+    MOVE_SPIT_UP,
+    MOVE_YAWN,
+    MOVE_MEMENTO,
+    MOVE_CURSE,
+    MOVE_AMNESIA,
+    MOVE_FISSURE,
+    MOVE_TRUMP_CARD,
+    MOVE_SLUDGE,
+    MOVE_CLEAR_SMOG,
+    MOVE_BRINE,
+    MOVE_MIST,
+    MOVE_ACID_ARMOR,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sDrifloonEggMoveLearnset[] = {
+    MOVE_MEMENTO,
+    MOVE_BODY_SLAM,
+    MOVE_DESTINY_BOND,
+    MOVE_DISABLE,
+    MOVE_HAZE,
+    MOVE_HYPNOSIS,
+    MOVE_WEATHER_BALL,
+    MOVE_CLEAR_SMOG,
+    MOVE_DEFOG,
+    MOVE_TAILWIND,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sBunearyEggMoveLearnset[] = {
+    MOVE_FAKE_TEARS,
+    MOVE_FAKE_OUT,
+    MOVE_ENCORE,
+    MOVE_SWEET_KISS,
+    MOVE_DOUBLE_HIT,
+    MOVE_LOW_KICK,
+    MOVE_SKY_UPPERCUT,
+    MOVE_SWITCHEROO,
+    MOVE_THUNDER_PUNCH,
+    MOVE_ICE_PUNCH,
+    MOVE_FIRE_PUNCH,
+    MOVE_FLAIL,
+    MOVE_FOCUS_PUNCH,
+    MOVE_CIRCLE_THROW,
+    MOVE_COPYCAT,
+    MOVE_TEETER_DANCE,
+    MOVE_COSMIC_POWER,
+    MOVE_MUD_SPORT,
+    MOVE_POWER_UP_PUNCH,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sGlameowEggMoveLearnset[] = {
+    MOVE_BITE,
+    MOVE_TAIL_WHIP,
+    MOVE_QUICK_ATTACK,
+    MOVE_SAND_ATTACK,
+    MOVE_FAKE_TEARS,
+    MOVE_ASSURANCE,
+    MOVE_FLAIL,
+    MOVE_SNATCH,
+    MOVE_WAKE_UP_SLAP,
+    MOVE_LAST_RESORT,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sChinglingEggMoveLearnset[] = {
+    MOVE_DISABLE,
+    MOVE_CURSE,
+    MOVE_HYPNOSIS,
+    MOVE_WISH,
+    MOVE_FUTURE_SIGHT,
+    MOVE_RECOVER,
+    MOVE_STORED_POWER,
+    MOVE_SKILL_SWAP,
+    MOVE_COSMIC_POWER,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sStunkyEggMoveLearnset[] = {
+    MOVE_PURSUIT,
+    MOVE_LEER,
+    MOVE_SMOG,
+    MOVE_DOUBLE_EDGE,
+    MOVE_CRUNCH,
+    MOVE_SCARY_FACE,
+    MOVE_ASTONISH,
+    MOVE_PUNISHMENT,
+    MOVE_HAZE,
+    MOVE_IRON_TAIL,
+    MOVE_FOUL_PLAY,
+    MOVE_FLAME_BURST,
+    MOVE_PLAY_ROUGH,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sBonslyEggMoveLearnset[] = {
+    MOVE_SELF_DESTRUCT,
+    MOVE_HEADBUTT,
+    MOVE_HARDEN,
+    MOVE_DEFENSE_CURL,
+    MOVE_ROLLOUT,
+    MOVE_SAND_TOMB,
+    MOVE_STEALTH_ROCK,
+    MOVE_CURSE,
+    MOVE_ENDURE,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sMimeJrEggMoveLearnset[] = {
+    MOVE_FUTURE_SIGHT,
+    MOVE_HYPNOSIS,
+    MOVE_MIMIC,
+    MOVE_FAKE_OUT,
+    MOVE_TRICK,
+    MOVE_CONFUSE_RAY,
+    MOVE_WAKE_UP_SLAP,
+    MOVE_TEETER_DANCE,
+    MOVE_HEALING_WISH,
+    MOVE_CHARM,
+    MOVE_NASTY_PLOT,
+    MOVE_POWER_SPLIT,
+    MOVE_MAGIC_ROOM,
+    MOVE_ICY_WIND,
+    MOVE_PSYCHIC_TERRAIN,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sHappinyEggMoveLearnset[] = {
+    MOVE_PRESENT,
+    MOVE_METRONOME,
+    MOVE_HEAL_BELL,
+    MOVE_AROMATHERAPY,
+    MOVE_COUNTER,
+    MOVE_HELPING_HAND,
+    MOVE_GRAVITY,
+    MOVE_LAST_RESORT,
+    MOVE_MUD_BOMB,
+    MOVE_NATURAL_GIFT,
+    MOVE_ENDURE,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sChatotEggMoveLearnset[] = {
+    MOVE_ENCORE,
+    MOVE_NIGHT_SHADE,
+    MOVE_AGILITY,
+    MOVE_NASTY_PLOT,
+    MOVE_SUPERSONIC,
+    MOVE_STEEL_WING,
+    MOVE_SLEEP_TALK,
+    MOVE_DEFOG,
+    MOVE_AIR_CUTTER,
+    MOVE_BOOMBURST,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sSpiritombEggMoveLearnset[] = {
+    MOVE_DESTINY_BOND,
+    MOVE_PAIN_SPLIT,
+    MOVE_SMOKESCREEN,
+    MOVE_IMPRISON,
+    MOVE_GRUDGE,
+    MOVE_SHADOW_SNEAK,
+    MOVE_CAPTIVATE,
+    MOVE_NIGHTMARE,
+    MOVE_FOUL_PLAY,
+    MOVE_DISABLE,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sGibleEggMoveLearnset[] = {
+    MOVE_DRAGON_BREATH,
+    MOVE_OUTRAGE,
+    MOVE_TWISTER,
+    MOVE_SCARY_FACE,
+    MOVE_DOUBLE_EDGE,
+    MOVE_THRASH,
+    MOVE_METAL_CLAW,
+    MOVE_SAND_TOMB,
+    MOVE_BODY_SLAM,
+    MOVE_IRON_HEAD,
+    MOVE_MUD_SHOT,
+    MOVE_ROCK_CLIMB,
+    MOVE_IRON_TAIL,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sMunchlaxEggMoveLearnset[] = {
+    MOVE_LICK,
+    MOVE_CHARM,
+    MOVE_DOUBLE_EDGE,
+    MOVE_CURSE,
+    MOVE_WHIRLWIND,
+    MOVE_PURSUIT,
+    MOVE_ZEN_HEADBUTT,
+    MOVE_COUNTER,
+    MOVE_NATURAL_GIFT,
+    MOVE_AFTER_YOU,
+    MOVE_SELF_DESTRUCT,
+    MOVE_BELCH,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sRioluEggMoveLearnset[] = {
+    MOVE_CROSS_CHOP,
+    MOVE_DETECT,
+    MOVE_BITE,
+    MOVE_MIND_READER,
+    MOVE_SKY_UPPERCUT,
+    MOVE_HIGH_JUMP_KICK,
+    MOVE_AGILITY,
+    MOVE_VACUUM_WAVE,
+    MOVE_CRUNCH,
+    MOVE_LOW_KICK,
+    MOVE_IRON_DEFENSE,
+    MOVE_BLAZE_KICK,
+    MOVE_BULLET_PUNCH,
+    MOVE_FOLLOW_ME,
+    MOVE_CIRCLE_THROW,
+    MOVE_METEOR_MASH,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sHippopotasEggMoveLearnset[] = {
+    MOVE_STOCKPILE,
+    MOVE_SWALLOW,
+    MOVE_SPIT_UP,
+    MOVE_CURSE,
+    MOVE_SLACK_OFF,
+    MOVE_BODY_SLAM,
+    MOVE_SAND_TOMB,
+    MOVE_REVENGE,
+    MOVE_SLEEP_TALK,
+    MOVE_WHIRLWIND,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sSkorupiEggMoveLearnset[] = {
+    MOVE_FEINT_ATTACK,
+    MOVE_SCREECH,
+    MOVE_SAND_ATTACK,
+    MOVE_SLASH,
+    MOVE_CONFUSE_RAY,
+    MOVE_WHIRLWIND,
+    MOVE_AGILITY,
+    MOVE_PURSUIT,
+    MOVE_NIGHT_SLASH,
+    MOVE_IRON_TAIL,
+    MOVE_TWINEEDLE,
+    MOVE_POISON_TAIL,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sCroagunkEggMoveLearnset[] = {
+    MOVE_ME_FIRST,
+    MOVE_FEINT,
+    MOVE_DYNAMIC_PUNCH,
+    MOVE_HEADBUTT,
+    MOVE_VACUUM_WAVE,
+    MOVE_MEDITATE,
+    MOVE_FAKE_OUT,
+    MOVE_WAKE_UP_SLAP,
+    MOVE_SMELLING_SALTS,
+    MOVE_CROSS_CHOP,
+    MOVE_BULLET_PUNCH,
+    MOVE_COUNTER,
+    MOVE_DRAIN_PUNCH,
+    MOVE_ACUPRESSURE,
+    MOVE_QUICK_GUARD,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sCarnivineEggMoveLearnset[] = {
+    MOVE_SLEEP_POWDER,
+    MOVE_STUN_SPORE,
+    MOVE_RAZOR_LEAF,
+    MOVE_SLAM,
+    MOVE_SYNTHESIS,
+    MOVE_MAGICAL_LEAF,
+    MOVE_LEECH_SEED,
+    MOVE_WORRY_SEED,
+    MOVE_GIGA_DRAIN,
+    MOVE_RAGE_POWDER,
+    MOVE_GRASS_WHISTLE,
+    MOVE_ACID_SPRAY,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sFinneonEggMoveLearnset[] = {
+    MOVE_SWEET_KISS,
+    MOVE_CHARM,
+    MOVE_FLAIL,
+    MOVE_AQUA_TAIL,
+    MOVE_SPLASH,
+    MOVE_PSYBEAM,
+    MOVE_TICKLE,
+    MOVE_AGILITY,
+    MOVE_BRINE,
+    MOVE_AURORA_BEAM,
+    MOVE_SIGNAL_BEAM,
+    MOVE_CONFUSE_RAY,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sMantykeEggMoveLearnset[] = {
+    MOVE_TWISTER,
+    MOVE_HYDRO_PUMP,
+    MOVE_HAZE,
+    MOVE_SLAM,
+    MOVE_MUD_SPORT,
+    MOVE_MIRROR_COAT,
+    MOVE_WATER_SPORT,
+    MOVE_SPLASH,
+    MOVE_SIGNAL_BEAM,
+    MOVE_WIDE_GUARD,
+    MOVE_AMNESIA,
+    MOVE_TAILWIND,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sSnoverEggMoveLearnset[] = {
+    MOVE_LEECH_SEED,
+    MOVE_MAGICAL_LEAF,
+    MOVE_SEED_BOMB,
+    MOVE_GROWTH,
+    MOVE_DOUBLE_EDGE,
+    MOVE_MIST,
+    MOVE_STOMP,
+    MOVE_SKULL_BASH,
+    MOVE_AVALANCHE,
+    MOVE_NATURAL_GIFT,
+    MOVE_BULLET_SEED,
+    MOVE_UNAVAILABLE,
+};
+#endif
+
+#if P_GEN_5_POKEMON == TRUE
+static const u16 sSnivyEggMoveLearnset[] = {
+    MOVE_CAPTIVATE,
+    MOVE_NATURAL_GIFT,
+    MOVE_GLARE,
+    MOVE_IRON_TAIL,
+    MOVE_MAGICAL_LEAF,
+    MOVE_SWEET_SCENT,
+    MOVE_MIRROR_COAT,
+    MOVE_PURSUIT,
+    MOVE_MEAN_LOOK,
+    MOVE_TWISTER,
+    MOVE_GRASSY_TERRAIN,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sTepigEggMoveLearnset[] = {
+    MOVE_COVET,
+    MOVE_BODY_SLAM,
+    MOVE_THRASH,
+    MOVE_MAGNITUDE,
+    MOVE_SUPERPOWER,
+    MOVE_CURSE,
+    MOVE_ENDEAVOR,
+    MOVE_YAWN,
+    MOVE_SLEEP_TALK,
+    MOVE_HEAVY_SLAM,
+    MOVE_SUCKER_PUNCH,
+    MOVE_BURN_UP,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sOshawottEggMoveLearnset[] = {
+    MOVE_COPYCAT,
+    MOVE_DETECT,
+    MOVE_AIR_SLASH,
+    MOVE_ASSURANCE,
+    MOVE_BRINE,
+    MOVE_NIGHT_SLASH,
+    MOVE_TRUMP_CARD,
+    MOVE_SCREECH,
+    MOVE_SACRED_SWORD,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sPatratEggMoveLearnset[] = {
+    MOVE_FORESIGHT,
+    MOVE_IRON_TAIL,
+    MOVE_SCREECH,
+    MOVE_ASSURANCE,
+    MOVE_PURSUIT,
+    MOVE_REVENGE,
+    MOVE_FLAIL,
+    MOVE_TEARFUL_LOOK,
+    MOVE_BULLET_SEED,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sLillipupEggMoveLearnset[] = {
+    MOVE_HOWL,
+    MOVE_SAND_ATTACK,
+    MOVE_MUD_SLAP,
+    MOVE_LICK,
+    MOVE_CHARM,
+    MOVE_ENDURE,
+    MOVE_YAWN,
+    MOVE_PURSUIT,
+    MOVE_FIRE_FANG,
+    MOVE_THUNDER_FANG,
+    MOVE_ICE_FANG,
+    MOVE_AFTER_YOU,
+    MOVE_PSYCHIC_FANGS,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sPurrloinEggMoveLearnset[] = {
+    MOVE_PAY_DAY,
+    MOVE_FOUL_PLAY,
+    MOVE_FEINT_ATTACK,
+    MOVE_FAKE_TEARS,
+    MOVE_CHARM,
+    MOVE_ENCORE,
+    MOVE_YAWN,
+    MOVE_COVET,
+    MOVE_COPYCAT,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sPansageEggMoveLearnset[] = {
+    MOVE_COVET,
+    MOVE_LOW_KICK,
+    MOVE_TICKLE,
+    MOVE_NASTY_PLOT,
+    MOVE_ROLE_PLAY,
+    MOVE_ASTONISH,
+    MOVE_GRASS_WHISTLE,
+    MOVE_MAGICAL_LEAF,
+    MOVE_BULLET_SEED,
+    MOVE_LEAF_STORM,
+    MOVE_DISARMING_VOICE,
+    MOVE_SPIKY_SHIELD,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sPansearEggMoveLearnset[] = {
+    MOVE_COVET,
+    MOVE_LOW_KICK,
+    MOVE_TICKLE,
+    MOVE_NASTY_PLOT,
+    MOVE_ROLE_PLAY,
+    MOVE_ASTONISH,
+    MOVE_SLEEP_TALK,
+    MOVE_FIRE_SPIN,
+    MOVE_FIRE_PUNCH,
+    MOVE_HEAT_WAVE,
+    MOVE_DISARMING_VOICE,
+    MOVE_BELCH,
+    MOVE_FLARE_BLITZ,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sPanpourEggMoveLearnset[] = {
+    MOVE_COVET,
+    MOVE_LOW_KICK,
+    MOVE_TICKLE,
+    MOVE_NASTY_PLOT,
+    MOVE_ROLE_PLAY,
+    MOVE_ASTONISH,
+    MOVE_AQUA_RING,
+    MOVE_AQUA_TAIL,
+    MOVE_MUD_SPORT,
+    MOVE_HYDRO_PUMP,
+    MOVE_DISARMING_VOICE,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sMunnaEggMoveLearnset[] = {
+    MOVE_SLEEP_TALK,
+    MOVE_SECRET_POWER,
+    MOVE_BARRIER,
+    MOVE_MAGIC_COAT,
+    MOVE_HELPING_HAND,
+    MOVE_BATON_PASS,
+    MOVE_SWIFT,
+    MOVE_CURSE,
+    MOVE_SONIC_BOOM,
+    MOVE_HEALING_WISH,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sPidoveEggMoveLearnset[] = {
+    MOVE_STEEL_WING,
+    MOVE_HYPNOSIS,
+    MOVE_UPROAR,
+    MOVE_BESTOW,
+    MOVE_WISH,
+    MOVE_MORNING_SUN,
+    MOVE_LUCKY_CHANT,
+    MOVE_NIGHT_SLASH,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sBlitzleEggMoveLearnset[] = {
+    MOVE_ME_FIRST,
+    MOVE_TAKE_DOWN,
+    MOVE_SAND_ATTACK,
+    MOVE_DOUBLE_KICK,
+    MOVE_SCREECH,
+    MOVE_RAGE,
+    MOVE_ENDURE,
+    MOVE_DOUBLE_EDGE,
+    MOVE_SHOCK_WAVE,
+    MOVE_SNATCH,
+    MOVE_FEINT,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sRoggenrolaEggMoveLearnset[] = {
+    MOVE_MAGNITUDE,
+    MOVE_CURSE,
+    MOVE_AUTOTOMIZE,
+    MOVE_ROCK_TOMB,
+    MOVE_LOCK_ON,
+    MOVE_HEAVY_SLAM,
+    MOVE_TAKE_DOWN,
+    MOVE_GRAVITY,
+    MOVE_WIDE_GUARD,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sWoobatEggMoveLearnset[] = {
+    MOVE_CHARM,
+    MOVE_KNOCK_OFF,
+    MOVE_FAKE_TEARS,
+    MOVE_SUPERSONIC,
+    MOVE_SYNCHRONOISE,
+    MOVE_STORED_POWER,
+    MOVE_ROOST,
+    MOVE_FLATTER,
+    MOVE_HELPING_HAND,
+    MOVE_CAPTIVATE,
+    MOVE_VENOM_DRENCH,
+    MOVE_PSYCHO_SHIFT,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sDrilburEggMoveLearnset[] = {
+    MOVE_IRON_DEFENSE,
+    MOVE_RAPID_SPIN,
+    MOVE_EARTH_POWER,
+    MOVE_CRUSH_CLAW,
+    MOVE_METAL_SOUND,
+    MOVE_SUBMISSION,
+    MOVE_SKULL_BASH,
+    MOVE_ROCK_CLIMB,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sAudinoEggMoveLearnset[] = {
+    MOVE_WISH,
+    MOVE_HEAL_BELL,
+    MOVE_LUCKY_CHANT,
+    MOVE_ENCORE,
+    MOVE_BESTOW,
+    MOVE_SWEET_KISS,
+    MOVE_YAWN,
+    MOVE_SLEEP_TALK,
+    MOVE_HEALING_WISH,
+    MOVE_AMNESIA,
+    MOVE_DRAINING_KISS,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sTimburrEggMoveLearnset[] = {
+    MOVE_DRAIN_PUNCH,
+    MOVE_ENDURE,
+    MOVE_COUNTER,
+    MOVE_COMET_PUNCH,
+    MOVE_FORESIGHT,
+    MOVE_SMELLING_SALTS,
+    MOVE_DETECT,
+    MOVE_WIDE_GUARD,
+    MOVE_FORCE_PALM,
+    MOVE_REVERSAL,
+    MOVE_MACH_PUNCH,
+    MOVE_POWER_UP_PUNCH,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sTympoleEggMoveLearnset[] = {
+    MOVE_WATER_PULSE,
+    MOVE_REFRESH,
+    MOVE_MUD_SPORT,
+    MOVE_MUD_BOMB,
+    MOVE_SLEEP_TALK,
+    MOVE_SNORE,
+    MOVE_MIST,
+    MOVE_EARTH_POWER,
+    MOVE_AFTER_YOU,
+    MOVE_VENOM_DRENCH,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sSewaddleEggMoveLearnset[] = {
+    MOVE_SILVER_WIND,
+    MOVE_SCREECH,
+    MOVE_RAZOR_WIND,
+    MOVE_MIND_READER,
+    MOVE_AGILITY,
+    MOVE_ME_FIRST,
+    MOVE_BATON_PASS,
+    MOVE_CAMOUFLAGE,
+    MOVE_AIR_SLASH,
+    MOVE_GRASSY_TERRAIN,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sVenipedeEggMoveLearnset[] = {
+    MOVE_TWINEEDLE,
+    MOVE_PIN_MISSILE,
+    MOVE_TOXIC_SPIKES,
+    MOVE_SPIKES,
+    MOVE_TAKE_DOWN,
+    MOVE_ROCK_CLIMB,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sCottoneeEggMoveLearnset[] = {
+    MOVE_NATURAL_GIFT,
+    MOVE_ENCORE,
+    MOVE_TICKLE,
+    MOVE_FAKE_TEARS,
+    MOVE_GRASS_WHISTLE,
+    MOVE_MEMENTO,
+    MOVE_BEAT_UP,
+    MOVE_SWITCHEROO,
+    MOVE_WORRY_SEED,
+    MOVE_CAPTIVATE,
+    MOVE_MISTY_TERRAIN,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sPetililEggMoveLearnset[] = {
+    MOVE_NATURAL_GIFT,
+    MOVE_CHARM,
+    MOVE_ENDURE,
+    MOVE_INGRAIN,
+    MOVE_WORRY_SEED,
+    MOVE_GRASS_WHISTLE,
+    MOVE_SWEET_SCENT,
+    MOVE_BIDE,
+    MOVE_HEALING_WISH,
+    MOVE_ENCORE,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sBasculinEggMoveLearnset[] = {
+    MOVE_SWIFT,
+    MOVE_BUBBLE_BEAM,
+    MOVE_MUD_SHOT,
+    MOVE_MUDDY_WATER,
+    MOVE_AGILITY,
+    MOVE_WHIRLPOOL,
+    MOVE_RAGE,
+    MOVE_BRINE,
+    MOVE_REVENGE,
+    MOVE_HEAD_SMASH,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sSandileEggMoveLearnset[] = {
+    MOVE_DOUBLE_EDGE,
+    MOVE_ROCK_CLIMB,
+    MOVE_PURSUIT,
+    MOVE_UPROAR,
+    MOVE_FIRE_FANG,
+    MOVE_THUNDER_FANG,
+    MOVE_BEAT_UP,
+    MOVE_FOCUS_ENERGY,
+    MOVE_COUNTER,
+    MOVE_MEAN_LOOK,
+    MOVE_ME_FIRST,
+    MOVE_POWER_TRIP,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sDarumakaEggMoveLearnset[] = {
+    MOVE_SLEEP_TALK,
+    MOVE_FOCUS_PUNCH,
+    MOVE_FOCUS_ENERGY,
+    MOVE_ENDURE,
+    MOVE_HAMMER_ARM,
+    MOVE_TAKE_DOWN,
+    MOVE_FLAME_WHEEL,
+    MOVE_ENCORE,
+    MOVE_YAWN,
+    MOVE_SNATCH,
+    MOVE_EXTRASENSORY,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sMaractusEggMoveLearnset[] = {
+    MOVE_BULLET_SEED,
+    MOVE_BOUNCE,
+    MOVE_WORRY_SEED,
+    MOVE_LEECH_SEED,
+    MOVE_SEED_BOMB,
+    MOVE_WOOD_HAMMER,
+    MOVE_SPIKES,
+    MOVE_GRASS_WHISTLE,
+    MOVE_GRASSY_TERRAIN,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sDwebbleEggMoveLearnset[] = {
+    MOVE_ENDURE,
+    MOVE_IRON_DEFENSE,
+    MOVE_NIGHT_SLASH,
+    MOVE_SAND_TOMB,
+    MOVE_COUNTER,
+    MOVE_CURSE,
+    MOVE_SPIKES,
+    MOVE_BLOCK,
+    MOVE_WIDE_GUARD,
+    MOVE_ROTOTILLER,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sScraggyEggMoveLearnset[] = {
+    MOVE_DRAIN_PUNCH,
+    MOVE_COUNTER,
+    MOVE_DRAGON_DANCE,
+    MOVE_DETECT,
+    MOVE_FAKE_OUT,
+    MOVE_FIRE_PUNCH,
+    MOVE_ICE_PUNCH,
+    MOVE_THUNDER_PUNCH,
+    MOVE_AMNESIA,
+    MOVE_FEINT_ATTACK,
+    MOVE_ZEN_HEADBUTT,
+    MOVE_QUICK_GUARD,
+    MOVE_POWER_UP_PUNCH,
+    MOVE_ACID_SPRAY,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sSigilyphEggMoveLearnset[] = {
+    MOVE_STORED_POWER,
+    MOVE_PSYCHO_SHIFT,
+    MOVE_ANCIENT_POWER,
+    MOVE_STEEL_WING,
+    MOVE_ROOST,
+    MOVE_SKILL_SWAP,
+    MOVE_FUTURE_SIGHT,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sYamaskEggMoveLearnset[] = {
+    MOVE_MEMENTO,
+    MOVE_FAKE_TEARS,
+    MOVE_NASTY_PLOT,
+    MOVE_ENDURE,
+    MOVE_HEAL_BLOCK,
+    MOVE_IMPRISON,
+    MOVE_NIGHTMARE,
+    MOVE_DISABLE,
+    MOVE_ALLY_SWITCH,
+    MOVE_TOXIC_SPIKES,
+    MOVE_CRAFTY_SHIELD,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sTirtougaEggMoveLearnset[] = {
+    MOVE_WATER_PULSE,
+    MOVE_KNOCK_OFF,
+    MOVE_ROCK_THROW,
+    MOVE_SLAM,
+    MOVE_IRON_DEFENSE,
+    MOVE_FLAIL,
+    MOVE_WHIRLPOOL,
+    MOVE_BODY_SLAM,
+    MOVE_BIDE,
+    MOVE_GUARD_SWAP,
+    MOVE_LIQUIDATION,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sArchenEggMoveLearnset[] = {
+    MOVE_STEEL_WING,
+    MOVE_DEFOG,
+    MOVE_DRAGON_PULSE,
+    MOVE_HEAD_SMASH,
+    MOVE_KNOCK_OFF,
+    MOVE_EARTH_POWER,
+    MOVE_BITE,
+    MOVE_ALLY_SWITCH,
+    MOVE_SWITCHEROO,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sTrubbishEggMoveLearnset[] = {
+    MOVE_SPIKES,
+    MOVE_ROLLOUT,
+    MOVE_HAZE,
+    MOVE_CURSE,
+    MOVE_ROCK_BLAST,
+    MOVE_SAND_ATTACK,
+    MOVE_MUD_SPORT,
+    MOVE_SELF_DESTRUCT,
+    MOVE_AUTOTOMIZE,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sZoruaEggMoveLearnset[] = {
+    MOVE_DETECT,
+    MOVE_CAPTIVATE,
+    MOVE_DARK_PULSE,
+    MOVE_SNATCH,
+    MOVE_MEMENTO,
+    MOVE_SUCKER_PUNCH,
+    MOVE_EXTRASENSORY,
+    MOVE_COUNTER,
+    MOVE_COPYCAT,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sMinccinoEggMoveLearnset[] = {
+    MOVE_IRON_TAIL,
+    MOVE_TAIL_WHIP,
+    MOVE_AQUA_TAIL,
+    MOVE_MUD_SLAP,
+    MOVE_KNOCK_OFF,
+    MOVE_FAKE_TEARS,
+    MOVE_SLEEP_TALK,
+    MOVE_ENDURE,
+    MOVE_FLAIL,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sGothitaEggMoveLearnset[] = {
+    MOVE_MIRROR_COAT,
+    MOVE_UPROAR,
+    MOVE_MIRACLE_EYE,
+    MOVE_CAPTIVATE,
+    MOVE_MEAN_LOOK,
+    MOVE_DARK_PULSE,
+    MOVE_HEAL_PULSE,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sSolosisEggMoveLearnset[] = {
+    MOVE_NIGHT_SHADE,
+    MOVE_ASTONISH,
+    MOVE_CONFUSE_RAY,
+    MOVE_ACID_ARMOR,
+    MOVE_TRICK,
+    MOVE_IMPRISON,
+    MOVE_SECRET_POWER,
+    MOVE_ASTONISH,
+    MOVE_HELPING_HAND,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sDucklettEggMoveLearnset[] = {
+    MOVE_STEEL_WING,
+    MOVE_BRINE,
+    MOVE_GUST,
+    MOVE_AIR_CUTTER,
+    MOVE_MIRROR_MOVE,
+    MOVE_ME_FIRST,
+    MOVE_LUCKY_CHANT,
+    MOVE_MUD_SPORT,
+    MOVE_AQUA_JET,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sVanilliteEggMoveLearnset[] = {
+    MOVE_WATER_PULSE,
+    MOVE_NATURAL_GIFT,
+    MOVE_IMPRISON,
+    MOVE_AUTOTOMIZE,
+    MOVE_IRON_DEFENSE,
+    MOVE_MAGNET_RISE,
+    MOVE_ICE_SHARD,
+    MOVE_POWDER_SNOW,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sDeerlingEggMoveLearnset[] = {
+    MOVE_FAKE_TEARS,
+    MOVE_NATURAL_GIFT,
+    MOVE_SYNTHESIS,
+    MOVE_WORRY_SEED,
+    MOVE_ODOR_SLEUTH,
+    MOVE_AGILITY,
+    MOVE_SLEEP_TALK,
+    MOVE_BATON_PASS,
+    MOVE_GRASS_WHISTLE,
+    MOVE_HEADBUTT,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sEmolgaEggMoveLearnset[] = {
+    MOVE_ROOST,
+    MOVE_IRON_TAIL,
+    MOVE_ASTONISH,
+    MOVE_AIR_SLASH,
+    MOVE_SHOCK_WAVE,
+    MOVE_CHARM,
+    MOVE_COVET,
+    MOVE_TICKLE,
+    MOVE_BATON_PASS,
+    MOVE_ION_DELUGE,
+    MOVE_SPEED_SWAP,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sKarrablastEggMoveLearnset[] = {
+    MOVE_MEGAHORN,
+    MOVE_PURSUIT,
+    MOVE_COUNTER,
+    MOVE_HORN_ATTACK,
+    MOVE_FEINT_ATTACK,
+    MOVE_BUG_BITE,
+    MOVE_SCREECH,
+    MOVE_KNOCK_OFF,
+    MOVE_DRILL_RUN,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sFoongusEggMoveLearnset[] = {
+    MOVE_GASTRO_ACID,
+    MOVE_GROWTH,
+    MOVE_POISON_POWDER,
+    MOVE_STUN_SPORE,
+    MOVE_ROLLOUT,
+    MOVE_DEFENSE_CURL,
+    MOVE_ENDURE,
+    MOVE_BODY_SLAM,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sFrillishEggMoveLearnset[] = {
+    MOVE_ACID_ARMOR,
+    MOVE_CONFUSE_RAY,
+    MOVE_PAIN_SPLIT,
+    MOVE_MIST,
+    MOVE_RECOVER,
+    MOVE_CONSTRICT,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sAlomomolaEggMoveLearnset[] = {
+    MOVE_PAIN_SPLIT,
+    MOVE_REFRESH,
+    MOVE_TICKLE,
+    MOVE_MIRROR_COAT,
+    MOVE_MIST,
+    MOVE_ENDURE,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sJoltikEggMoveLearnset[] = {
+    MOVE_PIN_MISSILE,
+    MOVE_POISON_STING,
+    MOVE_CROSS_POISON,
+    MOVE_ROCK_CLIMB,
+    MOVE_PURSUIT,
+    MOVE_DISABLE,
+    MOVE_FEINT_ATTACK,
+    MOVE_CAMOUFLAGE,
+    MOVE_LUNGE,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sFerroseedEggMoveLearnset[] = {
+    MOVE_BULLET_SEED,
+    MOVE_LEECH_SEED,
+    MOVE_SPIKES,
+    MOVE_WORRY_SEED,
+    MOVE_SEED_BOMB,
+    MOVE_GRAVITY,
+    MOVE_ROCK_CLIMB,
+    MOVE_STEALTH_ROCK,
+    MOVE_ACID_SPRAY,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sElgyemEggMoveLearnset[] = {
+    MOVE_TELEPORT,
+    MOVE_DISABLE,
+    MOVE_ASTONISH,
+    MOVE_POWER_SWAP,
+    MOVE_GUARD_SWAP,
+    MOVE_BARRIER,
+    MOVE_NASTY_PLOT,
+    MOVE_SKILL_SWAP,
+    MOVE_COSMIC_POWER,
+    MOVE_ALLY_SWITCH,
+    MOVE_UNAVAILABLE,
+};
 
-#if P_GEN_4_POKEMON == TRUE
-    egg_moves(TURTWIG,
-        MOVE_WORRY_SEED,
-        MOVE_GROWTH,
-        MOVE_TICKLE,
-        MOVE_BODY_SLAM,
-        MOVE_DOUBLE_EDGE,
-        MOVE_SAND_TOMB,
-        MOVE_SEED_BOMB,
-        MOVE_THRASH,
-        MOVE_AMNESIA,
-        MOVE_SUPERPOWER,
-        MOVE_STOCKPILE,
-        MOVE_SWALLOW,
-        MOVE_SPIT_UP,
-        MOVE_EARTH_POWER,
-        MOVE_WIDE_GUARD,
-        MOVE_GRASSY_TERRAIN,
-        MOVE_HEAVY_SLAM),
-
-    egg_moves(CHIMCHAR,
-        MOVE_FIRE_PUNCH,
-        MOVE_THUNDER_PUNCH,
-        MOVE_DOUBLE_KICK,
-        MOVE_ENCORE,
-        MOVE_HEAT_WAVE,
-        MOVE_FOCUS_ENERGY,
-        MOVE_HELPING_HAND,
-        MOVE_FAKE_OUT,
-        MOVE_BLAZE_KICK,
-        MOVE_COUNTER,
-        MOVE_ASSIST,
-        MOVE_QUICK_GUARD,
-        MOVE_FOCUS_PUNCH,
-        MOVE_SUBMISSION,
-        MOVE_POWER_UP_PUNCH),
-
-    egg_moves(PIPLUP,
-        MOVE_DOUBLE_HIT,
-        MOVE_SUPERSONIC,
-        MOVE_YAWN,
-        MOVE_MUD_SPORT,
-        MOVE_MUD_SLAP,
-        MOVE_SNORE,
-        MOVE_FLAIL,
-        MOVE_AGILITY,
-        MOVE_AQUA_RING,
-        MOVE_HYDRO_PUMP,
-        MOVE_FEATHER_DANCE,
-        MOVE_BIDE,
-        MOVE_ICY_WIND,
-        MOVE_POWER_TRIP),
-
-    egg_moves(STARLY,
-        MOVE_FEATHER_DANCE,
-        MOVE_FURY_ATTACK,
-        MOVE_PURSUIT,
-        MOVE_ASTONISH,
-        MOVE_SAND_ATTACK,
-        MOVE_FORESIGHT,
-        MOVE_DOUBLE_EDGE,
-        MOVE_STEEL_WING,
-        MOVE_UPROAR,
-        MOVE_ROOST,
-        MOVE_DETECT,
-        MOVE_REVENGE,
-        MOVE_MIRROR_MOVE),
-
-    egg_moves(BIDOOF,
-        MOVE_QUICK_ATTACK,
-        MOVE_WATER_SPORT,
-        MOVE_DOUBLE_EDGE,
-        MOVE_FURY_SWIPES,
-        MOVE_DEFENSE_CURL,
-        MOVE_ROLLOUT,
-        MOVE_ODOR_SLEUTH,
-        MOVE_AQUA_TAIL,
-        MOVE_ROCK_CLIMB,
-        MOVE_SLEEP_TALK,
-        MOVE_ENDURE,
-        MOVE_SKULL_BASH,
-        MOVE_MUD_SPORT),
-
-    egg_moves(SHINX,
-        MOVE_ICE_FANG,
-        MOVE_FIRE_FANG,
-        MOVE_THUNDER_FANG,
-        MOVE_QUICK_ATTACK,
-        MOVE_HOWL,
-        MOVE_TAKE_DOWN,
-        MOVE_NIGHT_SLASH,
-        MOVE_SHOCK_WAVE,
-        MOVE_SWIFT,
-        MOVE_DOUBLE_KICK,
-        MOVE_SIGNAL_BEAM,
-        MOVE_HELPING_HAND,
-        MOVE_EERIE_IMPULSE,
-        MOVE_FAKE_TEARS),
-
-    egg_moves(BUDEW,
-        MOVE_SPIKES,
-        MOVE_SYNTHESIS,
-        MOVE_PIN_MISSILE,
-        MOVE_COTTON_SPORE,
-        MOVE_SLEEP_POWDER,
-        MOVE_RAZOR_LEAF,
-        MOVE_MIND_READER,
-        MOVE_LEAF_STORM,
-        MOVE_EXTRASENSORY,
-        MOVE_SEED_BOMB,
-        MOVE_GIGA_DRAIN,
-        MOVE_NATURAL_GIFT,
-        MOVE_GRASS_WHISTLE),
-
-    egg_moves(CRANIDOS,
-        MOVE_CRUNCH,
-        MOVE_THRASH,
-        MOVE_DOUBLE_EDGE,
-        MOVE_LEER,
-        MOVE_SLAM,
-        MOVE_STOMP,
-        MOVE_WHIRLWIND,
-        MOVE_HAMMER_ARM,
-        MOVE_CURSE,
-        MOVE_IRON_TAIL,
-        MOVE_IRON_HEAD),
-
-    egg_moves(SHIELDON,
-        MOVE_HEADBUTT,
-        MOVE_SCARY_FACE,
-        MOVE_FOCUS_ENERGY,
-        MOVE_DOUBLE_EDGE,
-        MOVE_ROCK_BLAST,
-        MOVE_BODY_SLAM,
-        MOVE_SCREECH,
-        MOVE_CURSE,
-        MOVE_FISSURE,
-        MOVE_COUNTER,
-        MOVE_STEALTH_ROCK,
-        MOVE_WIDE_GUARD,
-        MOVE_GUARD_SPLIT),
-
-    egg_moves(PACHIRISU,
-        MOVE_COVET,
-        MOVE_BITE,
-        MOVE_FAKE_TEARS,
-        MOVE_DEFENSE_CURL,
-        MOVE_ROLLOUT,
-        MOVE_FLATTER,
-        MOVE_FLAIL,
-        MOVE_IRON_TAIL,
-        MOVE_TAIL_WHIP,
-        MOVE_FOLLOW_ME,
-        MOVE_CHARGE,
-        MOVE_BESTOW,
-        MOVE_ION_DELUGE,
-        MOVE_BABY_DOLL_EYES),
-
-    egg_moves(BUIZEL,
-        MOVE_MUD_SLAP,
-        MOVE_HEADBUTT,
-        MOVE_FURY_SWIPES,
-        MOVE_SLASH,
-        MOVE_ODOR_SLEUTH,
-        MOVE_DOUBLE_SLAP,
-        MOVE_FURY_CUTTER,
-        MOVE_BATON_PASS,
-        MOVE_AQUA_TAIL,
-        MOVE_AQUA_RING,
-        MOVE_ME_FIRST,
-        MOVE_SWITCHEROO,
-        MOVE_TAIL_SLAP,
-        MOVE_SOAK,
-        MOVE_HELPING_HAND),
-
-    egg_moves(CHERUBI,
-        MOVE_RAZOR_LEAF,
-        MOVE_SWEET_SCENT,
-        MOVE_TICKLE,
-        MOVE_NATURE_POWER,
-        MOVE_GRASS_WHISTLE,
-        MOVE_AROMATHERAPY,
-        MOVE_WEATHER_BALL,
-        MOVE_HEAL_PULSE,
-        MOVE_HEALING_WISH,
-        MOVE_SEED_BOMB,
-        MOVE_NATURAL_GIFT,
-        MOVE_DEFENSE_CURL,
-        MOVE_ROLLOUT,
-        MOVE_FLOWER_SHIELD,
-        MOVE_GRASSY_TERRAIN),
-
-    egg_moves(SHELLOS,
-        MOVE_COUNTER,
-        MOVE_MIRROR_COAT,
-        MOVE_STOCKPILE,
-        MOVE_SWALLOW,
-        MOVE_SPIT_UP,
-        MOVE_YAWN,
-        MOVE_MEMENTO,
-        MOVE_CURSE,
-        MOVE_AMNESIA,
-        MOVE_FISSURE,
-        MOVE_TRUMP_CARD,
-        MOVE_SLUDGE,
-        MOVE_CLEAR_SMOG,
-        MOVE_BRINE,
-        MOVE_MIST,
-        MOVE_ACID_ARMOR),
-
-    egg_moves(DRIFLOON,
-        MOVE_MEMENTO,
-        MOVE_BODY_SLAM,
-        MOVE_DESTINY_BOND,
-        MOVE_DISABLE,
-        MOVE_HAZE,
-        MOVE_HYPNOSIS,
-        MOVE_WEATHER_BALL,
-        MOVE_CLEAR_SMOG,
-        MOVE_DEFOG,
-        MOVE_TAILWIND),
-
-    egg_moves(BUNEARY,
-        MOVE_FAKE_TEARS,
-        MOVE_FAKE_OUT,
-        MOVE_ENCORE,
-        MOVE_SWEET_KISS,
-        MOVE_DOUBLE_HIT,
-        MOVE_LOW_KICK,
-        MOVE_SKY_UPPERCUT,
-        MOVE_SWITCHEROO,
-        MOVE_THUNDER_PUNCH,
-        MOVE_ICE_PUNCH,
-        MOVE_FIRE_PUNCH,
-        MOVE_FLAIL,
-        MOVE_FOCUS_PUNCH,
-        MOVE_CIRCLE_THROW,
-        MOVE_COPYCAT,
-        MOVE_TEETER_DANCE,
-        MOVE_COSMIC_POWER,
-        MOVE_MUD_SPORT,
-        MOVE_POWER_UP_PUNCH),
-
-    egg_moves(GLAMEOW,
-        MOVE_BITE,
-        MOVE_TAIL_WHIP,
-        MOVE_QUICK_ATTACK,
-        MOVE_SAND_ATTACK,
-        MOVE_FAKE_TEARS,
-        MOVE_ASSURANCE,
-        MOVE_FLAIL,
-        MOVE_SNATCH,
-        MOVE_WAKE_UP_SLAP,
-        MOVE_LAST_RESORT),
-
-    egg_moves(CHINGLING,
-        MOVE_DISABLE,
-        MOVE_CURSE,
-        MOVE_HYPNOSIS,
-        MOVE_WISH,
-        MOVE_FUTURE_SIGHT,
-        MOVE_RECOVER,
-        MOVE_STORED_POWER,
-        MOVE_SKILL_SWAP,
-        MOVE_COSMIC_POWER),
-
-    egg_moves(STUNKY,
-        MOVE_PURSUIT,
-        MOVE_LEER,
-        MOVE_SMOG,
-        MOVE_DOUBLE_EDGE,
-        MOVE_CRUNCH,
-        MOVE_SCARY_FACE,
-        MOVE_ASTONISH,
-        MOVE_PUNISHMENT,
-        MOVE_HAZE,
-        MOVE_IRON_TAIL,
-        MOVE_FOUL_PLAY,
-        MOVE_FLAME_BURST,
-        MOVE_PLAY_ROUGH),
-
-    egg_moves(BONSLY,
-        MOVE_SELF_DESTRUCT,
-        MOVE_HEADBUTT,
-        MOVE_HARDEN,
-        MOVE_DEFENSE_CURL,
-        MOVE_ROLLOUT,
-        MOVE_SAND_TOMB,
-        MOVE_STEALTH_ROCK,
-        MOVE_CURSE,
-        MOVE_ENDURE),
-
-    egg_moves(MIME_JR,
-        MOVE_FUTURE_SIGHT,
-        MOVE_HYPNOSIS,
-        MOVE_MIMIC,
-        MOVE_FAKE_OUT,
-        MOVE_TRICK,
-        MOVE_CONFUSE_RAY,
-        MOVE_WAKE_UP_SLAP,
-        MOVE_TEETER_DANCE,
-        MOVE_HEALING_WISH,
-        MOVE_CHARM,
-        MOVE_NASTY_PLOT,
-        MOVE_POWER_SPLIT,
-        MOVE_MAGIC_ROOM,
-        MOVE_ICY_WIND,
-        MOVE_PSYCHIC_TERRAIN),
-
-    egg_moves(HAPPINY,
-        MOVE_PRESENT,
-        MOVE_METRONOME,
-        MOVE_HEAL_BELL,
-        MOVE_AROMATHERAPY,
-        MOVE_COUNTER,
-        MOVE_HELPING_HAND,
-        MOVE_GRAVITY,
-        MOVE_LAST_RESORT,
-        MOVE_MUD_BOMB,
-        MOVE_NATURAL_GIFT,
-        MOVE_ENDURE),
-
-    egg_moves(CHATOT,
-        MOVE_ENCORE,
-        MOVE_NIGHT_SHADE,
-        MOVE_AGILITY,
-        MOVE_NASTY_PLOT,
-        MOVE_SUPERSONIC,
-        MOVE_STEEL_WING,
-        MOVE_SLEEP_TALK,
-        MOVE_DEFOG,
-        MOVE_AIR_CUTTER,
-        MOVE_BOOMBURST),
-
-    egg_moves(SPIRITOMB,
-        MOVE_DESTINY_BOND,
-        MOVE_PAIN_SPLIT,
-        MOVE_SMOKESCREEN,
-        MOVE_IMPRISON,
-        MOVE_GRUDGE,
-        MOVE_SHADOW_SNEAK,
-        MOVE_CAPTIVATE,
-        MOVE_NIGHTMARE,
-        MOVE_FOUL_PLAY,
-        MOVE_DISABLE),
-
-    egg_moves(GIBLE,
-        MOVE_DRAGON_BREATH,
-        MOVE_OUTRAGE,
-        MOVE_TWISTER,
-        MOVE_SCARY_FACE,
-        MOVE_DOUBLE_EDGE,
-        MOVE_THRASH,
-        MOVE_METAL_CLAW,
-        MOVE_SAND_TOMB,
-        MOVE_BODY_SLAM,
-        MOVE_IRON_HEAD,
-        MOVE_MUD_SHOT,
-        MOVE_ROCK_CLIMB,
-        MOVE_IRON_TAIL),
-
-    egg_moves(MUNCHLAX,
-        MOVE_LICK,
-        MOVE_CHARM,
-        MOVE_DOUBLE_EDGE,
-        MOVE_CURSE,
-        MOVE_WHIRLWIND,
-        MOVE_PURSUIT,
-        MOVE_ZEN_HEADBUTT,
-        MOVE_COUNTER,
-        MOVE_NATURAL_GIFT,
-        MOVE_AFTER_YOU,
-        MOVE_SELF_DESTRUCT,
-        MOVE_BELCH),
-
-    egg_moves(RIOLU,
-        MOVE_CROSS_CHOP,
-        MOVE_DETECT,
-        MOVE_BITE,
-        MOVE_MIND_READER,
-        MOVE_SKY_UPPERCUT,
-        MOVE_HIGH_JUMP_KICK,
-        MOVE_AGILITY,
-        MOVE_VACUUM_WAVE,
-        MOVE_CRUNCH,
-        MOVE_LOW_KICK,
-        MOVE_IRON_DEFENSE,
-        MOVE_BLAZE_KICK,
-        MOVE_BULLET_PUNCH,
-        MOVE_FOLLOW_ME,
-        MOVE_CIRCLE_THROW,
-        MOVE_METEOR_MASH),
-
-    egg_moves(HIPPOPOTAS,
-        MOVE_STOCKPILE,
-        MOVE_SWALLOW,
-        MOVE_SPIT_UP,
-        MOVE_CURSE,
-        MOVE_SLACK_OFF,
-        MOVE_BODY_SLAM,
-        MOVE_SAND_TOMB,
-        MOVE_REVENGE,
-        MOVE_SLEEP_TALK,
-        MOVE_WHIRLWIND),
-
-    egg_moves(SKORUPI,
-        MOVE_FEINT_ATTACK,
-        MOVE_SCREECH,
-        MOVE_SAND_ATTACK,
-        MOVE_SLASH,
-        MOVE_CONFUSE_RAY,
-        MOVE_WHIRLWIND,
-        MOVE_AGILITY,
-        MOVE_PURSUIT,
-        MOVE_NIGHT_SLASH,
-        MOVE_IRON_TAIL,
-        MOVE_TWINEEDLE,
-        MOVE_POISON_TAIL),
-
-    egg_moves(CROAGUNK,
-        MOVE_ME_FIRST,
-        MOVE_FEINT,
-        MOVE_DYNAMIC_PUNCH,
-        MOVE_HEADBUTT,
-        MOVE_VACUUM_WAVE,
-        MOVE_MEDITATE,
-        MOVE_FAKE_OUT,
-        MOVE_WAKE_UP_SLAP,
-        MOVE_SMELLING_SALTS,
-        MOVE_CROSS_CHOP,
-        MOVE_BULLET_PUNCH,
-        MOVE_COUNTER,
-        MOVE_DRAIN_PUNCH,
-        MOVE_ACUPRESSURE,
-        MOVE_QUICK_GUARD),
-
-    egg_moves(CARNIVINE,
-        MOVE_SLEEP_POWDER,
-        MOVE_STUN_SPORE,
-        MOVE_RAZOR_LEAF,
-        MOVE_SLAM,
-        MOVE_SYNTHESIS,
-        MOVE_MAGICAL_LEAF,
-        MOVE_LEECH_SEED,
-        MOVE_WORRY_SEED,
-        MOVE_GIGA_DRAIN,
-        MOVE_RAGE_POWDER,
-        MOVE_GRASS_WHISTLE,
-        MOVE_ACID_SPRAY),
-
-    egg_moves(FINNEON,
-        MOVE_SWEET_KISS,
-        MOVE_CHARM,
-        MOVE_FLAIL,
-        MOVE_AQUA_TAIL,
-        MOVE_SPLASH,
-        MOVE_PSYBEAM,
-        MOVE_TICKLE,
-        MOVE_AGILITY,
-        MOVE_BRINE,
-        MOVE_AURORA_BEAM,
-        MOVE_SIGNAL_BEAM,
-        MOVE_CONFUSE_RAY),
-
-    egg_moves(MANTYKE,
-        MOVE_TWISTER,
-        MOVE_HYDRO_PUMP,
-        MOVE_HAZE,
-        MOVE_SLAM,
-        MOVE_MUD_SPORT,
-        MOVE_MIRROR_COAT,
-        MOVE_WATER_SPORT,
-        MOVE_SPLASH,
-        MOVE_SIGNAL_BEAM,
-        MOVE_WIDE_GUARD,
-        MOVE_AMNESIA,
-        MOVE_TAILWIND),
-
-    egg_moves(SNOVER,
-        MOVE_LEECH_SEED,
-        MOVE_MAGICAL_LEAF,
-        MOVE_SEED_BOMB,
-        MOVE_GROWTH,
-        MOVE_DOUBLE_EDGE,
-        MOVE_MIST,
-        MOVE_STOMP,
-        MOVE_SKULL_BASH,
-        MOVE_AVALANCHE,
-        MOVE_NATURAL_GIFT,
-        MOVE_BULLET_SEED),
-#endif
+static const u16 sLitwickEggMoveLearnset[] = {
+    MOVE_ACID_ARMOR,
+    MOVE_HEAT_WAVE,
+    MOVE_HAZE,
+    MOVE_ENDURE,
+    MOVE_CAPTIVATE,
+    MOVE_ACID,
+    MOVE_CLEAR_SMOG,
+    MOVE_POWER_SPLIT,
+    MOVE_UNAVAILABLE,
+};
 
-#if P_GEN_5_POKEMON == TRUE
-    egg_moves(SNIVY,
-        MOVE_CAPTIVATE,
-        MOVE_NATURAL_GIFT,
-        MOVE_GLARE,
-        MOVE_IRON_TAIL,
-        MOVE_MAGICAL_LEAF,
-        MOVE_SWEET_SCENT,
-        MOVE_MIRROR_COAT,
-        MOVE_PURSUIT,
-        MOVE_MEAN_LOOK,
-        MOVE_TWISTER,
-        MOVE_GRASSY_TERRAIN),
-
-    egg_moves(TEPIG,
-        MOVE_COVET,
-        MOVE_BODY_SLAM,
-        MOVE_THRASH,
-        MOVE_MAGNITUDE,
-        MOVE_SUPERPOWER,
-        MOVE_CURSE,
-        MOVE_ENDEAVOR,
-        MOVE_YAWN,
-        MOVE_SLEEP_TALK,
-        MOVE_HEAVY_SLAM,
-        MOVE_SUCKER_PUNCH,
-        MOVE_BURN_UP),
-
-    egg_moves(OSHAWOTT,
-        MOVE_COPYCAT,
-        MOVE_DETECT,
-        MOVE_AIR_SLASH,
-        MOVE_ASSURANCE,
-        MOVE_BRINE,
-        MOVE_NIGHT_SLASH,
-        MOVE_TRUMP_CARD,
-        MOVE_SCREECH,
-        MOVE_SACRED_SWORD),
-
-    egg_moves(PATRAT,
-        MOVE_FORESIGHT,
-        MOVE_IRON_TAIL,
-        MOVE_SCREECH,
-        MOVE_ASSURANCE,
-        MOVE_PURSUIT,
-        MOVE_REVENGE,
-        MOVE_FLAIL,
-        MOVE_TEARFUL_LOOK,
-        MOVE_BULLET_SEED),
-
-    egg_moves(LILLIPUP,
-        MOVE_HOWL,
-        MOVE_SAND_ATTACK,
-        MOVE_MUD_SLAP,
-        MOVE_LICK,
-        MOVE_CHARM,
-        MOVE_ENDURE,
-        MOVE_YAWN,
-        MOVE_PURSUIT,
-        MOVE_FIRE_FANG,
-        MOVE_THUNDER_FANG,
-        MOVE_ICE_FANG,
-        MOVE_AFTER_YOU,
-        MOVE_PSYCHIC_FANGS),
-
-    egg_moves(PURRLOIN,
-        MOVE_PAY_DAY,
-        MOVE_FOUL_PLAY,
-        MOVE_FEINT_ATTACK,
-        MOVE_FAKE_TEARS,
-        MOVE_CHARM,
-        MOVE_ENCORE,
-        MOVE_YAWN,
-        MOVE_COVET,
-        MOVE_COPYCAT),
-
-    egg_moves(PANSAGE,
-        MOVE_COVET,
-        MOVE_LOW_KICK,
-        MOVE_TICKLE,
-        MOVE_NASTY_PLOT,
-        MOVE_ROLE_PLAY,
-        MOVE_ASTONISH,
-        MOVE_GRASS_WHISTLE,
-        MOVE_MAGICAL_LEAF,
-        MOVE_BULLET_SEED,
-        MOVE_LEAF_STORM,
-        MOVE_DISARMING_VOICE,
-        MOVE_SPIKY_SHIELD),
-
-    egg_moves(PANSEAR,
-        MOVE_COVET,
-        MOVE_LOW_KICK,
-        MOVE_TICKLE,
-        MOVE_NASTY_PLOT,
-        MOVE_ROLE_PLAY,
-        MOVE_ASTONISH,
-        MOVE_SLEEP_TALK,
-        MOVE_FIRE_SPIN,
-        MOVE_FIRE_PUNCH,
-        MOVE_HEAT_WAVE,
-        MOVE_DISARMING_VOICE,
-        MOVE_BELCH,
-        MOVE_FLARE_BLITZ),
-
-    egg_moves(PANPOUR,
-        MOVE_COVET,
-        MOVE_LOW_KICK,
-        MOVE_TICKLE,
-        MOVE_NASTY_PLOT,
-        MOVE_ROLE_PLAY,
-        MOVE_ASTONISH,
-        MOVE_AQUA_RING,
-        MOVE_AQUA_TAIL,
-        MOVE_MUD_SPORT,
-        MOVE_HYDRO_PUMP,
-        MOVE_DISARMING_VOICE),
-
-    egg_moves(MUNNA,
-        MOVE_SLEEP_TALK,
-        MOVE_SECRET_POWER,
-        MOVE_BARRIER,
-        MOVE_MAGIC_COAT,
-        MOVE_HELPING_HAND,
-        MOVE_BATON_PASS,
-        MOVE_SWIFT,
-        MOVE_CURSE,
-        MOVE_SONIC_BOOM,
-        MOVE_HEALING_WISH),
-
-    egg_moves(PIDOVE,
-        MOVE_STEEL_WING,
-        MOVE_HYPNOSIS,
-        MOVE_UPROAR,
-        MOVE_BESTOW,
-        MOVE_WISH,
-        MOVE_MORNING_SUN,
-        MOVE_LUCKY_CHANT,
-        MOVE_NIGHT_SLASH),
-
-    egg_moves(BLITZLE,
-        MOVE_ME_FIRST,
-        MOVE_TAKE_DOWN,
-        MOVE_SAND_ATTACK,
-        MOVE_DOUBLE_KICK,
-        MOVE_SCREECH,
-        MOVE_RAGE,
-        MOVE_ENDURE,
-        MOVE_DOUBLE_EDGE,
-        MOVE_SHOCK_WAVE,
-        MOVE_SNATCH,
-        MOVE_FEINT),
-
-    egg_moves(ROGGENROLA,
-        MOVE_MAGNITUDE,
-        MOVE_CURSE,
-        MOVE_AUTOTOMIZE,
-        MOVE_ROCK_TOMB,
-        MOVE_LOCK_ON,
-        MOVE_HEAVY_SLAM,
-        MOVE_TAKE_DOWN,
-        MOVE_GRAVITY,
-        MOVE_WIDE_GUARD),
-
-    egg_moves(WOOBAT,
-        MOVE_CHARM,
-        MOVE_KNOCK_OFF,
-        MOVE_FAKE_TEARS,
-        MOVE_SUPERSONIC,
-        MOVE_SYNCHRONOISE,
-        MOVE_STORED_POWER,
-        MOVE_ROOST,
-        MOVE_FLATTER,
-        MOVE_HELPING_HAND,
-        MOVE_CAPTIVATE,
-        MOVE_VENOM_DRENCH,
-        MOVE_PSYCHO_SHIFT),
-
-    egg_moves(DRILBUR,
-        MOVE_IRON_DEFENSE,
-        MOVE_RAPID_SPIN,
-        MOVE_EARTH_POWER,
-        MOVE_CRUSH_CLAW,
-        MOVE_METAL_SOUND,
-        MOVE_SUBMISSION,
-        MOVE_SKULL_BASH,
-        MOVE_ROCK_CLIMB),
-
-    egg_moves(AUDINO,
-        MOVE_WISH,
-        MOVE_HEAL_BELL,
-        MOVE_LUCKY_CHANT,
-        MOVE_ENCORE,
-        MOVE_BESTOW,
-        MOVE_SWEET_KISS,
-        MOVE_YAWN,
-        MOVE_SLEEP_TALK,
-        MOVE_HEALING_WISH,
-        MOVE_AMNESIA,
-        MOVE_DRAINING_KISS),
-
-    egg_moves(TIMBURR,
-        MOVE_DRAIN_PUNCH,
-        MOVE_ENDURE,
-        MOVE_COUNTER,
-        MOVE_COMET_PUNCH,
-        MOVE_FORESIGHT,
-        MOVE_SMELLING_SALTS,
-        MOVE_DETECT,
-        MOVE_WIDE_GUARD,
-        MOVE_FORCE_PALM,
-        MOVE_REVERSAL,
-        MOVE_MACH_PUNCH,
-        MOVE_POWER_UP_PUNCH),
-
-    egg_moves(TYMPOLE,
-        MOVE_WATER_PULSE,
-        MOVE_REFRESH,
-        MOVE_MUD_SPORT,
-        MOVE_MUD_BOMB,
-        MOVE_SLEEP_TALK,
-        MOVE_SNORE,
-        MOVE_MIST,
-        MOVE_EARTH_POWER,
-        MOVE_AFTER_YOU,
-        MOVE_VENOM_DRENCH),
-
-    egg_moves(SEWADDLE,
-        MOVE_SILVER_WIND,
-        MOVE_SCREECH,
-        MOVE_RAZOR_WIND,
-        MOVE_MIND_READER,
-        MOVE_AGILITY,
-        MOVE_ME_FIRST,
-        MOVE_BATON_PASS,
-        MOVE_CAMOUFLAGE,
-        MOVE_AIR_SLASH,
-        MOVE_GRASSY_TERRAIN),
-
-    egg_moves(VENIPEDE,
-        MOVE_TWINEEDLE,
-        MOVE_PIN_MISSILE,
-        MOVE_TOXIC_SPIKES,
-        MOVE_SPIKES,
-        MOVE_TAKE_DOWN,
-        MOVE_ROCK_CLIMB),
-
-    egg_moves(COTTONEE,
-        MOVE_NATURAL_GIFT,
-        MOVE_ENCORE,
-        MOVE_TICKLE,
-        MOVE_FAKE_TEARS,
-        MOVE_GRASS_WHISTLE,
-        MOVE_MEMENTO,
-        MOVE_BEAT_UP,
-        MOVE_SWITCHEROO,
-        MOVE_WORRY_SEED,
-        MOVE_CAPTIVATE,
-        MOVE_MISTY_TERRAIN),
-
-    egg_moves(PETILIL,
-        MOVE_NATURAL_GIFT,
-        MOVE_CHARM,
-        MOVE_ENDURE,
-        MOVE_INGRAIN,
-        MOVE_WORRY_SEED,
-        MOVE_GRASS_WHISTLE,
-        MOVE_SWEET_SCENT,
-        MOVE_BIDE,
-        MOVE_HEALING_WISH,
-        MOVE_ENCORE),
-
-    egg_moves(BASCULIN,
-        MOVE_SWIFT,
-        MOVE_BUBBLE_BEAM,
-        MOVE_MUD_SHOT,
-        MOVE_MUDDY_WATER,
-        MOVE_AGILITY,
-        MOVE_WHIRLPOOL,
-        MOVE_RAGE,
-        MOVE_BRINE,
-        MOVE_REVENGE,
-        MOVE_HEAD_SMASH),
-
-    egg_moves(SANDILE,
-        MOVE_DOUBLE_EDGE,
-        MOVE_ROCK_CLIMB,
-        MOVE_PURSUIT,
-        MOVE_UPROAR,
-        MOVE_FIRE_FANG,
-        MOVE_THUNDER_FANG,
-        MOVE_BEAT_UP,
-        MOVE_FOCUS_ENERGY,
-        MOVE_COUNTER,
-        MOVE_MEAN_LOOK,
-        MOVE_ME_FIRST,
-        MOVE_POWER_TRIP),
-
-    egg_moves(DARUMAKA,
-        MOVE_SLEEP_TALK,
-        MOVE_FOCUS_PUNCH,
-        MOVE_FOCUS_ENERGY,
-        MOVE_ENDURE,
-        MOVE_HAMMER_ARM,
-        MOVE_TAKE_DOWN,
-        MOVE_FLAME_WHEEL,
-        MOVE_ENCORE,
-        MOVE_YAWN,
-        MOVE_SNATCH,
-        MOVE_EXTRASENSORY),
-
-    egg_moves(MARACTUS,
-        MOVE_BULLET_SEED,
-        MOVE_BOUNCE,
-        MOVE_WORRY_SEED,
-        MOVE_LEECH_SEED,
-        MOVE_SEED_BOMB,
-        MOVE_WOOD_HAMMER,
-        MOVE_SPIKES,
-        MOVE_GRASS_WHISTLE,
-        MOVE_GRASSY_TERRAIN),
-
-    egg_moves(DWEBBLE,
-        MOVE_ENDURE,
-        MOVE_IRON_DEFENSE,
-        MOVE_NIGHT_SLASH,
-        MOVE_SAND_TOMB,
-        MOVE_COUNTER,
-        MOVE_CURSE,
-        MOVE_SPIKES,
-        MOVE_BLOCK,
-        MOVE_WIDE_GUARD,
-        MOVE_ROTOTILLER),
-
-    egg_moves(SCRAGGY,
-        MOVE_DRAIN_PUNCH,
-        MOVE_COUNTER,
-        MOVE_DRAGON_DANCE,
-        MOVE_DETECT,
-        MOVE_FAKE_OUT,
-        MOVE_FIRE_PUNCH,
-        MOVE_ICE_PUNCH,
-        MOVE_THUNDER_PUNCH,
-        MOVE_AMNESIA,
-        MOVE_FEINT_ATTACK,
-        MOVE_ZEN_HEADBUTT,
-        MOVE_QUICK_GUARD,
-        MOVE_POWER_UP_PUNCH,
-        MOVE_ACID_SPRAY),
-
-    egg_moves(SIGILYPH,
-        MOVE_STORED_POWER,
-        MOVE_PSYCHO_SHIFT,
-        MOVE_ANCIENT_POWER,
-        MOVE_STEEL_WING,
-        MOVE_ROOST,
-        MOVE_SKILL_SWAP,
-        MOVE_FUTURE_SIGHT),
-
-    egg_moves(YAMASK,
-        MOVE_MEMENTO,
-        MOVE_FAKE_TEARS,
-        MOVE_NASTY_PLOT,
-        MOVE_ENDURE,
-        MOVE_HEAL_BLOCK,
-        MOVE_IMPRISON,
-        MOVE_NIGHTMARE,
-        MOVE_DISABLE,
-        MOVE_ALLY_SWITCH,
-        MOVE_TOXIC_SPIKES,
-        MOVE_CRAFTY_SHIELD),
-
-    egg_moves(TIRTOUGA,
-        MOVE_WATER_PULSE,
-        MOVE_KNOCK_OFF,
-        MOVE_ROCK_THROW,
-        MOVE_SLAM,
-        MOVE_IRON_DEFENSE,
-        MOVE_FLAIL,
-        MOVE_WHIRLPOOL,
-        MOVE_BODY_SLAM,
-        MOVE_BIDE,
-        MOVE_GUARD_SWAP,
-        MOVE_LIQUIDATION),
-
-    egg_moves(ARCHEN,
-        MOVE_STEEL_WING,
-        MOVE_DEFOG,
-        MOVE_DRAGON_PULSE,
-        MOVE_HEAD_SMASH,
-        MOVE_KNOCK_OFF,
-        MOVE_EARTH_POWER,
-        MOVE_BITE,
-        MOVE_ALLY_SWITCH,
-        MOVE_SWITCHEROO),
-
-    egg_moves(TRUBBISH,
-        MOVE_SPIKES,
-        MOVE_ROLLOUT,
-        MOVE_HAZE,
-        MOVE_CURSE,
-        MOVE_ROCK_BLAST,
-        MOVE_SAND_ATTACK,
-        MOVE_MUD_SPORT,
-        MOVE_SELF_DESTRUCT,
-        MOVE_AUTOTOMIZE),
-
-    egg_moves(ZORUA,
-        MOVE_DETECT,
-        MOVE_CAPTIVATE,
-        MOVE_DARK_PULSE,
-        MOVE_SNATCH,
-        MOVE_MEMENTO,
-        MOVE_SUCKER_PUNCH,
-        MOVE_EXTRASENSORY,
-        MOVE_COUNTER,
-        MOVE_COPYCAT),
-
-    egg_moves(MINCCINO,
-        MOVE_IRON_TAIL,
-        MOVE_TAIL_WHIP,
-        MOVE_AQUA_TAIL,
-        MOVE_MUD_SLAP,
-        MOVE_KNOCK_OFF,
-        MOVE_FAKE_TEARS,
-        MOVE_SLEEP_TALK,
-        MOVE_ENDURE,
-        MOVE_FLAIL),
-
-    egg_moves(GOTHITA,
-        MOVE_MIRROR_COAT,
-        MOVE_UPROAR,
-        MOVE_MIRACLE_EYE,
-        MOVE_CAPTIVATE,
-        MOVE_MEAN_LOOK,
-        MOVE_DARK_PULSE,
-        MOVE_HEAL_PULSE),
-
-    egg_moves(SOLOSIS,
-        MOVE_NIGHT_SHADE,
-        MOVE_ASTONISH,
-        MOVE_CONFUSE_RAY,
-        MOVE_ACID_ARMOR,
-        MOVE_TRICK,
-        MOVE_IMPRISON,
-        MOVE_SECRET_POWER,
-        MOVE_ASTONISH,
-        MOVE_HELPING_HAND),
-
-    egg_moves(DUCKLETT,
-        MOVE_STEEL_WING,
-        MOVE_BRINE,
-        MOVE_GUST,
-        MOVE_AIR_CUTTER,
-        MOVE_MIRROR_MOVE,
-        MOVE_ME_FIRST,
-        MOVE_LUCKY_CHANT,
-        MOVE_MUD_SPORT,
-        MOVE_AQUA_JET),
-
-    egg_moves(VANILLITE,
-        MOVE_WATER_PULSE,
-        MOVE_NATURAL_GIFT,
-        MOVE_IMPRISON,
-        MOVE_AUTOTOMIZE,
-        MOVE_IRON_DEFENSE,
-        MOVE_MAGNET_RISE,
-        MOVE_ICE_SHARD,
-        MOVE_POWDER_SNOW),
-
-    egg_moves(DEERLING,
-        MOVE_FAKE_TEARS,
-        MOVE_NATURAL_GIFT,
-        MOVE_SYNTHESIS,
-        MOVE_WORRY_SEED,
-        MOVE_ODOR_SLEUTH,
-        MOVE_AGILITY,
-        MOVE_SLEEP_TALK,
-        MOVE_BATON_PASS,
-        MOVE_GRASS_WHISTLE,
-        MOVE_HEADBUTT),
-
-    egg_moves(EMOLGA,
-        MOVE_ROOST,
-        MOVE_IRON_TAIL,
-        MOVE_ASTONISH,
-        MOVE_AIR_SLASH,
-        MOVE_SHOCK_WAVE,
-        MOVE_CHARM,
-        MOVE_COVET,
-        MOVE_TICKLE,
-        MOVE_BATON_PASS,
-        MOVE_ION_DELUGE,
-        MOVE_SPEED_SWAP),
-
-    egg_moves(KARRABLAST,
-        MOVE_MEGAHORN,
-        MOVE_PURSUIT,
-        MOVE_COUNTER,
-        MOVE_HORN_ATTACK,
-        MOVE_FEINT_ATTACK,
-        MOVE_BUG_BITE,
-        MOVE_SCREECH,
-        MOVE_KNOCK_OFF,
-        MOVE_DRILL_RUN),
-
-    egg_moves(FOONGUS,
-        MOVE_GASTRO_ACID,
-        MOVE_GROWTH,
-        MOVE_POISON_POWDER,
-        MOVE_STUN_SPORE,
-        MOVE_ROLLOUT,
-        MOVE_DEFENSE_CURL,
-        MOVE_ENDURE,
-        MOVE_BODY_SLAM),
-
-    egg_moves(FRILLISH,
-        MOVE_ACID_ARMOR,
-        MOVE_CONFUSE_RAY,
-        MOVE_PAIN_SPLIT,
-        MOVE_MIST,
-        MOVE_RECOVER,
-        MOVE_CONSTRICT),
-
-    egg_moves(ALOMOMOLA,
-        MOVE_PAIN_SPLIT,
-        MOVE_REFRESH,
-        MOVE_TICKLE,
-        MOVE_MIRROR_COAT,
-        MOVE_MIST,
-        MOVE_ENDURE),
-
-    egg_moves(JOLTIK,
-        MOVE_PIN_MISSILE,
-        MOVE_POISON_STING,
-        MOVE_CROSS_POISON,
-        MOVE_ROCK_CLIMB,
-        MOVE_PURSUIT,
-        MOVE_DISABLE,
-        MOVE_FEINT_ATTACK,
-        MOVE_CAMOUFLAGE,
-        MOVE_LUNGE),
-
-    egg_moves(FERROSEED,
-        MOVE_BULLET_SEED,
-        MOVE_LEECH_SEED,
-        MOVE_SPIKES,
-        MOVE_WORRY_SEED,
-        MOVE_SEED_BOMB,
-        MOVE_GRAVITY,
-        MOVE_ROCK_CLIMB,
-        MOVE_STEALTH_ROCK,
-        MOVE_ACID_SPRAY),
-
-    egg_moves(ELGYEM,
-        MOVE_TELEPORT,
-        MOVE_DISABLE,
-        MOVE_ASTONISH,
-        MOVE_POWER_SWAP,
-        MOVE_GUARD_SWAP,
-        MOVE_BARRIER,
-        MOVE_NASTY_PLOT,
-        MOVE_SKILL_SWAP,
-        MOVE_COSMIC_POWER,
-        MOVE_ALLY_SWITCH),
-
-    egg_moves(LITWICK,
-        MOVE_ACID_ARMOR,
-        MOVE_HEAT_WAVE,
-        MOVE_HAZE,
-        MOVE_ENDURE,
-        MOVE_CAPTIVATE,
-        MOVE_ACID,
-        MOVE_CLEAR_SMOG,
-        MOVE_POWER_SPLIT),
-
-    egg_moves(AXEW,
-        MOVE_COUNTER,
-        MOVE_FOCUS_ENERGY,
-        MOVE_REVERSAL,
-        MOVE_ENDURE,
-        MOVE_RAZOR_WIND,
-        MOVE_NIGHT_SLASH,
-        MOVE_ENDEAVOR,
-        MOVE_IRON_TAIL,
-        MOVE_DRAGON_PULSE,
-        MOVE_HARDEN),
-
-    egg_moves(CUBCHOO,
-        MOVE_YAWN,
-        MOVE_AVALANCHE,
-        MOVE_ENCORE,
-        MOVE_ICE_PUNCH,
-        MOVE_NIGHT_SLASH,
-        MOVE_ASSURANCE,
-        MOVE_SLEEP_TALK,
-        MOVE_FOCUS_PUNCH,
-        MOVE_PLAY_ROUGH),
-
-    egg_moves(SHELMET,
-        MOVE_ENDURE,
-        MOVE_BATON_PASS,
-        MOVE_DOUBLE_EDGE,
-        MOVE_ENCORE,
-        MOVE_GUARD_SPLIT,
-        MOVE_MIND_READER,
-        MOVE_MUD_SLAP,
-        MOVE_SPIKES,
-        MOVE_FEINT,
-        MOVE_PURSUIT,
-        MOVE_TOXIC_SPIKES),
-
-    egg_moves(STUNFISK,
-        MOVE_SHOCK_WAVE,
-        MOVE_EARTH_POWER,
-        MOVE_YAWN,
-        MOVE_SLEEP_TALK,
-        MOVE_ASTONISH,
-        MOVE_CURSE,
-        MOVE_SPITE,
-        MOVE_SPARK,
-        MOVE_PAIN_SPLIT,
-        MOVE_EERIE_IMPULSE,
-        MOVE_REFLECT_TYPE,
-        MOVE_ME_FIRST),
-
-    egg_moves(MIENFOO,
-        MOVE_ENDURE,
-        MOVE_VITAL_THROW,
-        MOVE_BATON_PASS,
-        MOVE_SMELLING_SALTS,
-        MOVE_LOW_KICK,
-        MOVE_FEINT,
-        MOVE_ME_FIRST,
-        MOVE_KNOCK_OFF,
-        MOVE_ALLY_SWITCH),
-
-    egg_moves(DRUDDIGON,
-        MOVE_FIRE_FANG,
-        MOVE_THUNDER_FANG,
-        MOVE_CRUSH_CLAW,
-        MOVE_FEINT_ATTACK,
-        MOVE_PURSUIT,
-        MOVE_IRON_TAIL,
-        MOVE_POISON_TAIL,
-        MOVE_SNATCH,
-        MOVE_METAL_CLAW,
-        MOVE_GLARE,
-        MOVE_SUCKER_PUNCH),
-
-    egg_moves(PAWNIARD,
-        MOVE_REVENGE,
-        MOVE_SUCKER_PUNCH,
-        MOVE_PURSUIT,
-        MOVE_HEADBUTT,
-        MOVE_STEALTH_ROCK,
-        MOVE_PSYCHO_CUT,
-        MOVE_MEAN_LOOK,
-        MOVE_QUICK_GUARD),
-
-    egg_moves(BOUFFALANT,
-        MOVE_STOMP,
-        MOVE_ROCK_CLIMB,
-        MOVE_HEADBUTT,
-        MOVE_SKULL_BASH,
-        MOVE_MUD_SHOT,
-        MOVE_MUD_SLAP,
-        MOVE_IRON_HEAD,
-        MOVE_AMNESIA,
-        MOVE_BELCH,
-        MOVE_COTTON_GUARD),
-
-    egg_moves(VULLABY,
-        MOVE_STEEL_WING,
-        MOVE_MEAN_LOOK,
-        MOVE_ROOST,
-        MOVE_SCARY_FACE,
-        MOVE_KNOCK_OFF,
-        MOVE_FAKE_TEARS,
-        MOVE_FOUL_PLAY),
-
-    egg_moves(HEATMOR,
-        MOVE_PURSUIT,
-        MOVE_WRAP,
-        MOVE_NIGHT_SLASH,
-        MOVE_CURSE,
-        MOVE_BODY_SLAM,
-        MOVE_HEAT_WAVE,
-        MOVE_FEINT_ATTACK,
-        MOVE_SUCKER_PUNCH,
-        MOVE_TICKLE,
-        MOVE_SLEEP_TALK,
-        MOVE_BELCH),
-
-    egg_moves(DURANT,
-        MOVE_SCREECH,
-        MOVE_ENDURE,
-        MOVE_ROCK_CLIMB,
-        MOVE_BATON_PASS,
-        MOVE_THUNDER_FANG,
-        MOVE_FEINT_ATTACK),
-
-    egg_moves(DEINO,
-        MOVE_FIRE_FANG,
-        MOVE_THUNDER_FANG,
-        MOVE_ICE_FANG,
-        MOVE_DOUBLE_HIT,
-        MOVE_ASTONISH,
-        MOVE_EARTH_POWER,
-        MOVE_SCREECH,
-        MOVE_HEAD_SMASH,
-        MOVE_ASSURANCE,
-        MOVE_DARK_PULSE,
-        MOVE_BELCH),
-
-    egg_moves(LARVESTA,
-        MOVE_STRING_SHOT,
-        MOVE_HARDEN,
-        MOVE_FORESIGHT,
-        MOVE_ENDURE,
-        MOVE_ZEN_HEADBUTT,
-        MOVE_MORNING_SUN,
-        MOVE_MAGNET_RISE),
+static const u16 sAxewEggMoveLearnset[] = {
+    MOVE_COUNTER,
+    MOVE_FOCUS_ENERGY,
+    MOVE_REVERSAL,
+    MOVE_ENDURE,
+    MOVE_RAZOR_WIND,
+    MOVE_NIGHT_SLASH,
+    MOVE_ENDEAVOR,
+    MOVE_IRON_TAIL,
+    MOVE_DRAGON_PULSE,
+    MOVE_HARDEN,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sCubchooEggMoveLearnset[] = {
+    MOVE_YAWN,
+    MOVE_AVALANCHE,
+    MOVE_ENCORE,
+    MOVE_ICE_PUNCH,
+    MOVE_NIGHT_SLASH,
+    MOVE_ASSURANCE,
+    MOVE_SLEEP_TALK,
+    MOVE_FOCUS_PUNCH,
+    MOVE_PLAY_ROUGH,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sShelmetEggMoveLearnset[] = {
+    MOVE_ENDURE,
+    MOVE_BATON_PASS,
+    MOVE_DOUBLE_EDGE,
+    MOVE_ENCORE,
+    MOVE_GUARD_SPLIT,
+    MOVE_MIND_READER,
+    MOVE_MUD_SLAP,
+    MOVE_SPIKES,
+    MOVE_FEINT,
+    MOVE_PURSUIT,
+    MOVE_TOXIC_SPIKES,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sStunfiskEggMoveLearnset[] = {
+    MOVE_SHOCK_WAVE,
+    MOVE_EARTH_POWER,
+    MOVE_YAWN,
+    MOVE_SLEEP_TALK,
+    MOVE_ASTONISH,
+    MOVE_CURSE,
+    MOVE_SPITE,
+    MOVE_SPARK,
+    MOVE_PAIN_SPLIT,
+    MOVE_EERIE_IMPULSE,
+    MOVE_REFLECT_TYPE,
+    MOVE_ME_FIRST,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sMienfooEggMoveLearnset[] = {
+    MOVE_ENDURE,
+    MOVE_VITAL_THROW,
+    MOVE_BATON_PASS,
+    MOVE_SMELLING_SALTS,
+    MOVE_LOW_KICK,
+    MOVE_FEINT,
+    MOVE_ME_FIRST,
+    MOVE_KNOCK_OFF,
+    MOVE_ALLY_SWITCH,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sDruddigonEggMoveLearnset[] = {
+    MOVE_FIRE_FANG,
+    MOVE_THUNDER_FANG,
+    MOVE_CRUSH_CLAW,
+    MOVE_FEINT_ATTACK,
+    MOVE_PURSUIT,
+    MOVE_IRON_TAIL,
+    MOVE_POISON_TAIL,
+    MOVE_SNATCH,
+    MOVE_METAL_CLAW,
+    MOVE_GLARE,
+    MOVE_SUCKER_PUNCH,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sPawniardEggMoveLearnset[] = {
+    MOVE_REVENGE,
+    MOVE_SUCKER_PUNCH,
+    MOVE_PURSUIT,
+    MOVE_HEADBUTT,
+    MOVE_STEALTH_ROCK,
+    MOVE_PSYCHO_CUT,
+    MOVE_MEAN_LOOK,
+    MOVE_QUICK_GUARD,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sBouffalantEggMoveLearnset[] = {
+    MOVE_STOMP,
+    MOVE_ROCK_CLIMB,
+    MOVE_HEADBUTT,
+    MOVE_SKULL_BASH,
+    MOVE_MUD_SHOT,
+    MOVE_MUD_SLAP,
+    MOVE_IRON_HEAD,
+    MOVE_AMNESIA,
+    MOVE_BELCH,
+    MOVE_COTTON_GUARD,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sVullabyEggMoveLearnset[] = {
+    MOVE_STEEL_WING,
+    MOVE_MEAN_LOOK,
+    MOVE_ROOST,
+    MOVE_SCARY_FACE,
+    MOVE_KNOCK_OFF,
+    MOVE_FAKE_TEARS,
+    MOVE_FOUL_PLAY,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sHeatmorEggMoveLearnset[] = {
+    MOVE_PURSUIT,
+    MOVE_WRAP,
+    MOVE_NIGHT_SLASH,
+    MOVE_CURSE,
+    MOVE_BODY_SLAM,
+    MOVE_HEAT_WAVE,
+    MOVE_FEINT_ATTACK,
+    MOVE_SUCKER_PUNCH,
+    MOVE_TICKLE,
+    MOVE_SLEEP_TALK,
+    MOVE_BELCH,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sDurantEggMoveLearnset[] = {
+    MOVE_SCREECH,
+    MOVE_ENDURE,
+    MOVE_ROCK_CLIMB,
+    MOVE_BATON_PASS,
+    MOVE_THUNDER_FANG,
+    MOVE_FEINT_ATTACK,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sDeinoEggMoveLearnset[] = {
+    MOVE_FIRE_FANG,
+    MOVE_THUNDER_FANG,
+    MOVE_ICE_FANG,
+    MOVE_DOUBLE_HIT,
+    MOVE_ASTONISH,
+    MOVE_EARTH_POWER,
+    MOVE_SCREECH,
+    MOVE_HEAD_SMASH,
+    MOVE_ASSURANCE,
+    MOVE_DARK_PULSE,
+    MOVE_BELCH,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sLarvestaEggMoveLearnset[] = {
+    MOVE_STRING_SHOT,
+    MOVE_HARDEN,
+    MOVE_FORESIGHT,
+    MOVE_ENDURE,
+    MOVE_ZEN_HEADBUTT,
+    MOVE_MORNING_SUN,
+    MOVE_MAGNET_RISE,
+    MOVE_UNAVAILABLE,
+};
 #endif
 
 #if P_GEN_6_POKEMON == TRUE
-    egg_moves(CHESPIN,
-        MOVE_SYNTHESIS,
-        MOVE_BELLY_DRUM,
-        MOVE_CURSE,
-        MOVE_QUICK_GUARD,
-        MOVE_SPIKES,
-        MOVE_DEFENSE_CURL,
-        MOVE_ROLLOUT,
-        MOVE_POWER_UP_PUNCH),
-
-    egg_moves(FENNEKIN,
-        MOVE_WISH,
-        MOVE_HYPNOSIS,
-        MOVE_HEAT_WAVE,
-        MOVE_MAGIC_COAT,
-        MOVE_PSYCHIC_TERRAIN),
-
-    egg_moves(FROAKIE,
-        MOVE_BESTOW,
-        MOVE_MIND_READER,
-        MOVE_TOXIC_SPIKES,
-        MOVE_MUD_SPORT,
-        MOVE_CAMOUFLAGE,
-        MOVE_WATER_SPORT,
-        MOVE_POWER_UP_PUNCH),
-
-    egg_moves(BUNNELBY,
-        MOVE_SPIKES,
-        MOVE_DEFENSE_CURL,
-        MOVE_ROLLOUT),
-
-    egg_moves(FLETCHLING,
-        MOVE_TAILWIND,
-        MOVE_SNATCH,
-        MOVE_QUICK_GUARD),
-
-    egg_moves(SCATTERBUG,
-        MOVE_STUN_SPORE,
-        MOVE_POISON_POWDER,
-        MOVE_RAGE_POWDER),
-
-    egg_moves(LITLEO,
-        MOVE_ENTRAINMENT,
-        MOVE_YAWN,
-        MOVE_SNATCH,
-        MOVE_FIRE_SPIN,
-        MOVE_FLARE_BLITZ),
-
-    egg_moves(FLABEBE,
-        MOVE_COPYCAT,
-        MOVE_CAPTIVATE,
-        MOVE_CAMOUFLAGE,
-        MOVE_TEARFUL_LOOK),
-
-    egg_moves(SKIDDO,
-        MOVE_DEFENSE_CURL,
-        MOVE_ROLLOUT,
-        MOVE_MILK_DRINK,
-        MOVE_GRASSY_TERRAIN),
-
-    egg_moves(PANCHAM,
-        MOVE_QUASH,
-        MOVE_ME_FIRST,
-        MOVE_QUICK_GUARD,
-        MOVE_FOUL_PLAY,
-        MOVE_STORM_THROW,
-        MOVE_POWER_TRIP),
-
-    egg_moves(FURFROU,
-        MOVE_ROLE_PLAY,
-        MOVE_WORK_UP,
-        MOVE_MIMIC,
-        MOVE_CAPTIVATE,
-        MOVE_REFRESH),
-
-    egg_moves(ESPURR,
-        MOVE_TRICK,
-        MOVE_YAWN,
-        MOVE_ASSIST,
-        MOVE_BARRIER),
-
-    egg_moves(HONEDGE,
-        MOVE_METAL_SOUND,
-        MOVE_SHADOW_SNEAK,
-        MOVE_DESTINY_BOND,
-        MOVE_WIDE_GUARD),
-
-    egg_moves(SPRITZEE,
-        MOVE_DISABLE,
-        MOVE_WISH,
-        MOVE_CAPTIVATE,
-        MOVE_REFRESH,
-        MOVE_NASTY_PLOT),
-
-    egg_moves(SWIRLIX,
-        MOVE_AFTER_YOU,
-        MOVE_YAWN,
-        MOVE_BELLY_DRUM,
-        MOVE_COPYCAT,
-        MOVE_STICKY_WEB),
-
-    egg_moves(INKAY,
-        MOVE_SIMPLE_BEAM,
-        MOVE_POWER_SPLIT,
-        MOVE_CAMOUFLAGE,
-        MOVE_FLATTER,
-        MOVE_DESTINY_BOND,
-        MOVE_GUARD_SWAP),
-
-    egg_moves(BINACLE,
-        MOVE_TICKLE,
-        MOVE_SWITCHEROO,
-        MOVE_HELPING_HAND,
-        MOVE_WATER_SPORT),
-
-    egg_moves(SKRELP,
-        MOVE_TOXIC_SPIKES,
-        MOVE_PLAY_ROUGH,
-        MOVE_HAZE,
-        MOVE_ACID_ARMOR,
-        MOVE_VENOM_DRENCH),
-
-    egg_moves(CLAUNCHER,
-        MOVE_AQUA_JET,
-        MOVE_ENTRAINMENT,
-        MOVE_ENDURE,
-        MOVE_CRABHAMMER,
-        MOVE_HELPING_HAND),
-
-    egg_moves(HELIOPTILE,
-        MOVE_AGILITY,
-        MOVE_GLARE,
-        MOVE_CAMOUFLAGE,
-        MOVE_ELECTRIC_TERRAIN),
-
-    egg_moves(TYRUNT,
-        MOVE_DRAGON_DANCE,
-        MOVE_THUNDER_FANG,
-        MOVE_ICE_FANG,
-        MOVE_POISON_FANG,
-        MOVE_ROCK_POLISH,
-        MOVE_FIRE_FANG,
-        MOVE_CURSE),
-
-    egg_moves(AMAURA,
-        MOVE_HAZE,
-        MOVE_BARRIER,
-        MOVE_MIRROR_COAT,
-        MOVE_MAGNET_RISE,
-        MOVE_DISCHARGE),
-
-    egg_moves(HAWLUCHA,
-        MOVE_AGILITY,
-        MOVE_ME_FIRST,
-        MOVE_ALLY_SWITCH,
-        MOVE_ENTRAINMENT,
-        MOVE_MUD_SPORT,
-        MOVE_BATON_PASS,
-        MOVE_QUICK_GUARD,
-        MOVE_FEINT),
-
-    egg_moves(DEDENNE,
-        MOVE_EERIE_IMPULSE,
-        MOVE_COVET,
-        MOVE_HELPING_HAND,
-        MOVE_NATURAL_GIFT,
-        MOVE_TEARFUL_LOOK),
-
-    egg_moves(GOOMY,
-        MOVE_ACID_ARMOR,
-        MOVE_CURSE,
-        MOVE_IRON_TAIL,
-        MOVE_POISON_TAIL,
-        MOVE_COUNTER,
-        MOVE_ENDURE),
-
-    egg_moves(KLEFKI,
-        MOVE_SWITCHEROO,
-        MOVE_THIEF,
-        MOVE_LOCK_ON,
-        MOVE_IRON_DEFENSE),
-
-    egg_moves(PHANTUMP,
-        MOVE_GRUDGE,
-        MOVE_BESTOW,
-        MOVE_IMPRISON,
-        MOVE_VENOM_DRENCH,
-        MOVE_POWER_UP_PUNCH),
-
-    egg_moves(PUMPKABOO,
-        MOVE_DISABLE,
-        MOVE_BESTOW,
-        MOVE_DESTINY_BOND,
-        MOVE_CURSE),
-
-    egg_moves(BERGMITE,
-        MOVE_RECOVER,
-        MOVE_MIST,
-        MOVE_BARRIER,
-        MOVE_MIRROR_COAT),
-
-    egg_moves(NOIBAT,
-        MOVE_SWITCHEROO,
-        MOVE_SNATCH,
-        MOVE_OUTRAGE,
-        MOVE_TAILWIND),
+static const u16 sChespinEggMoveLearnset[] = {
+    MOVE_SYNTHESIS,
+    MOVE_BELLY_DRUM,
+    MOVE_CURSE,
+    MOVE_QUICK_GUARD,
+    MOVE_SPIKES,
+    MOVE_DEFENSE_CURL,
+    MOVE_ROLLOUT,
+    MOVE_POWER_UP_PUNCH,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sFennekinEggMoveLearnset[] = {
+    MOVE_WISH,
+    MOVE_HYPNOSIS,
+    MOVE_HEAT_WAVE,
+    MOVE_MAGIC_COAT,
+    MOVE_PSYCHIC_TERRAIN,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sFroakieEggMoveLearnset[] = {
+    MOVE_BESTOW,
+    MOVE_MIND_READER,
+    MOVE_TOXIC_SPIKES,
+    MOVE_MUD_SPORT,
+    MOVE_CAMOUFLAGE,
+    MOVE_WATER_SPORT,
+    MOVE_POWER_UP_PUNCH,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sBunnelbyEggMoveLearnset[] = {
+    MOVE_SPIKES,
+    MOVE_DEFENSE_CURL,
+    MOVE_ROLLOUT,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sFletchlingEggMoveLearnset[] = {
+    MOVE_TAILWIND,
+    MOVE_SNATCH,
+    MOVE_QUICK_GUARD,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sScatterbugEggMoveLearnset[] = {
+    MOVE_STUN_SPORE,
+    MOVE_POISON_POWDER,
+    MOVE_RAGE_POWDER,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sLitleoEggMoveLearnset[] = {
+    MOVE_ENTRAINMENT,
+    MOVE_YAWN,
+    MOVE_SNATCH,
+    MOVE_FIRE_SPIN,
+    MOVE_FLARE_BLITZ,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sFlabebeEggMoveLearnset[] = {
+    MOVE_COPYCAT,
+    MOVE_CAPTIVATE,
+    MOVE_CAMOUFLAGE,
+    MOVE_TEARFUL_LOOK,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sSkiddoEggMoveLearnset[] = {
+    MOVE_DEFENSE_CURL,
+    MOVE_ROLLOUT,
+    MOVE_MILK_DRINK,
+    MOVE_GRASSY_TERRAIN,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sPanchamEggMoveLearnset[] = {
+    MOVE_QUASH,
+    MOVE_ME_FIRST,
+    MOVE_QUICK_GUARD,
+    MOVE_FOUL_PLAY,
+    MOVE_STORM_THROW,
+    MOVE_POWER_TRIP,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sFurfrouEggMoveLearnset[] = {
+    MOVE_ROLE_PLAY,
+    MOVE_WORK_UP,
+    MOVE_MIMIC,
+    MOVE_CAPTIVATE,
+    MOVE_REFRESH,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sEspurrEggMoveLearnset[] = {
+    MOVE_TRICK,
+    MOVE_YAWN,
+    MOVE_ASSIST,
+    MOVE_BARRIER,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sHonedgeEggMoveLearnset[] = {
+    MOVE_METAL_SOUND,
+    MOVE_SHADOW_SNEAK,
+    MOVE_DESTINY_BOND,
+    MOVE_WIDE_GUARD,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sSpritzeeEggMoveLearnset[] = {
+    MOVE_DISABLE,
+    MOVE_WISH,
+    MOVE_CAPTIVATE,
+    MOVE_REFRESH,
+    MOVE_NASTY_PLOT,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sSwirlixEggMoveLearnset[] = {
+    MOVE_AFTER_YOU,
+    MOVE_YAWN,
+    MOVE_BELLY_DRUM,
+    MOVE_COPYCAT,
+    MOVE_STICKY_WEB,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sInkayEggMoveLearnset[] = {
+    MOVE_SIMPLE_BEAM,
+    MOVE_POWER_SPLIT,
+    MOVE_CAMOUFLAGE,
+    MOVE_FLATTER,
+    MOVE_DESTINY_BOND,
+    MOVE_GUARD_SWAP,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sBinacleEggMoveLearnset[] = {
+    MOVE_TICKLE,
+    MOVE_SWITCHEROO,
+    MOVE_HELPING_HAND,
+    MOVE_WATER_SPORT,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sSkrelpEggMoveLearnset[] = {
+    MOVE_TOXIC_SPIKES,
+    MOVE_PLAY_ROUGH,
+    MOVE_HAZE,
+    MOVE_ACID_ARMOR,
+    MOVE_VENOM_DRENCH,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sClauncherEggMoveLearnset[] = {
+    MOVE_AQUA_JET,
+    MOVE_ENTRAINMENT,
+    MOVE_ENDURE,
+    MOVE_CRABHAMMER,
+    MOVE_HELPING_HAND,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sHelioptileEggMoveLearnset[] = {
+    MOVE_AGILITY,
+    MOVE_GLARE,
+    MOVE_CAMOUFLAGE,
+    MOVE_ELECTRIC_TERRAIN,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sTyruntEggMoveLearnset[] = {
+    MOVE_DRAGON_DANCE,
+    MOVE_THUNDER_FANG,
+    MOVE_ICE_FANG,
+    MOVE_POISON_FANG,
+    MOVE_ROCK_POLISH,
+    MOVE_FIRE_FANG,
+    MOVE_CURSE,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sAmauraEggMoveLearnset[] = {
+    MOVE_HAZE,
+    MOVE_BARRIER,
+    MOVE_MIRROR_COAT,
+    MOVE_MAGNET_RISE,
+    MOVE_DISCHARGE,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sHawluchaEggMoveLearnset[] = {
+    MOVE_AGILITY,
+    MOVE_ME_FIRST,
+    MOVE_ALLY_SWITCH,
+    MOVE_ENTRAINMENT,
+    MOVE_MUD_SPORT,
+    MOVE_BATON_PASS,
+    MOVE_QUICK_GUARD,
+    MOVE_FEINT,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sDedenneEggMoveLearnset[] = {
+    MOVE_EERIE_IMPULSE,
+    MOVE_COVET,
+    MOVE_HELPING_HAND,
+    MOVE_NATURAL_GIFT,
+    MOVE_TEARFUL_LOOK,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sGoomyEggMoveLearnset[] = {
+    MOVE_ACID_ARMOR,
+    MOVE_CURSE,
+    MOVE_IRON_TAIL,
+    MOVE_POISON_TAIL,
+    MOVE_COUNTER,
+    MOVE_ENDURE,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sKlefkiEggMoveLearnset[] = {
+    MOVE_SWITCHEROO,
+    MOVE_THIEF,
+    MOVE_LOCK_ON,
+    MOVE_IRON_DEFENSE,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sPhantumpEggMoveLearnset[] = {
+    MOVE_GRUDGE,
+    MOVE_BESTOW,
+    MOVE_IMPRISON,
+    MOVE_VENOM_DRENCH,
+    MOVE_POWER_UP_PUNCH,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sPumpkabooEggMoveLearnset[] = {
+    MOVE_DISABLE,
+    MOVE_BESTOW,
+    MOVE_DESTINY_BOND,
+    MOVE_CURSE,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sBergmiteEggMoveLearnset[] = {
+    MOVE_RECOVER,
+    MOVE_MIST,
+    MOVE_BARRIER,
+    MOVE_MIRROR_COAT,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sNoibatEggMoveLearnset[] = {
+    MOVE_SWITCHEROO,
+    MOVE_SNATCH,
+    MOVE_OUTRAGE,
+    MOVE_TAILWIND,
+    MOVE_UNAVAILABLE,
+};
 #endif
 
 #if P_GEN_7_POKEMON == TRUE
-    egg_moves(ROWLET,
-        MOVE_CURSE,
-        MOVE_CONFUSE_RAY,
-        MOVE_OMINOUS_WIND,
-        MOVE_HAZE,
-        MOVE_BATON_PASS,
-        MOVE_DEFOG),
-
-    egg_moves(LITTEN,
-        MOVE_NASTY_PLOT,
-        MOVE_BODY_SLAM,
-        MOVE_CRUNCH,
-        MOVE_FAKE_OUT,
-        MOVE_REVENGE,
-        MOVE_HEAT_WAVE,
-        MOVE_POWER_TRIP),
-
-    egg_moves(POPPLIO,
-        MOVE_CHARM,
-        MOVE_AMNESIA,
-        MOVE_AQUA_RING,
-        MOVE_AROMATIC_MIST,
-        MOVE_PERISH_SONG,
-        MOVE_WONDER_ROOM),
-
-    egg_moves(PIKIPEK,
-        MOVE_BRAVE_BIRD,
-        MOVE_BOOMBURST,
-        MOVE_MIRROR_MOVE,
-        MOVE_TAILWIND,
-        MOVE_UPROAR),
-
-    egg_moves(YUNGOOS,
-        MOVE_REVENGE,
-        MOVE_LAST_RESORT,
-        MOVE_FIRE_FANG,
-        MOVE_ICE_FANG,
-        MOVE_THUNDER_FANG),
-
-    egg_moves(GRUBBIN,
-        MOVE_HARDEN,
-        MOVE_ELECTROWEB,
-        MOVE_MUD_SHOT,
-        MOVE_ENDURE),
-
-    egg_moves(CRABRAWLER,
-        MOVE_WIDE_GUARD,
-        MOVE_SUPERPOWER,
-        MOVE_ENDEAVOR,
-        MOVE_AMNESIA),
-
-    egg_moves(ORICORIO,
-        MOVE_PLUCK,
-        MOVE_TAILWIND,
-        MOVE_SAFEGUARD,
-        MOVE_CAPTIVATE),
-
-    egg_moves(CUTIEFLY,
-        MOVE_BATON_PASS,
-        MOVE_SKILL_SWAP,
-        MOVE_SPEED_SWAP,
-        MOVE_BESTOW,
-        MOVE_MOONBLAST,
-        MOVE_POWDER,
-        MOVE_STICKY_WEB),
-
-    egg_moves(ROCKRUFF,
-        MOVE_CRUSH_CLAW,
-        MOVE_FIRE_FANG,
-        MOVE_THUNDER_FANG,
-        MOVE_SUCKER_PUNCH,
-        MOVE_THRASH),
-
-    egg_moves(WISHIWASHI,
-        MOVE_MUDDY_WATER,
-        MOVE_MIST,
-        MOVE_WATER_PULSE,
-        MOVE_WATER_SPORT,
-        MOVE_WHIRLPOOL),
-
-    egg_moves(MAREANIE,
-        MOVE_STOCKPILE,
-        MOVE_SWALLOW,
-        MOVE_SPIT_UP,
-        MOVE_HAZE),
-
-    egg_moves(MUDBRAY,
-        MOVE_BODY_SLAM,
-        MOVE_DOUBLE_EDGE,
-        MOVE_MAGNITUDE,
-        MOVE_CLOSE_COMBAT,
-        MOVE_MUD_BOMB),
-
-    egg_moves(DEWPIDER,
-        MOVE_POWER_SPLIT,
-        MOVE_AURORA_BEAM,
-        MOVE_STOCKPILE,
-        MOVE_SPIT_UP,
-        MOVE_STICKY_WEB),
-
-    egg_moves(FOMANTIS,
-        MOVE_WEATHER_BALL,
-        MOVE_GIGA_DRAIN,
-        MOVE_AROMATHERAPY,
-        MOVE_DEFOG,
-        MOVE_LEAF_STORM),
-
-    egg_moves(MORELULL,
-        MOVE_AMNESIA,
-        MOVE_POISON_POWDER,
-        MOVE_STUN_SPORE,
-        MOVE_GROWTH,
-        MOVE_LEECH_SEED),
-
-    egg_moves(SALANDIT,
-        MOVE_BELCH,
-        MOVE_KNOCK_OFF,
-        MOVE_SAND_ATTACK,
-        MOVE_SNATCH,
-        MOVE_FAKE_OUT),
-
-    egg_moves(STUFFUL,
-        MOVE_ICE_PUNCH,
-        MOVE_THUNDER_PUNCH,
-        MOVE_FORCE_PALM,
-        MOVE_ENDURE,
-        MOVE_WIDE_GUARD,
-        MOVE_MEGA_KICK,
-        MOVE_STOMPING_TANTRUM),
-
-    egg_moves(BOUNSWEET,
-        MOVE_GRASS_WHISTLE,
-        MOVE_SYNTHESIS,
-        MOVE_PLAY_ROUGH,
-        MOVE_FEINT,
-        MOVE_CHARM,
-        MOVE_ACUPRESSURE),
-
-    egg_moves(COMFEY,
-        MOVE_ENDURE,
-        MOVE_AMNESIA,
-        MOVE_AFTER_YOU,
-        MOVE_LUCKY_CHANT),
-
-    egg_moves(ORANGURU,
-        MOVE_EXTRASENSORY,
-        MOVE_WONDER_ROOM,
-        MOVE_PSYCHIC_TERRAIN),
-
-    egg_moves(PASSIMIAN,
-        MOVE_SEISMIC_TOSS,
-        MOVE_VITAL_THROW,
-        MOVE_QUICK_GUARD,
-        MOVE_IRON_HEAD,
-        MOVE_QUICK_ATTACK,
-        MOVE_FEINT),
-
-    egg_moves(WIMPOD,
-        MOVE_SPIKES,
-        MOVE_METAL_CLAW,
-        MOVE_WIDE_GUARD,
-        MOVE_HARDEN,
-        MOVE_AQUA_JET),
-
-    egg_moves(SANDYGAST,
-        MOVE_AMNESIA,
-        MOVE_DESTINY_BOND,
-        MOVE_ANCIENT_POWER,
-        MOVE_STOCKPILE,
-        MOVE_SWALLOW,
-        MOVE_SPIT_UP,
-        MOVE_CURSE),
-
-    egg_moves(PYUKUMUKU,
-        MOVE_ENDURE,
-        MOVE_VENOM_DRENCH,
-        MOVE_BESTOW,
-        MOVE_TICKLE,
-        MOVE_SPITE),
-
-    egg_moves(KOMALA,
-        MOVE_CHARM,
-        MOVE_WISH,
-        MOVE_PLAY_ROUGH,
-        MOVE_SING),
-
-    egg_moves(TURTONATOR,
-        MOVE_WIDE_GUARD,
-        MOVE_REVENGE,
-        MOVE_HEAD_SMASH,
-        MOVE_FIRE_SPIN),
-
-    egg_moves(TOGEDEMARU,
-        MOVE_REVERSAL,
-        MOVE_PRESENT,
-        MOVE_ENCORE,
-        MOVE_TWINEEDLE,
-        MOVE_WISH,
-        MOVE_FAKE_OUT,
-        MOVE_TICKLE,
-        MOVE_FLAIL,
-        MOVE_DISARMING_VOICE),
-
-    egg_moves(MIMIKYU,
-        MOVE_GRUDGE,
-        MOVE_DESTINY_BOND,
-        MOVE_CURSE,
-        MOVE_NIGHTMARE),
-
-    egg_moves(BRUXISH,
-        MOVE_WATER_PULSE,
-        MOVE_POISON_FANG,
-        MOVE_ICE_FANG,
-        MOVE_RAGE),
-
-    egg_moves(DRAMPA,
-        MOVE_HURRICANE,
-        MOVE_DRAGON_RUSH,
-        MOVE_RAZOR_WIND,
-        MOVE_MIST,
-        MOVE_PLAY_ROUGH),
-
-    egg_moves(JANGMO_O,
-        MOVE_COUNTER,
-        MOVE_REVERSAL,
-        MOVE_DRAGON_BREATH),
+static const u16 sRowletEggMoveLearnset[] = {
+    MOVE_CURSE,
+    MOVE_CONFUSE_RAY,
+    MOVE_OMINOUS_WIND,
+    MOVE_HAZE,
+    MOVE_BATON_PASS,
+    MOVE_DEFOG,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sLittenEggMoveLearnset[] = {
+    MOVE_NASTY_PLOT,
+    MOVE_BODY_SLAM,
+    MOVE_CRUNCH,
+    MOVE_FAKE_OUT,
+    MOVE_REVENGE,
+    MOVE_HEAT_WAVE,
+    MOVE_POWER_TRIP,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sPopplioEggMoveLearnset[] = {
+    MOVE_CHARM,
+    MOVE_AMNESIA,
+    MOVE_AQUA_RING,
+    MOVE_AROMATIC_MIST,
+    MOVE_PERISH_SONG,
+    MOVE_WONDER_ROOM,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sPikipekEggMoveLearnset[] = {
+    MOVE_BRAVE_BIRD,
+    MOVE_BOOMBURST,
+    MOVE_MIRROR_MOVE,
+    MOVE_TAILWIND,
+    MOVE_UPROAR,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sYungoosEggMoveLearnset[] = {
+    MOVE_REVENGE,
+    MOVE_LAST_RESORT,
+    MOVE_FIRE_FANG,
+    MOVE_ICE_FANG,
+    MOVE_THUNDER_FANG,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sGrubbinEggMoveLearnset[] = {
+    MOVE_HARDEN,
+    MOVE_ELECTROWEB,
+    MOVE_MUD_SHOT,
+    MOVE_ENDURE,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sCrabrawlerEggMoveLearnset[] = {
+    MOVE_WIDE_GUARD,
+    MOVE_SUPERPOWER,
+    MOVE_ENDEAVOR,
+    MOVE_AMNESIA,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sOricorioEggMoveLearnset[] = {
+    MOVE_PLUCK,
+    MOVE_TAILWIND,
+    MOVE_SAFEGUARD,
+    MOVE_CAPTIVATE,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sCutieflyEggMoveLearnset[] = {
+    MOVE_BATON_PASS,
+    MOVE_SKILL_SWAP,
+    MOVE_SPEED_SWAP,
+    MOVE_BESTOW,
+    MOVE_MOONBLAST,
+    MOVE_POWDER,
+    MOVE_STICKY_WEB,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sRockruffEggMoveLearnset[] = {
+    MOVE_CRUSH_CLAW,
+    MOVE_FIRE_FANG,
+    MOVE_THUNDER_FANG,
+    MOVE_SUCKER_PUNCH,
+    MOVE_THRASH,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sWishiwashiEggMoveLearnset[] = {
+    MOVE_MUDDY_WATER,
+    MOVE_MIST,
+    MOVE_WATER_PULSE,
+    MOVE_WATER_SPORT,
+    MOVE_WHIRLPOOL,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sMareanieEggMoveLearnset[] = {
+    MOVE_STOCKPILE,
+    MOVE_SWALLOW,
+    MOVE_SPIT_UP,
+    MOVE_HAZE,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sMudbrayEggMoveLearnset[] = {
+    MOVE_BODY_SLAM,
+    MOVE_DOUBLE_EDGE,
+    MOVE_MAGNITUDE,
+    MOVE_CLOSE_COMBAT,
+    MOVE_MUD_BOMB,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sDewpiderEggMoveLearnset[] = {
+    MOVE_POWER_SPLIT,
+    MOVE_AURORA_BEAM,
+    MOVE_STOCKPILE,
+    MOVE_SPIT_UP,
+    MOVE_STICKY_WEB,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sFomantisEggMoveLearnset[] = {
+    MOVE_WEATHER_BALL,
+    MOVE_GIGA_DRAIN,
+    MOVE_AROMATHERAPY,
+    MOVE_DEFOG,
+    MOVE_LEAF_STORM,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sMorelullEggMoveLearnset[] = {
+    MOVE_AMNESIA,
+    MOVE_POISON_POWDER,
+    MOVE_STUN_SPORE,
+    MOVE_GROWTH,
+    MOVE_LEECH_SEED,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sSalanditEggMoveLearnset[] = {
+    MOVE_BELCH,
+    MOVE_KNOCK_OFF,
+    MOVE_SAND_ATTACK,
+    MOVE_SNATCH,
+    MOVE_FAKE_OUT,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sStuffulEggMoveLearnset[] = {
+    MOVE_ICE_PUNCH,
+    MOVE_THUNDER_PUNCH,
+    MOVE_FORCE_PALM,
+    MOVE_ENDURE,
+    MOVE_WIDE_GUARD,
+    MOVE_MEGA_KICK,
+    MOVE_STOMPING_TANTRUM,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sBounsweetEggMoveLearnset[] = {
+    MOVE_GRASS_WHISTLE,
+    MOVE_SYNTHESIS,
+    MOVE_PLAY_ROUGH,
+    MOVE_FEINT,
+    MOVE_CHARM,
+    MOVE_ACUPRESSURE,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sComfeyEggMoveLearnset[] = {
+    MOVE_ENDURE,
+    MOVE_AMNESIA,
+    MOVE_AFTER_YOU,
+    MOVE_LUCKY_CHANT,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sOranguruEggMoveLearnset[] = {
+    MOVE_EXTRASENSORY,
+    MOVE_WONDER_ROOM,
+    MOVE_PSYCHIC_TERRAIN,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sPassimianEggMoveLearnset[] = {
+    MOVE_SEISMIC_TOSS,
+    MOVE_VITAL_THROW,
+    MOVE_QUICK_GUARD,
+    MOVE_IRON_HEAD,
+    MOVE_QUICK_ATTACK,
+    MOVE_FEINT,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sWimpodEggMoveLearnset[] = {
+    MOVE_SPIKES,
+    MOVE_METAL_CLAW,
+    MOVE_WIDE_GUARD,
+    MOVE_HARDEN,
+    MOVE_AQUA_JET,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sSandygastEggMoveLearnset[] = {
+    MOVE_AMNESIA,
+    MOVE_DESTINY_BOND,
+    MOVE_ANCIENT_POWER,
+    MOVE_STOCKPILE,
+    MOVE_SWALLOW,
+    MOVE_SPIT_UP,
+    MOVE_CURSE,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sPyukumukuEggMoveLearnset[] = {
+    MOVE_ENDURE,
+    MOVE_VENOM_DRENCH,
+    MOVE_BESTOW,
+    MOVE_TICKLE,
+    MOVE_SPITE,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sKomalaEggMoveLearnset[] = {
+    MOVE_CHARM,
+    MOVE_WISH,
+    MOVE_PLAY_ROUGH,
+    MOVE_SING,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sTurtonatorEggMoveLearnset[] = {
+    MOVE_WIDE_GUARD,
+    MOVE_REVENGE,
+    MOVE_HEAD_SMASH,
+    MOVE_FIRE_SPIN,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sTogedemaruEggMoveLearnset[] = {
+    MOVE_REVERSAL,
+    MOVE_PRESENT,
+    MOVE_ENCORE,
+    MOVE_TWINEEDLE,
+    MOVE_WISH,
+    MOVE_FAKE_OUT,
+    MOVE_TICKLE,
+    MOVE_FLAIL,
+    MOVE_DISARMING_VOICE,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sMimikyuEggMoveLearnset[] = {
+    MOVE_GRUDGE,
+    MOVE_DESTINY_BOND,
+    MOVE_CURSE,
+    MOVE_NIGHTMARE,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sBruxishEggMoveLearnset[] = {
+    MOVE_WATER_PULSE,
+    MOVE_POISON_FANG,
+    MOVE_ICE_FANG,
+    MOVE_RAGE,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sDrampaEggMoveLearnset[] = {
+    MOVE_HURRICANE,
+    MOVE_DRAGON_RUSH,
+    MOVE_RAZOR_WIND,
+    MOVE_MIST,
+    MOVE_PLAY_ROUGH,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sJangmoOEggMoveLearnset[] = {
+    MOVE_COUNTER,
+    MOVE_REVERSAL,
+    MOVE_DRAGON_BREATH,
+    MOVE_UNAVAILABLE,
+};
 #endif
 
 #if P_GEN_8_POKEMON == TRUE
-    egg_moves(GROOKEY,
-        MOVE_GROWTH,
-        MOVE_HAMMER_ARM,
-        MOVE_FAKE_OUT,
-        MOVE_STRENGTH,
-        MOVE_NATURE_POWER,
-        MOVE_WORRY_SEED,
-        MOVE_LEECH_SEED),
-
-    egg_moves(SCORBUNNY,
-        MOVE_HIGH_JUMP_KICK,
-        MOVE_SAND_ATTACK,
-        MOVE_SUCKER_PUNCH,
-        MOVE_SUPER_FANG),
-
-    egg_moves(SOBBLE,
-        MOVE_AQUA_JET,
-        MOVE_DOUBLE_TEAM,
-        MOVE_AQUA_RING,
-        MOVE_MIST,
-        MOVE_HAZE,
-        MOVE_ICE_SHARD,
-        MOVE_FELL_STINGER),
-
-    egg_moves(SKWOVET,
-        MOVE_ROLLOUT,
-        MOVE_DEFENSE_CURL,
-        MOVE_LAST_RESORT,
-        MOVE_BELLY_DRUM),
-
-    egg_moves(ROOKIDEE,
-        MOVE_SKY_ATTACK,
-        MOVE_SAND_ATTACK,
-        MOVE_TAILWIND,
-        MOVE_DEFOG,
-        MOVE_ROCK_SMASH,
-        MOVE_SPITE,
-        MOVE_ROOST),
-
-    egg_moves(BLIPBUG,
-        MOVE_INFESTATION,
-        MOVE_SUPERSONIC,
-        MOVE_STICKY_WEB,
-        MOVE_RECOVER),
-
-    egg_moves(NICKIT,
-        MOVE_QUICK_GUARD,
-        MOVE_KNOCK_OFF,
-        MOVE_HOWL,
-        MOVE_TORMENT),
-
-    egg_moves(GOSSIFLEUR,
-        MOVE_GROWTH,
-        MOVE_LEECH_SEED,
-        MOVE_WORRY_SEED,
-        MOVE_POISON_POWDER,
-        MOVE_STUN_SPORE,
-        MOVE_SLEEP_POWDER),
-
-    egg_moves(WOOLOO,
-        MOVE_STOMP,
-        MOVE_SWAGGER,
-        MOVE_COUNTER),
-
-    egg_moves(CHEWTLE,
-        MOVE_SKULL_BASH,
-        MOVE_GASTRO_ACID,
-        MOVE_DRAGON_TAIL),
-
-    egg_moves(YAMPER,
-        MOVE_DOUBLE_EDGE,
-        MOVE_SAND_ATTACK,
-        MOVE_FLAME_CHARGE,
-        MOVE_DISCHARGE,
-        MOVE_HOWL),
-
-    egg_moves(ROLYCOLY,
-        MOVE_EXPLOSION,
-        MOVE_MUD_SLAP,
-        MOVE_BLOCK),
-
-    egg_moves(APPLIN,
-        MOVE_SUCKER_PUNCH,
-        MOVE_ROLLOUT,
-        MOVE_DEFENSE_CURL,
-        MOVE_RECYCLE),
-
-    egg_moves(SILICOBRA,
-        MOVE_DRAGON_RUSH,
-        MOVE_MUD_SLAP,
-        MOVE_LAST_RESORT,
-        MOVE_BELCH,
-        MOVE_POISON_TAIL),
-
-    egg_moves(CRAMORANT,
-        MOVE_DEFOG,
-        MOVE_AERIAL_ACE,
-        MOVE_FEATHER_DANCE,
-        MOVE_AQUA_RING,
-        MOVE_ROOST),
-
-    egg_moves(ARROKUDA,
-        MOVE_THRASH,
-        MOVE_ACUPRESSURE,
-        MOVE_SLASH,
-        MOVE_NIGHT_SLASH),
-
-    egg_moves(TOXEL,
-        MOVE_ENDEAVOR,
-        MOVE_METAL_SOUND,
-        MOVE_POWER_UP_PUNCH),
-
-    egg_moves(SIZZLIPEDE,
-        MOVE_KNOCK_OFF,
-        MOVE_STRUGGLE_BUG,
-        MOVE_ROLLOUT,
-        MOVE_DEFENSE_CURL),
-
-    egg_moves(CLOBBOPUS,
-        MOVE_PAIN_SPLIT,
-        MOVE_SOAK,
-        MOVE_SUCKER_PUNCH,
-        MOVE_CIRCLE_THROW,
-        MOVE_SEISMIC_TOSS,
-        MOVE_POWER_UP_PUNCH),
-
-    egg_moves(HATENNA,
-        MOVE_AROMATIC_MIST,
-        MOVE_NUZZLE,
-        MOVE_AFTER_YOU,
-        MOVE_QUASH),
-
-    egg_moves(MILCERY,
-        MOVE_BABY_DOLL_EYES,
-        MOVE_LAST_RESORT),
-
-    egg_moves(PINCURCHIN,
-        MOVE_MEMENTO,
-        MOVE_SUCKER_PUNCH),
-
-    egg_moves(SNOM,
-        MOVE_FAIRY_WIND,
-        MOVE_MIRROR_COAT,
-        MOVE_BUG_BITE),
-
-    egg_moves(STONJOURNER,
-        MOVE_CURSE,
-        MOVE_ANCIENT_POWER),
-
-    egg_moves(EISCUE,
-        MOVE_SOAK,
-        MOVE_AQUA_RING,
-        MOVE_BELLY_DRUM,
-        MOVE_DOUBLE_EDGE,
-        MOVE_ICICLE_CRASH,
-        MOVE_HEAD_SMASH),
-
-    egg_moves(INDEEDEE,
-        MOVE_PSYCH_UP,
-        MOVE_FAKE_OUT,
-        MOVE_EXTRASENSORY),
-
-    egg_moves(MORPEKO,
-        MOVE_SWAGGER,
-        MOVE_SUPER_FANG,
-        MOVE_CHARGE,
-        MOVE_TICKLE,
-        MOVE_RAPID_SPIN,
-        MOVE_QUASH,
-        MOVE_PARTING_SHOT,
-        MOVE_FAKE_OUT),
-
-    egg_moves(CUFANT,
-        MOVE_DOUBLE_EDGE,
-        MOVE_BELCH,
-        MOVE_CURSE,
-        MOVE_SLAM,
-        MOVE_FISSURE,
-        MOVE_SWAGGER,
-        MOVE_WHIRLWIND,
-        MOVE_DEFENSE_CURL),
-
-    egg_moves(DURALUDON,
-        MOVE_SLASH,
-        MOVE_NIGHT_SLASH,
-        MOVE_MIRROR_COAT),
-
-    egg_moves(DREEPY,
-        MOVE_CURSE,
-        MOVE_GRUDGE,
-        MOVE_CONFUSE_RAY,
-        MOVE_DOUBLE_TEAM,
-        MOVE_DISABLE,
-        MOVE_DRAGON_TAIL,
-        MOVE_SUCKER_PUNCH),
+static const u16 sGrookeyEggMoveLearnset[] = {
+    MOVE_GROWTH,
+    MOVE_HAMMER_ARM,
+    MOVE_FAKE_OUT,
+    MOVE_STRENGTH,
+    MOVE_NATURE_POWER,
+    MOVE_WORRY_SEED,
+    MOVE_LEECH_SEED,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sScorbunnyEggMoveLearnset[] = {
+    MOVE_HIGH_JUMP_KICK,
+    MOVE_SAND_ATTACK,
+    MOVE_SUCKER_PUNCH,
+    MOVE_SUPER_FANG,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sSobbleEggMoveLearnset[] = {
+    MOVE_AQUA_JET,
+    MOVE_DOUBLE_TEAM,
+    MOVE_AQUA_RING,
+    MOVE_MIST,
+    MOVE_HAZE,
+    MOVE_ICE_SHARD,
+    MOVE_FELL_STINGER,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sSkwovetEggMoveLearnset[] = {
+    MOVE_ROLLOUT,
+    MOVE_DEFENSE_CURL,
+    MOVE_LAST_RESORT,
+    MOVE_BELLY_DRUM,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sRookideeEggMoveLearnset[] = {
+    MOVE_SKY_ATTACK,
+    MOVE_SAND_ATTACK,
+    MOVE_TAILWIND,
+    MOVE_DEFOG,
+    MOVE_ROCK_SMASH,
+    MOVE_SPITE,
+    MOVE_ROOST,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sBlipbugEggMoveLearnset[] = {
+    MOVE_INFESTATION,
+    MOVE_SUPERSONIC,
+    MOVE_STICKY_WEB,
+    MOVE_RECOVER,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sNickitEggMoveLearnset[] = {
+    MOVE_QUICK_GUARD,
+    MOVE_KNOCK_OFF,
+    MOVE_HOWL,
+    MOVE_TORMENT,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sGossifleurEggMoveLearnset[] = {
+    MOVE_GROWTH,
+    MOVE_LEECH_SEED,
+    MOVE_WORRY_SEED,
+    MOVE_POISON_POWDER,
+    MOVE_STUN_SPORE,
+    MOVE_SLEEP_POWDER,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sWoolooEggMoveLearnset[] = {
+    MOVE_STOMP,
+    MOVE_SWAGGER,
+    MOVE_COUNTER,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sChewtleEggMoveLearnset[] = {
+    MOVE_SKULL_BASH,
+    MOVE_GASTRO_ACID,
+    MOVE_DRAGON_TAIL,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sYamperEggMoveLearnset[] = {
+    MOVE_DOUBLE_EDGE,
+    MOVE_SAND_ATTACK,
+    MOVE_FLAME_CHARGE,
+    MOVE_DISCHARGE,
+    MOVE_HOWL,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sRolycolyEggMoveLearnset[] = {
+    MOVE_EXPLOSION,
+    MOVE_MUD_SLAP,
+    MOVE_BLOCK,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sApplinEggMoveLearnset[] = {
+    MOVE_SUCKER_PUNCH,
+    MOVE_ROLLOUT,
+    MOVE_DEFENSE_CURL,
+    MOVE_RECYCLE,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sSilicobraEggMoveLearnset[] = {
+    MOVE_DRAGON_RUSH,
+    MOVE_MUD_SLAP,
+    MOVE_LAST_RESORT,
+    MOVE_BELCH,
+    MOVE_POISON_TAIL,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sCramorantEggMoveLearnset[] = {
+    MOVE_DEFOG,
+    MOVE_AERIAL_ACE,
+    MOVE_FEATHER_DANCE,
+    MOVE_AQUA_RING,
+    MOVE_ROOST,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sArrokudaEggMoveLearnset[] = {
+    MOVE_THRASH,
+    MOVE_ACUPRESSURE,
+    MOVE_SLASH,
+    MOVE_NIGHT_SLASH,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sToxelEggMoveLearnset[] = {
+    MOVE_ENDEAVOR,
+    MOVE_METAL_SOUND,
+    MOVE_POWER_UP_PUNCH,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sSizzlipedeEggMoveLearnset[] = {
+    MOVE_KNOCK_OFF,
+    MOVE_STRUGGLE_BUG,
+    MOVE_ROLLOUT,
+    MOVE_DEFENSE_CURL,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sClobbopusEggMoveLearnset[] = {
+    MOVE_PAIN_SPLIT,
+    MOVE_SOAK,
+    MOVE_SUCKER_PUNCH,
+    MOVE_CIRCLE_THROW,
+    MOVE_SEISMIC_TOSS,
+    MOVE_POWER_UP_PUNCH,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sHatennaEggMoveLearnset[] = {
+    MOVE_AROMATIC_MIST,
+    MOVE_NUZZLE,
+    MOVE_AFTER_YOU,
+    MOVE_QUASH,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sMilceryEggMoveLearnset[] = {
+    MOVE_BABY_DOLL_EYES,
+    MOVE_LAST_RESORT,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sPincurchinEggMoveLearnset[] = {
+    MOVE_MEMENTO,
+    MOVE_SUCKER_PUNCH,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sSnomEggMoveLearnset[] = {
+    MOVE_FAIRY_WIND,
+    MOVE_MIRROR_COAT,
+    MOVE_BUG_BITE,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sStonjournerEggMoveLearnset[] = {
+    MOVE_CURSE,
+    MOVE_ANCIENT_POWER,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sEiscueEggMoveLearnset[] = {
+    MOVE_SOAK,
+    MOVE_AQUA_RING,
+    MOVE_BELLY_DRUM,
+    MOVE_DOUBLE_EDGE,
+    MOVE_ICICLE_CRASH,
+    MOVE_HEAD_SMASH,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sIndeedeeEggMoveLearnset[] = {
+    MOVE_PSYCH_UP,
+    MOVE_FAKE_OUT,
+    MOVE_EXTRASENSORY,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sMorpekoEggMoveLearnset[] = {
+    MOVE_SWAGGER,
+    MOVE_SUPER_FANG,
+    MOVE_CHARGE,
+    MOVE_TICKLE,
+    MOVE_RAPID_SPIN,
+    MOVE_QUASH,
+    MOVE_PARTING_SHOT,
+    MOVE_FAKE_OUT,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sCufantEggMoveLearnset[] = {
+    MOVE_DOUBLE_EDGE,
+    MOVE_BELCH,
+    MOVE_CURSE,
+    MOVE_SLAM,
+    MOVE_FISSURE,
+    MOVE_SWAGGER,
+    MOVE_WHIRLWIND,
+    MOVE_DEFENSE_CURL,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sDuraludonEggMoveLearnset[] = {
+    MOVE_SLASH,
+    MOVE_NIGHT_SLASH,
+    MOVE_MIRROR_COAT,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sDreepyEggMoveLearnset[] = {
+    MOVE_CURSE,
+    MOVE_GRUDGE,
+    MOVE_CONFUSE_RAY,
+    MOVE_DOUBLE_TEAM,
+    MOVE_DISABLE,
+    MOVE_DRAGON_TAIL,
+    MOVE_SUCKER_PUNCH,
+    MOVE_UNAVAILABLE,
+};
 #endif
 
-    egg_moves(RATTATA_ALOLAN,
-        MOVE_COUNTER,
-        MOVE_FINAL_GAMBIT,
-        MOVE_FURY_SWIPES,
-        MOVE_ME_FIRST,
-        MOVE_REVENGE,
-        MOVE_REVERSAL,
-        MOVE_SNATCH,
-        MOVE_STOCKPILE,
-        MOVE_SWALLOW,
-        MOVE_SWITCHEROO,
-        MOVE_UPROAR),
-
-    egg_moves(SANDSHREW_ALOLAN,
-        MOVE_AMNESIA,
-        MOVE_CHIP_AWAY,
-        MOVE_COUNTER,
-        MOVE_CRUSH_CLAW,
-        MOVE_CURSE,
-        MOVE_ENDURE,
-        MOVE_FLAIL,
-        MOVE_HONE_CLAWS,
-        MOVE_ICICLE_CRASH,
-        MOVE_ICICLE_SPEAR,
-        MOVE_METAL_CLAW,
-        MOVE_NIGHT_SLASH),
-
-    egg_moves(VULPIX_ALOLAN,
-        MOVE_AGILITY,
-        MOVE_CHARM,
-        MOVE_DISABLE,
-        MOVE_ENCORE,
-        MOVE_EXTRASENSORY,
-        MOVE_FLAIL,
-        MOVE_FREEZE_DRY,
-        MOVE_HOWL,
-        MOVE_HYPNOSIS,
-        MOVE_MOONBLAST,
-        MOVE_POWER_SWAP,
-        MOVE_SPITE,
-        MOVE_SECRET_POWER,
-        MOVE_TAIL_SLAP),
-
-    egg_moves(DIGLETT_ALOLAN,
-        MOVE_ANCIENT_POWER,
-        MOVE_BEAT_UP,
-        MOVE_ENDURE,
-        MOVE_FEINT_ATTACK,
-        MOVE_FINAL_GAMBIT,
-        MOVE_HEADBUTT,
-        MOVE_MEMENTO,
-        MOVE_METAL_SOUND,
-        MOVE_PURSUIT,
-        MOVE_REVERSAL,
-        MOVE_THRASH),
-
-    egg_moves(MEOWTH_ALOLAN,
-        MOVE_AMNESIA,
-        MOVE_ASSIST,
-        MOVE_CHARM,
-        MOVE_COVET,
-        MOVE_FLAIL,
-        MOVE_FLATTER,
-        MOVE_FOUL_PLAY,
-        MOVE_HYPNOSIS,
-        MOVE_PARTING_SHOT,
-        MOVE_PUNISHMENT,
-        MOVE_SNATCH,
-        MOVE_SPITE),
-
-    egg_moves(GEODUDE_ALOLAN,
-        MOVE_AUTOTOMIZE,
-        MOVE_BLOCK,
-        MOVE_COUNTER,
-        MOVE_CURSE,
-        MOVE_ENDURE,
-        MOVE_FLAIL,
-        MOVE_MAGNET_RISE,
-        MOVE_ROCK_CLIMB,
-        MOVE_SCREECH,
-        MOVE_WIDE_GUARD),
-
-    egg_moves(GRIMER_ALOLAN,
-        MOVE_ASSURANCE,
-        MOVE_CLEAR_SMOG,
-        MOVE_CURSE,
-        MOVE_IMPRISON,
-        MOVE_MEAN_LOOK,
-        MOVE_POWER_UP_PUNCH,
-        MOVE_PURSUIT,
-        MOVE_SCARY_FACE,
-        MOVE_SHADOW_SNEAK,
-        MOVE_SPITE,
-        MOVE_SPIT_UP,
-        MOVE_STOCKPILE,
-        MOVE_SWALLOW),
-
-    egg_moves(MEOWTH_GALARIAN,
-        MOVE_SPITE,
-        MOVE_DOUBLE_EDGE,
-        MOVE_CURSE,
-        MOVE_FLAIL,
-        MOVE_NIGHT_SLASH,
-        MOVE_COVET),
-
-    egg_moves(PONYTA_GALARIAN,
-        MOVE_THRASH,
-        MOVE_DOUBLE_KICK,
-        MOVE_HYPNOSIS,
-        MOVE_DOUBLE_EDGE,
-        MOVE_HORN_DRILL,
-        MOVE_MORNING_SUN),
-
-    egg_moves(SLOWPOKE_GALARIAN,
-        MOVE_BELCH,
-        MOVE_BELLY_DRUM,
-        MOVE_BLOCK,
-        MOVE_STOMP),
-
-    egg_moves(FARFETCHD_GALARIAN,
-        MOVE_COUNTER,
-        MOVE_QUICK_ATTACK,
-        MOVE_FLAIL,
-        MOVE_QUICK_GUARD,
-        MOVE_CURSE,
-        MOVE_COVET,
-        MOVE_NIGHT_SLASH,
-        MOVE_SIMPLE_BEAM,
-        MOVE_DOUBLE_EDGE,
-        MOVE_FEINT,
-        MOVE_SKY_ATTACK),
-
-    egg_moves(MR_MIME_GALARIAN,
-        MOVE_FAKE_OUT,
-        MOVE_CONFUSE_RAY,
-        MOVE_POWER_SPLIT,
-        MOVE_TICKLE),
-
-    egg_moves(CORSOLA_GALARIAN,
-        MOVE_HAZE,
-        MOVE_CONFUSE_RAY,
-        MOVE_NATURE_POWER,
-        MOVE_DESTINY_BOND,
-        MOVE_WATER_PULSE,
-        MOVE_HEAD_SMASH),
-
-    egg_moves(ZIGZAGOON_GALARIAN,
-        MOVE_PARTING_SHOT,
-        MOVE_QUICK_GUARD,
-        MOVE_KNOCK_OFF),
+static const u16 sRattataAlolanEggMoveLearnset[] = {
+    MOVE_COUNTER,
+    MOVE_FINAL_GAMBIT,
+    MOVE_FURY_SWIPES,
+    MOVE_ME_FIRST,
+    MOVE_REVENGE,
+    MOVE_REVERSAL,
+    MOVE_SNATCH,
+    MOVE_STOCKPILE,
+    MOVE_SWALLOW,
+    MOVE_SWITCHEROO,
+    MOVE_UPROAR,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sSandshrewAlolanEggMoveLearnset[] = {
+    MOVE_AMNESIA,
+    MOVE_CHIP_AWAY,
+    MOVE_COUNTER,
+    MOVE_CRUSH_CLAW,
+    MOVE_CURSE,
+    MOVE_ENDURE,
+    MOVE_FLAIL,
+    MOVE_HONE_CLAWS,
+    MOVE_ICICLE_CRASH,
+    MOVE_ICICLE_SPEAR,
+    MOVE_METAL_CLAW,
+    MOVE_NIGHT_SLASH,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sVulpixAlolanEggMoveLearnset[] = {
+    MOVE_AGILITY,
+    MOVE_CHARM,
+    MOVE_DISABLE,
+    MOVE_ENCORE,
+    MOVE_EXTRASENSORY,
+    MOVE_FLAIL,
+    MOVE_FREEZE_DRY,
+    MOVE_HOWL,
+    MOVE_HYPNOSIS,
+    MOVE_MOONBLAST,
+    MOVE_POWER_SWAP,
+    MOVE_SPITE,
+    MOVE_SECRET_POWER,
+    MOVE_TAIL_SLAP,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sDiglettAlolanEggMoveLearnset[] = {
+    MOVE_ANCIENT_POWER,
+    MOVE_BEAT_UP,
+    MOVE_ENDURE,
+    MOVE_FEINT_ATTACK,
+    MOVE_FINAL_GAMBIT,
+    MOVE_HEADBUTT,
+    MOVE_MEMENTO,
+    MOVE_METAL_SOUND,
+    MOVE_PURSUIT,
+    MOVE_REVERSAL,
+    MOVE_THRASH,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sMeowthAlolanEggMoveLearnset[] = {
+    MOVE_AMNESIA,
+    MOVE_ASSIST,
+    MOVE_CHARM,
+    MOVE_COVET,
+    MOVE_FLAIL,
+    MOVE_FLATTER,
+    MOVE_FOUL_PLAY,
+    MOVE_HYPNOSIS,
+    MOVE_PARTING_SHOT,
+    MOVE_PUNISHMENT,
+    MOVE_SNATCH,
+    MOVE_SPITE,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sGeodudeAlolanEggMoveLearnset[] = {
+    MOVE_AUTOTOMIZE,
+    MOVE_BLOCK,
+    MOVE_COUNTER,
+    MOVE_CURSE,
+    MOVE_ENDURE,
+    MOVE_FLAIL,
+    MOVE_MAGNET_RISE,
+    MOVE_ROCK_CLIMB,
+    MOVE_SCREECH,
+    MOVE_WIDE_GUARD,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sGrimerAlolanEggMoveLearnset[] = {
+    MOVE_ASSURANCE,
+    MOVE_CLEAR_SMOG,
+    MOVE_CURSE,
+    MOVE_IMPRISON,
+    MOVE_MEAN_LOOK,
+    MOVE_POWER_UP_PUNCH,
+    MOVE_PURSUIT,
+    MOVE_SCARY_FACE,
+    MOVE_SHADOW_SNEAK,
+    MOVE_SPITE,
+    MOVE_SPIT_UP,
+    MOVE_STOCKPILE,
+    MOVE_SWALLOW,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sMeowthGalarianEggMoveLearnset[] = {
+    MOVE_SPITE,
+    MOVE_DOUBLE_EDGE,
+    MOVE_CURSE,
+    MOVE_FLAIL,
+    MOVE_NIGHT_SLASH,
+    MOVE_COVET,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sPonytaGalarianEggMoveLearnset[] = {
+    MOVE_THRASH,
+    MOVE_DOUBLE_KICK,
+    MOVE_HYPNOSIS,
+    MOVE_DOUBLE_EDGE,
+    MOVE_HORN_DRILL,
+    MOVE_MORNING_SUN,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sSlowpokeGalarianEggMoveLearnset[] = {
+    MOVE_BELCH,
+    MOVE_BELLY_DRUM,
+    MOVE_BLOCK,
+    MOVE_STOMP,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sFarfetchdGalarianEggMoveLearnset[] = {
+    MOVE_COUNTER,
+    MOVE_QUICK_ATTACK,
+    MOVE_FLAIL,
+    MOVE_QUICK_GUARD,
+    MOVE_CURSE,
+    MOVE_COVET,
+    MOVE_NIGHT_SLASH,
+    MOVE_SIMPLE_BEAM,
+    MOVE_DOUBLE_EDGE,
+    MOVE_FEINT,
+    MOVE_SKY_ATTACK,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sMrMimeGalarianEggMoveLearnset[] = {
+    MOVE_FAKE_OUT,
+    MOVE_CONFUSE_RAY,
+    MOVE_POWER_SPLIT,
+    MOVE_TICKLE,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sCorsolaGalarianEggMoveLearnset[] = {
+    MOVE_HAZE,
+    MOVE_CONFUSE_RAY,
+    MOVE_NATURE_POWER,
+    MOVE_DESTINY_BOND,
+    MOVE_WATER_PULSE,
+    MOVE_HEAD_SMASH,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sZigzagoonGalarianEggMoveLearnset[] = {
+    MOVE_PARTING_SHOT,
+    MOVE_QUICK_GUARD,
+    MOVE_KNOCK_OFF,
+    MOVE_UNAVAILABLE,
+};
 
 #if P_GEN_5_POKEMON == TRUE
-    egg_moves(DARUMAKA_GALARIAN,
-        MOVE_FOCUS_PUNCH,
-        MOVE_HAMMER_ARM,
-        MOVE_TAKE_DOWN,
-        MOVE_FLAME_WHEEL,
-        MOVE_YAWN,
-        MOVE_FREEZE_DRY,
-        MOVE_INCINERATE,
-        MOVE_POWER_UP_PUNCH),
-
-    egg_moves(YAMASK_GALARIAN,
-        MOVE_MEMENTO),
-
-    egg_moves(STUNFISK_GALARIAN,
-        MOVE_BIND,
-        MOVE_YAWN,
-        MOVE_ASTONISH,
-        MOVE_CURSE,
-        MOVE_SPITE,
-        MOVE_COUNTER,
-        MOVE_PAIN_SPLIT,
-        MOVE_REFLECT_TYPE),
+static const u16 sDarumakaGalarianEggMoveLearnset[] = {
+    MOVE_FOCUS_PUNCH,
+    MOVE_HAMMER_ARM,
+    MOVE_TAKE_DOWN,
+    MOVE_FLAME_WHEEL,
+    MOVE_YAWN,
+    MOVE_FREEZE_DRY,
+    MOVE_INCINERATE,
+    MOVE_POWER_UP_PUNCH,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sYamaskGalarianEggMoveLearnset[] = {
+    MOVE_MEMENTO,
+    MOVE_UNAVAILABLE,
+};
+
+static const u16 sStunfiskGalarianEggMoveLearnset[] = {
+    MOVE_BIND,
+    MOVE_YAWN,
+    MOVE_ASTONISH,
+    MOVE_CURSE,
+    MOVE_SPITE,
+    MOVE_COUNTER,
+    MOVE_PAIN_SPLIT,
+    MOVE_REFLECT_TYPE,
+    MOVE_UNAVAILABLE,
+};
 #endif
 
-    egg_moves(INDEEDEE_FEMALE,
-        MOVE_PSYCH_UP,
-        MOVE_FAKE_OUT,
-        MOVE_PSYCHO_SHIFT,
-        MOVE_HEAL_PULSE),
+static const u16 sIndeedeeFemaleEggMoveLearnset[] = {
+    MOVE_PSYCH_UP,
+    MOVE_FAKE_OUT,
+    MOVE_PSYCHO_SHIFT,
+    MOVE_HEAL_PULSE,
+    MOVE_UNAVAILABLE,
+};
 
-    EGG_MOVES_TERMINATOR
+// Species without an entry have no egg moves.
+const u16 *const gEggMoveLearnsets[NUM_SPECIES] =
+{
+    [SPECIES_BULBASAUR] = sBulbasaurEggMoveLearnset,
+    [SPECIES_CHARMANDER] = sCharmanderEggMoveLearnset,
+    [SPECIES_SQUIRTLE] = sSquirtleEggMoveLearnset,
+    [SPECIES_PIDGEY] = sPidgeyEggMoveLearnset,
+    [SPECIES_RATTATA] = sRattataEggMoveLearnset,
+    [SPECIES_SPEAROW] = sSpearowEggMoveLearnset,
+    [SPECIES_EKANS] = sEkansEggMoveLearnset,
+    [SPECIES_SANDSHREW] = sSandshrewEggMoveLearnset,
+    [SPECIES_NIDORAN_F] = sNidoranFEggMoveLearnset,
+    [SPECIES_NIDORAN_M] = sNidoranMEggMoveLearnset,
+    [SPECIES_VULPIX] = sVulpixEggMoveLearnset,
+    [SPECIES_ZUBAT] = sZubatEggMoveLearnset,
+    [SPECIES_ODDISH] = sOddishEggMoveLearnset,
+    [SPECIES_PARAS] = sParasEggMoveLearnset,
+    [SPECIES_VENONAT] = sVenonatEggMoveLearnset,
+    [SPECIES_DIGLETT] = sDiglettEggMoveLearnset,
+    [SPECIES_MEOWTH] = sMeowthEggMoveLearnset,
+    [SPECIES_PSYDUCK] = sPsyduckEggMoveLearnset,
+    [SPECIES_MANKEY] = sMankeyEggMoveLearnset,
+    [SPECIES_GROWLITHE] = sGrowlitheEggMoveLearnset,
+    [SPECIES_POLIWAG] = sPoliwagEggMoveLearnset,
+    [SPECIES_ABRA] = sAbraEggMoveLearnset,
+    [SPECIES_MACHOP] = sMachopEggMoveLearnset,
+    [SPECIES_BELLSPROUT] = sBellsproutEggMoveLearnset,
+    [SPECIES_TENTACOOL] = sTentacoolEggMoveLearnset,
+    [SPECIES_GEODUDE] = sGeodudeEggMoveLearnset,
+    [SPECIES_PONYTA] = sPonytaEggMoveLearnset,
+    [SPECIES_SLOWPOKE] = sSlowpokeEggMoveLearnset,
+    [SPECIES_FARFETCHD] = sFarfetchdEggMoveLearnset,
+    [SPECIES_DODUO] = sDoduoEggMoveLearnset,
+    [SPECIES_SEEL] = sSeelEggMoveLearnset,
+    [SPECIES_GRIMER] = sGrimerEggMoveLearnset,
+    [SPECIES_SHELLDER] = sShellderEggMoveLearnset,
+    [SPECIES_GASTLY] = sGastlyEggMoveLearnset,
+    [SPECIES_ONIX] = sOnixEggMoveLearnset,
+    [SPECIES_DROWZEE] = sDrowzeeEggMoveLearnset,
+    [SPECIES_KRABBY] = sKrabbyEggMoveLearnset,
+    [SPECIES_EXEGGCUTE] = sExeggcuteEggMoveLearnset,
+    [SPECIES_CUBONE] = sCuboneEggMoveLearnset,
+    [SPECIES_LICKITUNG] = sLickitungEggMoveLearnset,
+    [SPECIES_KOFFING] = sKoffingEggMoveLearnset,
+    [SPECIES_RHYHORN] = sRhyhornEggMoveLearnset,
+    [SPECIES_CHANSEY] = sChanseyEggMoveLearnset,
+    [SPECIES_TANGELA] = sTangelaEggMoveLearnset,
+    [SPECIES_KANGASKHAN] = sKangaskhanEggMoveLearnset,
+    [SPECIES_HORSEA] = sHorseaEggMoveLearnset,
+    [SPECIES_GOLDEEN] = sGoldeenEggMoveLearnset,
+    [SPECIES_MR_MIME] = sMrMimeEggMoveLearnset,
+    [SPECIES_SCYTHER] = sScytherEggMoveLearnset,
+    [SPECIES_PINSIR] = sPinsirEggMoveLearnset,
+    [SPECIES_LAPRAS] = sLaprasEggMoveLearnset,
+    [SPECIES_EEVEE] = sEeveeEggMoveLearnset,
+    [SPECIES_OMANYTE] = sOmanyteEggMoveLearnset,
+    [SPECIES_KABUTO] = sKabutoEggMoveLearnset,
+    [SPECIES_AERODACTYL] = sAerodactylEggMoveLearnset,
+    [SPECIES_SNORLAX] = sSnorlaxEggMoveLearnset,
+    [SPECIES_DRATINI] = sDratiniEggMoveLearnset,
+    [SPECIES_CHIKORITA] = sChikoritaEggMoveLearnset,
+    [SPECIES_CYNDAQUIL] = sCyndaquilEggMoveLearnset,
+    [SPECIES_TOTODILE] = sTotodileEggMoveLearnset,
+    [SPECIES_SENTRET] = sSentretEggMoveLearnset,
+    [SPECIES_HOOTHOOT] = sHoothootEggMoveLearnset,
+    [SPECIES_LEDYBA] = sLedybaEggMoveLearnset,
+    [SPECIES_SPINARAK] = sSpinarakEggMoveLearnset,
+    [SPECIES_CHINCHOU] = sChinchouEggMoveLearnset,
+    [SPECIES_PICHU] = sPichuEggMoveLearnset,
+    [SPECIES_CLEFFA] = sCleffaEggMoveLearnset,
+    [SPECIES_IGGLYBUFF] = sIgglybuffEggMoveLearnset,
+    [SPECIES_TOGEPI] = sTogepiEggMoveLearnset,
+    [SPECIES_NATU] = sNatuEggMoveLearnset,
+    [SPECIES_MAREEP] = sMareepEggMoveLearnset,
+    [SPECIES_MARILL] = sMarillEggMoveLearnset,
+    [SPECIES_SUDOWOODO] = sSudowoodoEggMoveLearnset,
+    [SPECIES_HOPPIP] = sHoppipEggMoveLearnset,
+    [SPECIES_AIPOM] = sAipomEggMoveLearnset,
+    [SPECIES_SUNKERN] = sSunkernEggMoveLearnset,
+    [SPECIES_YANMA] = sYanmaEggMoveLearnset,
+    [SPECIES_WOOPER] = sWooperEggMoveLearnset,
+    [SPECIES_MURKROW] = sMurkrowEggMoveLearnset,
+    [SPECIES_MISDREAVUS] = sMisdreavusEggMoveLearnset,
+    [SPECIES_GIRAFARIG] = sGirafarigEggMoveLearnset,
+    [SPECIES_PINECO] = sPinecoEggMoveLearnset,
+    [SPECIES_DUNSPARCE] = sDunsparceEggMoveLearnset,
+    [SPECIES_GLIGAR] = sGligarEggMoveLearnset,
+    [SPECIES_SNUBBULL] = sSnubbullEggMoveLearnset,
+    [SPECIES_QWILFISH] = sQwilfishEggMoveLearnset,
+    [SPECIES_SHUCKLE] = sShuckleEggMoveLearnset,
+    [SPECIES_HERACROSS] = sHeracrossEggMoveLearnset,
+    [SPECIES_SNEASEL] = sSneaselEggMoveLearnset,
+    [SPECIES_TEDDIURSA] = sTeddiursaEggMoveLearnset,
+    [SPECIES_SLUGMA] = sSlugmaEggMoveLearnset,
+    [SPECIES_SWINUB] = sSwinubEggMoveLearnset,
+    [SPECIES_CORSOLA] = sCorsolaEggMoveLearnset,
+    [SPECIES_REMORAID] = sRemoraidEggMoveLearnset,
+    [SPECIES_DELIBIRD] = sDelibirdEggMoveLearnset,
+    [SPECIES_MANTINE] = sMantineEggMoveLearnset,
+    [SPECIES_SKARMORY] = sSkarmoryEggMoveLearnset,
+    [SPECIES_HOUNDOUR] = sHoundourEggMoveLearnset,
+    [SPECIES_PHANPY] = sPhanpyEggMoveLearnset,
+    [SPECIES_STANTLER] = sStantlerEggMoveLearnset,
+    [SPECIES_TYROGUE] = sTyrogueEggMoveLearnset,
+    [SPECIES_SMOOCHUM] = sSmoochumEggMoveLearnset,
+    [SPECIES_ELEKID] = sElekidEggMoveLearnset,
+    [SPECIES_MAGBY] = sMagbyEggMoveLearnset,
+    [SPECIES_MILTANK] = sMiltankEggMoveLearnset,
+    [SPECIES_LARVITAR] = sLarvitarEggMoveLearnset,
+    [SPECIES_TREECKO] = sTreeckoEggMoveLearnset,
+    [SPECIES_TORCHIC] = sTorchicEggMoveLearnset,
+    [SPECIES_MUDKIP] = sMudkipEggMoveLearnset,
+    [SPECIES_POOCHYENA] = sPoochyenaEggMoveLearnset,
+    [SPECIES_ZIGZAGOON] = sZigzagoonEggMoveLearnset,
+    [SPECIES_LOTAD] = sLotadEggMoveLearnset,
+    [SPECIES_SEEDOT] = sSeedotEggMoveLearnset,
+    [SPECIES_TAILLOW] = sTaillowEggMoveLearnset,
+    [SPECIES_WINGULL] = sWingullEggMoveLearnset,
+    [SPECIES_RALTS] = sRaltsEggMoveLearnset,
+    [SPECIES_SURSKIT] = sSurskitEggMoveLearnset,
+    [SPECIES_SHROOMISH] = sShroomishEggMoveLearnset,
+    [SPECIES_SLAKOTH] = sSlakothEggMoveLearnset,
+    [SPECIES_NINCADA] = sNincadaEggMoveLearnset,
+    [SPECIES_WHISMUR] = sWhismurEggMoveLearnset,
+    [SPECIES_MAKUHITA] = sMakuhitaEggMoveLearnset,
+    [SPECIES_AZURILL] = sAzurillEggMoveLearnset,
+    [SPECIES_NOSEPASS] = sNosepassEggMoveLearnset,
+    [SPECIES_SKITTY] = sSkittyEggMoveLearnset,
+    [SPECIES_SABLEYE] = sSableyeEggMoveLearnset,
+    [SPECIES_MAWILE] = sMawileEggMoveLearnset,
+    [SPECIES_ARON] = sAronEggMoveLearnset,
+    [SPECIES_MEDITITE] = sMedititeEggMoveLearnset,
+    [SPECIES_ELECTRIKE] = sElectrikeEggMoveLearnset,
+    [SPECIES_PLUSLE] = sPlusleEggMoveLearnset,
+    [SPECIES_MINUN] = sMinunEggMoveLearnset,
+    [SPECIES_VOLBEAT] = sVolbeatEggMoveLearnset,
+    [SPECIES_ILLUMISE] = sIllumiseEggMoveLearnset,
+    [SPECIES_ROSELIA] = sRoseliaEggMoveLearnset,
+    [SPECIES_GULPIN] = sGulpinEggMoveLearnset,
+    [SPECIES_CARVANHA] = sCarvanhaEggMoveLearnset,
+    [SPECIES_WAILMER] = sWailmerEggMoveLearnset,
+    [SPECIES_NUMEL] = sNumelEggMoveLearnset,
+    [SPECIES_TORKOAL] = sTorkoalEggMoveLearnset,
+    [SPECIES_SPOINK] = sSpoinkEggMoveLearnset,
+    [SPECIES_SPINDA] = sSpindaEggMoveLearnset,
+    [SPECIES_TRAPINCH] = sTrapinchEggMoveLearnset,
+    [SPECIES_CACNEA] = sCacneaEggMoveLearnset,
+    [SPECIES_SWABLU] = sSwabluEggMoveLearnset,
+    [SPECIES_ZANGOOSE] = sZangooseEggMoveLearnset,
+    [SPECIES_SEVIPER] = sSeviperEggMoveLearnset,
+    [SPECIES_BARBOACH] = sBarboachEggMoveLearnset,
+    [SPECIES_CORPHISH] = sCorphishEggMoveLearnset,
+    [SPECIES_LILEEP] = sLileepEggMoveLearnset,
+    [SPECIES_ANORITH] = sAnorithEggMoveLearnset,
+    [SPECIES_FEEBAS] = sFeebasEggMoveLearnset,
+    [SPECIES_CASTFORM] = sCastformEggMoveLearnset,
+    [SPECIES_KECLEON] = sKecleonEggMoveLearnset,
+    [SPECIES_SHUPPET] = sShuppetEggMoveLearnset,
+    [SPECIES_DUSKULL] = sDuskullEggMoveLearnset,
+    [SPECIES_TROPIUS] = sTropiusEggMoveLearnset,
+    [SPECIES_CHIMECHO] = sChimechoEggMoveLearnset,
+    [SPECIES_ABSOL] = sAbsolEggMoveLearnset,
+    [SPECIES_SNORUNT] = sSnoruntEggMoveLearnset,
+    [SPECIES_SPHEAL] = sSphealEggMoveLearnset,
+    [SPECIES_CLAMPERL] = sClamperlEggMoveLearnset,
+    [SPECIES_RELICANTH] = sRelicanthEggMoveLearnset,
+    [SPECIES_LUVDISC] = sLuvdiscEggMoveLearnset,
+    [SPECIES_BAGON] = sBagonEggMoveLearnset,
+#if P_GEN_4_POKEMON == TRUE
+    [SPECIES_TURTWIG] = sTurtwigEggMoveLearnset,
+    [SPECIES_CHIMCHAR] = sChimcharEggMoveLearnset,
+    [SPECIES_PIPLUP] = sPiplupEggMoveLearnset,
+    [SPECIES_STARLY] = sStarlyEggMoveLearnset,
+    [SPECIES_BIDOOF] = sBidoofEggMoveLearnset,
+    [SPECIES_SHINX] = sShinxEggMoveLearnset,
+    [SPECIES_BUDEW] = sBudewEggMoveLearnset,
+    [SPECIES_CRANIDOS] = sCranidosEggMoveLearnset,
+    [SPECIES_SHIELDON] = sShieldonEggMoveLearnset,
+    [SPECIES_PACHIRISU] = sPachirisuEggMoveLearnset,
+    [SPECIES_BUIZEL] = sBuizelEggMoveLearnset,
+    [SPECIES_CHERUBI] = sCherubiEggMoveLearnset,
+    [SPECIES_SHELLOS] = sShellosEggMoveLearnset,
+    [SPECIES_DRIFLOON] = sDrifloonEggMoveLearnset,
+    [SPECIES_BUNEARY] = sBunearyEggMoveLearnset,
+    [SPECIES_GLAMEOW] = sGlameowEggMoveLearnset,
+    [SPECIES_CHINGLING] = sChinglingEggMoveLearnset,
+    [SPECIES_STUNKY] = sStunkyEggMoveLearnset,
+    [SPECIES_BONSLY] = sBonslyEggMoveLearnset,
+    [SPECIES_MIME_JR] = sMimeJrEggMoveLearnset,
+    [SPECIES_HAPPINY] = sHappinyEggMoveLearnset,
+    [SPECIES_CHATOT] = sChatotEggMoveLearnset,
+    [SPECIES_SPIRITOMB] = sSpiritombEggMoveLearnset,
+    [SPECIES_GIBLE] = sGibleEggMoveLearnset,
+    [SPECIES_MUNCHLAX] = sMunchlaxEggMoveLearnset,
+    [SPECIES_RIOLU] = sRioluEggMoveLearnset,
+    [SPECIES_HIPPOPOTAS] = sHippopotasEggMoveLearnset,
+    [SPECIES_SKORUPI] = sSkorupiEggMoveLearnset,
+    [SPECIES_CROAGUNK] = sCroagunkEggMoveLearnset,
+    [SPECIES_CARNIVINE] = sCarnivineEggMoveLearnset,
+    [SPECIES_FINNEON] = sFinneonEggMoveLearnset,
+    [SPECIES_MANTYKE] = sMantykeEggMoveLearnset,
+    [SPECIES_SNOVER] = sSnoverEggMoveLearnset,
+#endif
+#if P_GEN_5_POKEMON == TRUE
+    [SPECIES_SNIVY] = sSnivyEggMoveLearnset,
+    [SPECIES_TEPIG] = sTepigEggMoveLearnset,
+    [SPECIES_OSHAWOTT] = sOshawottEggMoveLearnset,
+    [SPECIES_PATRAT] = sPatratEggMoveLearnset,
+    [SPECIES_LILLIPUP] = sLillipupEggMoveLearnset,
+    [SPECIES_PURRLOIN] = sPurrloinEggMoveLearnset,
+    [SPECIES_PANSAGE] = sPansageEggMoveLearnset,
+    [SPECIES_PANSEAR] = sPansearEggMoveLearnset,
+    [SPECIES_PANPOUR] = sPanpourEggMoveLearnset,
+    [SPECIES_MUNNA] = sMunnaEggMoveLearnset,
+    [SPECIES_PIDOVE] = sPidoveEggMoveLearnset,
+    [SPECIES_BLITZLE] = sBlitzleEggMoveLearnset,
+    [SPECIES_ROGGENROLA] = sRoggenrolaEggMoveLearnset,
+    [SPECIES_WOOBAT] = sWoobatEggMoveLearnset,
+    [SPECIES_DRILBUR] = sDrilburEggMoveLearnset,
+    [SPECIES_AUDINO] = sAudinoEggMoveLearnset,
+    [SPECIES_TIMBURR] = sTimburrEggMoveLearnset,
+    [SPECIES_TYMPOLE] = sTympoleEggMoveLearnset,
+    [SPECIES_SEWADDLE] = sSewaddleEggMoveLearnset,
+    [SPECIES_VENIPEDE] = sVenipedeEggMoveLearnset,
+    [SPECIES_COTTONEE] = sCottoneeEggMoveLearnset,
+    [SPECIES_PETILIL] = sPetililEggMoveLearnset,
+    [SPECIES_BASCULIN] = sBasculinEggMoveLearnset,
+    [SPECIES_SANDILE] = sSandileEggMoveLearnset,
+    [SPECIES_DARUMAKA] = sDarumakaEggMoveLearnset,
+    [SPECIES_MARACTUS] = sMaractusEggMoveLearnset,
+    [SPECIES_DWEBBLE] = sDwebbleEggMoveLearnset,
+    [SPECIES_SCRAGGY] = sScraggyEggMoveLearnset,
+    [SPECIES_SIGILYPH] = sSigilyphEggMoveLearnset,
+    [SPECIES_YAMASK] = sYamaskEggMoveLearnset,
+    [SPECIES_TIRTOUGA] = sTirtougaEggMoveLearnset,
+    [SPECIES_ARCHEN] = sArchenEggMoveLearnset,
+    [SPECIES_TRUBBISH] = sTrubbishEggMoveLearnset,
+    [SPECIES_ZORUA] = sZoruaEggMoveLearnset,
+    [SPECIES_MINCCINO] = sMinccinoEggMoveLearnset,
+    [SPECIES_GOTHITA] = sGothitaEggMoveLearnset,
+    [SPECIES_SOLOSIS] = sSolosisEggMoveLearnset,
+    [SPECIES_DUCKLETT] = sDucklettEggMoveLearnset,
+    [SPECIES_VANILLITE] = sVanilliteEggMoveLearnset,
+    [SPECIES_DEERLING] = sDeerlingEggMoveLearnset,
+    [SPECIES_EMOLGA] = sEmolgaEggMoveLearnset,
+    [SPECIES_KARRABLAST] = sKarrablastEggMoveLearnset,
+    [SPECIES_FOONGUS] = sFoongusEggMoveLearnset,
+    [SPECIES_FRILLISH] = sFrillishEggMoveLearnset,
+    [SPECIES_ALOMOMOLA] = sAlomomolaEggMoveLearnset,
+    [SPECIES_JOLTIK] = sJoltikEggMoveLearnset,
+    [SPECIES_FERROSEED] = sFerroseedEggMoveLearnset,
+    [SPECIES_ELGYEM] = sElgyemEggMoveLearnset,
+    [SPECIES_LITWICK] = sLitwickEggMoveLearnset,
+    [SPECIES_AXEW] = sAxewEggMoveLearnset,
+    [SPECIES_CUBCHOO] = sCubchooEggMoveLearnset,
+    [SPECIES_SHELMET] = sShelmetEggMoveLearnset,
+    [SPECIES_STUNFISK] = sStunfiskEggMoveLearnset,
+    [SPECIES_MIENFOO] = sMienfooEggMoveLearnset,
+    [SPECIES_DRUDDIGON] = sDruddigonEggMoveLearnset,
+    [SPECIES_PAWNIARD] = sPawniardEggMoveLearnset,
+    [SPECIES_BOUFFALANT] = sBouffalantEggMoveLearnset,
+    [SPECIES_VULLABY] = sVullabyEggMoveLearnset,
+    [SPECIES_HEATMOR] = sHeatmorEggMoveLearnset,
+    [SPECIES_DURANT] = sDurantEggMoveLearnset,
+    [SPECIES_DEINO] = sDeinoEggMoveLearnset,
+    [SPECIES_LARVESTA] = sLarvestaEggMoveLearnset,
+#endif
+#if P_GEN_6_POKEMON == TRUE
+    [SPECIES_CHESPIN] = sChespinEggMoveLearnset,
+    [SPECIES_FENNEKIN] = sFennekinEggMoveLearnset,
+    [SPECIES_FROAKIE] = sFroakieEggMoveLearnset,
+    [SPECIES_BUNNELBY] = sBunnelbyEggMoveLearnset,
+    [SPECIES_FLETCHLING] = sFletchlingEggMoveLearnset,
+    [SPECIES_SCATTERBUG] = sScatterbugEggMoveLearnset,
+    [SPECIES_LITLEO] = sLitleoEggMoveLearnset,
+    [SPECIES_FLABEBE] = sFlabebeEggMoveLearnset,
+    [SPECIES_SKIDDO] = sSkiddoEggMoveLearnset,
+    [SPECIES_PANCHAM] = sPanchamEggMoveLearnset,
+    [SPECIES_FURFROU] = sFurfrouEggMoveLearnset,
+    [SPECIES_ESPURR] = sEspurrEggMoveLearnset,
+    [SPECIES_HONEDGE] = sHonedgeEggMoveLearnset,
+    [SPECIES_SPRITZEE] = sSpritzeeEggMoveLearnset,
+    [SPECIES_SWIRLIX] = sSwirlixEggMoveLearnset,
+    [SPECIES_INKAY] = sInkayEggMoveLearnset,
+    [SPECIES_BINACLE] = sBinacleEggMoveLearnset,
+    [SPECIES_SKRELP] = sSkrelpEggMoveLearnset,
+    [SPECIES_CLAUNCHER] = sClauncherEggMoveLearnset,
+    [SPECIES_HELIOPTILE] = sHelioptileEggMoveLearnset,
+    [SPECIES_TYRUNT] = sTyruntEggMoveLearnset,
+    [SPECIES_AMAURA] = sAmauraEggMoveLearnset,
+    [SPECIES_HAWLUCHA] = sHawluchaEggMoveLearnset,
+    [SPECIES_DEDENNE] = sDedenneEggMoveLearnset,
+    [SPECIES_GOOMY] = sGoomyEggMoveLearnset,
+    [SPECIES_KLEFKI] = sKlefkiEggMoveLearnset,
+    [SPECIES_PHANTUMP] = sPhantumpEggMoveLearnset,
+    [SPECIES_PUMPKABOO] = sPumpkabooEggMoveLearnset,
+    [SPECIES_BERGMITE] = sBergmiteEggMoveLearnset,
+    [SPECIES_NOIBAT] = sNoibatEggMoveLearnset,
+#endif
+#if P_GEN_7_POKEMON == TRUE
+    [SPECIES_ROWLET] = sRowletEggMoveLearnset,
+    [SPECIES_LITTEN] = sLittenEggMoveLearnset,
+    [SPECIES_POPPLIO] = sPopplioEggMoveLearnset,
+    [SPECIES_PIKIPEK] = sPikipekEggMoveLearnset,
+    [SPECIES_YUNGOOS] = sYungoosEggMoveLearnset,
+    [SPECIES_GRUBBIN] = sGrubbinEggMoveLearnset,
+    [SPECIES_CRABRAWLER] = sCrabrawlerEggMoveLearnset,
+    [SPECIES_ORICORIO] = sOricorioEggMoveLearnset,
+    [SPECIES_CUTIEFLY] = sCutieflyEggMoveLearnset,
+    [SPECIES_ROCKRUFF] = sRockruffEggMoveLearnset,
+    [SPECIES_WISHIWASHI] = sWishiwashiEggMoveLearnset,
+    [SPECIES_MAREANIE] = sMareanieEggMoveLearnset,
+    [SPECIES_MUDBRAY] = sMudbrayEggMoveLearnset,
+    [SPECIES_DEWPIDER] = sDewpiderEggMoveLearnset,
+    [SPECIES_FOMANTIS] = sFomantisEggMoveLearnset,
+    [SPECIES_MORELULL] = sMorelullEggMoveLearnset,
+    [SPECIES_SALANDIT] = sSalanditEggMoveLearnset,
+    [SPECIES_STUFFUL] = sStuffulEggMoveLearnset,
+    [SPECIES_BOUNSWEET] = sBounsweetEggMoveLearnset,
+    [SPECIES_COMFEY] = sComfeyEggMoveLearnset,
+    [SPECIES_ORANGURU] = sOranguruEggMoveLearnset,
+    [SPECIES_PASSIMIAN] = sPassimianEggMoveLearnset,
+    [SPECIES_WIMPOD] = sWimpodEggMoveLearnset,
+    [SPECIES_SANDYGAST] = sSandygastEggMoveLearnset,
+    [SPECIES_PYUKUMUKU] = sPyukumukuEggMoveLearnset,
+    [SPECIES_KOMALA] = sKomalaEggMoveLearnset,
+    [SPECIES_TURTONATOR] = sTurtonatorEggMoveLearnset,
+    [SPECIES_TOGEDEMARU] = sTogedemaruEggMoveLearnset,
+    [SPECIES_MIMIKYU] = sMimikyuEggMoveLearnset,
+    [SPECIES_BRUXISH] = sBruxishEggMoveLearnset,
+    [SPECIES_DRAMPA] = sDrampaEggMoveLearnset,
+    [SPECIES_JANGMO_O] = sJangmoOEggMoveLearnset,
+#endif
+#if P_GEN_8_POKEMON == TRUE
+    [SPECIES_GROOKEY] = sGrookeyEggMoveLearnset,
+    [SPECIES_SCORBUNNY] = sScorbunnyEggMoveLearnset,
+    [SPECIES_SOBBLE] = sSobbleEggMoveLearnset,
+    [SPECIES_SKWOVET] = sSkwovetEggMoveLearnset,
+    [SPECIES_ROOKIDEE] = sRookideeEggMoveLearnset,
+    [SPECIES_BLIPBUG] = sBlipbugEggMoveLearnset,
+    [SPECIES_NICKIT] = sNickitEggMoveLearnset,
+    [SPECIES_GOSSIFLEUR] = sGossifleurEggMoveLearnset,
+    [SPECIES_WOOLOO] = sWoolooEggMoveLearnset,
+    [SPECIES_CHEWTLE] = sChewtleEggMoveLearnset,
+    [SPECIES_YAMPER] = sYamperEggMoveLearnset,
+    [SPECIES_ROLYCOLY] = sRolycolyEggMoveLearnset,
+    [SPECIES_APPLIN] = sApplinEggMoveLearnset,
+    [SPECIES_SILICOBRA] = sSilicobraEggMoveLearnset,
+    [SPECIES_CRAMORANT] = sCramorantEggMoveLearnset,
+    [SPECIES_ARROKUDA] = sArrokudaEggMoveLearnset,
+    [SPECIES_TOXEL] = sToxelEggMoveLearnset,
+    [SPECIES_SIZZLIPEDE] = sSizzlipedeEggMoveLearnset,
+    [SPECIES_CLOBBOPUS] = sClobbopusEggMoveLearnset,
+    [SPECIES_HATENNA] = sHatennaEggMoveLearnset,
+    [SPECIES_MILCERY] = sMilceryEggMoveLearnset,
+    [SPECIES_PINCURCHIN] = sPincurchinEggMoveLearnset,
+    [SPECIES_SNOM] = sSnomEggMoveLearnset,
+    [SPECIES_STONJOURNER] = sStonjournerEggMoveLearnset,
+    [SPECIES_EISCUE] = sEiscueEggMoveLearnset,
+    [SPECIES_INDEEDEE] = sIndeedeeEggMoveLearnset,
+    [SPECIES_MORPEKO] = sMorpekoEggMoveLearnset,
+    [SPECIES_CUFANT] = sCufantEggMoveLearnset,
+    [SPECIES_DURALUDON] = sDuraludonEggMoveLearnset,
+    [SPECIES_DREEPY] = sDreepyEggMoveLearnset,
+#endif
+    [SPECIES_RATTATA_ALOLAN] = sRattataAlolanEggMoveLearnset,
+    [SPECIES_SANDSHREW_ALOLAN] = sSandshrewAlolanEggMoveLearnset,
+    [SPECIES_VULPIX_ALOLAN] = sVulpixAlolanEggMoveLearnset,
+    [SPECIES_DIGLETT_ALOLAN] = sDiglettAlolanEggMoveLearnset,
+    [SPECIES_MEOWTH_ALOLAN] = sMeowthAlolanEggMoveLearnset,
+    [SPECIES_GEODUDE_ALOLAN] = sGeodudeAlolanEggMoveLearnset,
+    [SPECIES_GRIMER_ALOLAN] = sGrimerAlolanEggMoveLearnset,
+    [SPECIES_MEOWTH_GALARIAN] = sMeowthGalarianEggMoveLearnset,
+    [SPECIES_PONYTA_GALARIAN] = sPonytaGalarianEggMoveLearnset,
+    [SPECIES_SLOWPOKE_GALARIAN] = sSlowpokeGalarianEggMoveLearnset,
+    [SPECIES_FARFETCHD_GALARIAN] = sFarfetchdGalarianEggMoveLearnset,
+    [SPECIES_MR_MIME_GALARIAN] = sMrMimeGalarianEggMoveLearnset,
+    [SPECIES_CORSOLA_GALARIAN] = sCorsolaGalarianEggMoveLearnset,
+    [SPECIES_ZIGZAGOON_GALARIAN] = sZigzagoonGalarianEggMoveLearnset,
+#if P_GEN_5_POKEMON == TRUE
+    [SPECIES_DARUMAKA_GALARIAN] = sDarumakaGalarianEggMoveLearnset,
+    [SPECIES_YAMASK_GALARIAN] = sYamaskGalarianEggMoveLearnset,
+    [SPECIES_STUNFISK_GALARIAN] = sStunfiskGalarianEggMoveLearnset,
+#endif
+    [SPECIES_INDEEDEE_FEMALE] = sIndeedeeFemaleEggMoveLearnset,
 };
@@ -0,0 +1,231 @@
+// Every species in the Hoenn Dex. Included by src/pokemon.c with
+// HOENN_DEX_ENTRY defined for each table that is derived from it.
+    HOENN_DEX_ENTRY(TREECKO),
+    HOENN_DEX_ENTRY(GROVYLE),
+    HOENN_DEX_ENTRY(SCEPTILE),
+    HOENN_DEX_ENTRY(TORCHIC),
+    HOENN_DEX_ENTRY(COMBUSKEN),
+    HOENN_DEX_ENTRY(BLAZIKEN),
+    HOENN_DEX_ENTRY(MUDKIP),
+    HOENN_DEX_ENTRY(MARSHTOMP),
+    HOENN_DEX_ENTRY(SWAMPERT),
+    HOENN_DEX_ENTRY(POOCHYENA),
+    HOENN_DEX_ENTRY(MIGHTYENA),
+    HOENN_DEX_ENTRY(ZIGZAGOON),
+    HOENN_DEX_ENTRY(LINOONE),
+    HOENN_DEX_ENTRY(WURMPLE),
+    HOENN_DEX_ENTRY(SILCOON),
+    HOENN_DEX_ENTRY(BEAUTIFLY),
+    HOENN_DEX_ENTRY(CASCOON),
+    HOENN_DEX_ENTRY(DUSTOX),
+    HOENN_DEX_ENTRY(LOTAD),
+    HOENN_DEX_ENTRY(LOMBRE),
+    HOENN_DEX_ENTRY(LUDICOLO),
+    HOENN_DEX_ENTRY(SEEDOT),
+    HOENN_DEX_ENTRY(NUZLEAF),
+    HOENN_DEX_ENTRY(SHIFTRY),
+    HOENN_DEX_ENTRY(TAILLOW),
+    HOENN_DEX_ENTRY(SWELLOW),
+    HOENN_DEX_ENTRY(WINGULL),
+    HOENN_DEX_ENTRY(PELIPPER),
+    HOENN_DEX_ENTRY(RALTS),
+    HOENN_DEX_ENTRY(KIRLIA),
+    HOENN_DEX_ENTRY(GARDEVOIR),
+#if P_GEN_4_POKEMON == TRUE
+    HOENN_DEX_ENTRY(GALLADE),
+#endif
+    HOENN_DEX_ENTRY(SURSKIT),
+    HOENN_DEX_ENTRY(MASQUERAIN),
+    HOENN_DEX_ENTRY(SHROOMISH),
+    HOENN_DEX_ENTRY(BRELOOM),
+    HOENN_DEX_ENTRY(SLAKOTH),
+    HOENN_DEX_ENTRY(VIGOROTH),
+    HOENN_DEX_ENTRY(SLAKING),
+    HOENN_DEX_ENTRY(ABRA),
+    HOENN_DEX_ENTRY(KADABRA),
+    HOENN_DEX_ENTRY(ALAKAZAM),
+    HOENN_DEX_ENTRY(NINCADA),
+    HOENN_DEX_ENTRY(NINJASK),
+    HOENN_DEX_ENTRY(SHEDINJA),
+    HOENN_DEX_ENTRY(WHISMUR),
+    HOENN_DEX_ENTRY(LOUDRED),
+    HOENN_DEX_ENTRY(EXPLOUD),
+    HOENN_DEX_ENTRY(MAKUHITA),
+    HOENN_DEX_ENTRY(HARIYAMA),
+    HOENN_DEX_ENTRY(GOLDEEN),
+    HOENN_DEX_ENTRY(SEAKING),
+    HOENN_DEX_ENTRY(MAGIKARP),
+    HOENN_DEX_ENTRY(GYARADOS),
+    HOENN_DEX_ENTRY(AZURILL),
+    HOENN_DEX_ENTRY(MARILL),
+    HOENN_DEX_ENTRY(AZUMARILL),
+    HOENN_DEX_ENTRY(GEODUDE),
+    HOENN_DEX_ENTRY(GRAVELER),
+    HOENN_DEX_ENTRY(GOLEM),
+    HOENN_DEX_ENTRY(NOSEPASS),
+#if P_GEN_4_POKEMON == TRUE
+    HOENN_DEX_ENTRY(PROBOPASS),
+#endif
+    HOENN_DEX_ENTRY(SKITTY),
+    HOENN_DEX_ENTRY(DELCATTY),
+    HOENN_DEX_ENTRY(ZUBAT),
+    HOENN_DEX_ENTRY(GOLBAT),
+    HOENN_DEX_ENTRY(CROBAT),
+    HOENN_DEX_ENTRY(TENTACOOL),
+    HOENN_DEX_ENTRY(TENTACRUEL),
+    HOENN_DEX_ENTRY(SABLEYE),
+    HOENN_DEX_ENTRY(MAWILE),
+    HOENN_DEX_ENTRY(ARON),
+    HOENN_DEX_ENTRY(LAIRON),
+    HOENN_DEX_ENTRY(AGGRON),
+    HOENN_DEX_ENTRY(MACHOP),
+    HOENN_DEX_ENTRY(MACHOKE),
+    HOENN_DEX_ENTRY(MACHAMP),
+    HOENN_DEX_ENTRY(MEDITITE),
+    HOENN_DEX_ENTRY(MEDICHAM),
+    HOENN_DEX_ENTRY(ELECTRIKE),
+    HOENN_DEX_ENTRY(MANECTRIC),
+    HOENN_DEX_ENTRY(PLUSLE),
+    HOENN_DEX_ENTRY(MINUN),
+    HOENN_DEX_ENTRY(MAGNEMITE),
+    HOENN_DEX_ENTRY(MAGNETON),
+#if P_GEN_4_POKEMON == TRUE
+    HOENN_DEX_ENTRY(MAGNEZONE),
+#endif
+    HOENN_DEX_ENTRY(VOLTORB),
+    HOENN_DEX_ENTRY(ELECTRODE),
+    HOENN_DEX_ENTRY(VOLBEAT),
+    HOENN_DEX_ENTRY(ILLUMISE),
+    HOENN_DEX_ENTRY(ODDISH),
+    HOENN_DEX_ENTRY(GLOOM),
+    HOENN_DEX_ENTRY(VILEPLUME),
+    HOENN_DEX_ENTRY(BELLOSSOM),
+    HOENN_DEX_ENTRY(DODUO),
+    HOENN_DEX_ENTRY(DODRIO),
+#if P_GEN_4_POKEMON == TRUE
+    HOENN_DEX_ENTRY(BUDEW),
+    HOENN_DEX_ENTRY(ROSELIA),
+    HOENN_DEX_ENTRY(ROSERADE),
+#else
+    HOENN_DEX_ENTRY(ROSELIA),
+#endif
+    HOENN_DEX_ENTRY(GULPIN),
+    HOENN_DEX_ENTRY(SWALOT),
+    HOENN_DEX_ENTRY(CARVANHA),
+    HOENN_DEX_ENTRY(SHARPEDO),
+    HOENN_DEX_ENTRY(WAILMER),
+    HOENN_DEX_ENTRY(WAILORD),
+    HOENN_DEX_ENTRY(NUMEL),
+    HOENN_DEX_ENTRY(CAMERUPT),
+    HOENN_DEX_ENTRY(SLUGMA),
+    HOENN_DEX_ENTRY(MAGCARGO),
+    HOENN_DEX_ENTRY(TORKOAL),
+    HOENN_DEX_ENTRY(GRIMER),
+    HOENN_DEX_ENTRY(MUK),
+    HOENN_DEX_ENTRY(KOFFING),
+    HOENN_DEX_ENTRY(WEEZING),
+    HOENN_DEX_ENTRY(SPOINK),
+    HOENN_DEX_ENTRY(GRUMPIG),
+    HOENN_DEX_ENTRY(SANDSHREW),
+    HOENN_DEX_ENTRY(SANDSLASH),
+    HOENN_DEX_ENTRY(SPINDA),
+    HOENN_DEX_ENTRY(SKARMORY),
+    HOENN_DEX_ENTRY(TRAPINCH),
+    HOENN_DEX_ENTRY(VIBRAVA),
+    HOENN_DEX_ENTRY(FLYGON),
+    HOENN_DEX_ENTRY(CACNEA),
+    HOENN_DEX_ENTRY(CACTURNE),
+    HOENN_DEX_ENTRY(SWABLU),
+    HOENN_DEX_ENTRY(ALTARIA),
+    HOENN_DEX_ENTRY(ZANGOOSE),
+    HOENN_DEX_ENTRY(SEVIPER),
+    HOENN_DEX_ENTRY(LUNATONE),
+    HOENN_DEX_ENTRY(SOLROCK),
+    HOENN_DEX_ENTRY(BARBOACH),
+    HOENN_DEX_ENTRY(WHISCASH),
+    HOENN_DEX_ENTRY(CORPHISH),
+    HOENN_DEX_ENTRY(CRAWDAUNT),
+    HOENN_DEX_ENTRY(BALTOY),
+    HOENN_DEX_ENTRY(CLAYDOL),
+    HOENN_DEX_ENTRY(LILEEP),
+    HOENN_DEX_ENTRY(CRADILY),
+    HOENN_DEX_ENTRY(ANORITH),
+    HOENN_DEX_ENTRY(ARMALDO),
+    HOENN_DEX_ENTRY(IGGLYBUFF),
+    HOENN_DEX_ENTRY(JIGGLYPUFF),
+    HOENN_DEX_ENTRY(WIGGLYTUFF),
+    HOENN_DEX_ENTRY(FEEBAS),
+    HOENN_DEX_ENTRY(MILOTIC),
+    HOENN_DEX_ENTRY(CASTFORM),
+    HOENN_DEX_ENTRY(STARYU),
+    HOENN_DEX_ENTRY(STARMIE),
+    HOENN_DEX_ENTRY(KECLEON),
+    HOENN_DEX_ENTRY(SHUPPET),
+    HOENN_DEX_ENTRY(BANETTE),
+    HOENN_DEX_ENTRY(DUSKULL),
+    HOENN_DEX_ENTRY(DUSCLOPS),
+#if P_GEN_4_POKEMON == TRUE
+    HOENN_DEX_ENTRY(DUSKNOIR),
+    HOENN_DEX_ENTRY(TROPIUS),
+    HOENN_DEX_ENTRY(CHINGLING),
+#else
+    HOENN_DEX_ENTRY(TROPIUS),
+#endif
+    HOENN_DEX_ENTRY(CHIMECHO),
+    HOENN_DEX_ENTRY(ABSOL),
+    HOENN_DEX_ENTRY(VULPIX),
+    HOENN_DEX_ENTRY(NINETALES),
+    HOENN_DEX_ENTRY(PICHU),
+    HOENN_DEX_ENTRY(PIKACHU),
+    HOENN_DEX_ENTRY(RAICHU),
+    HOENN_DEX_ENTRY(PSYDUCK),
+    HOENN_DEX_ENTRY(GOLDUCK),
+    HOENN_DEX_ENTRY(WYNAUT),
+    HOENN_DEX_ENTRY(WOBBUFFET),
+    HOENN_DEX_ENTRY(NATU),
+    HOENN_DEX_ENTRY(XATU),
+    HOENN_DEX_ENTRY(GIRAFARIG),
+    HOENN_DEX_ENTRY(PHANPY),
+    HOENN_DEX_ENTRY(DONPHAN),
+    HOENN_DEX_ENTRY(PINSIR),
+    HOENN_DEX_ENTRY(HERACROSS),
+    HOENN_DEX_ENTRY(RHYHORN),
+    HOENN_DEX_ENTRY(RHYDON),
+#if P_GEN_4_POKEMON == TRUE
+    HOENN_DEX_ENTRY(RHYPERIOR),
+#endif
+    HOENN_DEX_ENTRY(SNORUNT),
+    HOENN_DEX_ENTRY(GLALIE),
+#if P_GEN_4_POKEMON == TRUE
+    HOENN_DEX_ENTRY(FROSLASS),
+#endif
+    HOENN_DEX_ENTRY(SPHEAL),
+    HOENN_DEX_ENTRY(SEALEO),
+    HOENN_DEX_ENTRY(WALREIN),
+    HOENN_DEX_ENTRY(CLAMPERL),
+    HOENN_DEX_ENTRY(HUNTAIL),
+    HOENN_DEX_ENTRY(GOREBYSS),
+    HOENN_DEX_ENTRY(RELICANTH),
+    HOENN_DEX_ENTRY(CORSOLA),
+    HOENN_DEX_ENTRY(CHINCHOU),
+    HOENN_DEX_ENTRY(LANTURN),
+    HOENN_DEX_ENTRY(LUVDISC),
+    HOENN_DEX_ENTRY(HORSEA),
+    HOENN_DEX_ENTRY(SEADRA),
+    HOENN_DEX_ENTRY(KINGDRA),
+    HOENN_DEX_ENTRY(BAGON),
+    HOENN_DEX_ENTRY(SHELGON),
+    HOENN_DEX_ENTRY(SALAMENCE),
+    HOENN_DEX_ENTRY(BELDUM),
+    HOENN_DEX_ENTRY(METANG),
+    HOENN_DEX_ENTRY(METAGROSS),
+    HOENN_DEX_ENTRY(REGIROCK),
+    HOENN_DEX_ENTRY(REGICE),
+    HOENN_DEX_ENTRY(REGISTEEL),
+    HOENN_DEX_ENTRY(LATIAS),
+    HOENN_DEX_ENTRY(LATIOS),
+    HOENN_DEX_ENTRY(KYOGRE),
+    HOENN_DEX_ENTRY(GROUDON),
+    HOENN_DEX_ENTRY(RAYQUAZA),
+    HOENN_DEX_ENTRY(JIRACHI),
+    HOENN_DEX_ENTRY(DEOXYS),
@@ -0,0 +1,917 @@
+// The base species of every National Dex entry. Included by src/pokemon.c
+// with NATIONAL_DEX_ENTRY defined for each table that is derived from it.
+    NATIONAL_DEX_ENTRY(BULBASAUR),
+    NATIONAL_DEX_ENTRY(IVYSAUR),
+    NATIONAL_DEX_ENTRY(VENUSAUR),
+    NATIONAL_DEX_ENTRY(CHARMANDER),
+    NATIONAL_DEX_ENTRY(CHARMELEON),
+    NATIONAL_DEX_ENTRY(CHARIZARD),
+    NATIONAL_DEX_ENTRY(SQUIRTLE),
+    NATIONAL_DEX_ENTRY(WARTORTLE),
+    NATIONAL_DEX_ENTRY(BLASTOISE),
+    NATIONAL_DEX_ENTRY(CATERPIE),
+    NATIONAL_DEX_ENTRY(METAPOD),
+    NATIONAL_DEX_ENTRY(BUTTERFREE),
+    NATIONAL_DEX_ENTRY(WEEDLE),
+    NATIONAL_DEX_ENTRY(KAKUNA),
+    NATIONAL_DEX_ENTRY(BEEDRILL),
+    NATIONAL_DEX_ENTRY(PIDGEY),
+    NATIONAL_DEX_ENTRY(PIDGEOTTO),
+    NATIONAL_DEX_ENTRY(PIDGEOT),
+    NATIONAL_DEX_ENTRY(RATTATA),
+    NATIONAL_DEX_ENTRY(RATICATE),
+    NATIONAL_DEX_ENTRY(SPEAROW),
+    NATIONAL_DEX_ENTRY(FEAROW),
+    NATIONAL_DEX_ENTRY(EKANS),
+    NATIONAL_DEX_ENTRY(ARBOK),
+    NATIONAL_DEX_ENTRY(PIKACHU),
+    NATIONAL_DEX_ENTRY(RAICHU),
+    NATIONAL_DEX_ENTRY(SANDSHREW),
+    NATIONAL_DEX_ENTRY(SANDSLASH),
+    NATIONAL_DEX_ENTRY(NIDORAN_F),
+    NATIONAL_DEX_ENTRY(NIDORINA),
+    NATIONAL_DEX_ENTRY(NIDOQUEEN),
+    NATIONAL_DEX_ENTRY(NIDORAN_M),
+    NATIONAL_DEX_ENTRY(NIDORINO),
+    NATIONAL_DEX_ENTRY(NIDOKING),
+    NATIONAL_DEX_ENTRY(CLEFAIRY),
+    NATIONAL_DEX_ENTRY(CLEFABLE),
+    NATIONAL_DEX_ENTRY(VULPIX),
+    NATIONAL_DEX_ENTRY(NINETALES),
+    NATIONAL_DEX_ENTRY(JIGGLYPUFF),
+    NATIONAL_DEX_ENTRY(WIGGLYTUFF),
+    NATIONAL_DEX_ENTRY(ZUBAT),
+    NATIONAL_DEX_ENTRY(GOLBAT),
+    NATIONAL_DEX_ENTRY(ODDISH),
+    NATIONAL_DEX_ENTRY(GLOOM),
+    NATIONAL_DEX_ENTRY(VILEPLUME),
+    NATIONAL_DEX_ENTRY(PARAS),
+    NATIONAL_DEX_ENTRY(PARASECT),
+    NATIONAL_DEX_ENTRY(VENONAT),
+    NATIONAL_DEX_ENTRY(VENOMOTH),
+    NATIONAL_DEX_ENTRY(DIGLETT),
+    NATIONAL_DEX_ENTRY(DUGTRIO),
+    NATIONAL_DEX_ENTRY(MEOWTH),
+    NATIONAL_DEX_ENTRY(PERSIAN),
+    NATIONAL_DEX_ENTRY(PSYDUCK),
+    NATIONAL_DEX_ENTRY(GOLDUCK),
+    NATIONAL_DEX_ENTRY(MANKEY),
+    NATIONAL_DEX_ENTRY(PRIMEAPE),
+    NATIONAL_DEX_ENTRY(GROWLITHE),
+    NATIONAL_DEX_ENTRY(ARCANINE),
+    NATIONAL_DEX_ENTRY(POLIWAG),
+    NATIONAL_DEX_ENTRY(POLIWHIRL),
+    NATIONAL_DEX_ENTRY(POLIWRATH),
+    NATIONAL_DEX_ENTRY(ABRA),
+    NATIONAL_DEX_ENTRY(KADABRA),
+    NATIONAL_DEX_ENTRY(ALAKAZAM),
+    NATIONAL_DEX_ENTRY(MACHOP),
+    NATIONAL_DEX_ENTRY(MACHOKE),
+    NATIONAL_DEX_ENTRY(MACHAMP),
+    NATIONAL_DEX_ENTRY(BELLSPROUT),
+    NATIONAL_DEX_ENTRY(WEEPINBELL),
+    NATIONAL_DEX_ENTRY(VICTREEBEL),
+    NATIONAL_DEX_ENTRY(TENTACOOL),
+    NATIONAL_DEX_ENTRY(TENTACRUEL),
+    NATIONAL_DEX_ENTRY(GEODUDE),
+    NATIONAL_DEX_ENTRY(GRAVELER),
+    NATIONAL_DEX_ENTRY(GOLEM),
+    NATIONAL_DEX_ENTRY(PONYTA),
+    NATIONAL_DEX_ENTRY(RAPIDASH),
+    NATIONAL_DEX_ENTRY(SLOWPOKE),
+    NATIONAL_DEX_ENTRY(SLOWBRO),
+    NATIONAL_DEX_ENTRY(MAGNEMITE),
+    NATIONAL_DEX_ENTRY(MAGNETON),
+    NATIONAL_DEX_ENTRY(FARFETCHD),
+    NATIONAL_DEX_ENTRY(DODUO),
+    NATIONAL_DEX_ENTRY(DODRIO),
+    NATIONAL_DEX_ENTRY(SEEL),
+    NATIONAL_DEX_ENTRY(DEWGONG),
+    NATIONAL_DEX_ENTRY(GRIMER),
+    NATIONAL_DEX_ENTRY(MUK),
+    NATIONAL_DEX_ENTRY(SHELLDER),
+    NATIONAL_DEX_ENTRY(CLOYSTER),
+    NATIONAL_DEX_ENTRY(GASTLY),
+    NATIONAL_DEX_ENTRY(HAUNTER),
+    NATIONAL_DEX_ENTRY(GENGAR),
+    NATIONAL_DEX_ENTRY(ONIX),
+    NATIONAL_DEX_ENTRY(DROWZEE),
+    NATIONAL_DEX_ENTRY(HYPNO),
+    NATIONAL_DEX_ENTRY(KRABBY),
+    NATIONAL_DEX_ENTRY(KINGLER),
+    NATIONAL_DEX_ENTRY(VOLTORB),
+    NATIONAL_DEX_ENTRY(ELECTRODE),
+    NATIONAL_DEX_ENTRY(EXEGGCUTE),
+    NATIONAL_DEX_ENTRY(EXEGGUTOR),
+    NATIONAL_DEX_ENTRY(CUBONE),
+    NATIONAL_DEX_ENTRY(MAROWAK),
+    NATIONAL_DEX_ENTRY(HITMONLEE),
+    NATIONAL_DEX_ENTRY(HITMONCHAN),
+    NATIONAL_DEX_ENTRY(LICKITUNG),
+    NATIONAL_DEX_ENTRY(KOFFING),
+    NATIONAL_DEX_ENTRY(WEEZING),
+    NATIONAL_DEX_ENTRY(RHYHORN),
+    NATIONAL_DEX_ENTRY(RHYDON),
+    NATIONAL_DEX_ENTRY(CHANSEY),
+    NATIONAL_DEX_ENTRY(TANGELA),
+    NATIONAL_DEX_ENTRY(KANGASKHAN),
+    NATIONAL_DEX_ENTRY(HORSEA),
+    NATIONAL_DEX_ENTRY(SEADRA),
+    NATIONAL_DEX_ENTRY(GOLDEEN),
+    NATIONAL_DEX_ENTRY(SEAKING),
+    NATIONAL_DEX_ENTRY(STARYU),
+    NATIONAL_DEX_ENTRY(STARMIE),
+    NATIONAL_DEX_ENTRY(MR_MIME),
+    NATIONAL_DEX_ENTRY(SCYTHER),
+    NATIONAL_DEX_ENTRY(JYNX),
+    NATIONAL_DEX_ENTRY(ELECTABUZZ),
+    NATIONAL_DEX_ENTRY(MAGMAR),
+    NATIONAL_DEX_ENTRY(PINSIR),
+    NATIONAL_DEX_ENTRY(TAUROS),
+    NATIONAL_DEX_ENTRY(MAGIKARP),
+    NATIONAL_DEX_ENTRY(GYARADOS),
+    NATIONAL_DEX_ENTRY(LAPRAS),
+    NATIONAL_DEX_ENTRY(DITTO),
+    NATIONAL_DEX_ENTRY(EEVEE),
+    NATIONAL_DEX_ENTRY(VAPOREON),
+    NATIONAL_DEX_ENTRY(JOLTEON),
+    NATIONAL_DEX_ENTRY(FLAREON),
+    NATIONAL_DEX_ENTRY(PORYGON),
+    NATIONAL_DEX_ENTRY(OMANYTE),
+    NATIONAL_DEX_ENTRY(OMASTAR),
+    NATIONAL_DEX_ENTRY(KABUTO),
+    NATIONAL_DEX_ENTRY(KABUTOPS),
+    NATIONAL_DEX_ENTRY(AERODACTYL),
+    NATIONAL_DEX_ENTRY(SNORLAX),
+    NATIONAL_DEX_ENTRY(ARTICUNO),
+    NATIONAL_DEX_ENTRY(ZAPDOS),
+    NATIONAL_DEX_ENTRY(MOLTRES),
+    NATIONAL_DEX_ENTRY(DRATINI),
+    NATIONAL_DEX_ENTRY(DRAGONAIR),
+    NATIONAL_DEX_ENTRY(DRAGONITE),
+    NATIONAL_DEX_ENTRY(MEWTWO),
+    NATIONAL_DEX_ENTRY(MEW),
+    NATIONAL_DEX_ENTRY(CHIKORITA),
+    NATIONAL_DEX_ENTRY(BAYLEEF),
+    NATIONAL_DEX_ENTRY(MEGANIUM),
+    NATIONAL_DEX_ENTRY(CYNDAQUIL),
+    NATIONAL_DEX_ENTRY(QUILAVA),
+    NATIONAL_DEX_ENTRY(TYPHLOSION),
+    NATIONAL_DEX_ENTRY(TOTODILE),
+    NATIONAL_DEX_ENTRY(CROCONAW),
+    NATIONAL_DEX_ENTRY(FERALIGATR),
+    NATIONAL_DEX_ENTRY(SENTRET),
+    NATIONAL_DEX_ENTRY(FURRET),
+    NATIONAL_DEX_ENTRY(HOOTHOOT),
+    NATIONAL_DEX_ENTRY(NOCTOWL),
+    NATIONAL_DEX_ENTRY(LEDYBA),
+    NATIONAL_DEX_ENTRY(LEDIAN),
+    NATIONAL_DEX_ENTRY(SPINARAK),
+    NATIONAL_DEX_ENTRY(ARIADOS),
+    NATIONAL_DEX_ENTRY(CROBAT),
+    NATIONAL_DEX_ENTRY(CHINCHOU),
+    NATIONAL_DEX_ENTRY(LANTURN),
+    NATIONAL_DEX_ENTRY(PICHU),
+    NATIONAL_DEX_ENTRY(CLEFFA),
+    NATIONAL_DEX_ENTRY(IGGLYBUFF),
+    NATIONAL_DEX_ENTRY(TOGEPI),
+    NATIONAL_DEX_ENTRY(TOGETIC),
+    NATIONAL_DEX_ENTRY(NATU),
+    NATIONAL_DEX_ENTRY(XATU),
+    NATIONAL_DEX_ENTRY(MAREEP),
+    NATIONAL_DEX_ENTRY(FLAAFFY),
+    NATIONAL_DEX_ENTRY(AMPHAROS),
+    NATIONAL_DEX_ENTRY(BELLOSSOM),
+    NATIONAL_DEX_ENTRY(MARILL),
+    NATIONAL_DEX_ENTRY(AZUMARILL),
+    NATIONAL_DEX_ENTRY(SUDOWOODO),
+    NATIONAL_DEX_ENTRY(POLITOED),
+    NATIONAL_DEX_ENTRY(HOPPIP),
+    NATIONAL_DEX_ENTRY(SKIPLOOM),
+    NATIONAL_DEX_ENTRY(JUMPLUFF),
+    NATIONAL_DEX_ENTRY(AIPOM),
+    NATIONAL_DEX_ENTRY(SUNKERN),
+    NATIONAL_DEX_ENTRY(SUNFLORA),
+    NATIONAL_DEX_ENTRY(YANMA),
+    NATIONAL_DEX_ENTRY(WOOPER),
+    NATIONAL_DEX_ENTRY(QUAGSIRE),
+    NATIONAL_DEX_ENTRY(ESPEON),
+    NATIONAL_DEX_ENTRY(UMBREON),
+    NATIONAL_DEX_ENTRY(MURKROW),
+    NATIONAL_DEX_ENTRY(SLOWKING),
+    NATIONAL_DEX_ENTRY(MISDREAVUS),
+    NATIONAL_DEX_ENTRY(UNOWN),
+    NATIONAL_DEX_ENTRY(WOBBUFFET),
+    NATIONAL_DEX_ENTRY(GIRAFARIG),
+    NATIONAL_DEX_ENTRY(PINECO),
+    NATIONAL_DEX_ENTRY(FORRETRESS),
+    NATIONAL_DEX_ENTRY(DUNSPARCE),
+    NATIONAL_DEX_ENTRY(GLIGAR),
+    NATIONAL_DEX_ENTRY(STEELIX),
+    NATIONAL_DEX_ENTRY(SNUBBULL),
+    NATIONAL_DEX_ENTRY(GRANBULL),
+    NATIONAL_DEX_ENTRY(QWILFISH),
+    NATIONAL_DEX_ENTRY(SCIZOR),
+    NATIONAL_DEX_ENTRY(SHUCKLE),
+    NATIONAL_DEX_ENTRY(HERACROSS),
+    NATIONAL_DEX_ENTRY(SNEASEL),
+    NATIONAL_DEX_ENTRY(TEDDIURSA),
+    NATIONAL_DEX_ENTRY(URSARING),
+    NATIONAL_DEX_ENTRY(SLUGMA),
+    NATIONAL_DEX_ENTRY(MAGCARGO),
+    NATIONAL_DEX_ENTRY(SWINUB),
+    NATIONAL_DEX_ENTRY(PILOSWINE),
+    NATIONAL_DEX_ENTRY(CORSOLA),
+    NATIONAL_DEX_ENTRY(REMORAID),
+    NATIONAL_DEX_ENTRY(OCTILLERY),
+    NATIONAL_DEX_ENTRY(DELIBIRD),
+    NATIONAL_DEX_ENTRY(MANTINE),
+    NATIONAL_DEX_ENTRY(SKARMORY),
+    NATIONAL_DEX_ENTRY(HOUNDOUR),
+    NATIONAL_DEX_ENTRY(HOUNDOOM),
+    NATIONAL_DEX_ENTRY(KINGDRA),
+    NATIONAL_DEX_ENTRY(PHANPY),
+    NATIONAL_DEX_ENTRY(DONPHAN),
+    NATIONAL_DEX_ENTRY(PORYGON2),
+    NATIONAL_DEX_ENTRY(STANTLER),
+    NATIONAL_DEX_ENTRY(SMEARGLE),
+    NATIONAL_DEX_ENTRY(TYROGUE),
+    NATIONAL_DEX_ENTRY(HITMONTOP),
+    NATIONAL_DEX_ENTRY(SMOOCHUM),
+    NATIONAL_DEX_ENTRY(ELEKID),
+    NATIONAL_DEX_ENTRY(MAGBY),
+    NATIONAL_DEX_ENTRY(MILTANK),
+    NATIONAL_DEX_ENTRY(BLISSEY),
+    NATIONAL_DEX_ENTRY(RAIKOU),
+    NATIONAL_DEX_ENTRY(ENTEI),
+    NATIONAL_DEX_ENTRY(SUICUNE),
+    NATIONAL_DEX_ENTRY(LARVITAR),
+    NATIONAL_DEX_ENTRY(PUPITAR),
+    NATIONAL_DEX_ENTRY(TYRANITAR),
+    NATIONAL_DEX_ENTRY(LUGIA),
+    NATIONAL_DEX_ENTRY(HO_OH),
+    NATIONAL_DEX_ENTRY(CELEBI),
+    NATIONAL_DEX_ENTRY(TREECKO),
+    NATIONAL_DEX_ENTRY(GROVYLE),
+    NATIONAL_DEX_ENTRY(SCEPTILE),
+    NATIONAL_DEX_ENTRY(TORCHIC),
+    NATIONAL_DEX_ENTRY(COMBUSKEN),
+    NATIONAL_DEX_ENTRY(BLAZIKEN),
+    NATIONAL_DEX_ENTRY(MUDKIP),
+    NATIONAL_DEX_ENTRY(MARSHTOMP),
+    NATIONAL_DEX_ENTRY(SWAMPERT),
+    NATIONAL_DEX_ENTRY(POOCHYENA),
+    NATIONAL_DEX_ENTRY(MIGHTYENA),
+    NATIONAL_DEX_ENTRY(ZIGZAGOON),
+    NATIONAL_DEX_ENTRY(LINOONE),
+    NATIONAL_DEX_ENTRY(WURMPLE),
+    NATIONAL_DEX_ENTRY(SILCOON),
+    NATIONAL_DEX_ENTRY(BEAUTIFLY),
+    NATIONAL_DEX_ENTRY(CASCOON),
+    NATIONAL_DEX_ENTRY(DUSTOX),
+    NATIONAL_DEX_ENTRY(LOTAD),
+    NATIONAL_DEX_ENTRY(LOMBRE),
+    NATIONAL_DEX_ENTRY(LUDICOLO),
+    NATIONAL_DEX_ENTRY(SEEDOT),
+    NATIONAL_DEX_ENTRY(NUZLEAF),
+    NATIONAL_DEX_ENTRY(SHIFTRY),
+    NATIONAL_DEX_ENTRY(TAILLOW),
+    NATIONAL_DEX_ENTRY(SWELLOW),
+    NATIONAL_DEX_ENTRY(WINGULL),
+    NATIONAL_DEX_ENTRY(PELIPPER),
+    NATIONAL_DEX_ENTRY(RALTS),
+    NATIONAL_DEX_ENTRY(KIRLIA),
+    NATIONAL_DEX_ENTRY(GARDEVOIR),
+    NATIONAL_DEX_ENTRY(SURSKIT),
+    NATIONAL_DEX_ENTRY(MASQUERAIN),
+    NATIONAL_DEX_ENTRY(SHROOMISH),
+    NATIONAL_DEX_ENTRY(BRELOOM),
+    NATIONAL_DEX_ENTRY(SLAKOTH),
+    NATIONAL_DEX_ENTRY(VIGOROTH),
+    NATIONAL_DEX_ENTRY(SLAKING),
+    NATIONAL_DEX_ENTRY(NINCADA),
+    NATIONAL_DEX_ENTRY(NINJASK),
+    NATIONAL_DEX_ENTRY(SHEDINJA),
+    NATIONAL_DEX_ENTRY(WHISMUR),
+    NATIONAL_DEX_ENTRY(LOUDRED),
+    NATIONAL_DEX_ENTRY(EXPLOUD),
+    NATIONAL_DEX_ENTRY(MAKUHITA),
+    NATIONAL_DEX_ENTRY(HARIYAMA),
+    NATIONAL_DEX_ENTRY(AZURILL),
+    NATIONAL_DEX_ENTRY(NOSEPASS),
+    NATIONAL_DEX_ENTRY(SKITTY),
+    NATIONAL_DEX_ENTRY(DELCATTY),
+    NATIONAL_DEX_ENTRY(SABLEYE),
+    NATIONAL_DEX_ENTRY(MAWILE),
+    NATIONAL_DEX_ENTRY(ARON),
+    NATIONAL_DEX_ENTRY(LAIRON),
+    NATIONAL_DEX_ENTRY(AGGRON),
+    NATIONAL_DEX_ENTRY(MEDITITE),
+    NATIONAL_DEX_ENTRY(MEDICHAM),
+    NATIONAL_DEX_ENTRY(ELECTRIKE),
+    NATIONAL_DEX_ENTRY(MANECTRIC),
+    NATIONAL_DEX_ENTRY(PLUSLE),
+    NATIONAL_DEX_ENTRY(MINUN),
+    NATIONAL_DEX_ENTRY(VOLBEAT),
+    NATIONAL_DEX_ENTRY(ILLUMISE),
+    NATIONAL_DEX_ENTRY(ROSELIA),
+    NATIONAL_DEX_ENTRY(GULPIN),
+    NATIONAL_DEX_ENTRY(SWALOT),
+    NATIONAL_DEX_ENTRY(CARVANHA),
+    NATIONAL_DEX_ENTRY(SHARPEDO),
+    NATIONAL_DEX_ENTRY(WAILMER),
+    NATIONAL_DEX_ENTRY(WAILORD),
+    NATIONAL_DEX_ENTRY(NUMEL),
+    NATIONAL_DEX_ENTRY(CAMERUPT),
+    NATIONAL_DEX_ENTRY(TORKOAL),
+    NATIONAL_DEX_ENTRY(SPOINK),
+    NATIONAL_DEX_ENTRY(GRUMPIG),
+    NATIONAL_DEX_ENTRY(SPINDA),
+    NATIONAL_DEX_ENTRY(TRAPINCH),
+    NATIONAL_DEX_ENTRY(VIBRAVA),
+    NATIONAL_DEX_ENTRY(FLYGON),
+    NATIONAL_DEX_ENTRY(CACNEA),
+    NATIONAL_DEX_ENTRY(CACTURNE),
+    NATIONAL_DEX_ENTRY(SWABLU),
+    NATIONAL_DEX_ENTRY(ALTARIA),
+    NATIONAL_DEX_ENTRY(ZANGOOSE),
+    NATIONAL_DEX_ENTRY(SEVIPER),
+    NATIONAL_DEX_ENTRY(LUNATONE),
+    NATIONAL_DEX_ENTRY(SOLROCK),
+    NATIONAL_DEX_ENTRY(BARBOACH),
+    NATIONAL_DEX_ENTRY(WHISCASH),
+    NATIONAL_DEX_ENTRY(CORPHISH),
+    NATIONAL_DEX_ENTRY(CRAWDAUNT),
+    NATIONAL_DEX_ENTRY(BALTOY),
+    NATIONAL_DEX_ENTRY(CLAYDOL),
+    NATIONAL_DEX_ENTRY(LILEEP),
+    NATIONAL_DEX_ENTRY(CRADILY),
+    NATIONAL_DEX_ENTRY(ANORITH),
+    NATIONAL_DEX_ENTRY(ARMALDO),
+    NATIONAL_DEX_ENTRY(FEEBAS),
+    NATIONAL_DEX_ENTRY(MILOTIC),
+    NATIONAL_DEX_ENTRY(CASTFORM),
+    NATIONAL_DEX_ENTRY(KECLEON),
+    NATIONAL_DEX_ENTRY(SHUPPET),
+    NATIONAL_DEX_ENTRY(BANETTE),
+    NATIONAL_DEX_ENTRY(DUSKULL),
+    NATIONAL_DEX_ENTRY(DUSCLOPS),
+    NATIONAL_DEX_ENTRY(TROPIUS),
+    NATIONAL_DEX_ENTRY(CHIMECHO),
+    NATIONAL_DEX_ENTRY(ABSOL),
+    NATIONAL_DEX_ENTRY(WYNAUT),
+    NATIONAL_DEX_ENTRY(SNORUNT),
+    NATIONAL_DEX_ENTRY(GLALIE),
+    NATIONAL_DEX_ENTRY(SPHEAL),
+    NATIONAL_DEX_ENTRY(SEALEO),
+    NATIONAL_DEX_ENTRY(WALREIN),
+    NATIONAL_DEX_ENTRY(CLAMPERL),
+    NATIONAL_DEX_ENTRY(HUNTAIL),
+    NATIONAL_DEX_ENTRY(GOREBYSS),
+    NATIONAL_DEX_ENTRY(RELICANTH),
+    NATIONAL_DEX_ENTRY(LUVDISC),
+    NATIONAL_DEX_ENTRY(BAGON),
+    NATIONAL_DEX_ENTRY(SHELGON),
+    NATIONAL_DEX_ENTRY(SALAMENCE),
+    NATIONAL_DEX_ENTRY(BELDUM),
+    NATIONAL_DEX_ENTRY(METANG),
+    NATIONAL_DEX_ENTRY(METAGROSS),
+    NATIONAL_DEX_ENTRY(REGIROCK),
+    NATIONAL_DEX_ENTRY(REGICE),
+    NATIONAL_DEX_ENTRY(REGISTEEL),
+    NATIONAL_DEX_ENTRY(LATIAS),
+    NATIONAL_DEX_ENTRY(LATIOS),
+    NATIONAL_DEX_ENTRY(KYOGRE),
+    NATIONAL_DEX_ENTRY(GROUDON),
+    NATIONAL_DEX_ENTRY(RAYQUAZA),
+    NATIONAL_DEX_ENTRY(JIRACHI),
+    NATIONAL_DEX_ENTRY(DEOXYS),
+#if P_GEN_4_POKEMON == TRUE
+    NATIONAL_DEX_ENTRY(TURTWIG),
+    NATIONAL_DEX_ENTRY(GROTLE),
+    NATIONAL_DEX_ENTRY(TORTERRA),
+    NATIONAL_DEX_ENTRY(CHIMCHAR),
+    NATIONAL_DEX_ENTRY(MONFERNO),
+    NATIONAL_DEX_ENTRY(INFERNAPE),
+    NATIONAL_DEX_ENTRY(PIPLUP),
+    NATIONAL_DEX_ENTRY(PRINPLUP),
+    NATIONAL_DEX_ENTRY(EMPOLEON),
+    NATIONAL_DEX_ENTRY(STARLY),
+    NATIONAL_DEX_ENTRY(STARAVIA),
+    NATIONAL_DEX_ENTRY(STARAPTOR),
+    NATIONAL_DEX_ENTRY(BIDOOF),
+    NATIONAL_DEX_ENTRY(BIBAREL),
+    NATIONAL_DEX_ENTRY(KRICKETOT),
+    NATIONAL_DEX_ENTRY(KRICKETUNE),
+    NATIONAL_DEX_ENTRY(SHINX),
+    NATIONAL_DEX_ENTRY(LUXIO),
+    NATIONAL_DEX_ENTRY(LUXRAY),
+    NATIONAL_DEX_ENTRY(BUDEW),
+    NATIONAL_DEX_ENTRY(ROSERADE),
+    NATIONAL_DEX_ENTRY(CRANIDOS),
+    NATIONAL_DEX_ENTRY(RAMPARDOS),
+    NATIONAL_DEX_ENTRY(SHIELDON),
+    NATIONAL_DEX_ENTRY(BASTIODON),
+    NATIONAL_DEX_ENTRY(BURMY),
+    NATIONAL_DEX_ENTRY(WORMADAM),
+    NATIONAL_DEX_ENTRY(MOTHIM),
+    NATIONAL_DEX_ENTRY(COMBEE),
+    NATIONAL_DEX_ENTRY(VESPIQUEN),
+    NATIONAL_DEX_ENTRY(PACHIRISU),
+    NATIONAL_DEX_ENTRY(BUIZEL),
+    NATIONAL_DEX_ENTRY(FLOATZEL),
+    NATIONAL_DEX_ENTRY(CHERUBI),
+    NATIONAL_DEX_ENTRY(CHERRIM),
+    NATIONAL_DEX_ENTRY(SHELLOS),
+    NATIONAL_DEX_ENTRY(GASTRODON),
+    NATIONAL_DEX_ENTRY(AMBIPOM),
+    NATIONAL_DEX_ENTRY(DRIFLOON),
+    NATIONAL_DEX_ENTRY(DRIFBLIM),
+    NATIONAL_DEX_ENTRY(BUNEARY),
+    NATIONAL_DEX_ENTRY(LOPUNNY),
+    NATIONAL_DEX_ENTRY(MISMAGIUS),
+    NATIONAL_DEX_ENTRY(HONCHKROW),
+    NATIONAL_DEX_ENTRY(GLAMEOW),
+    NATIONAL_DEX_ENTRY(PURUGLY),
+    NATIONAL_DEX_ENTRY(CHINGLING),
+    NATIONAL_DEX_ENTRY(STUNKY),
+    NATIONAL_DEX_ENTRY(SKUNTANK),
+    NATIONAL_DEX_ENTRY(BRONZOR),
+    NATIONAL_DEX_ENTRY(BRONZONG),
+    NATIONAL_DEX_ENTRY(BONSLY),
+    NATIONAL_DEX_ENTRY(MIME_JR),
+    NATIONAL_DEX_ENTRY(HAPPINY),
+    NATIONAL_DEX_ENTRY(CHATOT),
+    NATIONAL_DEX_ENTRY(SPIRITOMB),
+    NATIONAL_DEX_ENTRY(GIBLE),
+    NATIONAL_DEX_ENTRY(GABITE),
+    NATIONAL_DEX_ENTRY(GARCHOMP),
+    NATIONAL_DEX_ENTRY(MUNCHLAX),
+    NATIONAL_DEX_ENTRY(RIOLU),
+    NATIONAL_DEX_ENTRY(LUCARIO),
+    NATIONAL_DEX_ENTRY(HIPPOPOTAS),
+    NATIONAL_DEX_ENTRY(HIPPOWDON),
+    NATIONAL_DEX_ENTRY(SKORUPI),
+    NATIONAL_DEX_ENTRY(DRAPION),
+    NATIONAL_DEX_ENTRY(CROAGUNK),
+    NATIONAL_DEX_ENTRY(TOXICROAK),
+    NATIONAL_DEX_ENTRY(CARNIVINE),
+    NATIONAL_DEX_ENTRY(FINNEON),
+    NATIONAL_DEX_ENTRY(LUMINEON),
+    NATIONAL_DEX_ENTRY(MANTYKE),
+    NATIONAL_DEX_ENTRY(SNOVER),
+    NATIONAL_DEX_ENTRY(ABOMASNOW),
+    NATIONAL_DEX_ENTRY(WEAVILE),
+    NATIONAL_DEX_ENTRY(MAGNEZONE),
+    NATIONAL_DEX_ENTRY(LICKILICKY),
+    NATIONAL_DEX_ENTRY(RHYPERIOR),
+    NATIONAL_DEX_ENTRY(TANGROWTH),
+    NATIONAL_DEX_ENTRY(ELECTIVIRE),
+    NATIONAL_DEX_ENTRY(MAGMORTAR),
+    NATIONAL_DEX_ENTRY(TOGEKISS),
+    NATIONAL_DEX_ENTRY(YANMEGA),
+    NATIONAL_DEX_ENTRY(LEAFEON),
+    NATIONAL_DEX_ENTRY(GLACEON),
+    NATIONAL_DEX_ENTRY(GLISCOR),
+    NATIONAL_DEX_ENTRY(MAMOSWINE),
+    NATIONAL_DEX_ENTRY(PORYGON_Z),
+    NATIONAL_DEX_ENTRY(GALLADE),
+    NATIONAL_DEX_ENTRY(PROBOPASS),
+    NATIONAL_DEX_ENTRY(DUSKNOIR),
+    NATIONAL_DEX_ENTRY(FROSLASS),
+    NATIONAL_DEX_ENTRY(ROTOM),
+    NATIONAL_DEX_ENTRY(UXIE),
+    NATIONAL_DEX_ENTRY(MESPRIT),
+    NATIONAL_DEX_ENTRY(AZELF),
+    NATIONAL_DEX_ENTRY(DIALGA),
+    NATIONAL_DEX_ENTRY(PALKIA),
+    NATIONAL_DEX_ENTRY(HEATRAN),
+    NATIONAL_DEX_ENTRY(REGIGIGAS),
+    NATIONAL_DEX_ENTRY(GIRATINA),
+    NATIONAL_DEX_ENTRY(CRESSELIA),
+    NATIONAL_DEX_ENTRY(PHIONE),
+    NATIONAL_DEX_ENTRY(MANAPHY),
+    NATIONAL_DEX_ENTRY(DARKRAI),
+    NATIONAL_DEX_ENTRY(SHAYMIN),
+    NATIONAL_DEX_ENTRY(ARCEUS),
+#endif
+#if P_GEN_5_POKEMON == TRUE
+    NATIONAL_DEX_ENTRY(VICTINI),
+    NATIONAL_DEX_ENTRY(SNIVY),
+    NATIONAL_DEX_ENTRY(SERVINE),
+    NATIONAL_DEX_ENTRY(SERPERIOR),
+    NATIONAL_DEX_ENTRY(TEPIG),
+    NATIONAL_DEX_ENTRY(PIGNITE),
+    NATIONAL_DEX_ENTRY(EMBOAR),
+    NATIONAL_DEX_ENTRY(OSHAWOTT),
+    NATIONAL_DEX_ENTRY(DEWOTT),
+    NATIONAL_DEX_ENTRY(SAMUROTT),
+    NATIONAL_DEX_ENTRY(PATRAT),
+    NATIONAL_DEX_ENTRY(WATCHOG),
+    NATIONAL_DEX_ENTRY(LILLIPUP),
+    NATIONAL_DEX_ENTRY(HERDIER),
+    NATIONAL_DEX_ENTRY(STOUTLAND),
+    NATIONAL_DEX_ENTRY(PURRLOIN),
+    NATIONAL_DEX_ENTRY(LIEPARD),
+    NATIONAL_DEX_ENTRY(PANSAGE),
+    NATIONAL_DEX_ENTRY(SIMISAGE),
+    NATIONAL_DEX_ENTRY(PANSEAR),
+    NATIONAL_DEX_ENTRY(SIMISEAR),
+    NATIONAL_DEX_ENTRY(PANPOUR),
+    NATIONAL_DEX_ENTRY(SIMIPOUR),
+    NATIONAL_DEX_ENTRY(MUNNA),
+    NATIONAL_DEX_ENTRY(MUSHARNA),
+    NATIONAL_DEX_ENTRY(PIDOVE),
+    NATIONAL_DEX_ENTRY(TRANQUILL),
+    NATIONAL_DEX_ENTRY(UNFEZANT),
+    NATIONAL_DEX_ENTRY(BLITZLE),
+    NATIONAL_DEX_ENTRY(ZEBSTRIKA),
+    NATIONAL_DEX_ENTRY(ROGGENROLA),
+    NATIONAL_DEX_ENTRY(BOLDORE),
+    NATIONAL_DEX_ENTRY(GIGALITH),
+    NATIONAL_DEX_ENTRY(WOOBAT),
+    NATIONAL_DEX_ENTRY(SWOOBAT),
+    NATIONAL_DEX_ENTRY(DRILBUR),
+    NATIONAL_DEX_ENTRY(EXCADRILL),
+    NATIONAL_DEX_ENTRY(AUDINO),
+    NATIONAL_DEX_ENTRY(TIMBURR),
+    NATIONAL_DEX_ENTRY(GURDURR),
+    NATIONAL_DEX_ENTRY(CONKELDURR),
+    NATIONAL_DEX_ENTRY(TYMPOLE),
+    NATIONAL_DEX_ENTRY(PALPITOAD),
+    NATIONAL_DEX_ENTRY(SEISMITOAD),
+    NATIONAL_DEX_ENTRY(THROH),
+    NATIONAL_DEX_ENTRY(SAWK),
+    NATIONAL_DEX_ENTRY(SEWADDLE),
+    NATIONAL_DEX_ENTRY(SWADLOON),
+    NATIONAL_DEX_ENTRY(LEAVANNY),
+    NATIONAL_DEX_ENTRY(VENIPEDE),
+    NATIONAL_DEX_ENTRY(WHIRLIPEDE),
+    NATIONAL_DEX_ENTRY(SCOLIPEDE),
+    NATIONAL_DEX_ENTRY(COTTONEE),
+    NATIONAL_DEX_ENTRY(WHIMSICOTT),
+    NATIONAL_DEX_ENTRY(PETILIL),
+    NATIONAL_DEX_ENTRY(LILLIGANT),
+    NATIONAL_DEX_ENTRY(BASCULIN),
+    NATIONAL_DEX_ENTRY(SANDILE),
+    NATIONAL_DEX_ENTRY(KROKOROK),
+    NATIONAL_DEX_ENTRY(KROOKODILE),
+    NATIONAL_DEX_ENTRY(DARUMAKA),
+    NATIONAL_DEX_ENTRY(DARMANITAN),
+    NATIONAL_DEX_ENTRY(MARACTUS),
+    NATIONAL_DEX_ENTRY(DWEBBLE),
+    NATIONAL_DEX_ENTRY(CRUSTLE),
+    NATIONAL_DEX_ENTRY(SCRAGGY),
+    NATIONAL_DEX_ENTRY(SCRAFTY),
+    NATIONAL_DEX_ENTRY(SIGILYPH),
+    NATIONAL_DEX_ENTRY(YAMASK),
+    NATIONAL_DEX_ENTRY(COFAGRIGUS),
+    NATIONAL_DEX_ENTRY(TIRTOUGA),
+    NATIONAL_DEX_ENTRY(CARRACOSTA),
+    NATIONAL_DEX_ENTRY(ARCHEN),
+    NATIONAL_DEX_ENTRY(ARCHEOPS),
+    NATIONAL_DEX_ENTRY(TRUBBISH),
+    NATIONAL_DEX_ENTRY(GARBODOR),
+    NATIONAL_DEX_ENTRY(ZORUA),
+    NATIONAL_DEX_ENTRY(ZOROARK),
+    NATIONAL_DEX_ENTRY(MINCCINO),
+    NATIONAL_DEX_ENTRY(CINCCINO),
+    NATIONAL_DEX_ENTRY(GOTHITA),
+    NATIONAL_DEX_ENTRY(GOTHORITA),
+    NATIONAL_DEX_ENTRY(GOTHITELLE),
+    NATIONAL_DEX_ENTRY(SOLOSIS),
+    NATIONAL_DEX_ENTRY(DUOSION),
+    NATIONAL_DEX_ENTRY(REUNICLUS),
+    NATIONAL_DEX_ENTRY(DUCKLETT),
+    NATIONAL_DEX_ENTRY(SWANNA),
+    NATIONAL_DEX_ENTRY(VANILLITE),
+    NATIONAL_DEX_ENTRY(VANILLISH),
+    NATIONAL_DEX_ENTRY(VANILLUXE),
+    NATIONAL_DEX_ENTRY(DEERLING),
+    NATIONAL_DEX_ENTRY(SAWSBUCK),
+    NATIONAL_DEX_ENTRY(EMOLGA),
+    NATIONAL_DEX_ENTRY(KARRABLAST),
+    NATIONAL_DEX_ENTRY(ESCAVALIER),
+    NATIONAL_DEX_ENTRY(FOONGUS),
+    NATIONAL_DEX_ENTRY(AMOONGUSS),
+    NATIONAL_DEX_ENTRY(FRILLISH),
+    NATIONAL_DEX_ENTRY(JELLICENT),
+    NATIONAL_DEX_ENTRY(ALOMOMOLA),
+    NATIONAL_DEX_ENTRY(JOLTIK),
+    NATIONAL_DEX_ENTRY(GALVANTULA),
+    NATIONAL_DEX_ENTRY(FERROSEED),
+    NATIONAL_DEX_ENTRY(FERROTHORN),
+    NATIONAL_DEX_ENTRY(KLINK),
+    NATIONAL_DEX_ENTRY(KLANG),
+    NATIONAL_DEX_ENTRY(KLINKLANG),
+    NATIONAL_DEX_ENTRY(TYNAMO),
+    NATIONAL_DEX_ENTRY(EELEKTRIK),
+    NATIONAL_DEX_ENTRY(EELEKTROSS),
+    NATIONAL_DEX_ENTRY(ELGYEM),
+    NATIONAL_DEX_ENTRY(BEHEEYEM),
+    NATIONAL_DEX_ENTRY(LITWICK),
+    NATIONAL_DEX_ENTRY(LAMPENT),
+    NATIONAL_DEX_ENTRY(CHANDELURE),
+    NATIONAL_DEX_ENTRY(AXEW),
+    NATIONAL_DEX_ENTRY(FRAXURE),
+    NATIONAL_DEX_ENTRY(HAXORUS),
+    NATIONAL_DEX_ENTRY(CUBCHOO),
+    NATIONAL_DEX_ENTRY(BEARTIC),
+    NATIONAL_DEX_ENTRY(CRYOGONAL),
+    NATIONAL_DEX_ENTRY(SHELMET),
+    NATIONAL_DEX_ENTRY(ACCELGOR),
+    NATIONAL_DEX_ENTRY(STUNFISK),
+    NATIONAL_DEX_ENTRY(MIENFOO),
+    NATIONAL_DEX_ENTRY(MIENSHAO),
+    NATIONAL_DEX_ENTRY(DRUDDIGON),
+    NATIONAL_DEX_ENTRY(GOLETT),
+    NATIONAL_DEX_ENTRY(GOLURK),
+    NATIONAL_DEX_ENTRY(PAWNIARD),
+    NATIONAL_DEX_ENTRY(BISHARP),
+    NATIONAL_DEX_ENTRY(BOUFFALANT),
+    NATIONAL_DEX_ENTRY(RUFFLET),
+    NATIONAL_DEX_ENTRY(BRAVIARY),
+    NATIONAL_DEX_ENTRY(VULLABY),
+    NATIONAL_DEX_ENTRY(MANDIBUZZ),
+    NATIONAL_DEX_ENTRY(HEATMOR),
+    NATIONAL_DEX_ENTRY(DURANT),
+    NATIONAL_DEX_ENTRY(DEINO),
+    NATIONAL_DEX_ENTRY(ZWEILOUS),
+    NATIONAL_DEX_ENTRY(HYDREIGON),
+    NATIONAL_DEX_ENTRY(LARVESTA),
+    NATIONAL_DEX_ENTRY(VOLCARONA),
+    NATIONAL_DEX_ENTRY(COBALION),
+    NATIONAL_DEX_ENTRY(TERRAKION),
+    NATIONAL_DEX_ENTRY(VIRIZION),
+    NATIONAL_DEX_ENTRY(TORNADUS),
+    NATIONAL_DEX_ENTRY(THUNDURUS),
+    NATIONAL_DEX_ENTRY(RESHIRAM),
+    NATIONAL_DEX_ENTRY(ZEKROM),
+    NATIONAL_DEX_ENTRY(LANDORUS),
+    NATIONAL_DEX_ENTRY(KYUREM),
+    NATIONAL_DEX_ENTRY(KELDEO),
+    NATIONAL_DEX_ENTRY(MELOETTA),
+    NATIONAL_DEX_ENTRY(GENESECT),
+#endif
+#if P_GEN_6_POKEMON == TRUE
+    NATIONAL_DEX_ENTRY(CHESPIN),
+    NATIONAL_DEX_ENTRY(QUILLADIN),
+    NATIONAL_DEX_ENTRY(CHESNAUGHT),
+    NATIONAL_DEX_ENTRY(FENNEKIN),
+    NATIONAL_DEX_ENTRY(BRAIXEN),
+    NATIONAL_DEX_ENTRY(DELPHOX),
+    NATIONAL_DEX_ENTRY(FROAKIE),
+    NATIONAL_DEX_ENTRY(FROGADIER),
+    NATIONAL_DEX_ENTRY(GRENINJA),
+    NATIONAL_DEX_ENTRY(BUNNELBY),
+    NATIONAL_DEX_ENTRY(DIGGERSBY),
+    NATIONAL_DEX_ENTRY(FLETCHLING),
+    NATIONAL_DEX_ENTRY(FLETCHINDER),
+    NATIONAL_DEX_ENTRY(TALONFLAME),
+    NATIONAL_DEX_ENTRY(SCATTERBUG),
+    NATIONAL_DEX_ENTRY(SPEWPA),
+    NATIONAL_DEX_ENTRY(VIVILLON),
+    NATIONAL_DEX_ENTRY(LITLEO),
+    NATIONAL_DEX_ENTRY(PYROAR),
+    NATIONAL_DEX_ENTRY(FLABEBE),
+    NATIONAL_DEX_ENTRY(FLOETTE),
+    NATIONAL_DEX_ENTRY(FLORGES),
+    NATIONAL_DEX_ENTRY(SKIDDO),
+    NATIONAL_DEX_ENTRY(GOGOAT),
+    NATIONAL_DEX_ENTRY(PANCHAM),
+    NATIONAL_DEX_ENTRY(PANGORO),
+    NATIONAL_DEX_ENTRY(FURFROU),
+    NATIONAL_DEX_ENTRY(ESPURR),
+    NATIONAL_DEX_ENTRY(MEOWSTIC),
+    NATIONAL_DEX_ENTRY(HONEDGE),
+    NATIONAL_DEX_ENTRY(DOUBLADE),
+    NATIONAL_DEX_ENTRY(AEGISLASH),
+    NATIONAL_DEX_ENTRY(SPRITZEE),
+    NATIONAL_DEX_ENTRY(AROMATISSE),
+    NATIONAL_DEX_ENTRY(SWIRLIX),
+    NATIONAL_DEX_ENTRY(SLURPUFF),
+    NATIONAL_DEX_ENTRY(INKAY),
+    NATIONAL_DEX_ENTRY(MALAMAR),
+    NATIONAL_DEX_ENTRY(BINACLE),
+    NATIONAL_DEX_ENTRY(BARBARACLE),
+    NATIONAL_DEX_ENTRY(SKRELP),
+    NATIONAL_DEX_ENTRY(DRAGALGE),
+    NATIONAL_DEX_ENTRY(CLAUNCHER),
+    NATIONAL_DEX_ENTRY(CLAWITZER),
+    NATIONAL_DEX_ENTRY(HELIOPTILE),
+    NATIONAL_DEX_ENTRY(HELIOLISK),
+    NATIONAL_DEX_ENTRY(TYRUNT),
+    NATIONAL_DEX_ENTRY(TYRANTRUM),
+    NATIONAL_DEX_ENTRY(AMAURA),
+    NATIONAL_DEX_ENTRY(AURORUS),
+    NATIONAL_DEX_ENTRY(SYLVEON),
+    NATIONAL_DEX_ENTRY(HAWLUCHA),
+    NATIONAL_DEX_ENTRY(DEDENNE),
+    NATIONAL_DEX_ENTRY(CARBINK),
+    NATIONAL_DEX_ENTRY(GOOMY),
+    NATIONAL_DEX_ENTRY(SLIGGOO),
+    NATIONAL_DEX_ENTRY(GOODRA),
+    NATIONAL_DEX_ENTRY(KLEFKI),
+    NATIONAL_DEX_ENTRY(PHANTUMP),
+    NATIONAL_DEX_ENTRY(TREVENANT),
+    NATIONAL_DEX_ENTRY(PUMPKABOO),
+    NATIONAL_DEX_ENTRY(GOURGEIST),
+    NATIONAL_DEX_ENTRY(BERGMITE),
+    NATIONAL_DEX_ENTRY(AVALUGG),
+    NATIONAL_DEX_ENTRY(NOIBAT),
+    NATIONAL_DEX_ENTRY(NOIVERN),
+    NATIONAL_DEX_ENTRY(XERNEAS),
+    NATIONAL_DEX_ENTRY(YVELTAL),
+    NATIONAL_DEX_ENTRY(ZYGARDE),
+    NATIONAL_DEX_ENTRY(DIANCIE),
+    NATIONAL_DEX_ENTRY(HOOPA),
+    NATIONAL_DEX_ENTRY(VOLCANION),
+#endif
+#if P_GEN_7_POKEMON == TRUE
+    NATIONAL_DEX_ENTRY(ROWLET),
+    NATIONAL_DEX_ENTRY(DARTRIX),
+    NATIONAL_DEX_ENTRY(DECIDUEYE),
+    NATIONAL_DEX_ENTRY(LITTEN),
+    NATIONAL_DEX_ENTRY(TORRACAT),
+    NATIONAL_DEX_ENTRY(INCINEROAR),
+    NATIONAL_DEX_ENTRY(POPPLIO),
+    NATIONAL_DEX_ENTRY(BRIONNE),
+    NATIONAL_DEX_ENTRY(PRIMARINA),
+    NATIONAL_DEX_ENTRY(PIKIPEK),
+    NATIONAL_DEX_ENTRY(TRUMBEAK),
+    NATIONAL_DEX_ENTRY(TOUCANNON),
+    NATIONAL_DEX_ENTRY(YUNGOOS),
+    NATIONAL_DEX_ENTRY(GUMSHOOS),
+    NATIONAL_DEX_ENTRY(GRUBBIN),
+    NATIONAL_DEX_ENTRY(CHARJABUG),
+    NATIONAL_DEX_ENTRY(VIKAVOLT),
+    NATIONAL_DEX_ENTRY(CRABRAWLER),
+    NATIONAL_DEX_ENTRY(CRABOMINABLE),
+    NATIONAL_DEX_ENTRY(ORICORIO),
+    NATIONAL_DEX_ENTRY(CUTIEFLY),
+    NATIONAL_DEX_ENTRY(RIBOMBEE),
+    NATIONAL_DEX_ENTRY(ROCKRUFF),
+    NATIONAL_DEX_ENTRY(LYCANROC),
+    NATIONAL_DEX_ENTRY(WISHIWASHI),
+    NATIONAL_DEX_ENTRY(MAREANIE),
+    NATIONAL_DEX_ENTRY(TOXAPEX),
+    NATIONAL_DEX_ENTRY(MUDBRAY),
+    NATIONAL_DEX_ENTRY(MUDSDALE),
+    NATIONAL_DEX_ENTRY(DEWPIDER),
+    NATIONAL_DEX_ENTRY(ARAQUANID),
+    NATIONAL_DEX_ENTRY(FOMANTIS),
+    NATIONAL_DEX_ENTRY(LURANTIS),
+    NATIONAL_DEX_ENTRY(MORELULL),
+    NATIONAL_DEX_ENTRY(SHIINOTIC),
+    NATIONAL_DEX_ENTRY(SALANDIT),
+    NATIONAL_DEX_ENTRY(SALAZZLE),
+    NATIONAL_DEX_ENTRY(STUFFUL),
+    NATIONAL_DEX_ENTRY(BEWEAR),
+    NATIONAL_DEX_ENTRY(BOUNSWEET),
+    NATIONAL_DEX_ENTRY(STEENEE),
+    NATIONAL_DEX_ENTRY(TSAREENA),
+    NATIONAL_DEX_ENTRY(COMFEY),
+    NATIONAL_DEX_ENTRY(ORANGURU),
+    NATIONAL_DEX_ENTRY(PASSIMIAN),
+    NATIONAL_DEX_ENTRY(WIMPOD),
+    NATIONAL_DEX_ENTRY(GOLISOPOD),
+    NATIONAL_DEX_ENTRY(SANDYGAST),
+    NATIONAL_DEX_ENTRY(PALOSSAND),
+    NATIONAL_DEX_ENTRY(PYUKUMUKU),
+    NATIONAL_DEX_ENTRY(TYPE_NULL),
+    NATIONAL_DEX_ENTRY(SILVALLY),
+    NATIONAL_DEX_ENTRY(MINIOR),
+    NATIONAL_DEX_ENTRY(KOMALA),
+    NATIONAL_DEX_ENTRY(TURTONATOR),
+    NATIONAL_DEX_ENTRY(TOGEDEMARU),
+    NATIONAL_DEX_ENTRY(MIMIKYU),
+    NATIONAL_DEX_ENTRY(BRUXISH),
+    NATIONAL_DEX_ENTRY(DRAMPA),
+    NATIONAL_DEX_ENTRY(DHELMISE),
+    NATIONAL_DEX_ENTRY(JANGMO_O),
+    NATIONAL_DEX_ENTRY(HAKAMO_O),
+    NATIONAL_DEX_ENTRY(KOMMO_O),
+    NATIONAL_DEX_ENTRY(TAPU_KOKO),
+    NATIONAL_DEX_ENTRY(TAPU_LELE),
+    NATIONAL_DEX_ENTRY(TAPU_BULU),
+    NATIONAL_DEX_ENTRY(TAPU_FINI),
+    NATIONAL_DEX_ENTRY(COSMOG),
+    NATIONAL_DEX_ENTRY(COSMOEM),
+    NATIONAL_DEX_ENTRY(SOLGALEO),
+    NATIONAL_DEX_ENTRY(LUNALA),
+    NATIONAL_DEX_ENTRY(NIHILEGO),
+    NATIONAL_DEX_ENTRY(BUZZWOLE),
+    NATIONAL_DEX_ENTRY(PHEROMOSA),
+    NATIONAL_DEX_ENTRY(XURKITREE),
+    NATIONAL_DEX_ENTRY(CELESTEELA),
+    NATIONAL_DEX_ENTRY(KARTANA),
+    NATIONAL_DEX_ENTRY(GUZZLORD),
+    NATIONAL_DEX_ENTRY(NECROZMA),
+    NATIONAL_DEX_ENTRY(MAGEARNA),
+    NATIONAL_DEX_ENTRY(MARSHADOW),
+    NATIONAL_DEX_ENTRY(POIPOLE),
+    NATIONAL_DEX_ENTRY(NAGANADEL),
+    NATIONAL_DEX_ENTRY(STAKATAKA),
+    NATIONAL_DEX_ENTRY(BLACEPHALON),
+    NATIONAL_DEX_ENTRY(ZERAORA),
+    NATIONAL_DEX_ENTRY(MELTAN),
+    NATIONAL_DEX_ENTRY(MELMETAL),
+#endif
+#if P_GEN_8_POKEMON == TRUE
+    NATIONAL_DEX_ENTRY(GROOKEY),
+    NATIONAL_DEX_ENTRY(THWACKEY),
+    NATIONAL_DEX_ENTRY(RILLABOOM),
+    NATIONAL_DEX_ENTRY(SCORBUNNY),
+    NATIONAL_DEX_ENTRY(RABOOT),
+    NATIONAL_DEX_ENTRY(CINDERACE),
+    NATIONAL_DEX_ENTRY(SOBBLE),
+    NATIONAL_DEX_ENTRY(DRIZZILE),
+    NATIONAL_DEX_ENTRY(INTELEON),
+    NATIONAL_DEX_ENTRY(SKWOVET),
+    NATIONAL_DEX_ENTRY(GREEDENT),
+    NATIONAL_DEX_ENTRY(ROOKIDEE),
+    NATIONAL_DEX_ENTRY(CORVISQUIRE),
+    NATIONAL_DEX_ENTRY(CORVIKNIGHT),
+    NATIONAL_DEX_ENTRY(BLIPBUG),
+    NATIONAL_DEX_ENTRY(DOTTLER),
+    NATIONAL_DEX_ENTRY(ORBEETLE),
+    NATIONAL_DEX_ENTRY(NICKIT),
+    NATIONAL_DEX_ENTRY(THIEVUL),
+    NATIONAL_DEX_ENTRY(GOSSIFLEUR),
+    NATIONAL_DEX_ENTRY(ELDEGOSS),
+    NATIONAL_DEX_ENTRY(WOOLOO),
+    NATIONAL_DEX_ENTRY(DUBWOOL),
+    NATIONAL_DEX_ENTRY(CHEWTLE),
+    NATIONAL_DEX_ENTRY(DREDNAW),
+    NATIONAL_DEX_ENTRY(YAMPER),
+    NATIONAL_DEX_ENTRY(BOLTUND),
+    NATIONAL_DEX_ENTRY(ROLYCOLY),
+    NATIONAL_DEX_ENTRY(CARKOL),
+    NATIONAL_DEX_ENTRY(COALOSSAL),
+    NATIONAL_DEX_ENTRY(APPLIN),
+    NATIONAL_DEX_ENTRY(FLAPPLE),
+    NATIONAL_DEX_ENTRY(APPLETUN),
+    NATIONAL_DEX_ENTRY(SILICOBRA),
+    NATIONAL_DEX_ENTRY(SANDACONDA),
+    NATIONAL_DEX_ENTRY(CRAMORANT),
+    NATIONAL_DEX_ENTRY(ARROKUDA),
+    NATIONAL_DEX_ENTRY(BARRASKEWDA),
+    NATIONAL_DEX_ENTRY(TOXEL),
+    NATIONAL_DEX_ENTRY(TOXTRICITY),
+    NATIONAL_DEX_ENTRY(SIZZLIPEDE),
+    NATIONAL_DEX_ENTRY(CENTISKORCH),
+    NATIONAL_DEX_ENTRY(CLOBBOPUS),
+    NATIONAL_DEX_ENTRY(GRAPPLOCT),
+    NATIONAL_DEX_ENTRY(SINISTEA),
+    NATIONAL_DEX_ENTRY(POLTEAGEIST),
+    NATIONAL_DEX_ENTRY(HATENNA),
+    NATIONAL_DEX_ENTRY(HATTREM),
+    NATIONAL_DEX_ENTRY(HATTERENE),
+    NATIONAL_DEX_ENTRY(IMPIDIMP),
+    NATIONAL_DEX_ENTRY(MORGREM),
+    NATIONAL_DEX_ENTRY(GRIMMSNARL),
+    NATIONAL_DEX_ENTRY(OBSTAGOON),
+    NATIONAL_DEX_ENTRY(PERRSERKER),
+    NATIONAL_DEX_ENTRY(CURSOLA),
+    NATIONAL_DEX_ENTRY(SIRFETCHD),
+    NATIONAL_DEX_ENTRY(MR_RIME),
+    NATIONAL_DEX_ENTRY(RUNERIGUS),
+    NATIONAL_DEX_ENTRY(MILCERY),
+    NATIONAL_DEX_ENTRY(ALCREMIE),
+    NATIONAL_DEX_ENTRY(FALINKS),
+    NATIONAL_DEX_ENTRY(PINCURCHIN),
+    NATIONAL_DEX_ENTRY(SNOM),
+    NATIONAL_DEX_ENTRY(FROSMOTH),
+    NATIONAL_DEX_ENTRY(STONJOURNER),
+    NATIONAL_DEX_ENTRY(EISCUE),
+    NATIONAL_DEX_ENTRY(INDEEDEE),
+    NATIONAL_DEX_ENTRY(MORPEKO),
+    NATIONAL_DEX_ENTRY(CUFANT),
+    NATIONAL_DEX_ENTRY(COPPERAJAH),
+    NATIONAL_DEX_ENTRY(DRACOZOLT),
+    NATIONAL_DEX_ENTRY(ARCTOZOLT),
+    NATIONAL_DEX_ENTRY(DRACOVISH),
+    NATIONAL_DEX_ENTRY(ARCTOVISH),
+    NATIONAL_DEX_ENTRY(DURALUDON),
+    NATIONAL_DEX_ENTRY(DREEPY),
+    NATIONAL_DEX_ENTRY(DRAKLOAK),
+    NATIONAL_DEX_ENTRY(DRAGAPULT),
+    NATIONAL_DEX_ENTRY(ZACIAN),
+    NATIONAL_DEX_ENTRY(ZAMAZENTA),
+    NATIONAL_DEX_ENTRY(ETERNATUS),
+    NATIONAL_DEX_ENTRY(KUBFU),
+    NATIONAL_DEX_ENTRY(URSHIFU),
+    NATIONAL_DEX_ENTRY(ZARUDE),
+    NATIONAL_DEX_ENTRY(REGIELEKI),
+    NATIONAL_DEX_ENTRY(REGIDRAGO),
+    NATIONAL_DEX_ENTRY(GLASTRIER),
+    NATIONAL_DEX_ENTRY(SPECTRIER),
+    NATIONAL_DEX_ENTRY(CALYREX),
+    NATIONAL_DEX_ENTRY(WYRDEER),
+    NATIONAL_DEX_ENTRY(KLEAVOR),
+    NATIONAL_DEX_ENTRY(URSALUNA),
+    NATIONAL_DEX_ENTRY(BASCULEGION),
+    NATIONAL_DEX_ENTRY(SNEASLER),
+    NATIONAL_DEX_ENTRY(OVERQWIL),
+    NATIONAL_DEX_ENTRY(ENAMORUS),
+#endif
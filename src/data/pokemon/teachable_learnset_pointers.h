@@ -1,1339 +1,1341 @@
-const u16 *const gTeachableLearnsets[NUM_SPECIES] =
+#define TEACHABLE_LEARNSET(learnset) {learnset, ARRAY_COUNT(learnset) - 1}
+
+const struct TeachableLearnset gTeachableLearnsets[NUM_SPECIES] =
 {
-    [SPECIES_NONE] = sBulbasaurTeachableLearnset,
-    [SPECIES_BULBASAUR] = sBulbasaurTeachableLearnset,
-    [SPECIES_IVYSAUR] = sIvysaurTeachableLearnset,
-    [SPECIES_VENUSAUR] = sVenusaurTeachableLearnset,
-    [SPECIES_CHARMANDER] = sCharmanderTeachableLearnset,
-    [SPECIES_CHARMELEON] = sCharmeleonTeachableLearnset,
-    [SPECIES_CHARIZARD] = sCharizardTeachableLearnset,
-    [SPECIES_SQUIRTLE] = sSquirtleTeachableLearnset,
-    [SPECIES_WARTORTLE] = sWartortleTeachableLearnset,
-    [SPECIES_BLASTOISE] = sBlastoiseTeachableLearnset,
-    [SPECIES_CATERPIE] = sCaterpieTeachableLearnset,
-    [SPECIES_METAPOD] = sMetapodTeachableLearnset,
-    [SPECIES_BUTTERFREE] = sButterfreeTeachableLearnset,
-    [SPECIES_WEEDLE] = sWeedleTeachableLearnset,
-    [SPECIES_KAKUNA] = sKakunaTeachableLearnset,
-    [SPECIES_BEEDRILL] = sBeedrillTeachableLearnset,
-    [SPECIES_PIDGEY] = sPidgeyTeachableLearnset,
-    [SPECIES_PIDGEOTTO] = sPidgeottoTeachableLearnset,
-    [SPECIES_PIDGEOT] = sPidgeotTeachableLearnset,
-    [SPECIES_RATTATA] = sRattataTeachableLearnset,
-    [SPECIES_RATICATE] = sRaticateTeachableLearnset,
-    [SPECIES_SPEAROW] = sSpearowTeachableLearnset,
-    [SPECIES_FEAROW] = sFearowTeachableLearnset,
-    [SPECIES_EKANS] = sEkansTeachableLearnset,
-    [SPECIES_ARBOK] = sArbokTeachableLearnset,
-    [SPECIES_PIKACHU] = sPikachuTeachableLearnset,
-    [SPECIES_RAICHU] = sRaichuTeachableLearnset,
-    [SPECIES_SANDSHREW] = sSandshrewTeachableLearnset,
-    [SPECIES_SANDSLASH] = sSandslashTeachableLearnset,
-    [SPECIES_NIDORAN_F] = sNidoranFTeachableLearnset,
-    [SPECIES_NIDORINA] = sNidorinaTeachableLearnset,
-    [SPECIES_NIDOQUEEN] = sNidoqueenTeachableLearnset,
-    [SPECIES_NIDORAN_M] = sNidoranMTeachableLearnset,
-    [SPECIES_NIDORINO] = sNidorinoTeachableLearnset,
-    [SPECIES_NIDOKING] = sNidokingTeachableLearnset,
-    [SPECIES_CLEFAIRY] = sClefairyTeachableLearnset,
-    [SPECIES_CLEFABLE] = sClefableTeachableLearnset,
-    [SPECIES_VULPIX] = sVulpixTeachableLearnset,
-    [SPECIES_NINETALES] = sNinetalesTeachableLearnset,
-    [SPECIES_JIGGLYPUFF] = sJigglypuffTeachableLearnset,
-    [SPECIES_WIGGLYTUFF] = sWigglytuffTeachableLearnset,
-    [SPECIES_ZUBAT] = sZubatTeachableLearnset,
-    [SPECIES_GOLBAT] = sGolbatTeachableLearnset,
-    [SPECIES_ODDISH] = sOddishTeachableLearnset,
-    [SPECIES_GLOOM] = sGloomTeachableLearnset,
-    [SPECIES_VILEPLUME] = sVileplumeTeachableLearnset,
-    [SPECIES_PARAS] = sParasTeachableLearnset,
-    [SPECIES_PARASECT] = sParasectTeachableLearnset,
-    [SPECIES_VENONAT] = sVenonatTeachableLearnset,
-    [SPECIES_VENOMOTH] = sVenomothTeachableLearnset,
-    [SPECIES_DIGLETT] = sDiglettTeachableLearnset,
-    [SPECIES_DUGTRIO] = sDugtrioTeachableLearnset,
-    [SPECIES_MEOWTH] = sMeowthTeachableLearnset,
-    [SPECIES_PERSIAN] = sPersianTeachableLearnset,
-    [SPECIES_PSYDUCK] = sPsyduckTeachableLearnset,
-    [SPECIES_GOLDUCK] = sGolduckTeachableLearnset,
-    [SPECIES_MANKEY] = sMankeyTeachableLearnset,
-    [SPECIES_PRIMEAPE] = sPrimeapeTeachableLearnset,
-    [SPECIES_GROWLITHE] = sGrowlitheTeachableLearnset,
-    [SPECIES_ARCANINE] = sArcanineTeachableLearnset,
-    [SPECIES_POLIWAG] = sPoliwagTeachableLearnset,
-    [SPECIES_POLIWHIRL] = sPoliwhirlTeachableLearnset,
-    [SPECIES_POLIWRATH] = sPoliwrathTeachableLearnset,
-    [SPECIES_ABRA] = sAbraTeachableLearnset,
-    [SPECIES_KADABRA] = sKadabraTeachableLearnset,
-    [SPECIES_ALAKAZAM] = sAlakazamTeachableLearnset,
-    [SPECIES_MACHOP] = sMachopTeachableLearnset,
-    [SPECIES_MACHOKE] = sMachokeTeachableLearnset,
-    [SPECIES_MACHAMP] = sMachampTeachableLearnset,
-    [SPECIES_BELLSPROUT] = sBellsproutTeachableLearnset,
-    [SPECIES_WEEPINBELL] = sWeepinbellTeachableLearnset,
-    [SPECIES_VICTREEBEL] = sVictreebelTeachableLearnset,
-    [SPECIES_TENTACOOL] = sTentacoolTeachableLearnset,
-    [SPECIES_TENTACRUEL] = sTentacruelTeachableLearnset,
-    [SPECIES_GEODUDE] = sGeodudeTeachableLearnset,
-    [SPECIES_GRAVELER] = sGravelerTeachableLearnset,
-    [SPECIES_GOLEM] = sGolemTeachableLearnset,
-    [SPECIES_PONYTA] = sPonytaTeachableLearnset,
-    [SPECIES_RAPIDASH] = sRapidashTeachableLearnset,
-    [SPECIES_SLOWPOKE] = sSlowpokeTeachableLearnset,
-    [SPECIES_SLOWBRO] = sSlowbroTeachableLearnset,
-    [SPECIES_MAGNEMITE] = sMagnemiteTeachableLearnset,
-    [SPECIES_MAGNETON] = sMagnetonTeachableLearnset,
-    [SPECIES_FARFETCHD] = sFarfetchdTeachableLearnset,
-    [SPECIES_DODUO] = sDoduoTeachableLearnset,
-    [SPECIES_DODRIO] = sDodrioTeachableLearnset,
-    [SPECIES_SEEL] = sSeelTeachableLearnset,
-    [SPECIES_DEWGONG] = sDewgongTeachableLearnset,
-    [SPECIES_GRIMER] = sGrimerTeachableLearnset,
-    [SPECIES_MUK] = sMukTeachableLearnset,
-    [SPECIES_SHELLDER] = sShellderTeachableLearnset,
-    [SPECIES_CLOYSTER] = sCloysterTeachableLearnset,
-    [SPECIES_GASTLY] = sGastlyTeachableLearnset,
-    [SPECIES_HAUNTER] = sHaunterTeachableLearnset,
-    [SPECIES_GENGAR] = sGengarTeachableLearnset,
-    [SPECIES_ONIX] = sOnixTeachableLearnset,
-    [SPECIES_DROWZEE] = sDrowzeeTeachableLearnset,
-    [SPECIES_HYPNO] = sHypnoTeachableLearnset,
-    [SPECIES_KRABBY] = sKrabbyTeachableLearnset,
-    [SPECIES_KINGLER] = sKinglerTeachableLearnset,
-    [SPECIES_VOLTORB] = sVoltorbTeachableLearnset,
-    [SPECIES_ELECTRODE] = sElectrodeTeachableLearnset,
-    [SPECIES_EXEGGCUTE] = sExeggcuteTeachableLearnset,
-    [SPECIES_EXEGGUTOR] = sExeggutorTeachableLearnset,
-    [SPECIES_CUBONE] = sCuboneTeachableLearnset,
-    [SPECIES_MAROWAK] = sMarowakTeachableLearnset,
-    [SPECIES_HITMONLEE] = sHitmonleeTeachableLearnset,
-    [SPECIES_HITMONCHAN] = sHitmonchanTeachableLearnset,
-    [SPECIES_LICKITUNG] = sLickitungTeachableLearnset,
-    [SPECIES_KOFFING] = sKoffingTeachableLearnset,
-    [SPECIES_WEEZING] = sWeezingTeachableLearnset,
-    [SPECIES_RHYHORN] = sRhyhornTeachableLearnset,
-    [SPECIES_RHYDON] = sRhydonTeachableLearnset,
-    [SPECIES_CHANSEY] = sChanseyTeachableLearnset,
-    [SPECIES_TANGELA] = sTangelaTeachableLearnset,
-    [SPECIES_KANGASKHAN] = sKangaskhanTeachableLearnset,
-    [SPECIES_HORSEA] = sHorseaTeachableLearnset,
-    [SPECIES_SEADRA] = sSeadraTeachableLearnset,
-    [SPECIES_GOLDEEN] = sGoldeenTeachableLearnset,
-    [SPECIES_SEAKING] = sSeakingTeachableLearnset,
-    [SPECIES_STARYU] = sStaryuTeachableLearnset,
-    [SPECIES_STARMIE] = sStarmieTeachableLearnset,
-    [SPECIES_MR_MIME] = sMrMimeTeachableLearnset,
-    [SPECIES_SCYTHER] = sScytherTeachableLearnset,
-    [SPECIES_JYNX] = sJynxTeachableLearnset,
-    [SPECIES_ELECTABUZZ] = sElectabuzzTeachableLearnset,
-    [SPECIES_MAGMAR] = sMagmarTeachableLearnset,
-    [SPECIES_PINSIR] = sPinsirTeachableLearnset,
-    [SPECIES_TAUROS] = sTaurosTeachableLearnset,
-    [SPECIES_MAGIKARP] = sMagikarpTeachableLearnset,
-    [SPECIES_GYARADOS] = sGyaradosTeachableLearnset,
-    [SPECIES_LAPRAS] = sLaprasTeachableLearnset,
-    [SPECIES_DITTO] = sDittoTeachableLearnset,
-    [SPECIES_EEVEE] = sEeveeTeachableLearnset,
-    [SPECIES_VAPOREON] = sVaporeonTeachableLearnset,
-    [SPECIES_JOLTEON] = sJolteonTeachableLearnset,
-    [SPECIES_FLAREON] = sFlareonTeachableLearnset,
-    [SPECIES_PORYGON] = sPorygonTeachableLearnset,
-    [SPECIES_OMANYTE] = sOmanyteTeachableLearnset,
-    [SPECIES_OMASTAR] = sOmastarTeachableLearnset,
-    [SPECIES_KABUTO] = sKabutoTeachableLearnset,
-    [SPECIES_KABUTOPS] = sKabutopsTeachableLearnset,
-    [SPECIES_AERODACTYL] = sAerodactylTeachableLearnset,
-    [SPECIES_SNORLAX] = sSnorlaxTeachableLearnset,
-    [SPECIES_ARTICUNO] = sArticunoTeachableLearnset,
-    [SPECIES_ZAPDOS] = sZapdosTeachableLearnset,
-    [SPECIES_MOLTRES] = sMoltresTeachableLearnset,
-    [SPECIES_DRATINI] = sDratiniTeachableLearnset,
-    [SPECIES_DRAGONAIR] = sDragonairTeachableLearnset,
-    [SPECIES_DRAGONITE] = sDragoniteTeachableLearnset,
-    [SPECIES_MEWTWO] = sMewtwoTeachableLearnset,
-    [SPECIES_MEW] = sMewTeachableLearnset,
-    [SPECIES_CHIKORITA] = sChikoritaTeachableLearnset,
-    [SPECIES_BAYLEEF] = sBayleefTeachableLearnset,
-    [SPECIES_MEGANIUM] = sMeganiumTeachableLearnset,
-    [SPECIES_CYNDAQUIL] = sCyndaquilTeachableLearnset,
-    [SPECIES_QUILAVA] = sQuilavaTeachableLearnset,
-    [SPECIES_TYPHLOSION] = sTyphlosionTeachableLearnset,
-    [SPECIES_TOTODILE] = sTotodileTeachableLearnset,
-    [SPECIES_CROCONAW] = sCroconawTeachableLearnset,
-    [SPECIES_FERALIGATR] = sFeraligatrTeachableLearnset,
-    [SPECIES_SENTRET] = sSentretTeachableLearnset,
-    [SPECIES_FURRET] = sFurretTeachableLearnset,
-    [SPECIES_HOOTHOOT] = sHoothootTeachableLearnset,
-    [SPECIES_NOCTOWL] = sNoctowlTeachableLearnset,
-    [SPECIES_LEDYBA] = sLedybaTeachableLearnset,
-    [SPECIES_LEDIAN] = sLedianTeachableLearnset,
-    [SPECIES_SPINARAK] = sSpinarakTeachableLearnset,
-    [SPECIES_ARIADOS] = sAriadosTeachableLearnset,
-    [SPECIES_CROBAT] = sCrobatTeachableLearnset,
-    [SPECIES_CHINCHOU] = sChinchouTeachableLearnset,
-    [SPECIES_LANTURN] = sLanturnTeachableLearnset,
-    [SPECIES_PICHU] = sPichuTeachableLearnset,
-    [SPECIES_CLEFFA] = sCleffaTeachableLearnset,
-    [SPECIES_IGGLYBUFF] = sIgglybuffTeachableLearnset,
-    [SPECIES_TOGEPI] = sTogepiTeachableLearnset,
-    [SPECIES_TOGETIC] = sTogeticTeachableLearnset,
-    [SPECIES_NATU] = sNatuTeachableLearnset,
-    [SPECIES_XATU] = sXatuTeachableLearnset,
-    [SPECIES_MAREEP] = sMareepTeachableLearnset,
-    [SPECIES_FLAAFFY] = sFlaaffyTeachableLearnset,
-    [SPECIES_AMPHAROS] = sAmpharosTeachableLearnset,
-    [SPECIES_BELLOSSOM] = sBellossomTeachableLearnset,
-    [SPECIES_MARILL] = sMarillTeachableLearnset,
-    [SPECIES_AZUMARILL] = sAzumarillTeachableLearnset,
-    [SPECIES_SUDOWOODO] = sSudowoodoTeachableLearnset,
-    [SPECIES_POLITOED] = sPolitoedTeachableLearnset,
-    [SPECIES_HOPPIP] = sHoppipTeachableLearnset,
-    [SPECIES_SKIPLOOM] = sSkiploomTeachableLearnset,
-    [SPECIES_JUMPLUFF] = sJumpluffTeachableLearnset,
-    [SPECIES_AIPOM] = sAipomTeachableLearnset,
-    [SPECIES_SUNKERN] = sSunkernTeachableLearnset,
-    [SPECIES_SUNFLORA] = sSunfloraTeachableLearnset,
-    [SPECIES_YANMA] = sYanmaTeachableLearnset,
-    [SPECIES_WOOPER] = sWooperTeachableLearnset,
-    [SPECIES_QUAGSIRE] = sQuagsireTeachableLearnset,
-    [SPECIES_ESPEON] = sEspeonTeachableLearnset,
-    [SPECIES_UMBREON] = sUmbreonTeachableLearnset,
-    [SPECIES_MURKROW] = sMurkrowTeachableLearnset,
-    [SPECIES_SLOWKING] = sSlowkingTeachableLearnset,
-    [SPECIES_MISDREAVUS] = sMisdreavusTeachableLearnset,
-    [SPECIES_UNOWN] = sUnownTeachableLearnset,
-    [SPECIES_WOBBUFFET] = sWobbuffetTeachableLearnset,
-    [SPECIES_GIRAFARIG] = sGirafarigTeachableLearnset,
-    [SPECIES_PINECO] = sPinecoTeachableLearnset,
-    [SPECIES_FORRETRESS] = sForretressTeachableLearnset,
-    [SPECIES_DUNSPARCE] = sDunsparceTeachableLearnset,
-    [SPECIES_GLIGAR] = sGligarTeachableLearnset,
-    [SPECIES_STEELIX] = sSteelixTeachableLearnset,
-    [SPECIES_SNUBBULL] = sSnubbullTeachableLearnset,
-    [SPECIES_GRANBULL] = sGranbullTeachableLearnset,
-    [SPECIES_QWILFISH] = sQwilfishTeachableLearnset,
-    [SPECIES_SCIZOR] = sScizorTeachableLearnset,
-    [SPECIES_SHUCKLE] = sShuckleTeachableLearnset,
-    [SPECIES_HERACROSS] = sHeracrossTeachableLearnset,
-    [SPECIES_SNEASEL] = sSneaselTeachableLearnset,
-    [SPECIES_TEDDIURSA] = sTeddiursaTeachableLearnset,
-    [SPECIES_URSARING] = sUrsaringTeachableLearnset,
-    [SPECIES_SLUGMA] = sSlugmaTeachableLearnset,
-    [SPECIES_MAGCARGO] = sMagcargoTeachableLearnset,
-    [SPECIES_SWINUB] = sSwinubTeachableLearnset,
-    [SPECIES_PILOSWINE] = sPiloswineTeachableLearnset,
-    [SPECIES_CORSOLA] = sCorsolaTeachableLearnset,
-    [SPECIES_REMORAID] = sRemoraidTeachableLearnset,
-    [SPECIES_OCTILLERY] = sOctilleryTeachableLearnset,
-    [SPECIES_DELIBIRD] = sDelibirdTeachableLearnset,
-    [SPECIES_MANTINE] = sMantineTeachableLearnset,
-    [SPECIES_SKARMORY] = sSkarmoryTeachableLearnset,
-    [SPECIES_HOUNDOUR] = sHoundourTeachableLearnset,
-    [SPECIES_HOUNDOOM] = sHoundoomTeachableLearnset,
-    [SPECIES_KINGDRA] = sKingdraTeachableLearnset,
-    [SPECIES_PHANPY] = sPhanpyTeachableLearnset,
-    [SPECIES_DONPHAN] = sDonphanTeachableLearnset,
-    [SPECIES_PORYGON2] = sPorygon2TeachableLearnset,
-    [SPECIES_STANTLER] = sStantlerTeachableLearnset,
-    [SPECIES_SMEARGLE] = sSmeargleTeachableLearnset,
-    [SPECIES_TYROGUE] = sTyrogueTeachableLearnset,
-    [SPECIES_HITMONTOP] = sHitmontopTeachableLearnset,
-    [SPECIES_SMOOCHUM] = sSmoochumTeachableLearnset,
-    [SPECIES_ELEKID] = sElekidTeachableLearnset,
-    [SPECIES_MAGBY] = sMagbyTeachableLearnset,
-    [SPECIES_MILTANK] = sMiltankTeachableLearnset,
-    [SPECIES_BLISSEY] = sBlisseyTeachableLearnset,
-    [SPECIES_RAIKOU] = sRaikouTeachableLearnset,
-    [SPECIES_ENTEI] = sEnteiTeachableLearnset,
-    [SPECIES_SUICUNE] = sSuicuneTeachableLearnset,
-    [SPECIES_LARVITAR] = sLarvitarTeachableLearnset,
-    [SPECIES_PUPITAR] = sPupitarTeachableLearnset,
-    [SPECIES_TYRANITAR] = sTyranitarTeachableLearnset,
-    [SPECIES_LUGIA] = sLugiaTeachableLearnset,
-    [SPECIES_HO_OH] = sHoOhTeachableLearnset,
-    [SPECIES_CELEBI] = sCelebiTeachableLearnset,
-    [SPECIES_TREECKO] = sTreeckoTeachableLearnset,
-    [SPECIES_GROVYLE] = sGrovyleTeachableLearnset,
-    [SPECIES_SCEPTILE] = sSceptileTeachableLearnset,
-    [SPECIES_TORCHIC] = sTorchicTeachableLearnset,
-    [SPECIES_COMBUSKEN] = sCombuskenTeachableLearnset,
-    [SPECIES_BLAZIKEN] = sBlazikenTeachableLearnset,
-    [SPECIES_MUDKIP] = sMudkipTeachableLearnset,
-    [SPECIES_MARSHTOMP] = sMarshtompTeachableLearnset,
-    [SPECIES_SWAMPERT] = sSwampertTeachableLearnset,
-    [SPECIES_POOCHYENA] = sPoochyenaTeachableLearnset,
-    [SPECIES_MIGHTYENA] = sMightyenaTeachableLearnset,
-    [SPECIES_ZIGZAGOON] = sZigzagoonTeachableLearnset,
-    [SPECIES_LINOONE] = sLinooneTeachableLearnset,
-    [SPECIES_WURMPLE] = sWurmpleTeachableLearnset,
-    [SPECIES_SILCOON] = sSilcoonTeachableLearnset,
-    [SPECIES_BEAUTIFLY] = sBeautiflyTeachableLearnset,
-    [SPECIES_CASCOON] = sCascoonTeachableLearnset,
-    [SPECIES_DUSTOX] = sDustoxTeachableLearnset,
-    [SPECIES_LOTAD] = sLotadTeachableLearnset,
-    [SPECIES_LOMBRE] = sLombreTeachableLearnset,
-    [SPECIES_LUDICOLO] = sLudicoloTeachableLearnset,
-    [SPECIES_SEEDOT] = sSeedotTeachableLearnset,
-    [SPECIES_NUZLEAF] = sNuzleafTeachableLearnset,
-    [SPECIES_SHIFTRY] = sShiftryTeachableLearnset,
-    [SPECIES_NINCADA] = sNincadaTeachableLearnset,
-    [SPECIES_NINJASK] = sNinjaskTeachableLearnset,
-    [SPECIES_SHEDINJA] = sShedinjaTeachableLearnset,
-    [SPECIES_TAILLOW] = sTaillowTeachableLearnset,
-    [SPECIES_SWELLOW] = sSwellowTeachableLearnset,
-    [SPECIES_SHROOMISH] = sShroomishTeachableLearnset,
-    [SPECIES_BRELOOM] = sBreloomTeachableLearnset,
-    [SPECIES_SPINDA] = sSpindaTeachableLearnset,
-    [SPECIES_WINGULL] = sWingullTeachableLearnset,
-    [SPECIES_PELIPPER] = sPelipperTeachableLearnset,
-    [SPECIES_SURSKIT] = sSurskitTeachableLearnset,
-    [SPECIES_MASQUERAIN] = sMasquerainTeachableLearnset,
-    [SPECIES_WAILMER] = sWailmerTeachableLearnset,
-    [SPECIES_WAILORD] = sWailordTeachableLearnset,
-    [SPECIES_SKITTY] = sSkittyTeachableLearnset,
-    [SPECIES_DELCATTY] = sDelcattyTeachableLearnset,
-    [SPECIES_KECLEON] = sKecleonTeachableLearnset,
-    [SPECIES_BALTOY] = sBaltoyTeachableLearnset,
-    [SPECIES_CLAYDOL] = sClaydolTeachableLearnset,
-    [SPECIES_NOSEPASS] = sNosepassTeachableLearnset,
-    [SPECIES_TORKOAL] = sTorkoalTeachableLearnset,
-    [SPECIES_SABLEYE] = sSableyeTeachableLearnset,
-    [SPECIES_BARBOACH] = sBarboachTeachableLearnset,
-    [SPECIES_WHISCASH] = sWhiscashTeachableLearnset,
-    [SPECIES_LUVDISC] = sLuvdiscTeachableLearnset,
-    [SPECIES_CORPHISH] = sCorphishTeachableLearnset,
-    [SPECIES_CRAWDAUNT] = sCrawdauntTeachableLearnset,
-    [SPECIES_FEEBAS] = sFeebasTeachableLearnset,
-    [SPECIES_MILOTIC] = sMiloticTeachableLearnset,
-    [SPECIES_CARVANHA] = sCarvanhaTeachableLearnset,
-    [SPECIES_SHARPEDO] = sSharpedoTeachableLearnset,
-    [SPECIES_TRAPINCH] = sTrapinchTeachableLearnset,
-    [SPECIES_VIBRAVA] = sVibravaTeachableLearnset,
-    [SPECIES_FLYGON] = sFlygonTeachableLearnset,
-    [SPECIES_MAKUHITA] = sMakuhitaTeachableLearnset,
-    [SPECIES_HARIYAMA] = sHariyamaTeachableLearnset,
-    [SPECIES_ELECTRIKE] = sElectrikeTeachableLearnset,
-    [SPECIES_MANECTRIC] = sManectricTeachableLearnset,
-    [SPECIES_NUMEL] = sNumelTeachableLearnset,
-    [SPECIES_CAMERUPT] = sCameruptTeachableLearnset,
-    [SPECIES_SPHEAL] = sSphealTeachableLearnset,
-    [SPECIES_SEALEO] = sSealeoTeachableLearnset,
-    [SPECIES_WALREIN] = sWalreinTeachableLearnset,
-    [SPECIES_CACNEA] = sCacneaTeachableLearnset,
-    [SPECIES_CACTURNE] = sCacturneTeachableLearnset,
-    [SPECIES_SNORUNT] = sSnoruntTeachableLearnset,
-    [SPECIES_GLALIE] = sGlalieTeachableLearnset,
-    [SPECIES_LUNATONE] = sLunatoneTeachableLearnset,
-    [SPECIES_SOLROCK] = sSolrockTeachableLearnset,
-    [SPECIES_AZURILL] = sAzurillTeachableLearnset,
-    [SPECIES_SPOINK] = sSpoinkTeachableLearnset,
-    [SPECIES_GRUMPIG] = sGrumpigTeachableLearnset,
-    [SPECIES_PLUSLE] = sPlusleTeachableLearnset,
-    [SPECIES_MINUN] = sMinunTeachableLearnset,
-    [SPECIES_MAWILE] = sMawileTeachableLearnset,
-    [SPECIES_MEDITITE] = sMedititeTeachableLearnset,
-    [SPECIES_MEDICHAM] = sMedichamTeachableLearnset,
-    [SPECIES_SWABLU] = sSwabluTeachableLearnset,
-    [SPECIES_ALTARIA] = sAltariaTeachableLearnset,
-    [SPECIES_WYNAUT] = sWynautTeachableLearnset,
-    [SPECIES_DUSKULL] = sDuskullTeachableLearnset,
-    [SPECIES_DUSCLOPS] = sDusclopsTeachableLearnset,
-    [SPECIES_ROSELIA] = sRoseliaTeachableLearnset,
-    [SPECIES_SLAKOTH] = sSlakothTeachableLearnset,
-    [SPECIES_VIGOROTH] = sVigorothTeachableLearnset,
-    [SPECIES_SLAKING] = sSlakingTeachableLearnset,
-    [SPECIES_GULPIN] = sGulpinTeachableLearnset,
-    [SPECIES_SWALOT] = sSwalotTeachableLearnset,
-    [SPECIES_TROPIUS] = sTropiusTeachableLearnset,
-    [SPECIES_WHISMUR] = sWhismurTeachableLearnset,
-    [SPECIES_LOUDRED] = sLoudredTeachableLearnset,
-    [SPECIES_EXPLOUD] = sExploudTeachableLearnset,
-    [SPECIES_CLAMPERL] = sClamperlTeachableLearnset,
-    [SPECIES_HUNTAIL] = sHuntailTeachableLearnset,
-    [SPECIES_GOREBYSS] = sGorebyssTeachableLearnset,
-    [SPECIES_ABSOL] = sAbsolTeachableLearnset,
-    [SPECIES_SHUPPET] = sShuppetTeachableLearnset,
-    [SPECIES_BANETTE] = sBanetteTeachableLearnset,
-    [SPECIES_SEVIPER] = sSeviperTeachableLearnset,
-    [SPECIES_ZANGOOSE] = sZangooseTeachableLearnset,
-    [SPECIES_RELICANTH] = sRelicanthTeachableLearnset,
-    [SPECIES_ARON] = sAronTeachableLearnset,
-    [SPECIES_LAIRON] = sLaironTeachableLearnset,
-    [SPECIES_AGGRON] = sAggronTeachableLearnset,
-    [SPECIES_CASTFORM] = sCastformTeachableLearnset,
-    [SPECIES_VOLBEAT] = sVolbeatTeachableLearnset,
-    [SPECIES_ILLUMISE] = sIllumiseTeachableLearnset,
-    [SPECIES_LILEEP] = sLileepTeachableLearnset,
-    [SPECIES_CRADILY] = sCradilyTeachableLearnset,
-    [SPECIES_ANORITH] = sAnorithTeachableLearnset,
-    [SPECIES_ARMALDO] = sArmaldoTeachableLearnset,
-    [SPECIES_RALTS] = sRaltsTeachableLearnset,
-    [SPECIES_KIRLIA] = sKirliaTeachableLearnset,
-    [SPECIES_GARDEVOIR] = sGardevoirTeachableLearnset,
-    [SPECIES_BAGON] = sBagonTeachableLearnset,
-    [SPECIES_SHELGON] = sShelgonTeachableLearnset,
-    [SPECIES_SALAMENCE] = sSalamenceTeachableLearnset,
-    [SPECIES_BELDUM] = sBeldumTeachableLearnset,
-    [SPECIES_METANG] = sMetangTeachableLearnset,
-    [SPECIES_METAGROSS] = sMetagrossTeachableLearnset,
-    [SPECIES_REGIROCK] = sRegirockTeachableLearnset,
-    [SPECIES_REGICE] = sRegiceTeachableLearnset,
-    [SPECIES_REGISTEEL] = sRegisteelTeachableLearnset,
-    [SPECIES_KYOGRE] = sKyogreTeachableLearnset,
-    [SPECIES_GROUDON] = sGroudonTeachableLearnset,
-    [SPECIES_RAYQUAZA] = sRayquazaTeachableLearnset,
-    [SPECIES_LATIAS] = sLatiasTeachableLearnset,
-    [SPECIES_LATIOS] = sLatiosTeachableLearnset,
-    [SPECIES_JIRACHI] = sJirachiTeachableLearnset,
-    [SPECIES_DEOXYS] = sDeoxysTeachableLearnset,
-    [SPECIES_CHIMECHO] = sChimechoTeachableLearnset,
+    [SPECIES_NONE] = TEACHABLE_LEARNSET(sBulbasaurTeachableLearnset),
+    [SPECIES_BULBASAUR] = TEACHABLE_LEARNSET(sBulbasaurTeachableLearnset),
+    [SPECIES_IVYSAUR] = TEACHABLE_LEARNSET(sIvysaurTeachableLearnset),
+    [SPECIES_VENUSAUR] = TEACHABLE_LEARNSET(sVenusaurTeachableLearnset),
+    [SPECIES_CHARMANDER] = TEACHABLE_LEARNSET(sCharmanderTeachableLearnset),
+    [SPECIES_CHARMELEON] = TEACHABLE_LEARNSET(sCharmeleonTeachableLearnset),
+    [SPECIES_CHARIZARD] = TEACHABLE_LEARNSET(sCharizardTeachableLearnset),
+    [SPECIES_SQUIRTLE] = TEACHABLE_LEARNSET(sSquirtleTeachableLearnset),
+    [SPECIES_WARTORTLE] = TEACHABLE_LEARNSET(sWartortleTeachableLearnset),
+    [SPECIES_BLASTOISE] = TEACHABLE_LEARNSET(sBlastoiseTeachableLearnset),
+    [SPECIES_CATERPIE] = TEACHABLE_LEARNSET(sCaterpieTeachableLearnset),
+    [SPECIES_METAPOD] = TEACHABLE_LEARNSET(sMetapodTeachableLearnset),
+    [SPECIES_BUTTERFREE] = TEACHABLE_LEARNSET(sButterfreeTeachableLearnset),
+    [SPECIES_WEEDLE] = TEACHABLE_LEARNSET(sWeedleTeachableLearnset),
+    [SPECIES_KAKUNA] = TEACHABLE_LEARNSET(sKakunaTeachableLearnset),
+    [SPECIES_BEEDRILL] = TEACHABLE_LEARNSET(sBeedrillTeachableLearnset),
+    [SPECIES_PIDGEY] = TEACHABLE_LEARNSET(sPidgeyTeachableLearnset),
+    [SPECIES_PIDGEOTTO] = TEACHABLE_LEARNSET(sPidgeottoTeachableLearnset),
+    [SPECIES_PIDGEOT] = TEACHABLE_LEARNSET(sPidgeotTeachableLearnset),
+    [SPECIES_RATTATA] = TEACHABLE_LEARNSET(sRattataTeachableLearnset),
+    [SPECIES_RATICATE] = TEACHABLE_LEARNSET(sRaticateTeachableLearnset),
+    [SPECIES_SPEAROW] = TEACHABLE_LEARNSET(sSpearowTeachableLearnset),
+    [SPECIES_FEAROW] = TEACHABLE_LEARNSET(sFearowTeachableLearnset),
+    [SPECIES_EKANS] = TEACHABLE_LEARNSET(sEkansTeachableLearnset),
+    [SPECIES_ARBOK] = TEACHABLE_LEARNSET(sArbokTeachableLearnset),
+    [SPECIES_PIKACHU] = TEACHABLE_LEARNSET(sPikachuTeachableLearnset),
+    [SPECIES_RAICHU] = TEACHABLE_LEARNSET(sRaichuTeachableLearnset),
+    [SPECIES_SANDSHREW] = TEACHABLE_LEARNSET(sSandshrewTeachableLearnset),
+    [SPECIES_SANDSLASH] = TEACHABLE_LEARNSET(sSandslashTeachableLearnset),
+    [SPECIES_NIDORAN_F] = TEACHABLE_LEARNSET(sNidoranFTeachableLearnset),
+    [SPECIES_NIDORINA] = TEACHABLE_LEARNSET(sNidorinaTeachableLearnset),
+    [SPECIES_NIDOQUEEN] = TEACHABLE_LEARNSET(sNidoqueenTeachableLearnset),
+    [SPECIES_NIDORAN_M] = TEACHABLE_LEARNSET(sNidoranMTeachableLearnset),
+    [SPECIES_NIDORINO] = TEACHABLE_LEARNSET(sNidorinoTeachableLearnset),
+    [SPECIES_NIDOKING] = TEACHABLE_LEARNSET(sNidokingTeachableLearnset),
+    [SPECIES_CLEFAIRY] = TEACHABLE_LEARNSET(sClefairyTeachableLearnset),
+    [SPECIES_CLEFABLE] = TEACHABLE_LEARNSET(sClefableTeachableLearnset),
+    [SPECIES_VULPIX] = TEACHABLE_LEARNSET(sVulpixTeachableLearnset),
+    [SPECIES_NINETALES] = TEACHABLE_LEARNSET(sNinetalesTeachableLearnset),
+    [SPECIES_JIGGLYPUFF] = TEACHABLE_LEARNSET(sJigglypuffTeachableLearnset),
+    [SPECIES_WIGGLYTUFF] = TEACHABLE_LEARNSET(sWigglytuffTeachableLearnset),
+    [SPECIES_ZUBAT] = TEACHABLE_LEARNSET(sZubatTeachableLearnset),
+    [SPECIES_GOLBAT] = TEACHABLE_LEARNSET(sGolbatTeachableLearnset),
+    [SPECIES_ODDISH] = TEACHABLE_LEARNSET(sOddishTeachableLearnset),
+    [SPECIES_GLOOM] = TEACHABLE_LEARNSET(sGloomTeachableLearnset),
+    [SPECIES_VILEPLUME] = TEACHABLE_LEARNSET(sVileplumeTeachableLearnset),
+    [SPECIES_PARAS] = TEACHABLE_LEARNSET(sParasTeachableLearnset),
+    [SPECIES_PARASECT] = TEACHABLE_LEARNSET(sParasectTeachableLearnset),
+    [SPECIES_VENONAT] = TEACHABLE_LEARNSET(sVenonatTeachableLearnset),
+    [SPECIES_VENOMOTH] = TEACHABLE_LEARNSET(sVenomothTeachableLearnset),
+    [SPECIES_DIGLETT] = TEACHABLE_LEARNSET(sDiglettTeachableLearnset),
+    [SPECIES_DUGTRIO] = TEACHABLE_LEARNSET(sDugtrioTeachableLearnset),
+    [SPECIES_MEOWTH] = TEACHABLE_LEARNSET(sMeowthTeachableLearnset),
+    [SPECIES_PERSIAN] = TEACHABLE_LEARNSET(sPersianTeachableLearnset),
+    [SPECIES_PSYDUCK] = TEACHABLE_LEARNSET(sPsyduckTeachableLearnset),
+    [SPECIES_GOLDUCK] = TEACHABLE_LEARNSET(sGolduckTeachableLearnset),
+    [SPECIES_MANKEY] = TEACHABLE_LEARNSET(sMankeyTeachableLearnset),
+    [SPECIES_PRIMEAPE] = TEACHABLE_LEARNSET(sPrimeapeTeachableLearnset),
+    [SPECIES_GROWLITHE] = TEACHABLE_LEARNSET(sGrowlitheTeachableLearnset),
+    [SPECIES_ARCANINE] = TEACHABLE_LEARNSET(sArcanineTeachableLearnset),
+    [SPECIES_POLIWAG] = TEACHABLE_LEARNSET(sPoliwagTeachableLearnset),
+    [SPECIES_POLIWHIRL] = TEACHABLE_LEARNSET(sPoliwhirlTeachableLearnset),
+    [SPECIES_POLIWRATH] = TEACHABLE_LEARNSET(sPoliwrathTeachableLearnset),
+    [SPECIES_ABRA] = TEACHABLE_LEARNSET(sAbraTeachableLearnset),
+    [SPECIES_KADABRA] = TEACHABLE_LEARNSET(sKadabraTeachableLearnset),
+    [SPECIES_ALAKAZAM] = TEACHABLE_LEARNSET(sAlakazamTeachableLearnset),
+    [SPECIES_MACHOP] = TEACHABLE_LEARNSET(sMachopTeachableLearnset),
+    [SPECIES_MACHOKE] = TEACHABLE_LEARNSET(sMachokeTeachableLearnset),
+    [SPECIES_MACHAMP] = TEACHABLE_LEARNSET(sMachampTeachableLearnset),
+    [SPECIES_BELLSPROUT] = TEACHABLE_LEARNSET(sBellsproutTeachableLearnset),
+    [SPECIES_WEEPINBELL] = TEACHABLE_LEARNSET(sWeepinbellTeachableLearnset),
+    [SPECIES_VICTREEBEL] = TEACHABLE_LEARNSET(sVictreebelTeachableLearnset),
+    [SPECIES_TENTACOOL] = TEACHABLE_LEARNSET(sTentacoolTeachableLearnset),
+    [SPECIES_TENTACRUEL] = TEACHABLE_LEARNSET(sTentacruelTeachableLearnset),
+    [SPECIES_GEODUDE] = TEACHABLE_LEARNSET(sGeodudeTeachableLearnset),
+    [SPECIES_GRAVELER] = TEACHABLE_LEARNSET(sGravelerTeachableLearnset),
+    [SPECIES_GOLEM] = TEACHABLE_LEARNSET(sGolemTeachableLearnset),
+    [SPECIES_PONYTA] = TEACHABLE_LEARNSET(sPonytaTeachableLearnset),
+    [SPECIES_RAPIDASH] = TEACHABLE_LEARNSET(sRapidashTeachableLearnset),
+    [SPECIES_SLOWPOKE] = TEACHABLE_LEARNSET(sSlowpokeTeachableLearnset),
+    [SPECIES_SLOWBRO] = TEACHABLE_LEARNSET(sSlowbroTeachableLearnset),
+    [SPECIES_MAGNEMITE] = TEACHABLE_LEARNSET(sMagnemiteTeachableLearnset),
+    [SPECIES_MAGNETON] = TEACHABLE_LEARNSET(sMagnetonTeachableLearnset),
+    [SPECIES_FARFETCHD] = TEACHABLE_LEARNSET(sFarfetchdTeachableLearnset),
+    [SPECIES_DODUO] = TEACHABLE_LEARNSET(sDoduoTeachableLearnset),
+    [SPECIES_DODRIO] = TEACHABLE_LEARNSET(sDodrioTeachableLearnset),
+    [SPECIES_SEEL] = TEACHABLE_LEARNSET(sSeelTeachableLearnset),
+    [SPECIES_DEWGONG] = TEACHABLE_LEARNSET(sDewgongTeachableLearnset),
+    [SPECIES_GRIMER] = TEACHABLE_LEARNSET(sGrimerTeachableLearnset),
+    [SPECIES_MUK] = TEACHABLE_LEARNSET(sMukTeachableLearnset),
+    [SPECIES_SHELLDER] = TEACHABLE_LEARNSET(sShellderTeachableLearnset),
+    [SPECIES_CLOYSTER] = TEACHABLE_LEARNSET(sCloysterTeachableLearnset),
+    [SPECIES_GASTLY] = TEACHABLE_LEARNSET(sGastlyTeachableLearnset),
+    [SPECIES_HAUNTER] = TEACHABLE_LEARNSET(sHaunterTeachableLearnset),
+    [SPECIES_GENGAR] = TEACHABLE_LEARNSET(sGengarTeachableLearnset),
+    [SPECIES_ONIX] = TEACHABLE_LEARNSET(sOnixTeachableLearnset),
+    [SPECIES_DROWZEE] = TEACHABLE_LEARNSET(sDrowzeeTeachableLearnset),
+    [SPECIES_HYPNO] = TEACHABLE_LEARNSET(sHypnoTeachableLearnset),
+    [SPECIES_KRABBY] = TEACHABLE_LEARNSET(sKrabbyTeachableLearnset),
+    [SPECIES_KINGLER] = TEACHABLE_LEARNSET(sKinglerTeachableLearnset),
+    [SPECIES_VOLTORB] = TEACHABLE_LEARNSET(sVoltorbTeachableLearnset),
+    [SPECIES_ELECTRODE] = TEACHABLE_LEARNSET(sElectrodeTeachableLearnset),
+    [SPECIES_EXEGGCUTE] = TEACHABLE_LEARNSET(sExeggcuteTeachableLearnset),
+    [SPECIES_EXEGGUTOR] = TEACHABLE_LEARNSET(sExeggutorTeachableLearnset),
+    [SPECIES_CUBONE] = TEACHABLE_LEARNSET(sCuboneTeachableLearnset),
+    [SPECIES_MAROWAK] = TEACHABLE_LEARNSET(sMarowakTeachableLearnset),
+    [SPECIES_HITMONLEE] = TEACHABLE_LEARNSET(sHitmonleeTeachableLearnset),
+    [SPECIES_HITMONCHAN] = TEACHABLE_LEARNSET(sHitmonchanTeachableLearnset),
+    [SPECIES_LICKITUNG] = TEACHABLE_LEARNSET(sLickitungTeachableLearnset),
+    [SPECIES_KOFFING] = TEACHABLE_LEARNSET(sKoffingTeachableLearnset),
+    [SPECIES_WEEZING] = TEACHABLE_LEARNSET(sWeezingTeachableLearnset),
+    [SPECIES_RHYHORN] = TEACHABLE_LEARNSET(sRhyhornTeachableLearnset),
+    [SPECIES_RHYDON] = TEACHABLE_LEARNSET(sRhydonTeachableLearnset),
+    [SPECIES_CHANSEY] = TEACHABLE_LEARNSET(sChanseyTeachableLearnset),
+    [SPECIES_TANGELA] = TEACHABLE_LEARNSET(sTangelaTeachableLearnset),
+    [SPECIES_KANGASKHAN] = TEACHABLE_LEARNSET(sKangaskhanTeachableLearnset),
+    [SPECIES_HORSEA] = TEACHABLE_LEARNSET(sHorseaTeachableLearnset),
+    [SPECIES_SEADRA] = TEACHABLE_LEARNSET(sSeadraTeachableLearnset),
+    [SPECIES_GOLDEEN] = TEACHABLE_LEARNSET(sGoldeenTeachableLearnset),
+    [SPECIES_SEAKING] = TEACHABLE_LEARNSET(sSeakingTeachableLearnset),
+    [SPECIES_STARYU] = TEACHABLE_LEARNSET(sStaryuTeachableLearnset),
+    [SPECIES_STARMIE] = TEACHABLE_LEARNSET(sStarmieTeachableLearnset),
+    [SPECIES_MR_MIME] = TEACHABLE_LEARNSET(sMrMimeTeachableLearnset),
+    [SPECIES_SCYTHER] = TEACHABLE_LEARNSET(sScytherTeachableLearnset),
+    [SPECIES_JYNX] = TEACHABLE_LEARNSET(sJynxTeachableLearnset),
+    [SPECIES_ELECTABUZZ] = TEACHABLE_LEARNSET(sElectabuzzTeachableLearnset),
+    [SPECIES_MAGMAR] = TEACHABLE_LEARNSET(sMagmarTeachableLearnset),
+    [SPECIES_PINSIR] = TEACHABLE_LEARNSET(sPinsirTeachableLearnset),
+    [SPECIES_TAUROS] = TEACHABLE_LEARNSET(sTaurosTeachableLearnset),
+    [SPECIES_MAGIKARP] = TEACHABLE_LEARNSET(sMagikarpTeachableLearnset),
+    [SPECIES_GYARADOS] = TEACHABLE_LEARNSET(sGyaradosTeachableLearnset),
+    [SPECIES_LAPRAS] = TEACHABLE_LEARNSET(sLaprasTeachableLearnset),
+    [SPECIES_DITTO] = TEACHABLE_LEARNSET(sDittoTeachableLearnset),
+    [SPECIES_EEVEE] = TEACHABLE_LEARNSET(sEeveeTeachableLearnset),
+    [SPECIES_VAPOREON] = TEACHABLE_LEARNSET(sVaporeonTeachableLearnset),
+    [SPECIES_JOLTEON] = TEACHABLE_LEARNSET(sJolteonTeachableLearnset),
+    [SPECIES_FLAREON] = TEACHABLE_LEARNSET(sFlareonTeachableLearnset),
+    [SPECIES_PORYGON] = TEACHABLE_LEARNSET(sPorygonTeachableLearnset),
+    [SPECIES_OMANYTE] = TEACHABLE_LEARNSET(sOmanyteTeachableLearnset),
+    [SPECIES_OMASTAR] = TEACHABLE_LEARNSET(sOmastarTeachableLearnset),
+    [SPECIES_KABUTO] = TEACHABLE_LEARNSET(sKabutoTeachableLearnset),
+    [SPECIES_KABUTOPS] = TEACHABLE_LEARNSET(sKabutopsTeachableLearnset),
+    [SPECIES_AERODACTYL] = TEACHABLE_LEARNSET(sAerodactylTeachableLearnset),
+    [SPECIES_SNORLAX] = TEACHABLE_LEARNSET(sSnorlaxTeachableLearnset),
+    [SPECIES_ARTICUNO] = TEACHABLE_LEARNSET(sArticunoTeachableLearnset),
+    [SPECIES_ZAPDOS] = TEACHABLE_LEARNSET(sZapdosTeachableLearnset),
+    [SPECIES_MOLTRES] = TEACHABLE_LEARNSET(sMoltresTeachableLearnset),
+    [SPECIES_DRATINI] = TEACHABLE_LEARNSET(sDratiniTeachableLearnset),
+    [SPECIES_DRAGONAIR] = TEACHABLE_LEARNSET(sDragonairTeachableLearnset),
+    [SPECIES_DRAGONITE] = TEACHABLE_LEARNSET(sDragoniteTeachableLearnset),
+    [SPECIES_MEWTWO] = TEACHABLE_LEARNSET(sMewtwoTeachableLearnset),
+    [SPECIES_MEW] = TEACHABLE_LEARNSET(sMewTeachableLearnset),
+    [SPECIES_CHIKORITA] = TEACHABLE_LEARNSET(sChikoritaTeachableLearnset),
+    [SPECIES_BAYLEEF] = TEACHABLE_LEARNSET(sBayleefTeachableLearnset),
+    [SPECIES_MEGANIUM] = TEACHABLE_LEARNSET(sMeganiumTeachableLearnset),
+    [SPECIES_CYNDAQUIL] = TEACHABLE_LEARNSET(sCyndaquilTeachableLearnset),
+    [SPECIES_QUILAVA] = TEACHABLE_LEARNSET(sQuilavaTeachableLearnset),
+    [SPECIES_TYPHLOSION] = TEACHABLE_LEARNSET(sTyphlosionTeachableLearnset),
+    [SPECIES_TOTODILE] = TEACHABLE_LEARNSET(sTotodileTeachableLearnset),
+    [SPECIES_CROCONAW] = TEACHABLE_LEARNSET(sCroconawTeachableLearnset),
+    [SPECIES_FERALIGATR] = TEACHABLE_LEARNSET(sFeraligatrTeachableLearnset),
+    [SPECIES_SENTRET] = TEACHABLE_LEARNSET(sSentretTeachableLearnset),
+    [SPECIES_FURRET] = TEACHABLE_LEARNSET(sFurretTeachableLearnset),
+    [SPECIES_HOOTHOOT] = TEACHABLE_LEARNSET(sHoothootTeachableLearnset),
+    [SPECIES_NOCTOWL] = TEACHABLE_LEARNSET(sNoctowlTeachableLearnset),
+    [SPECIES_LEDYBA] = TEACHABLE_LEARNSET(sLedybaTeachableLearnset),
+    [SPECIES_LEDIAN] = TEACHABLE_LEARNSET(sLedianTeachableLearnset),
+    [SPECIES_SPINARAK] = TEACHABLE_LEARNSET(sSpinarakTeachableLearnset),
+    [SPECIES_ARIADOS] = TEACHABLE_LEARNSET(sAriadosTeachableLearnset),
+    [SPECIES_CROBAT] = TEACHABLE_LEARNSET(sCrobatTeachableLearnset),
+    [SPECIES_CHINCHOU] = TEACHABLE_LEARNSET(sChinchouTeachableLearnset),
+    [SPECIES_LANTURN] = TEACHABLE_LEARNSET(sLanturnTeachableLearnset),
+    [SPECIES_PICHU] = TEACHABLE_LEARNSET(sPichuTeachableLearnset),
+    [SPECIES_CLEFFA] = TEACHABLE_LEARNSET(sCleffaTeachableLearnset),
+    [SPECIES_IGGLYBUFF] = TEACHABLE_LEARNSET(sIgglybuffTeachableLearnset),
+    [SPECIES_TOGEPI] = TEACHABLE_LEARNSET(sTogepiTeachableLearnset),
+    [SPECIES_TOGETIC] = TEACHABLE_LEARNSET(sTogeticTeachableLearnset),
+    [SPECIES_NATU] = TEACHABLE_LEARNSET(sNatuTeachableLearnset),
+    [SPECIES_XATU] = TEACHABLE_LEARNSET(sXatuTeachableLearnset),
+    [SPECIES_MAREEP] = TEACHABLE_LEARNSET(sMareepTeachableLearnset),
+    [SPECIES_FLAAFFY] = TEACHABLE_LEARNSET(sFlaaffyTeachableLearnset),
+    [SPECIES_AMPHAROS] = TEACHABLE_LEARNSET(sAmpharosTeachableLearnset),
+    [SPECIES_BELLOSSOM] = TEACHABLE_LEARNSET(sBellossomTeachableLearnset),
+    [SPECIES_MARILL] = TEACHABLE_LEARNSET(sMarillTeachableLearnset),
+    [SPECIES_AZUMARILL] = TEACHABLE_LEARNSET(sAzumarillTeachableLearnset),
+    [SPECIES_SUDOWOODO] = TEACHABLE_LEARNSET(sSudowoodoTeachableLearnset),
+    [SPECIES_POLITOED] = TEACHABLE_LEARNSET(sPolitoedTeachableLearnset),
+    [SPECIES_HOPPIP] = TEACHABLE_LEARNSET(sHoppipTeachableLearnset),
+    [SPECIES_SKIPLOOM] = TEACHABLE_LEARNSET(sSkiploomTeachableLearnset),
+    [SPECIES_JUMPLUFF] = TEACHABLE_LEARNSET(sJumpluffTeachableLearnset),
+    [SPECIES_AIPOM] = TEACHABLE_LEARNSET(sAipomTeachableLearnset),
+    [SPECIES_SUNKERN] = TEACHABLE_LEARNSET(sSunkernTeachableLearnset),
+    [SPECIES_SUNFLORA] = TEACHABLE_LEARNSET(sSunfloraTeachableLearnset),
+    [SPECIES_YANMA] = TEACHABLE_LEARNSET(sYanmaTeachableLearnset),
+    [SPECIES_WOOPER] = TEACHABLE_LEARNSET(sWooperTeachableLearnset),
+    [SPECIES_QUAGSIRE] = TEACHABLE_LEARNSET(sQuagsireTeachableLearnset),
+    [SPECIES_ESPEON] = TEACHABLE_LEARNSET(sEspeonTeachableLearnset),
+    [SPECIES_UMBREON] = TEACHABLE_LEARNSET(sUmbreonTeachableLearnset),
+    [SPECIES_MURKROW] = TEACHABLE_LEARNSET(sMurkrowTeachableLearnset),
+    [SPECIES_SLOWKING] = TEACHABLE_LEARNSET(sSlowkingTeachableLearnset),
+    [SPECIES_MISDREAVUS] = TEACHABLE_LEARNSET(sMisdreavusTeachableLearnset),
+    [SPECIES_UNOWN] = TEACHABLE_LEARNSET(sUnownTeachableLearnset),
+    [SPECIES_WOBBUFFET] = TEACHABLE_LEARNSET(sWobbuffetTeachableLearnset),
+    [SPECIES_GIRAFARIG] = TEACHABLE_LEARNSET(sGirafarigTeachableLearnset),
+    [SPECIES_PINECO] = TEACHABLE_LEARNSET(sPinecoTeachableLearnset),
+    [SPECIES_FORRETRESS] = TEACHABLE_LEARNSET(sForretressTeachableLearnset),
+    [SPECIES_DUNSPARCE] = TEACHABLE_LEARNSET(sDunsparceTeachableLearnset),
+    [SPECIES_GLIGAR] = TEACHABLE_LEARNSET(sGligarTeachableLearnset),
+    [SPECIES_STEELIX] = TEACHABLE_LEARNSET(sSteelixTeachableLearnset),
+    [SPECIES_SNUBBULL] = TEACHABLE_LEARNSET(sSnubbullTeachableLearnset),
+    [SPECIES_GRANBULL] = TEACHABLE_LEARNSET(sGranbullTeachableLearnset),
+    [SPECIES_QWILFISH] = TEACHABLE_LEARNSET(sQwilfishTeachableLearnset),
+    [SPECIES_SCIZOR] = TEACHABLE_LEARNSET(sScizorTeachableLearnset),
+    [SPECIES_SHUCKLE] = TEACHABLE_LEARNSET(sShuckleTeachableLearnset),
+    [SPECIES_HERACROSS] = TEACHABLE_LEARNSET(sHeracrossTeachableLearnset),
+    [SPECIES_SNEASEL] = TEACHABLE_LEARNSET(sSneaselTeachableLearnset),
+    [SPECIES_TEDDIURSA] = TEACHABLE_LEARNSET(sTeddiursaTeachableLearnset),
+    [SPECIES_URSARING] = TEACHABLE_LEARNSET(sUrsaringTeachableLearnset),
+    [SPECIES_SLUGMA] = TEACHABLE_LEARNSET(sSlugmaTeachableLearnset),
+    [SPECIES_MAGCARGO] = TEACHABLE_LEARNSET(sMagcargoTeachableLearnset),
+    [SPECIES_SWINUB] = TEACHABLE_LEARNSET(sSwinubTeachableLearnset),
+    [SPECIES_PILOSWINE] = TEACHABLE_LEARNSET(sPiloswineTeachableLearnset),
+    [SPECIES_CORSOLA] = TEACHABLE_LEARNSET(sCorsolaTeachableLearnset),
+    [SPECIES_REMORAID] = TEACHABLE_LEARNSET(sRemoraidTeachableLearnset),
+    [SPECIES_OCTILLERY] = TEACHABLE_LEARNSET(sOctilleryTeachableLearnset),
+    [SPECIES_DELIBIRD] = TEACHABLE_LEARNSET(sDelibirdTeachableLearnset),
+    [SPECIES_MANTINE] = TEACHABLE_LEARNSET(sMantineTeachableLearnset),
+    [SPECIES_SKARMORY] = TEACHABLE_LEARNSET(sSkarmoryTeachableLearnset),
+    [SPECIES_HOUNDOUR] = TEACHABLE_LEARNSET(sHoundourTeachableLearnset),
+    [SPECIES_HOUNDOOM] = TEACHABLE_LEARNSET(sHoundoomTeachableLearnset),
+    [SPECIES_KINGDRA] = TEACHABLE_LEARNSET(sKingdraTeachableLearnset),
+    [SPECIES_PHANPY] = TEACHABLE_LEARNSET(sPhanpyTeachableLearnset),
+    [SPECIES_DONPHAN] = TEACHABLE_LEARNSET(sDonphanTeachableLearnset),
+    [SPECIES_PORYGON2] = TEACHABLE_LEARNSET(sPorygon2TeachableLearnset),
+    [SPECIES_STANTLER] = TEACHABLE_LEARNSET(sStantlerTeachableLearnset),
+    [SPECIES_SMEARGLE] = TEACHABLE_LEARNSET(sSmeargleTeachableLearnset),
+    [SPECIES_TYROGUE] = TEACHABLE_LEARNSET(sTyrogueTeachableLearnset),
+    [SPECIES_HITMONTOP] = TEACHABLE_LEARNSET(sHitmontopTeachableLearnset),
+    [SPECIES_SMOOCHUM] = TEACHABLE_LEARNSET(sSmoochumTeachableLearnset),
+    [SPECIES_ELEKID] = TEACHABLE_LEARNSET(sElekidTeachableLearnset),
+    [SPECIES_MAGBY] = TEACHABLE_LEARNSET(sMagbyTeachableLearnset),
+    [SPECIES_MILTANK] = TEACHABLE_LEARNSET(sMiltankTeachableLearnset),
+    [SPECIES_BLISSEY] = TEACHABLE_LEARNSET(sBlisseyTeachableLearnset),
+    [SPECIES_RAIKOU] = TEACHABLE_LEARNSET(sRaikouTeachableLearnset),
+    [SPECIES_ENTEI] = TEACHABLE_LEARNSET(sEnteiTeachableLearnset),
+    [SPECIES_SUICUNE] = TEACHABLE_LEARNSET(sSuicuneTeachableLearnset),
+    [SPECIES_LARVITAR] = TEACHABLE_LEARNSET(sLarvitarTeachableLearnset),
+    [SPECIES_PUPITAR] = TEACHABLE_LEARNSET(sPupitarTeachableLearnset),
+    [SPECIES_TYRANITAR] = TEACHABLE_LEARNSET(sTyranitarTeachableLearnset),
+    [SPECIES_LUGIA] = TEACHABLE_LEARNSET(sLugiaTeachableLearnset),
+    [SPECIES_HO_OH] = TEACHABLE_LEARNSET(sHoOhTeachableLearnset),
+    [SPECIES_CELEBI] = TEACHABLE_LEARNSET(sCelebiTeachableLearnset),
+    [SPECIES_TREECKO] = TEACHABLE_LEARNSET(sTreeckoTeachableLearnset),
+    [SPECIES_GROVYLE] = TEACHABLE_LEARNSET(sGrovyleTeachableLearnset),
+    [SPECIES_SCEPTILE] = TEACHABLE_LEARNSET(sSceptileTeachableLearnset),
+    [SPECIES_TORCHIC] = TEACHABLE_LEARNSET(sTorchicTeachableLearnset),
+    [SPECIES_COMBUSKEN] = TEACHABLE_LEARNSET(sCombuskenTeachableLearnset),
+    [SPECIES_BLAZIKEN] = TEACHABLE_LEARNSET(sBlazikenTeachableLearnset),
+    [SPECIES_MUDKIP] = TEACHABLE_LEARNSET(sMudkipTeachableLearnset),
+    [SPECIES_MARSHTOMP] = TEACHABLE_LEARNSET(sMarshtompTeachableLearnset),
+    [SPECIES_SWAMPERT] = TEACHABLE_LEARNSET(sSwampertTeachableLearnset),
+    [SPECIES_POOCHYENA] = TEACHABLE_LEARNSET(sPoochyenaTeachableLearnset),
+    [SPECIES_MIGHTYENA] = TEACHABLE_LEARNSET(sMightyenaTeachableLearnset),
+    [SPECIES_ZIGZAGOON] = TEACHABLE_LEARNSET(sZigzagoonTeachableLearnset),
+    [SPECIES_LINOONE] = TEACHABLE_LEARNSET(sLinooneTeachableLearnset),
+    [SPECIES_WURMPLE] = TEACHABLE_LEARNSET(sWurmpleTeachableLearnset),
+    [SPECIES_SILCOON] = TEACHABLE_LEARNSET(sSilcoonTeachableLearnset),
+    [SPECIES_BEAUTIFLY] = TEACHABLE_LEARNSET(sBeautiflyTeachableLearnset),
+    [SPECIES_CASCOON] = TEACHABLE_LEARNSET(sCascoonTeachableLearnset),
+    [SPECIES_DUSTOX] = TEACHABLE_LEARNSET(sDustoxTeachableLearnset),
+    [SPECIES_LOTAD] = TEACHABLE_LEARNSET(sLotadTeachableLearnset),
+    [SPECIES_LOMBRE] = TEACHABLE_LEARNSET(sLombreTeachableLearnset),
+    [SPECIES_LUDICOLO] = TEACHABLE_LEARNSET(sLudicoloTeachableLearnset),
+    [SPECIES_SEEDOT] = TEACHABLE_LEARNSET(sSeedotTeachableLearnset),
+    [SPECIES_NUZLEAF] = TEACHABLE_LEARNSET(sNuzleafTeachableLearnset),
+    [SPECIES_SHIFTRY] = TEACHABLE_LEARNSET(sShiftryTeachableLearnset),
+    [SPECIES_NINCADA] = TEACHABLE_LEARNSET(sNincadaTeachableLearnset),
+    [SPECIES_NINJASK] = TEACHABLE_LEARNSET(sNinjaskTeachableLearnset),
+    [SPECIES_SHEDINJA] = TEACHABLE_LEARNSET(sShedinjaTeachableLearnset),
+    [SPECIES_TAILLOW] = TEACHABLE_LEARNSET(sTaillowTeachableLearnset),
+    [SPECIES_SWELLOW] = TEACHABLE_LEARNSET(sSwellowTeachableLearnset),
+    [SPECIES_SHROOMISH] = TEACHABLE_LEARNSET(sShroomishTeachableLearnset),
+    [SPECIES_BRELOOM] = TEACHABLE_LEARNSET(sBreloomTeachableLearnset),
+    [SPECIES_SPINDA] = TEACHABLE_LEARNSET(sSpindaTeachableLearnset),
+    [SPECIES_WINGULL] = TEACHABLE_LEARNSET(sWingullTeachableLearnset),
+    [SPECIES_PELIPPER] = TEACHABLE_LEARNSET(sPelipperTeachableLearnset),
+    [SPECIES_SURSKIT] = TEACHABLE_LEARNSET(sSurskitTeachableLearnset),
+    [SPECIES_MASQUERAIN] = TEACHABLE_LEARNSET(sMasquerainTeachableLearnset),
+    [SPECIES_WAILMER] = TEACHABLE_LEARNSET(sWailmerTeachableLearnset),
+    [SPECIES_WAILORD] = TEACHABLE_LEARNSET(sWailordTeachableLearnset),
+    [SPECIES_SKITTY] = TEACHABLE_LEARNSET(sSkittyTeachableLearnset),
+    [SPECIES_DELCATTY] = TEACHABLE_LEARNSET(sDelcattyTeachableLearnset),
+    [SPECIES_KECLEON] = TEACHABLE_LEARNSET(sKecleonTeachableLearnset),
+    [SPECIES_BALTOY] = TEACHABLE_LEARNSET(sBaltoyTeachableLearnset),
+    [SPECIES_CLAYDOL] = TEACHABLE_LEARNSET(sClaydolTeachableLearnset),
+    [SPECIES_NOSEPASS] = TEACHABLE_LEARNSET(sNosepassTeachableLearnset),
+    [SPECIES_TORKOAL] = TEACHABLE_LEARNSET(sTorkoalTeachableLearnset),
+    [SPECIES_SABLEYE] = TEACHABLE_LEARNSET(sSableyeTeachableLearnset),
+    [SPECIES_BARBOACH] = TEACHABLE_LEARNSET(sBarboachTeachableLearnset),
+    [SPECIES_WHISCASH] = TEACHABLE_LEARNSET(sWhiscashTeachableLearnset),
+    [SPECIES_LUVDISC] = TEACHABLE_LEARNSET(sLuvdiscTeachableLearnset),
+    [SPECIES_CORPHISH] = TEACHABLE_LEARNSET(sCorphishTeachableLearnset),
+    [SPECIES_CRAWDAUNT] = TEACHABLE_LEARNSET(sCrawdauntTeachableLearnset),
+    [SPECIES_FEEBAS] = TEACHABLE_LEARNSET(sFeebasTeachableLearnset),
+    [SPECIES_MILOTIC] = TEACHABLE_LEARNSET(sMiloticTeachableLearnset),
+    [SPECIES_CARVANHA] = TEACHABLE_LEARNSET(sCarvanhaTeachableLearnset),
+    [SPECIES_SHARPEDO] = TEACHABLE_LEARNSET(sSharpedoTeachableLearnset),
+    [SPECIES_TRAPINCH] = TEACHABLE_LEARNSET(sTrapinchTeachableLearnset),
+    [SPECIES_VIBRAVA] = TEACHABLE_LEARNSET(sVibravaTeachableLearnset),
+    [SPECIES_FLYGON] = TEACHABLE_LEARNSET(sFlygonTeachableLearnset),
+    [SPECIES_MAKUHITA] = TEACHABLE_LEARNSET(sMakuhitaTeachableLearnset),
+    [SPECIES_HARIYAMA] = TEACHABLE_LEARNSET(sHariyamaTeachableLearnset),
+    [SPECIES_ELECTRIKE] = TEACHABLE_LEARNSET(sElectrikeTeachableLearnset),
+    [SPECIES_MANECTRIC] = TEACHABLE_LEARNSET(sManectricTeachableLearnset),
+    [SPECIES_NUMEL] = TEACHABLE_LEARNSET(sNumelTeachableLearnset),
+    [SPECIES_CAMERUPT] = TEACHABLE_LEARNSET(sCameruptTeachableLearnset),
+    [SPECIES_SPHEAL] = TEACHABLE_LEARNSET(sSphealTeachableLearnset),
+    [SPECIES_SEALEO] = TEACHABLE_LEARNSET(sSealeoTeachableLearnset),
+    [SPECIES_WALREIN] = TEACHABLE_LEARNSET(sWalreinTeachableLearnset),
+    [SPECIES_CACNEA] = TEACHABLE_LEARNSET(sCacneaTeachableLearnset),
+    [SPECIES_CACTURNE] = TEACHABLE_LEARNSET(sCacturneTeachableLearnset),
+    [SPECIES_SNORUNT] = TEACHABLE_LEARNSET(sSnoruntTeachableLearnset),
+    [SPECIES_GLALIE] = TEACHABLE_LEARNSET(sGlalieTeachableLearnset),
+    [SPECIES_LUNATONE] = TEACHABLE_LEARNSET(sLunatoneTeachableLearnset),
+    [SPECIES_SOLROCK] = TEACHABLE_LEARNSET(sSolrockTeachableLearnset),
+    [SPECIES_AZURILL] = TEACHABLE_LEARNSET(sAzurillTeachableLearnset),
+    [SPECIES_SPOINK] = TEACHABLE_LEARNSET(sSpoinkTeachableLearnset),
+    [SPECIES_GRUMPIG] = TEACHABLE_LEARNSET(sGrumpigTeachableLearnset),
+    [SPECIES_PLUSLE] = TEACHABLE_LEARNSET(sPlusleTeachableLearnset),
+    [SPECIES_MINUN] = TEACHABLE_LEARNSET(sMinunTeachableLearnset),
+    [SPECIES_MAWILE] = TEACHABLE_LEARNSET(sMawileTeachableLearnset),
+    [SPECIES_MEDITITE] = TEACHABLE_LEARNSET(sMedititeTeachableLearnset),
+    [SPECIES_MEDICHAM] = TEACHABLE_LEARNSET(sMedichamTeachableLearnset),
+    [SPECIES_SWABLU] = TEACHABLE_LEARNSET(sSwabluTeachableLearnset),
+    [SPECIES_ALTARIA] = TEACHABLE_LEARNSET(sAltariaTeachableLearnset),
+    [SPECIES_WYNAUT] = TEACHABLE_LEARNSET(sWynautTeachableLearnset),
+    [SPECIES_DUSKULL] = TEACHABLE_LEARNSET(sDuskullTeachableLearnset),
+    [SPECIES_DUSCLOPS] = TEACHABLE_LEARNSET(sDusclopsTeachableLearnset),
+    [SPECIES_ROSELIA] = TEACHABLE_LEARNSET(sRoseliaTeachableLearnset),
+    [SPECIES_SLAKOTH] = TEACHABLE_LEARNSET(sSlakothTeachableLearnset),
+    [SPECIES_VIGOROTH] = TEACHABLE_LEARNSET(sVigorothTeachableLearnset),
+    [SPECIES_SLAKING] = TEACHABLE_LEARNSET(sSlakingTeachableLearnset),
+    [SPECIES_GULPIN] = TEACHABLE_LEARNSET(sGulpinTeachableLearnset),
+    [SPECIES_SWALOT] = TEACHABLE_LEARNSET(sSwalotTeachableLearnset),
+    [SPECIES_TROPIUS] = TEACHABLE_LEARNSET(sTropiusTeachableLearnset),
+    [SPECIES_WHISMUR] = TEACHABLE_LEARNSET(sWhismurTeachableLearnset),
+    [SPECIES_LOUDRED] = TEACHABLE_LEARNSET(sLoudredTeachableLearnset),
+    [SPECIES_EXPLOUD] = TEACHABLE_LEARNSET(sExploudTeachableLearnset),
+    [SPECIES_CLAMPERL] = TEACHABLE_LEARNSET(sClamperlTeachableLearnset),
+    [SPECIES_HUNTAIL] = TEACHABLE_LEARNSET(sHuntailTeachableLearnset),
+    [SPECIES_GOREBYSS] = TEACHABLE_LEARNSET(sGorebyssTeachableLearnset),
+    [SPECIES_ABSOL] = TEACHABLE_LEARNSET(sAbsolTeachableLearnset),
+    [SPECIES_SHUPPET] = TEACHABLE_LEARNSET(sShuppetTeachableLearnset),
+    [SPECIES_BANETTE] = TEACHABLE_LEARNSET(sBanetteTeachableLearnset),
+    [SPECIES_SEVIPER] = TEACHABLE_LEARNSET(sSeviperTeachableLearnset),
+    [SPECIES_ZANGOOSE] = TEACHABLE_LEARNSET(sZangooseTeachableLearnset),
+    [SPECIES_RELICANTH] = TEACHABLE_LEARNSET(sRelicanthTeachableLearnset),
+    [SPECIES_ARON] = TEACHABLE_LEARNSET(sAronTeachableLearnset),
+    [SPECIES_LAIRON] = TEACHABLE_LEARNSET(sLaironTeachableLearnset),
+    [SPECIES_AGGRON] = TEACHABLE_LEARNSET(sAggronTeachableLearnset),
+    [SPECIES_CASTFORM] = TEACHABLE_LEARNSET(sCastformTeachableLearnset),
+    [SPECIES_VOLBEAT] = TEACHABLE_LEARNSET(sVolbeatTeachableLearnset),
+    [SPECIES_ILLUMISE] = TEACHABLE_LEARNSET(sIllumiseTeachableLearnset),
+    [SPECIES_LILEEP] = TEACHABLE_LEARNSET(sLileepTeachableLearnset),
+    [SPECIES_CRADILY] = TEACHABLE_LEARNSET(sCradilyTeachableLearnset),
+    [SPECIES_ANORITH] = TEACHABLE_LEARNSET(sAnorithTeachableLearnset),
+    [SPECIES_ARMALDO] = TEACHABLE_LEARNSET(sArmaldoTeachableLearnset),
+    [SPECIES_RALTS] = TEACHABLE_LEARNSET(sRaltsTeachableLearnset),
+    [SPECIES_KIRLIA] = TEACHABLE_LEARNSET(sKirliaTeachableLearnset),
+    [SPECIES_GARDEVOIR] = TEACHABLE_LEARNSET(sGardevoirTeachableLearnset),
+    [SPECIES_BAGON] = TEACHABLE_LEARNSET(sBagonTeachableLearnset),
+    [SPECIES_SHELGON] = TEACHABLE_LEARNSET(sShelgonTeachableLearnset),
+    [SPECIES_SALAMENCE] = TEACHABLE_LEARNSET(sSalamenceTeachableLearnset),
+    [SPECIES_BELDUM] = TEACHABLE_LEARNSET(sBeldumTeachableLearnset),
+    [SPECIES_METANG] = TEACHABLE_LEARNSET(sMetangTeachableLearnset),
+    [SPECIES_METAGROSS] = TEACHABLE_LEARNSET(sMetagrossTeachableLearnset),
+    [SPECIES_REGIROCK] = TEACHABLE_LEARNSET(sRegirockTeachableLearnset),
+    [SPECIES_REGICE] = TEACHABLE_LEARNSET(sRegiceTeachableLearnset),
+    [SPECIES_REGISTEEL] = TEACHABLE_LEARNSET(sRegisteelTeachableLearnset),
+    [SPECIES_KYOGRE] = TEACHABLE_LEARNSET(sKyogreTeachableLearnset),
+    [SPECIES_GROUDON] = TEACHABLE_LEARNSET(sGroudonTeachableLearnset),
+    [SPECIES_RAYQUAZA] = TEACHABLE_LEARNSET(sRayquazaTeachableLearnset),
+    [SPECIES_LATIAS] = TEACHABLE_LEARNSET(sLatiasTeachableLearnset),
+    [SPECIES_LATIOS] = TEACHABLE_LEARNSET(sLatiosTeachableLearnset),
+    [SPECIES_JIRACHI] = TEACHABLE_LEARNSET(sJirachiTeachableLearnset),
+    [SPECIES_DEOXYS] = TEACHABLE_LEARNSET(sDeoxysTeachableLearnset),
+    [SPECIES_CHIMECHO] = TEACHABLE_LEARNSET(sChimechoTeachableLearnset),
 #if P_GEN_4_POKEMON == TRUE
-    [SPECIES_TURTWIG] = sTurtwigTeachableLearnset,
-    [SPECIES_GROTLE] = sGrotleTeachableLearnset,
-    [SPECIES_TORTERRA] = sTorterraTeachableLearnset,
-    [SPECIES_CHIMCHAR] = sChimcharTeachableLearnset,
-    [SPECIES_MONFERNO] = sMonfernoTeachableLearnset,
-    [SPECIES_INFERNAPE] = sInfernapeTeachableLearnset,
-    [SPECIES_PIPLUP] = sPiplupTeachableLearnset,
-    [SPECIES_PRINPLUP] = sPrinplupTeachableLearnset,
-    [SPECIES_EMPOLEON] = sEmpoleonTeachableLearnset,
-    [SPECIES_STARLY] = sStarlyTeachableLearnset,
-    [SPECIES_STARAVIA] = sStaraviaTeachableLearnset,
-    [SPECIES_STARAPTOR] = sStaraptorTeachableLearnset,
-    [SPECIES_BIDOOF] = sBidoofTeachableLearnset,
-    [SPECIES_BIBAREL] = sBibarelTeachableLearnset,
-    [SPECIES_KRICKETOT] = sKricketotTeachableLearnset,
-    [SPECIES_KRICKETUNE] = sKricketuneTeachableLearnset,
-    [SPECIES_SHINX] = sShinxTeachableLearnset,
-    [SPECIES_LUXIO] = sLuxioTeachableLearnset,
-    [SPECIES_LUXRAY] = sLuxrayTeachableLearnset,
-    [SPECIES_BUDEW] = sBudewTeachableLearnset,
-    [SPECIES_ROSERADE] = sRoseradeTeachableLearnset,
-    [SPECIES_CRANIDOS] = sCranidosTeachableLearnset,
-    [SPECIES_RAMPARDOS] = sRampardosTeachableLearnset,
-    [SPECIES_SHIELDON] = sShieldonTeachableLearnset,
-    [SPECIES_BASTIODON] = sBastiodonTeachableLearnset,
-    [SPECIES_BURMY] = sBurmyTeachableLearnset,
-    [SPECIES_WORMADAM] = sWormadamTeachableLearnset,
-    [SPECIES_MOTHIM] = sMothimTeachableLearnset,
-    [SPECIES_COMBEE] = sCombeeTeachableLearnset,
-    [SPECIES_VESPIQUEN] = sVespiquenTeachableLearnset,
-    [SPECIES_PACHIRISU] = sPachirisuTeachableLearnset,
-    [SPECIES_BUIZEL] = sBuizelTeachableLearnset,
-    [SPECIES_FLOATZEL] = sFloatzelTeachableLearnset,
-    [SPECIES_CHERUBI] = sCherubiTeachableLearnset,
-    [SPECIES_CHERRIM] = sCherrimTeachableLearnset,
-    [SPECIES_SHELLOS] = sShellosTeachableLearnset,
-    [SPECIES_GASTRODON] = sGastrodonTeachableLearnset,
-    [SPECIES_AMBIPOM] = sAmbipomTeachableLearnset,
-    [SPECIES_DRIFLOON] = sDrifloonTeachableLearnset,
-    [SPECIES_DRIFBLIM] = sDrifblimTeachableLearnset,
-    [SPECIES_BUNEARY] = sBunearyTeachableLearnset,
-    [SPECIES_LOPUNNY] = sLopunnyTeachableLearnset,
-    [SPECIES_MISMAGIUS] = sMismagiusTeachableLearnset,
-    [SPECIES_HONCHKROW] = sHonchkrowTeachableLearnset,
-    [SPECIES_GLAMEOW] = sGlameowTeachableLearnset,
-    [SPECIES_PURUGLY] = sPuruglyTeachableLearnset,
-    [SPECIES_CHINGLING] = sChinglingTeachableLearnset,
-    [SPECIES_STUNKY] = sStunkyTeachableLearnset,
-    [SPECIES_SKUNTANK] = sSkuntankTeachableLearnset,
-    [SPECIES_BRONZOR] = sBronzorTeachableLearnset,
-    [SPECIES_BRONZONG] = sBronzongTeachableLearnset,
-    [SPECIES_BONSLY] = sBonslyTeachableLearnset,
-    [SPECIES_MIME_JR] = sMimeJrTeachableLearnset,
-    [SPECIES_HAPPINY] = sHappinyTeachableLearnset,
-    [SPECIES_CHATOT] = sChatotTeachableLearnset,
-    [SPECIES_SPIRITOMB] = sSpiritombTeachableLearnset,
-    [SPECIES_GIBLE] = sGibleTeachableLearnset,
-    [SPECIES_GABITE] = sGabiteTeachableLearnset,
-    [SPECIES_GARCHOMP] = sGarchompTeachableLearnset,
-    [SPECIES_MUNCHLAX] = sMunchlaxTeachableLearnset,
-    [SPECIES_RIOLU] = sRioluTeachableLearnset,
-    [SPECIES_LUCARIO] = sLucarioTeachableLearnset,
-    [SPECIES_HIPPOPOTAS] = sHippopotasTeachableLearnset,
-    [SPECIES_HIPPOWDON] = sHippowdonTeachableLearnset,
-    [SPECIES_SKORUPI] = sSkorupiTeachableLearnset,
-    [SPECIES_DRAPION] = sDrapionTeachableLearnset,
-    [SPECIES_CROAGUNK] = sCroagunkTeachableLearnset,
-    [SPECIES_TOXICROAK] = sToxicroakTeachableLearnset,
-    [SPECIES_CARNIVINE] = sCarnivineTeachableLearnset,
-    [SPECIES_FINNEON] = sFinneonTeachableLearnset,
-    [SPECIES_LUMINEON] = sLumineonTeachableLearnset,
-    [SPECIES_MANTYKE] = sMantykeTeachableLearnset,
-    [SPECIES_SNOVER] = sSnoverTeachableLearnset,
-    [SPECIES_ABOMASNOW] = sAbomasnowTeachableLearnset,
-    [SPECIES_WEAVILE] = sWeavileTeachableLearnset,
-    [SPECIES_MAGNEZONE] = sMagnezoneTeachableLearnset,
-    [SPECIES_LICKILICKY] = sLickilickyTeachableLearnset,
-    [SPECIES_RHYPERIOR] = sRhyperiorTeachableLearnset,
-    [SPECIES_TANGROWTH] = sTangrowthTeachableLearnset,
-    [SPECIES_ELECTIVIRE] = sElectivireTeachableLearnset,
-    [SPECIES_MAGMORTAR] = sMagmortarTeachableLearnset,
-    [SPECIES_TOGEKISS] = sTogekissTeachableLearnset,
-    [SPECIES_YANMEGA] = sYanmegaTeachableLearnset,
-    [SPECIES_LEAFEON] = sLeafeonTeachableLearnset,
-    [SPECIES_GLACEON] = sGlaceonTeachableLearnset,
-    [SPECIES_GLISCOR] = sGliscorTeachableLearnset,
-    [SPECIES_MAMOSWINE] = sMamoswineTeachableLearnset,
-    [SPECIES_PORYGON_Z] = sPorygonZTeachableLearnset,
-    [SPECIES_GALLADE] = sGalladeTeachableLearnset,
-    [SPECIES_PROBOPASS] = sProbopassTeachableLearnset,
-    [SPECIES_DUSKNOIR] = sDusknoirTeachableLearnset,
-    [SPECIES_FROSLASS] = sFroslassTeachableLearnset,
-    [SPECIES_ROTOM] = sRotomTeachableLearnset,
-    [SPECIES_UXIE] = sUxieTeachableLearnset,
-    [SPECIES_MESPRIT] = sMespritTeachableLearnset,
-    [SPECIES_AZELF] = sAzelfTeachableLearnset,
-    [SPECIES_DIALGA] = sDialgaTeachableLearnset,
-    [SPECIES_PALKIA] = sPalkiaTeachableLearnset,
-    [SPECIES_HEATRAN] = sHeatranTeachableLearnset,
-    [SPECIES_REGIGIGAS] = sRegigigasTeachableLearnset,
-    [SPECIES_GIRATINA] = sGiratinaTeachableLearnset,
-    [SPECIES_CRESSELIA] = sCresseliaTeachableLearnset,
-    [SPECIES_PHIONE] = sPhioneTeachableLearnset,
-    [SPECIES_MANAPHY] = sManaphyTeachableLearnset,
-    [SPECIES_DARKRAI] = sDarkraiTeachableLearnset,
-    [SPECIES_SHAYMIN] = sShayminTeachableLearnset,
-    [SPECIES_ARCEUS] = sArceusTeachableLearnset,
+    [SPECIES_TURTWIG] = TEACHABLE_LEARNSET(sTurtwigTeachableLearnset),
+    [SPECIES_GROTLE] = TEACHABLE_LEARNSET(sGrotleTeachableLearnset),
+    [SPECIES_TORTERRA] = TEACHABLE_LEARNSET(sTorterraTeachableLearnset),
+    [SPECIES_CHIMCHAR] = TEACHABLE_LEARNSET(sChimcharTeachableLearnset),
+    [SPECIES_MONFERNO] = TEACHABLE_LEARNSET(sMonfernoTeachableLearnset),
+    [SPECIES_INFERNAPE] = TEACHABLE_LEARNSET(sInfernapeTeachableLearnset),
+    [SPECIES_PIPLUP] = TEACHABLE_LEARNSET(sPiplupTeachableLearnset),
+    [SPECIES_PRINPLUP] = TEACHABLE_LEARNSET(sPrinplupTeachableLearnset),
+    [SPECIES_EMPOLEON] = TEACHABLE_LEARNSET(sEmpoleonTeachableLearnset),
+    [SPECIES_STARLY] = TEACHABLE_LEARNSET(sStarlyTeachableLearnset),
+    [SPECIES_STARAVIA] = TEACHABLE_LEARNSET(sStaraviaTeachableLearnset),
+    [SPECIES_STARAPTOR] = TEACHABLE_LEARNSET(sStaraptorTeachableLearnset),
+    [SPECIES_BIDOOF] = TEACHABLE_LEARNSET(sBidoofTeachableLearnset),
+    [SPECIES_BIBAREL] = TEACHABLE_LEARNSET(sBibarelTeachableLearnset),
+    [SPECIES_KRICKETOT] = TEACHABLE_LEARNSET(sKricketotTeachableLearnset),
+    [SPECIES_KRICKETUNE] = TEACHABLE_LEARNSET(sKricketuneTeachableLearnset),
+    [SPECIES_SHINX] = TEACHABLE_LEARNSET(sShinxTeachableLearnset),
+    [SPECIES_LUXIO] = TEACHABLE_LEARNSET(sLuxioTeachableLearnset),
+    [SPECIES_LUXRAY] = TEACHABLE_LEARNSET(sLuxrayTeachableLearnset),
+    [SPECIES_BUDEW] = TEACHABLE_LEARNSET(sBudewTeachableLearnset),
+    [SPECIES_ROSERADE] = TEACHABLE_LEARNSET(sRoseradeTeachableLearnset),
+    [SPECIES_CRANIDOS] = TEACHABLE_LEARNSET(sCranidosTeachableLearnset),
+    [SPECIES_RAMPARDOS] = TEACHABLE_LEARNSET(sRampardosTeachableLearnset),
+    [SPECIES_SHIELDON] = TEACHABLE_LEARNSET(sShieldonTeachableLearnset),
+    [SPECIES_BASTIODON] = TEACHABLE_LEARNSET(sBastiodonTeachableLearnset),
+    [SPECIES_BURMY] = TEACHABLE_LEARNSET(sBurmyTeachableLearnset),
+    [SPECIES_WORMADAM] = TEACHABLE_LEARNSET(sWormadamTeachableLearnset),
+    [SPECIES_MOTHIM] = TEACHABLE_LEARNSET(sMothimTeachableLearnset),
+    [SPECIES_COMBEE] = TEACHABLE_LEARNSET(sCombeeTeachableLearnset),
+    [SPECIES_VESPIQUEN] = TEACHABLE_LEARNSET(sVespiquenTeachableLearnset),
+    [SPECIES_PACHIRISU] = TEACHABLE_LEARNSET(sPachirisuTeachableLearnset),
+    [SPECIES_BUIZEL] = TEACHABLE_LEARNSET(sBuizelTeachableLearnset),
+    [SPECIES_FLOATZEL] = TEACHABLE_LEARNSET(sFloatzelTeachableLearnset),
+    [SPECIES_CHERUBI] = TEACHABLE_LEARNSET(sCherubiTeachableLearnset),
+    [SPECIES_CHERRIM] = TEACHABLE_LEARNSET(sCherrimTeachableLearnset),
+    [SPECIES_SHELLOS] = TEACHABLE_LEARNSET(sShellosTeachableLearnset),
+    [SPECIES_GASTRODON] = TEACHABLE_LEARNSET(sGastrodonTeachableLearnset),
+    [SPECIES_AMBIPOM] = TEACHABLE_LEARNSET(sAmbipomTeachableLearnset),
+    [SPECIES_DRIFLOON] = TEACHABLE_LEARNSET(sDrifloonTeachableLearnset),
+    [SPECIES_DRIFBLIM] = TEACHABLE_LEARNSET(sDrifblimTeachableLearnset),
+    [SPECIES_BUNEARY] = TEACHABLE_LEARNSET(sBunearyTeachableLearnset),
+    [SPECIES_LOPUNNY] = TEACHABLE_LEARNSET(sLopunnyTeachableLearnset),
+    [SPECIES_MISMAGIUS] = TEACHABLE_LEARNSET(sMismagiusTeachableLearnset),
+    [SPECIES_HONCHKROW] = TEACHABLE_LEARNSET(sHonchkrowTeachableLearnset),
+    [SPECIES_GLAMEOW] = TEACHABLE_LEARNSET(sGlameowTeachableLearnset),
+    [SPECIES_PURUGLY] = TEACHABLE_LEARNSET(sPuruglyTeachableLearnset),
+    [SPECIES_CHINGLING] = TEACHABLE_LEARNSET(sChinglingTeachableLearnset),
+    [SPECIES_STUNKY] = TEACHABLE_LEARNSET(sStunkyTeachableLearnset),
+    [SPECIES_SKUNTANK] = TEACHABLE_LEARNSET(sSkuntankTeachableLearnset),
+    [SPECIES_BRONZOR] = TEACHABLE_LEARNSET(sBronzorTeachableLearnset),
+    [SPECIES_BRONZONG] = TEACHABLE_LEARNSET(sBronzongTeachableLearnset),
+    [SPECIES_BONSLY] = TEACHABLE_LEARNSET(sBonslyTeachableLearnset),
+    [SPECIES_MIME_JR] = TEACHABLE_LEARNSET(sMimeJrTeachableLearnset),
+    [SPECIES_HAPPINY] = TEACHABLE_LEARNSET(sHappinyTeachableLearnset),
+    [SPECIES_CHATOT] = TEACHABLE_LEARNSET(sChatotTeachableLearnset),
+    [SPECIES_SPIRITOMB] = TEACHABLE_LEARNSET(sSpiritombTeachableLearnset),
+    [SPECIES_GIBLE] = TEACHABLE_LEARNSET(sGibleTeachableLearnset),
+    [SPECIES_GABITE] = TEACHABLE_LEARNSET(sGabiteTeachableLearnset),
+    [SPECIES_GARCHOMP] = TEACHABLE_LEARNSET(sGarchompTeachableLearnset),
+    [SPECIES_MUNCHLAX] = TEACHABLE_LEARNSET(sMunchlaxTeachableLearnset),
+    [SPECIES_RIOLU] = TEACHABLE_LEARNSET(sRioluTeachableLearnset),
+    [SPECIES_LUCARIO] = TEACHABLE_LEARNSET(sLucarioTeachableLearnset),
+    [SPECIES_HIPPOPOTAS] = TEACHABLE_LEARNSET(sHippopotasTeachableLearnset),
+    [SPECIES_HIPPOWDON] = TEACHABLE_LEARNSET(sHippowdonTeachableLearnset),
+    [SPECIES_SKORUPI] = TEACHABLE_LEARNSET(sSkorupiTeachableLearnset),
+    [SPECIES_DRAPION] = TEACHABLE_LEARNSET(sDrapionTeachableLearnset),
+    [SPECIES_CROAGUNK] = TEACHABLE_LEARNSET(sCroagunkTeachableLearnset),
+    [SPECIES_TOXICROAK] = TEACHABLE_LEARNSET(sToxicroakTeachableLearnset),
+    [SPECIES_CARNIVINE] = TEACHABLE_LEARNSET(sCarnivineTeachableLearnset),
+    [SPECIES_FINNEON] = TEACHABLE_LEARNSET(sFinneonTeachableLearnset),
+    [SPECIES_LUMINEON] = TEACHABLE_LEARNSET(sLumineonTeachableLearnset),
+    [SPECIES_MANTYKE] = TEACHABLE_LEARNSET(sMantykeTeachableLearnset),
+    [SPECIES_SNOVER] = TEACHABLE_LEARNSET(sSnoverTeachableLearnset),
+    [SPECIES_ABOMASNOW] = TEACHABLE_LEARNSET(sAbomasnowTeachableLearnset),
+    [SPECIES_WEAVILE] = TEACHABLE_LEARNSET(sWeavileTeachableLearnset),
+    [SPECIES_MAGNEZONE] = TEACHABLE_LEARNSET(sMagnezoneTeachableLearnset),
+    [SPECIES_LICKILICKY] = TEACHABLE_LEARNSET(sLickilickyTeachableLearnset),
+    [SPECIES_RHYPERIOR] = TEACHABLE_LEARNSET(sRhyperiorTeachableLearnset),
+    [SPECIES_TANGROWTH] = TEACHABLE_LEARNSET(sTangrowthTeachableLearnset),
+    [SPECIES_ELECTIVIRE] = TEACHABLE_LEARNSET(sElectivireTeachableLearnset),
+    [SPECIES_MAGMORTAR] = TEACHABLE_LEARNSET(sMagmortarTeachableLearnset),
+    [SPECIES_TOGEKISS] = TEACHABLE_LEARNSET(sTogekissTeachableLearnset),
+    [SPECIES_YANMEGA] = TEACHABLE_LEARNSET(sYanmegaTeachableLearnset),
+    [SPECIES_LEAFEON] = TEACHABLE_LEARNSET(sLeafeonTeachableLearnset),
+    [SPECIES_GLACEON] = TEACHABLE_LEARNSET(sGlaceonTeachableLearnset),
+    [SPECIES_GLISCOR] = TEACHABLE_LEARNSET(sGliscorTeachableLearnset),
+    [SPECIES_MAMOSWINE] = TEACHABLE_LEARNSET(sMamoswineTeachableLearnset),
+    [SPECIES_PORYGON_Z] = TEACHABLE_LEARNSET(sPorygonZTeachableLearnset),
+    [SPECIES_GALLADE] = TEACHABLE_LEARNSET(sGalladeTeachableLearnset),
+    [SPECIES_PROBOPASS] = TEACHABLE_LEARNSET(sProbopassTeachableLearnset),
+    [SPECIES_DUSKNOIR] = TEACHABLE_LEARNSET(sDusknoirTeachableLearnset),
+    [SPECIES_FROSLASS] = TEACHABLE_LEARNSET(sFroslassTeachableLearnset),
+    [SPECIES_ROTOM] = TEACHABLE_LEARNSET(sRotomTeachableLearnset),
+    [SPECIES_UXIE] = TEACHABLE_LEARNSET(sUxieTeachableLearnset),
+    [SPECIES_MESPRIT] = TEACHABLE_LEARNSET(sMespritTeachableLearnset),
+    [SPECIES_AZELF] = TEACHABLE_LEARNSET(sAzelfTeachableLearnset),
+    [SPECIES_DIALGA] = TEACHABLE_LEARNSET(sDialgaTeachableLearnset),
+    [SPECIES_PALKIA] = TEACHABLE_LEARNSET(sPalkiaTeachableLearnset),
+    [SPECIES_HEATRAN] = TEACHABLE_LEARNSET(sHeatranTeachableLearnset),
+    [SPECIES_REGIGIGAS] = TEACHABLE_LEARNSET(sRegigigasTeachableLearnset),
+    [SPECIES_GIRATINA] = TEACHABLE_LEARNSET(sGiratinaTeachableLearnset),
+    [SPECIES_CRESSELIA] = TEACHABLE_LEARNSET(sCresseliaTeachableLearnset),
+    [SPECIES_PHIONE] = TEACHABLE_LEARNSET(sPhioneTeachableLearnset),
+    [SPECIES_MANAPHY] = TEACHABLE_LEARNSET(sManaphyTeachableLearnset),
+    [SPECIES_DARKRAI] = TEACHABLE_LEARNSET(sDarkraiTeachableLearnset),
+    [SPECIES_SHAYMIN] = TEACHABLE_LEARNSET(sShayminTeachableLearnset),
+    [SPECIES_ARCEUS] = TEACHABLE_LEARNSET(sArceusTeachableLearnset),
 #endif
 #if P_GEN_5_POKEMON == TRUE
-    [SPECIES_VICTINI] = sVictiniTeachableLearnset,
-    [SPECIES_SNIVY] = sSnivyTeachableLearnset,
-    [SPECIES_SERVINE] = sServineTeachableLearnset,
-    [SPECIES_SERPERIOR] = sSerperiorTeachableLearnset,
-    [SPECIES_TEPIG] = sTepigTeachableLearnset,
-    [SPECIES_PIGNITE] = sPigniteTeachableLearnset,
-    [SPECIES_EMBOAR] = sEmboarTeachableLearnset,
-    [SPECIES_OSHAWOTT] = sOshawottTeachableLearnset,
-    [SPECIES_DEWOTT] = sDewottTeachableLearnset,
-    [SPECIES_SAMUROTT] = sSamurottTeachableLearnset,
-    [SPECIES_PATRAT] = sPatratTeachableLearnset,
-    [SPECIES_WATCHOG] = sWatchogTeachableLearnset,
-    [SPECIES_LILLIPUP] = sLillipupTeachableLearnset,
-    [SPECIES_HERDIER] = sHerdierTeachableLearnset,
-    [SPECIES_STOUTLAND] = sStoutlandTeachableLearnset,
-    [SPECIES_PURRLOIN] = sPurrloinTeachableLearnset,
-    [SPECIES_LIEPARD] = sLiepardTeachableLearnset,
-    [SPECIES_PANSAGE] = sPansageTeachableLearnset,
-    [SPECIES_SIMISAGE] = sSimisageTeachableLearnset,
-    [SPECIES_PANSEAR] = sPansearTeachableLearnset,
-    [SPECIES_SIMISEAR] = sSimisearTeachableLearnset,
-    [SPECIES_PANPOUR] = sPanpourTeachableLearnset,
-    [SPECIES_SIMIPOUR] = sSimipourTeachableLearnset,
-    [SPECIES_MUNNA] = sMunnaTeachableLearnset,
-    [SPECIES_MUSHARNA] = sMusharnaTeachableLearnset,
-    [SPECIES_PIDOVE] = sPidoveTeachableLearnset,
-    [SPECIES_TRANQUILL] = sTranquillTeachableLearnset,
-    [SPECIES_UNFEZANT] = sUnfezantTeachableLearnset,
-    [SPECIES_BLITZLE] = sBlitzleTeachableLearnset,
-    [SPECIES_ZEBSTRIKA] = sZebstrikaTeachableLearnset,
-    [SPECIES_ROGGENROLA] = sRoggenrolaTeachableLearnset,
-    [SPECIES_BOLDORE] = sBoldoreTeachableLearnset,
-    [SPECIES_GIGALITH] = sGigalithTeachableLearnset,
-    [SPECIES_WOOBAT] = sWoobatTeachableLearnset,
-    [SPECIES_SWOOBAT] = sSwoobatTeachableLearnset,
-    [SPECIES_DRILBUR] = sDrilburTeachableLearnset,
-    [SPECIES_EXCADRILL] = sExcadrillTeachableLearnset,
-    [SPECIES_AUDINO] = sAudinoTeachableLearnset,
-    [SPECIES_TIMBURR] = sTimburrTeachableLearnset,
-    [SPECIES_GURDURR] = sGurdurrTeachableLearnset,
-    [SPECIES_CONKELDURR] = sConkeldurrTeachableLearnset,
-    [SPECIES_TYMPOLE] = sTympoleTeachableLearnset,
-    [SPECIES_PALPITOAD] = sPalpitoadTeachableLearnset,
-    [SPECIES_SEISMITOAD] = sSeismitoadTeachableLearnset,
-    [SPECIES_THROH] = sThrohTeachableLearnset,
-    [SPECIES_SAWK] = sSawkTeachableLearnset,
-    [SPECIES_SEWADDLE] = sSewaddleTeachableLearnset,
-    [SPECIES_SWADLOON] = sSwadloonTeachableLearnset,
-    [SPECIES_LEAVANNY] = sLeavannyTeachableLearnset,
-    [SPECIES_VENIPEDE] = sVenipedeTeachableLearnset,
-    [SPECIES_WHIRLIPEDE] = sWhirlipedeTeachableLearnset,
-    [SPECIES_SCOLIPEDE] = sScolipedeTeachableLearnset,
-    [SPECIES_COTTONEE] = sCottoneeTeachableLearnset,
-    [SPECIES_WHIMSICOTT] = sWhimsicottTeachableLearnset,
-    [SPECIES_PETILIL] = sPetililTeachableLearnset,
-    [SPECIES_LILLIGANT] = sLilligantTeachableLearnset,
-    [SPECIES_BASCULIN] = sBasculinTeachableLearnset,
-    [SPECIES_SANDILE] = sSandileTeachableLearnset,
-    [SPECIES_KROKOROK] = sKrokorokTeachableLearnset,
-    [SPECIES_KROOKODILE] = sKrookodileTeachableLearnset,
-    [SPECIES_DARUMAKA] = sDarumakaTeachableLearnset,
-    [SPECIES_DARMANITAN] = sDarmanitanTeachableLearnset,
-    [SPECIES_MARACTUS] = sMaractusTeachableLearnset,
-    [SPECIES_DWEBBLE] = sDwebbleTeachableLearnset,
-    [SPECIES_CRUSTLE] = sCrustleTeachableLearnset,
-    [SPECIES_SCRAGGY] = sScraggyTeachableLearnset,
-    [SPECIES_SCRAFTY] = sScraftyTeachableLearnset,
-    [SPECIES_SIGILYPH] = sSigilyphTeachableLearnset,
-    [SPECIES_YAMASK] = sYamaskTeachableLearnset,
-    [SPECIES_COFAGRIGUS] = sCofagrigusTeachableLearnset,
-    [SPECIES_TIRTOUGA] = sTirtougaTeachableLearnset,
-    [SPECIES_CARRACOSTA] = sCarracostaTeachableLearnset,
-    [SPECIES_ARCHEN] = sArchenTeachableLearnset,
-    [SPECIES_ARCHEOPS] = sArcheopsTeachableLearnset,
-    [SPECIES_TRUBBISH] = sTrubbishTeachableLearnset,
-    [SPECIES_GARBODOR] = sGarbodorTeachableLearnset,
-    [SPECIES_ZORUA] = sZoruaTeachableLearnset,
-    [SPECIES_ZOROARK] = sZoroarkTeachableLearnset,
-    [SPECIES_MINCCINO] = sMinccinoTeachableLearnset,
-    [SPECIES_CINCCINO] = sCinccinoTeachableLearnset,
-    [SPECIES_GOTHITA] = sGothitaTeachableLearnset,
-    [SPECIES_GOTHORITA] = sGothoritaTeachableLearnset,
-    [SPECIES_GOTHITELLE] = sGothitelleTeachableLearnset,
-    [SPECIES_SOLOSIS] = sSolosisTeachableLearnset,
-    [SPECIES_DUOSION] = sDuosionTeachableLearnset,
-    [SPECIES_REUNICLUS] = sReuniclusTeachableLearnset,
-    [SPECIES_DUCKLETT] = sDucklettTeachableLearnset,
-    [SPECIES_SWANNA] = sSwannaTeachableLearnset,
-    [SPECIES_VANILLITE] = sVanilliteTeachableLearnset,
-    [SPECIES_VANILLISH] = sVanillishTeachableLearnset,
-    [SPECIES_VANILLUXE] = sVanilluxeTeachableLearnset,
-    [SPECIES_DEERLING] = sDeerlingTeachableLearnset,
-    [SPECIES_SAWSBUCK] = sSawsbuckTeachableLearnset,
-    [SPECIES_EMOLGA] = sEmolgaTeachableLearnset,
-    [SPECIES_KARRABLAST] = sKarrablastTeachableLearnset,
-    [SPECIES_ESCAVALIER] = sEscavalierTeachableLearnset,
-    [SPECIES_FOONGUS] = sFoongusTeachableLearnset,
-    [SPECIES_AMOONGUSS] = sAmoongussTeachableLearnset,
-    [SPECIES_FRILLISH] = sFrillishTeachableLearnset,
-    [SPECIES_JELLICENT] = sJellicentTeachableLearnset,
-    [SPECIES_ALOMOMOLA] = sAlomomolaTeachableLearnset,
-    [SPECIES_JOLTIK] = sJoltikTeachableLearnset,
-    [SPECIES_GALVANTULA] = sGalvantulaTeachableLearnset,
-    [SPECIES_FERROSEED] = sFerroseedTeachableLearnset,
-    [SPECIES_FERROTHORN] = sFerrothornTeachableLearnset,
-    [SPECIES_KLINK] = sKlinkTeachableLearnset,
-    [SPECIES_KLANG] = sKlangTeachableLearnset,
-    [SPECIES_KLINKLANG] = sKlinklangTeachableLearnset,
-    [SPECIES_TYNAMO] = sTynamoTeachableLearnset,
-    [SPECIES_EELEKTRIK] = sEelektrikTeachableLearnset,
-    [SPECIES_EELEKTROSS] = sEelektrossTeachableLearnset,
-    [SPECIES_ELGYEM] = sElgyemTeachableLearnset,
-    [SPECIES_BEHEEYEM] = sBeheeyemTeachableLearnset,
-    [SPECIES_LITWICK] = sLitwickTeachableLearnset,
-    [SPECIES_LAMPENT] = sLampentTeachableLearnset,
-    [SPECIES_CHANDELURE] = sChandelureTeachableLearnset,
-    [SPECIES_AXEW] = sAxewTeachableLearnset,
-    [SPECIES_FRAXURE] = sFraxureTeachableLearnset,
-    [SPECIES_HAXORUS] = sHaxorusTeachableLearnset,
-    [SPECIES_CUBCHOO] = sCubchooTeachableLearnset,
-    [SPECIES_BEARTIC] = sBearticTeachableLearnset,
-    [SPECIES_CRYOGONAL] = sCryogonalTeachableLearnset,
-    [SPECIES_SHELMET] = sShelmetTeachableLearnset,
-    [SPECIES_ACCELGOR] = sAccelgorTeachableLearnset,
-    [SPECIES_STUNFISK] = sStunfiskTeachableLearnset,
-    [SPECIES_MIENFOO] = sMienfooTeachableLearnset,
-    [SPECIES_MIENSHAO] = sMienshaoTeachableLearnset,
-    [SPECIES_DRUDDIGON] = sDruddigonTeachableLearnset,
-    [SPECIES_GOLETT] = sGolettTeachableLearnset,
-    [SPECIES_GOLURK] = sGolurkTeachableLearnset,
-    [SPECIES_PAWNIARD] = sPawniardTeachableLearnset,
-    [SPECIES_BISHARP] = sBisharpTeachableLearnset,
-    [SPECIES_BOUFFALANT] = sBouffalantTeachableLearnset,
-    [SPECIES_RUFFLET] = sRuffletTeachableLearnset,
-    [SPECIES_BRAVIARY] = sBraviaryTeachableLearnset,
-    [SPECIES_VULLABY] = sVullabyTeachableLearnset,
-    [SPECIES_MANDIBUZZ] = sMandibuzzTeachableLearnset,
-    [SPECIES_HEATMOR] = sHeatmorTeachableLearnset,
-    [SPECIES_DURANT] = sDurantTeachableLearnset,
-    [SPECIES_DEINO] = sDeinoTeachableLearnset,
-    [SPECIES_ZWEILOUS] = sZweilousTeachableLearnset,
-    [SPECIES_HYDREIGON] = sHydreigonTeachableLearnset,
-    [SPECIES_LARVESTA] = sLarvestaTeachableLearnset,
-    [SPECIES_VOLCARONA] = sVolcaronaTeachableLearnset,
-    [SPECIES_COBALION] = sCobalionTeachableLearnset,
-    [SPECIES_TERRAKION] = sTerrakionTeachableLearnset,
-    [SPECIES_VIRIZION] = sVirizionTeachableLearnset,
-    [SPECIES_TORNADUS] = sTornadusTeachableLearnset,
-    [SPECIES_THUNDURUS] = sThundurusTeachableLearnset,
-    [SPECIES_RESHIRAM] = sReshiramTeachableLearnset,
-    [SPECIES_ZEKROM] = sZekromTeachableLearnset,
-    [SPECIES_LANDORUS] = sLandorusTeachableLearnset,
-    [SPECIES_KYUREM] = sKyuremTeachableLearnset,
-    [SPECIES_KELDEO] = sKeldeoTeachableLearnset,
-    [SPECIES_MELOETTA] = sMeloettaTeachableLearnset,
-    [SPECIES_GENESECT] = sGenesectTeachableLearnset,
+    [SPECIES_VICTINI] = TEACHABLE_LEARNSET(sVictiniTeachableLearnset),
+    [SPECIES_SNIVY] = TEACHABLE_LEARNSET(sSnivyTeachableLearnset),
+    [SPECIES_SERVINE] = TEACHABLE_LEARNSET(sServineTeachableLearnset),
+    [SPECIES_SERPERIOR] = TEACHABLE_LEARNSET(sSerperiorTeachableLearnset),
+    [SPECIES_TEPIG] = TEACHABLE_LEARNSET(sTepigTeachableLearnset),
+    [SPECIES_PIGNITE] = TEACHABLE_LEARNSET(sPigniteTeachableLearnset),
+    [SPECIES_EMBOAR] = TEACHABLE_LEARNSET(sEmboarTeachableLearnset),
+    [SPECIES_OSHAWOTT] = TEACHABLE_LEARNSET(sOshawottTeachableLearnset),
+    [SPECIES_DEWOTT] = TEACHABLE_LEARNSET(sDewottTeachableLearnset),
+    [SPECIES_SAMUROTT] = TEACHABLE_LEARNSET(sSamurottTeachableLearnset),
+    [SPECIES_PATRAT] = TEACHABLE_LEARNSET(sPatratTeachableLearnset),
+    [SPECIES_WATCHOG] = TEACHABLE_LEARNSET(sWatchogTeachableLearnset),
+    [SPECIES_LILLIPUP] = TEACHABLE_LEARNSET(sLillipupTeachableLearnset),
+    [SPECIES_HERDIER] = TEACHABLE_LEARNSET(sHerdierTeachableLearnset),
+    [SPECIES_STOUTLAND] = TEACHABLE_LEARNSET(sStoutlandTeachableLearnset),
+    [SPECIES_PURRLOIN] = TEACHABLE_LEARNSET(sPurrloinTeachableLearnset),
+    [SPECIES_LIEPARD] = TEACHABLE_LEARNSET(sLiepardTeachableLearnset),
+    [SPECIES_PANSAGE] = TEACHABLE_LEARNSET(sPansageTeachableLearnset),
+    [SPECIES_SIMISAGE] = TEACHABLE_LEARNSET(sSimisageTeachableLearnset),
+    [SPECIES_PANSEAR] = TEACHABLE_LEARNSET(sPansearTeachableLearnset),
+    [SPECIES_SIMISEAR] = TEACHABLE_LEARNSET(sSimisearTeachableLearnset),
+    [SPECIES_PANPOUR] = TEACHABLE_LEARNSET(sPanpourTeachableLearnset),
+    [SPECIES_SIMIPOUR] = TEACHABLE_LEARNSET(sSimipourTeachableLearnset),
+    [SPECIES_MUNNA] = TEACHABLE_LEARNSET(sMunnaTeachableLearnset),
+    [SPECIES_MUSHARNA] = TEACHABLE_LEARNSET(sMusharnaTeachableLearnset),
+    [SPECIES_PIDOVE] = TEACHABLE_LEARNSET(sPidoveTeachableLearnset),
+    [SPECIES_TRANQUILL] = TEACHABLE_LEARNSET(sTranquillTeachableLearnset),
+    [SPECIES_UNFEZANT] = TEACHABLE_LEARNSET(sUnfezantTeachableLearnset),
+    [SPECIES_BLITZLE] = TEACHABLE_LEARNSET(sBlitzleTeachableLearnset),
+    [SPECIES_ZEBSTRIKA] = TEACHABLE_LEARNSET(sZebstrikaTeachableLearnset),
+    [SPECIES_ROGGENROLA] = TEACHABLE_LEARNSET(sRoggenrolaTeachableLearnset),
+    [SPECIES_BOLDORE] = TEACHABLE_LEARNSET(sBoldoreTeachableLearnset),
+    [SPECIES_GIGALITH] = TEACHABLE_LEARNSET(sGigalithTeachableLearnset),
+    [SPECIES_WOOBAT] = TEACHABLE_LEARNSET(sWoobatTeachableLearnset),
+    [SPECIES_SWOOBAT] = TEACHABLE_LEARNSET(sSwoobatTeachableLearnset),
+    [SPECIES_DRILBUR] = TEACHABLE_LEARNSET(sDrilburTeachableLearnset),
+    [SPECIES_EXCADRILL] = TEACHABLE_LEARNSET(sExcadrillTeachableLearnset),
+    [SPECIES_AUDINO] = TEACHABLE_LEARNSET(sAudinoTeachableLearnset),
+    [SPECIES_TIMBURR] = TEACHABLE_LEARNSET(sTimburrTeachableLearnset),
+    [SPECIES_GURDURR] = TEACHABLE_LEARNSET(sGurdurrTeachableLearnset),
+    [SPECIES_CONKELDURR] = TEACHABLE_LEARNSET(sConkeldurrTeachableLearnset),
+    [SPECIES_TYMPOLE] = TEACHABLE_LEARNSET(sTympoleTeachableLearnset),
+    [SPECIES_PALPITOAD] = TEACHABLE_LEARNSET(sPalpitoadTeachableLearnset),
+    [SPECIES_SEISMITOAD] = TEACHABLE_LEARNSET(sSeismitoadTeachableLearnset),
+    [SPECIES_THROH] = TEACHABLE_LEARNSET(sThrohTeachableLearnset),
+    [SPECIES_SAWK] = TEACHABLE_LEARNSET(sSawkTeachableLearnset),
+    [SPECIES_SEWADDLE] = TEACHABLE_LEARNSET(sSewaddleTeachableLearnset),
+    [SPECIES_SWADLOON] = TEACHABLE_LEARNSET(sSwadloonTeachableLearnset),
+    [SPECIES_LEAVANNY] = TEACHABLE_LEARNSET(sLeavannyTeachableLearnset),
+    [SPECIES_VENIPEDE] = TEACHABLE_LEARNSET(sVenipedeTeachableLearnset),
+    [SPECIES_WHIRLIPEDE] = TEACHABLE_LEARNSET(sWhirlipedeTeachableLearnset),
+    [SPECIES_SCOLIPEDE] = TEACHABLE_LEARNSET(sScolipedeTeachableLearnset),
+    [SPECIES_COTTONEE] = TEACHABLE_LEARNSET(sCottoneeTeachableLearnset),
+    [SPECIES_WHIMSICOTT] = TEACHABLE_LEARNSET(sWhimsicottTeachableLearnset),
+    [SPECIES_PETILIL] = TEACHABLE_LEARNSET(sPetililTeachableLearnset),
+    [SPECIES_LILLIGANT] = TEACHABLE_LEARNSET(sLilligantTeachableLearnset),
+    [SPECIES_BASCULIN] = TEACHABLE_LEARNSET(sBasculinTeachableLearnset),
+    [SPECIES_SANDILE] = TEACHABLE_LEARNSET(sSandileTeachableLearnset),
+    [SPECIES_KROKOROK] = TEACHABLE_LEARNSET(sKrokorokTeachableLearnset),
+    [SPECIES_KROOKODILE] = TEACHABLE_LEARNSET(sKrookodileTeachableLearnset),
+    [SPECIES_DARUMAKA] = TEACHABLE_LEARNSET(sDarumakaTeachableLearnset),
+    [SPECIES_DARMANITAN] = TEACHABLE_LEARNSET(sDarmanitanTeachableLearnset),
+    [SPECIES_MARACTUS] = TEACHABLE_LEARNSET(sMaractusTeachableLearnset),
+    [SPECIES_DWEBBLE] = TEACHABLE_LEARNSET(sDwebbleTeachableLearnset),
+    [SPECIES_CRUSTLE] = TEACHABLE_LEARNSET(sCrustleTeachableLearnset),
+    [SPECIES_SCRAGGY] = TEACHABLE_LEARNSET(sScraggyTeachableLearnset),
+    [SPECIES_SCRAFTY] = TEACHABLE_LEARNSET(sScraftyTeachableLearnset),
+    [SPECIES_SIGILYPH] = TEACHABLE_LEARNSET(sSigilyphTeachableLearnset),
+    [SPECIES_YAMASK] = TEACHABLE_LEARNSET(sYamaskTeachableLearnset),
+    [SPECIES_COFAGRIGUS] = TEACHABLE_LEARNSET(sCofagrigusTeachableLearnset),
+    [SPECIES_TIRTOUGA] = TEACHABLE_LEARNSET(sTirtougaTeachableLearnset),
+    [SPECIES_CARRACOSTA] = TEACHABLE_LEARNSET(sCarracostaTeachableLearnset),
+    [SPECIES_ARCHEN] = TEACHABLE_LEARNSET(sArchenTeachableLearnset),
+    [SPECIES_ARCHEOPS] = TEACHABLE_LEARNSET(sArcheopsTeachableLearnset),
+    [SPECIES_TRUBBISH] = TEACHABLE_LEARNSET(sTrubbishTeachableLearnset),
+    [SPECIES_GARBODOR] = TEACHABLE_LEARNSET(sGarbodorTeachableLearnset),
+    [SPECIES_ZORUA] = TEACHABLE_LEARNSET(sZoruaTeachableLearnset),
+    [SPECIES_ZOROARK] = TEACHABLE_LEARNSET(sZoroarkTeachableLearnset),
+    [SPECIES_MINCCINO] = TEACHABLE_LEARNSET(sMinccinoTeachableLearnset),
+    [SPECIES_CINCCINO] = TEACHABLE_LEARNSET(sCinccinoTeachableLearnset),
+    [SPECIES_GOTHITA] = TEACHABLE_LEARNSET(sGothitaTeachableLearnset),
+    [SPECIES_GOTHORITA] = TEACHABLE_LEARNSET(sGothoritaTeachableLearnset),
+    [SPECIES_GOTHITELLE] = TEACHABLE_LEARNSET(sGothitelleTeachableLearnset),
+    [SPECIES_SOLOSIS] = TEACHABLE_LEARNSET(sSolosisTeachableLearnset),
+    [SPECIES_DUOSION] = TEACHABLE_LEARNSET(sDuosionTeachableLearnset),
+    [SPECIES_REUNICLUS] = TEACHABLE_LEARNSET(sReuniclusTeachableLearnset),
+    [SPECIES_DUCKLETT] = TEACHABLE_LEARNSET(sDucklettTeachableLearnset),
+    [SPECIES_SWANNA] = TEACHABLE_LEARNSET(sSwannaTeachableLearnset),
+    [SPECIES_VANILLITE] = TEACHABLE_LEARNSET(sVanilliteTeachableLearnset),
+    [SPECIES_VANILLISH] = TEACHABLE_LEARNSET(sVanillishTeachableLearnset),
+    [SPECIES_VANILLUXE] = TEACHABLE_LEARNSET(sVanilluxeTeachableLearnset),
+    [SPECIES_DEERLING] = TEACHABLE_LEARNSET(sDeerlingTeachableLearnset),
+    [SPECIES_SAWSBUCK] = TEACHABLE_LEARNSET(sSawsbuckTeachableLearnset),
+    [SPECIES_EMOLGA] = TEACHABLE_LEARNSET(sEmolgaTeachableLearnset),
+    [SPECIES_KARRABLAST] = TEACHABLE_LEARNSET(sKarrablastTeachableLearnset),
+    [SPECIES_ESCAVALIER] = TEACHABLE_LEARNSET(sEscavalierTeachableLearnset),
+    [SPECIES_FOONGUS] = TEACHABLE_LEARNSET(sFoongusTeachableLearnset),
+    [SPECIES_AMOONGUSS] = TEACHABLE_LEARNSET(sAmoongussTeachableLearnset),
+    [SPECIES_FRILLISH] = TEACHABLE_LEARNSET(sFrillishTeachableLearnset),
+    [SPECIES_JELLICENT] = TEACHABLE_LEARNSET(sJellicentTeachableLearnset),
+    [SPECIES_ALOMOMOLA] = TEACHABLE_LEARNSET(sAlomomolaTeachableLearnset),
+    [SPECIES_JOLTIK] = TEACHABLE_LEARNSET(sJoltikTeachableLearnset),
+    [SPECIES_GALVANTULA] = TEACHABLE_LEARNSET(sGalvantulaTeachableLearnset),
+    [SPECIES_FERROSEED] = TEACHABLE_LEARNSET(sFerroseedTeachableLearnset),
+    [SPECIES_FERROTHORN] = TEACHABLE_LEARNSET(sFerrothornTeachableLearnset),
+    [SPECIES_KLINK] = TEACHABLE_LEARNSET(sKlinkTeachableLearnset),
+    [SPECIES_KLANG] = TEACHABLE_LEARNSET(sKlangTeachableLearnset),
+    [SPECIES_KLINKLANG] = TEACHABLE_LEARNSET(sKlinklangTeachableLearnset),
+    [SPECIES_TYNAMO] = TEACHABLE_LEARNSET(sTynamoTeachableLearnset),
+    [SPECIES_EELEKTRIK] = TEACHABLE_LEARNSET(sEelektrikTeachableLearnset),
+    [SPECIES_EELEKTROSS] = TEACHABLE_LEARNSET(sEelektrossTeachableLearnset),
+    [SPECIES_ELGYEM] = TEACHABLE_LEARNSET(sElgyemTeachableLearnset),
+    [SPECIES_BEHEEYEM] = TEACHABLE_LEARNSET(sBeheeyemTeachableLearnset),
+    [SPECIES_LITWICK] = TEACHABLE_LEARNSET(sLitwickTeachableLearnset),
+    [SPECIES_LAMPENT] = TEACHABLE_LEARNSET(sLampentTeachableLearnset),
+    [SPECIES_CHANDELURE] = TEACHABLE_LEARNSET(sChandelureTeachableLearnset),
+    [SPECIES_AXEW] = TEACHABLE_LEARNSET(sAxewTeachableLearnset),
+    [SPECIES_FRAXURE] = TEACHABLE_LEARNSET(sFraxureTeachableLearnset),
+    [SPECIES_HAXORUS] = TEACHABLE_LEARNSET(sHaxorusTeachableLearnset),
+    [SPECIES_CUBCHOO] = TEACHABLE_LEARNSET(sCubchooTeachableLearnset),
+    [SPECIES_BEARTIC] = TEACHABLE_LEARNSET(sBearticTeachableLearnset),
+    [SPECIES_CRYOGONAL] = TEACHABLE_LEARNSET(sCryogonalTeachableLearnset),
+    [SPECIES_SHELMET] = TEACHABLE_LEARNSET(sShelmetTeachableLearnset),
+    [SPECIES_ACCELGOR] = TEACHABLE_LEARNSET(sAccelgorTeachableLearnset),
+    [SPECIES_STUNFISK] = TEACHABLE_LEARNSET(sStunfiskTeachableLearnset),
+    [SPECIES_MIENFOO] = TEACHABLE_LEARNSET(sMienfooTeachableLearnset),
+    [SPECIES_MIENSHAO] = TEACHABLE_LEARNSET(sMienshaoTeachableLearnset),
+    [SPECIES_DRUDDIGON] = TEACHABLE_LEARNSET(sDruddigonTeachableLearnset),
+    [SPECIES_GOLETT] = TEACHABLE_LEARNSET(sGolettTeachableLearnset),
+    [SPECIES_GOLURK] = TEACHABLE_LEARNSET(sGolurkTeachableLearnset),
+    [SPECIES_PAWNIARD] = TEACHABLE_LEARNSET(sPawniardTeachableLearnset),
+    [SPECIES_BISHARP] = TEACHABLE_LEARNSET(sBisharpTeachableLearnset),
+    [SPECIES_BOUFFALANT] = TEACHABLE_LEARNSET(sBouffalantTeachableLearnset),
+    [SPECIES_RUFFLET] = TEACHABLE_LEARNSET(sRuffletTeachableLearnset),
+    [SPECIES_BRAVIARY] = TEACHABLE_LEARNSET(sBraviaryTeachableLearnset),
+    [SPECIES_VULLABY] = TEACHABLE_LEARNSET(sVullabyTeachableLearnset),
+    [SPECIES_MANDIBUZZ] = TEACHABLE_LEARNSET(sMandibuzzTeachableLearnset),
+    [SPECIES_HEATMOR] = TEACHABLE_LEARNSET(sHeatmorTeachableLearnset),
+    [SPECIES_DURANT] = TEACHABLE_LEARNSET(sDurantTeachableLearnset),
+    [SPECIES_DEINO] = TEACHABLE_LEARNSET(sDeinoTeachableLearnset),
+    [SPECIES_ZWEILOUS] = TEACHABLE_LEARNSET(sZweilousTeachableLearnset),
+    [SPECIES_HYDREIGON] = TEACHABLE_LEARNSET(sHydreigonTeachableLearnset),
+    [SPECIES_LARVESTA] = TEACHABLE_LEARNSET(sLarvestaTeachableLearnset),
+    [SPECIES_VOLCARONA] = TEACHABLE_LEARNSET(sVolcaronaTeachableLearnset),
+    [SPECIES_COBALION] = TEACHABLE_LEARNSET(sCobalionTeachableLearnset),
+    [SPECIES_TERRAKION] = TEACHABLE_LEARNSET(sTerrakionTeachableLearnset),
+    [SPECIES_VIRIZION] = TEACHABLE_LEARNSET(sVirizionTeachableLearnset),
+    [SPECIES_TORNADUS] = TEACHABLE_LEARNSET(sTornadusTeachableLearnset),
+    [SPECIES_THUNDURUS] = TEACHABLE_LEARNSET(sThundurusTeachableLearnset),
+    [SPECIES_RESHIRAM] = TEACHABLE_LEARNSET(sReshiramTeachableLearnset),
+    [SPECIES_ZEKROM] = TEACHABLE_LEARNSET(sZekromTeachableLearnset),
+    [SPECIES_LANDORUS] = TEACHABLE_LEARNSET(sLandorusTeachableLearnset),
+    [SPECIES_KYUREM] = TEACHABLE_LEARNSET(sKyuremTeachableLearnset),
+    [SPECIES_KELDEO] = TEACHABLE_LEARNSET(sKeldeoTeachableLearnset),
+    [SPECIES_MELOETTA] = TEACHABLE_LEARNSET(sMeloettaTeachableLearnset),
+    [SPECIES_GENESECT] = TEACHABLE_LEARNSET(sGenesectTeachableLearnset),
 #endif
 #if P_GEN_6_POKEMON == TRUE
-    [SPECIES_CHESPIN] = sChespinTeachableLearnset,
-    [SPECIES_QUILLADIN] = sQuilladinTeachableLearnset,
-    [SPECIES_CHESNAUGHT] = sChesnaughtTeachableLearnset,
-    [SPECIES_FENNEKIN] = sFennekinTeachableLearnset,
-    [SPECIES_BRAIXEN] = sBraixenTeachableLearnset,
-    [SPECIES_DELPHOX] = sDelphoxTeachableLearnset,
-    [SPECIES_FROAKIE] = sFroakieTeachableLearnset,
-    [SPECIES_FROGADIER] = sFrogadierTeachableLearnset,
-    [SPECIES_GRENINJA] = sGreninjaTeachableLearnset,
-    [SPECIES_BUNNELBY] = sBunnelbyTeachableLearnset,
-    [SPECIES_DIGGERSBY] = sDiggersbyTeachableLearnset,
-    [SPECIES_FLETCHLING] = sFletchlingTeachableLearnset,
-    [SPECIES_FLETCHINDER] = sFletchinderTeachableLearnset,
-    [SPECIES_TALONFLAME] = sTalonflameTeachableLearnset,
-    [SPECIES_SCATTERBUG] = sScatterbugTeachableLearnset,
-    [SPECIES_SPEWPA] = sSpewpaTeachableLearnset,
-    [SPECIES_VIVILLON] = sVivillonTeachableLearnset,
-    [SPECIES_LITLEO] = sLitleoTeachableLearnset,
-    [SPECIES_PYROAR] = sPyroarTeachableLearnset,
-    [SPECIES_FLABEBE] = sFlabebeTeachableLearnset,
-    [SPECIES_FLOETTE] = sFloetteTeachableLearnset,
-    [SPECIES_FLORGES] = sFlorgesTeachableLearnset,
-    [SPECIES_SKIDDO] = sSkiddoTeachableLearnset,
-    [SPECIES_GOGOAT] = sGogoatTeachableLearnset,
-    [SPECIES_PANCHAM] = sPanchamTeachableLearnset,
-    [SPECIES_PANGORO] = sPangoroTeachableLearnset,
-    [SPECIES_FURFROU] = sFurfrouTeachableLearnset,
-    [SPECIES_ESPURR] = sEspurrTeachableLearnset,
-    [SPECIES_MEOWSTIC] = sMeowsticTeachableLearnset,
-    [SPECIES_HONEDGE] = sHonedgeTeachableLearnset,
-    [SPECIES_DOUBLADE] = sDoubladeTeachableLearnset,
-    [SPECIES_AEGISLASH] = sAegislashTeachableLearnset,
-    [SPECIES_SPRITZEE] = sSpritzeeTeachableLearnset,
-    [SPECIES_AROMATISSE] = sAromatisseTeachableLearnset,
-    [SPECIES_SWIRLIX] = sSwirlixTeachableLearnset,
-    [SPECIES_SLURPUFF] = sSlurpuffTeachableLearnset,
-    [SPECIES_INKAY] = sInkayTeachableLearnset,
-    [SPECIES_MALAMAR] = sMalamarTeachableLearnset,
-    [SPECIES_BINACLE] = sBinacleTeachableLearnset,
-    [SPECIES_BARBARACLE] = sBarbaracleTeachableLearnset,
-    [SPECIES_SKRELP] = sSkrelpTeachableLearnset,
-    [SPECIES_DRAGALGE] = sDragalgeTeachableLearnset,
-    [SPECIES_CLAUNCHER] = sClauncherTeachableLearnset,
-    [SPECIES_CLAWITZER] = sClawitzerTeachableLearnset,
-    [SPECIES_HELIOPTILE] = sHelioptileTeachableLearnset,
-    [SPECIES_HELIOLISK] = sHelioliskTeachableLearnset,
-    [SPECIES_TYRUNT] = sTyruntTeachableLearnset,
-    [SPECIES_TYRANTRUM] = sTyrantrumTeachableLearnset,
-    [SPECIES_AMAURA] = sAmauraTeachableLearnset,
-    [SPECIES_AURORUS] = sAurorusTeachableLearnset,
-    [SPECIES_SYLVEON] = sSylveonTeachableLearnset,
-    [SPECIES_HAWLUCHA] = sHawluchaTeachableLearnset,
-    [SPECIES_DEDENNE] = sDedenneTeachableLearnset,
-    [SPECIES_CARBINK] = sCarbinkTeachableLearnset,
-    [SPECIES_GOOMY] = sGoomyTeachableLearnset,
-    [SPECIES_SLIGGOO] = sSliggooTeachableLearnset,
-    [SPECIES_GOODRA] = sGoodraTeachableLearnset,
-    [SPECIES_KLEFKI] = sKlefkiTeachableLearnset,
-    [SPECIES_PHANTUMP] = sPhantumpTeachableLearnset,
-    [SPECIES_TREVENANT] = sTrevenantTeachableLearnset,
-    [SPECIES_PUMPKABOO] = sPumpkabooTeachableLearnset,
-    [SPECIES_GOURGEIST] = sGourgeistTeachableLearnset,
-    [SPECIES_BERGMITE] = sBergmiteTeachableLearnset,
-    [SPECIES_AVALUGG] = sAvaluggTeachableLearnset,
-    [SPECIES_NOIBAT] = sNoibatTeachableLearnset,
-    [SPECIES_NOIVERN] = sNoivernTeachableLearnset,
-    [SPECIES_XERNEAS] = sXerneasTeachableLearnset,
-    [SPECIES_YVELTAL] = sYveltalTeachableLearnset,
-    [SPECIES_ZYGARDE] = sZygardeTeachableLearnset,
-    [SPECIES_DIANCIE] = sDiancieTeachableLearnset,
-    [SPECIES_HOOPA] = sHoopaTeachableLearnset,
-    [SPECIES_VOLCANION] = sVolcanionTeachableLearnset,
+    [SPECIES_CHESPIN] = TEACHABLE_LEARNSET(sChespinTeachableLearnset),
+    [SPECIES_QUILLADIN] = TEACHABLE_LEARNSET(sQuilladinTeachableLearnset),
+    [SPECIES_CHESNAUGHT] = TEACHABLE_LEARNSET(sChesnaughtTeachableLearnset),
+    [SPECIES_FENNEKIN] = TEACHABLE_LEARNSET(sFennekinTeachableLearnset),
+    [SPECIES_BRAIXEN] = TEACHABLE_LEARNSET(sBraixenTeachableLearnset),
+    [SPECIES_DELPHOX] = TEACHABLE_LEARNSET(sDelphoxTeachableLearnset),
+    [SPECIES_FROAKIE] = TEACHABLE_LEARNSET(sFroakieTeachableLearnset),
+    [SPECIES_FROGADIER] = TEACHABLE_LEARNSET(sFrogadierTeachableLearnset),
+    [SPECIES_GRENINJA] = TEACHABLE_LEARNSET(sGreninjaTeachableLearnset),
+    [SPECIES_BUNNELBY] = TEACHABLE_LEARNSET(sBunnelbyTeachableLearnset),
+    [SPECIES_DIGGERSBY] = TEACHABLE_LEARNSET(sDiggersbyTeachableLearnset),
+    [SPECIES_FLETCHLING] = TEACHABLE_LEARNSET(sFletchlingTeachableLearnset),
+    [SPECIES_FLETCHINDER] = TEACHABLE_LEARNSET(sFletchinderTeachableLearnset),
+    [SPECIES_TALONFLAME] = TEACHABLE_LEARNSET(sTalonflameTeachableLearnset),
+    [SPECIES_SCATTERBUG] = TEACHABLE_LEARNSET(sScatterbugTeachableLearnset),
+    [SPECIES_SPEWPA] = TEACHABLE_LEARNSET(sSpewpaTeachableLearnset),
+    [SPECIES_VIVILLON] = TEACHABLE_LEARNSET(sVivillonTeachableLearnset),
+    [SPECIES_LITLEO] = TEACHABLE_LEARNSET(sLitleoTeachableLearnset),
+    [SPECIES_PYROAR] = TEACHABLE_LEARNSET(sPyroarTeachableLearnset),
+    [SPECIES_FLABEBE] = TEACHABLE_LEARNSET(sFlabebeTeachableLearnset),
+    [SPECIES_FLOETTE] = TEACHABLE_LEARNSET(sFloetteTeachableLearnset),
+    [SPECIES_FLORGES] = TEACHABLE_LEARNSET(sFlorgesTeachableLearnset),
+    [SPECIES_SKIDDO] = TEACHABLE_LEARNSET(sSkiddoTeachableLearnset),
+    [SPECIES_GOGOAT] = TEACHABLE_LEARNSET(sGogoatTeachableLearnset),
+    [SPECIES_PANCHAM] = TEACHABLE_LEARNSET(sPanchamTeachableLearnset),
+    [SPECIES_PANGORO] = TEACHABLE_LEARNSET(sPangoroTeachableLearnset),
+    [SPECIES_FURFROU] = TEACHABLE_LEARNSET(sFurfrouTeachableLearnset),
+    [SPECIES_ESPURR] = TEACHABLE_LEARNSET(sEspurrTeachableLearnset),
+    [SPECIES_MEOWSTIC] = TEACHABLE_LEARNSET(sMeowsticTeachableLearnset),
+    [SPECIES_HONEDGE] = TEACHABLE_LEARNSET(sHonedgeTeachableLearnset),
+    [SPECIES_DOUBLADE] = TEACHABLE_LEARNSET(sDoubladeTeachableLearnset),
+    [SPECIES_AEGISLASH] = TEACHABLE_LEARNSET(sAegislashTeachableLearnset),
+    [SPECIES_SPRITZEE] = TEACHABLE_LEARNSET(sSpritzeeTeachableLearnset),
+    [SPECIES_AROMATISSE] = TEACHABLE_LEARNSET(sAromatisseTeachableLearnset),
+    [SPECIES_SWIRLIX] = TEACHABLE_LEARNSET(sSwirlixTeachableLearnset),
+    [SPECIES_SLURPUFF] = TEACHABLE_LEARNSET(sSlurpuffTeachableLearnset),
+    [SPECIES_INKAY] = TEACHABLE_LEARNSET(sInkayTeachableLearnset),
+    [SPECIES_MALAMAR] = TEACHABLE_LEARNSET(sMalamarTeachableLearnset),
+    [SPECIES_BINACLE] = TEACHABLE_LEARNSET(sBinacleTeachableLearnset),
+    [SPECIES_BARBARACLE] = TEACHABLE_LEARNSET(sBarbaracleTeachableLearnset),
+    [SPECIES_SKRELP] = TEACHABLE_LEARNSET(sSkrelpTeachableLearnset),
+    [SPECIES_DRAGALGE] = TEACHABLE_LEARNSET(sDragalgeTeachableLearnset),
+    [SPECIES_CLAUNCHER] = TEACHABLE_LEARNSET(sClauncherTeachableLearnset),
+    [SPECIES_CLAWITZER] = TEACHABLE_LEARNSET(sClawitzerTeachableLearnset),
+    [SPECIES_HELIOPTILE] = TEACHABLE_LEARNSET(sHelioptileTeachableLearnset),
+    [SPECIES_HELIOLISK] = TEACHABLE_LEARNSET(sHelioliskTeachableLearnset),
+    [SPECIES_TYRUNT] = TEACHABLE_LEARNSET(sTyruntTeachableLearnset),
+    [SPECIES_TYRANTRUM] = TEACHABLE_LEARNSET(sTyrantrumTeachableLearnset),
+    [SPECIES_AMAURA] = TEACHABLE_LEARNSET(sAmauraTeachableLearnset),
+    [SPECIES_AURORUS] = TEACHABLE_LEARNSET(sAurorusTeachableLearnset),
+    [SPECIES_SYLVEON] = TEACHABLE_LEARNSET(sSylveonTeachableLearnset),
+    [SPECIES_HAWLUCHA] = TEACHABLE_LEARNSET(sHawluchaTeachableLearnset),
+    [SPECIES_DEDENNE] = TEACHABLE_LEARNSET(sDedenneTeachableLearnset),
+    [SPECIES_CARBINK] = TEACHABLE_LEARNSET(sCarbinkTeachableLearnset),
+    [SPECIES_GOOMY] = TEACHABLE_LEARNSET(sGoomyTeachableLearnset),
+    [SPECIES_SLIGGOO] = TEACHABLE_LEARNSET(sSliggooTeachableLearnset),
+    [SPECIES_GOODRA] = TEACHABLE_LEARNSET(sGoodraTeachableLearnset),
+    [SPECIES_KLEFKI] = TEACHABLE_LEARNSET(sKlefkiTeachableLearnset),
+    [SPECIES_PHANTUMP] = TEACHABLE_LEARNSET(sPhantumpTeachableLearnset),
+    [SPECIES_TREVENANT] = TEACHABLE_LEARNSET(sTrevenantTeachableLearnset),
+    [SPECIES_PUMPKABOO] = TEACHABLE_LEARNSET(sPumpkabooTeachableLearnset),
+    [SPECIES_GOURGEIST] = TEACHABLE_LEARNSET(sGourgeistTeachableLearnset),
+    [SPECIES_BERGMITE] = TEACHABLE_LEARNSET(sBergmiteTeachableLearnset),
+    [SPECIES_AVALUGG] = TEACHABLE_LEARNSET(sAvaluggTeachableLearnset),
+    [SPECIES_NOIBAT] = TEACHABLE_LEARNSET(sNoibatTeachableLearnset),
+    [SPECIES_NOIVERN] = TEACHABLE_LEARNSET(sNoivernTeachableLearnset),
+    [SPECIES_XERNEAS] = TEACHABLE_LEARNSET(sXerneasTeachableLearnset),
+    [SPECIES_YVELTAL] = TEACHABLE_LEARNSET(sYveltalTeachableLearnset),
+    [SPECIES_ZYGARDE] = TEACHABLE_LEARNSET(sZygardeTeachableLearnset),
+    [SPECIES_DIANCIE] = TEACHABLE_LEARNSET(sDiancieTeachableLearnset),
+    [SPECIES_HOOPA] = TEACHABLE_LEARNSET(sHoopaTeachableLearnset),
+    [SPECIES_VOLCANION] = TEACHABLE_LEARNSET(sVolcanionTeachableLearnset),
 #endif
 #if P_GEN_7_POKEMON == TRUE
-    [SPECIES_ROWLET] = sRowletTeachableLearnset,
-    [SPECIES_DARTRIX] = sDartrixTeachableLearnset,
-    [SPECIES_DECIDUEYE] = sDecidueyeTeachableLearnset,
-    [SPECIES_LITTEN] = sLittenTeachableLearnset,
-    [SPECIES_TORRACAT] = sTorracatTeachableLearnset,
-    [SPECIES_INCINEROAR] = sIncineroarTeachableLearnset,
-    [SPECIES_POPPLIO] = sPopplioTeachableLearnset,
-    [SPECIES_BRIONNE] = sBrionneTeachableLearnset,
-    [SPECIES_PRIMARINA] = sPrimarinaTeachableLearnset,
-    [SPECIES_PIKIPEK] = sPikipekTeachableLearnset,
-    [SPECIES_TRUMBEAK] = sTrumbeakTeachableLearnset,
-    [SPECIES_TOUCANNON] = sToucannonTeachableLearnset,
-    [SPECIES_YUNGOOS] = sYungoosTeachableLearnset,
-    [SPECIES_GUMSHOOS] = sGumshoosTeachableLearnset,
-    [SPECIES_GRUBBIN] = sGrubbinTeachableLearnset,
-    [SPECIES_CHARJABUG] = sCharjabugTeachableLearnset,
-    [SPECIES_VIKAVOLT] = sVikavoltTeachableLearnset,
-    [SPECIES_CRABRAWLER] = sCrabrawlerTeachableLearnset,
-    [SPECIES_CRABOMINABLE] = sCrabominableTeachableLearnset,
-    [SPECIES_ORICORIO] = sOricorioTeachableLearnset,
-    [SPECIES_CUTIEFLY] = sCutieflyTeachableLearnset,
-    [SPECIES_RIBOMBEE] = sRibombeeTeachableLearnset,
-    [SPECIES_ROCKRUFF] = sRockruffTeachableLearnset,
-    [SPECIES_LYCANROC] = sLycanrocTeachableLearnset,
-    [SPECIES_WISHIWASHI] = sWishiwashiTeachableLearnset,
-    [SPECIES_MAREANIE] = sMareanieTeachableLearnset,
-    [SPECIES_TOXAPEX] = sToxapexTeachableLearnset,
-    [SPECIES_MUDBRAY] = sMudbrayTeachableLearnset,
-    [SPECIES_MUDSDALE] = sMudsdaleTeachableLearnset,
-    [SPECIES_DEWPIDER] = sDewpiderTeachableLearnset,
-    [SPECIES_ARAQUANID] = sAraquanidTeachableLearnset,
-    [SPECIES_FOMANTIS] = sFomantisTeachableLearnset,
-    [SPECIES_LURANTIS] = sLurantisTeachableLearnset,
-    [SPECIES_MORELULL] = sMorelullTeachableLearnset,
-    [SPECIES_SHIINOTIC] = sShiinoticTeachableLearnset,
-    [SPECIES_SALANDIT] = sSalanditTeachableLearnset,
-    [SPECIES_SALAZZLE] = sSalazzleTeachableLearnset,
-    [SPECIES_STUFFUL] = sStuffulTeachableLearnset,
-    [SPECIES_BEWEAR] = sBewearTeachableLearnset,
-    [SPECIES_BOUNSWEET] = sBounsweetTeachableLearnset,
-    [SPECIES_STEENEE] = sSteeneeTeachableLearnset,
-    [SPECIES_TSAREENA] = sTsareenaTeachableLearnset,
-    [SPECIES_COMFEY] = sComfeyTeachableLearnset,
-    [SPECIES_ORANGURU] = sOranguruTeachableLearnset,
-    [SPECIES_PASSIMIAN] = sPassimianTeachableLearnset,
-    [SPECIES_WIMPOD] = sWimpodTeachableLearnset,
-    [SPECIES_GOLISOPOD] = sGolisopodTeachableLearnset,
-    [SPECIES_SANDYGAST] = sSandygastTeachableLearnset,
-    [SPECIES_PALOSSAND] = sPalossandTeachableLearnset,
-    [SPECIES_PYUKUMUKU] = sPyukumukuTeachableLearnset,
-    [SPECIES_TYPE_NULL] = sTypeNullTeachableLearnset,
-    [SPECIES_SILVALLY] = sSilvallyTeachableLearnset,
-    [SPECIES_MINIOR] = sMiniorTeachableLearnset,
-    [SPECIES_KOMALA] = sKomalaTeachableLearnset,
-    [SPECIES_TURTONATOR] = sTurtonatorTeachableLearnset,
-    [SPECIES_TOGEDEMARU] = sTogedemaruTeachableLearnset,
-    [SPECIES_MIMIKYU] = sMimikyuTeachableLearnset,
-    [SPECIES_BRUXISH] = sBruxishTeachableLearnset,
-    [SPECIES_DRAMPA] = sDrampaTeachableLearnset,
-    [SPECIES_DHELMISE] = sDhelmiseTeachableLearnset,
-    [SPECIES_JANGMO_O] = sJangmoOTeachableLearnset,
-    [SPECIES_HAKAMO_O] = sHakamoOTeachableLearnset,
-    [SPECIES_KOMMO_O] = sKommoOTeachableLearnset,
-    [SPECIES_TAPU_KOKO] = sTapuKokoTeachableLearnset,
-    [SPECIES_TAPU_LELE] = sTapuLeleTeachableLearnset,
-    [SPECIES_TAPU_BULU] = sTapuBuluTeachableLearnset,
-    [SPECIES_TAPU_FINI] = sTapuFiniTeachableLearnset,
-    [SPECIES_COSMOG] = sCosmogTeachableLearnset,
-    [SPECIES_COSMOEM] = sCosmoemTeachableLearnset,
-    [SPECIES_SOLGALEO] = sSolgaleoTeachableLearnset,
-    [SPECIES_LUNALA] = sLunalaTeachableLearnset,
-    [SPECIES_NIHILEGO] = sNihilegoTeachableLearnset,
-    [SPECIES_BUZZWOLE] = sBuzzwoleTeachableLearnset,
-    [SPECIES_PHEROMOSA] = sPheromosaTeachableLearnset,
-    [SPECIES_XURKITREE] = sXurkitreeTeachableLearnset,
-    [SPECIES_CELESTEELA] = sCelesteelaTeachableLearnset,
-    [SPECIES_KARTANA] = sKartanaTeachableLearnset,
-    [SPECIES_GUZZLORD] = sGuzzlordTeachableLearnset,
-    [SPECIES_NECROZMA] = sNecrozmaTeachableLearnset,
-    [SPECIES_MAGEARNA] = sMagearnaTeachableLearnset,
-    [SPECIES_MARSHADOW] = sMarshadowTeachableLearnset,
-    [SPECIES_POIPOLE] = sPoipoleTeachableLearnset,
-    [SPECIES_NAGANADEL] = sNaganadelTeachableLearnset,
-    [SPECIES_STAKATAKA] = sStakatakaTeachableLearnset,
-    [SPECIES_BLACEPHALON] = sBlacephalonTeachableLearnset,
-    [SPECIES_ZERAORA] = sZeraoraTeachableLearnset,
-    [SPECIES_MELTAN] = sMeltanTeachableLearnset,
-    [SPECIES_MELMETAL] = sMelmetalTeachableLearnset,
+    [SPECIES_ROWLET] = TEACHABLE_LEARNSET(sRowletTeachableLearnset),
+    [SPECIES_DARTRIX] = TEACHABLE_LEARNSET(sDartrixTeachableLearnset),
+    [SPECIES_DECIDUEYE] = TEACHABLE_LEARNSET(sDecidueyeTeachableLearnset),
+    [SPECIES_LITTEN] = TEACHABLE_LEARNSET(sLittenTeachableLearnset),
+    [SPECIES_TORRACAT] = TEACHABLE_LEARNSET(sTorracatTeachableLearnset),
+    [SPECIES_INCINEROAR] = TEACHABLE_LEARNSET(sIncineroarTeachableLearnset),
+    [SPECIES_POPPLIO] = TEACHABLE_LEARNSET(sPopplioTeachableLearnset),
+    [SPECIES_BRIONNE] = TEACHABLE_LEARNSET(sBrionneTeachableLearnset),
+    [SPECIES_PRIMARINA] = TEACHABLE_LEARNSET(sPrimarinaTeachableLearnset),
+    [SPECIES_PIKIPEK] = TEACHABLE_LEARNSET(sPikipekTeachableLearnset),
+    [SPECIES_TRUMBEAK] = TEACHABLE_LEARNSET(sTrumbeakTeachableLearnset),
+    [SPECIES_TOUCANNON] = TEACHABLE_LEARNSET(sToucannonTeachableLearnset),
+    [SPECIES_YUNGOOS] = TEACHABLE_LEARNSET(sYungoosTeachableLearnset),
+    [SPECIES_GUMSHOOS] = TEACHABLE_LEARNSET(sGumshoosTeachableLearnset),
+    [SPECIES_GRUBBIN] = TEACHABLE_LEARNSET(sGrubbinTeachableLearnset),
+    [SPECIES_CHARJABUG] = TEACHABLE_LEARNSET(sCharjabugTeachableLearnset),
+    [SPECIES_VIKAVOLT] = TEACHABLE_LEARNSET(sVikavoltTeachableLearnset),
+    [SPECIES_CRABRAWLER] = TEACHABLE_LEARNSET(sCrabrawlerTeachableLearnset),
+    [SPECIES_CRABOMINABLE] = TEACHABLE_LEARNSET(sCrabominableTeachableLearnset),
+    [SPECIES_ORICORIO] = TEACHABLE_LEARNSET(sOricorioTeachableLearnset),
+    [SPECIES_CUTIEFLY] = TEACHABLE_LEARNSET(sCutieflyTeachableLearnset),
+    [SPECIES_RIBOMBEE] = TEACHABLE_LEARNSET(sRibombeeTeachableLearnset),
+    [SPECIES_ROCKRUFF] = TEACHABLE_LEARNSET(sRockruffTeachableLearnset),
+    [SPECIES_LYCANROC] = TEACHABLE_LEARNSET(sLycanrocTeachableLearnset),
+    [SPECIES_WISHIWASHI] = TEACHABLE_LEARNSET(sWishiwashiTeachableLearnset),
+    [SPECIES_MAREANIE] = TEACHABLE_LEARNSET(sMareanieTeachableLearnset),
+    [SPECIES_TOXAPEX] = TEACHABLE_LEARNSET(sToxapexTeachableLearnset),
+    [SPECIES_MUDBRAY] = TEACHABLE_LEARNSET(sMudbrayTeachableLearnset),
+    [SPECIES_MUDSDALE] = TEACHABLE_LEARNSET(sMudsdaleTeachableLearnset),
+    [SPECIES_DEWPIDER] = TEACHABLE_LEARNSET(sDewpiderTeachableLearnset),
+    [SPECIES_ARAQUANID] = TEACHABLE_LEARNSET(sAraquanidTeachableLearnset),
+    [SPECIES_FOMANTIS] = TEACHABLE_LEARNSET(sFomantisTeachableLearnset),
+    [SPECIES_LURANTIS] = TEACHABLE_LEARNSET(sLurantisTeachableLearnset),
+    [SPECIES_MORELULL] = TEACHABLE_LEARNSET(sMorelullTeachableLearnset),
+    [SPECIES_SHIINOTIC] = TEACHABLE_LEARNSET(sShiinoticTeachableLearnset),
+    [SPECIES_SALANDIT] = TEACHABLE_LEARNSET(sSalanditTeachableLearnset),
+    [SPECIES_SALAZZLE] = TEACHABLE_LEARNSET(sSalazzleTeachableLearnset),
+    [SPECIES_STUFFUL] = TEACHABLE_LEARNSET(sStuffulTeachableLearnset),
+    [SPECIES_BEWEAR] = TEACHABLE_LEARNSET(sBewearTeachableLearnset),
+    [SPECIES_BOUNSWEET] = TEACHABLE_LEARNSET(sBounsweetTeachableLearnset),
+    [SPECIES_STEENEE] = TEACHABLE_LEARNSET(sSteeneeTeachableLearnset),
+    [SPECIES_TSAREENA] = TEACHABLE_LEARNSET(sTsareenaTeachableLearnset),
+    [SPECIES_COMFEY] = TEACHABLE_LEARNSET(sComfeyTeachableLearnset),
+    [SPECIES_ORANGURU] = TEACHABLE_LEARNSET(sOranguruTeachableLearnset),
+    [SPECIES_PASSIMIAN] = TEACHABLE_LEARNSET(sPassimianTeachableLearnset),
+    [SPECIES_WIMPOD] = TEACHABLE_LEARNSET(sWimpodTeachableLearnset),
+    [SPECIES_GOLISOPOD] = TEACHABLE_LEARNSET(sGolisopodTeachableLearnset),
+    [SPECIES_SANDYGAST] = TEACHABLE_LEARNSET(sSandygastTeachableLearnset),
+    [SPECIES_PALOSSAND] = TEACHABLE_LEARNSET(sPalossandTeachableLearnset),
+    [SPECIES_PYUKUMUKU] = TEACHABLE_LEARNSET(sPyukumukuTeachableLearnset),
+    [SPECIES_TYPE_NULL] = TEACHABLE_LEARNSET(sTypeNullTeachableLearnset),
+    [SPECIES_SILVALLY] = TEACHABLE_LEARNSET(sSilvallyTeachableLearnset),
+    [SPECIES_MINIOR] = TEACHABLE_LEARNSET(sMiniorTeachableLearnset),
+    [SPECIES_KOMALA] = TEACHABLE_LEARNSET(sKomalaTeachableLearnset),
+    [SPECIES_TURTONATOR] = TEACHABLE_LEARNSET(sTurtonatorTeachableLearnset),
+    [SPECIES_TOGEDEMARU] = TEACHABLE_LEARNSET(sTogedemaruTeachableLearnset),
+    [SPECIES_MIMIKYU] = TEACHABLE_LEARNSET(sMimikyuTeachableLearnset),
+    [SPECIES_BRUXISH] = TEACHABLE_LEARNSET(sBruxishTeachableLearnset),
+    [SPECIES_DRAMPA] = TEACHABLE_LEARNSET(sDrampaTeachableLearnset),
+    [SPECIES_DHELMISE] = TEACHABLE_LEARNSET(sDhelmiseTeachableLearnset),
+    [SPECIES_JANGMO_O] = TEACHABLE_LEARNSET(sJangmoOTeachableLearnset),
+    [SPECIES_HAKAMO_O] = TEACHABLE_LEARNSET(sHakamoOTeachableLearnset),
+    [SPECIES_KOMMO_O] = TEACHABLE_LEARNSET(sKommoOTeachableLearnset),
+    [SPECIES_TAPU_KOKO] = TEACHABLE_LEARNSET(sTapuKokoTeachableLearnset),
+    [SPECIES_TAPU_LELE] = TEACHABLE_LEARNSET(sTapuLeleTeachableLearnset),
+    [SPECIES_TAPU_BULU] = TEACHABLE_LEARNSET(sTapuBuluTeachableLearnset),
+    [SPECIES_TAPU_FINI] = TEACHABLE_LEARNSET(sTapuFiniTeachableLearnset),
+    [SPECIES_COSMOG] = TEACHABLE_LEARNSET(sCosmogTeachableLearnset),
+    [SPECIES_COSMOEM] = TEACHABLE_LEARNSET(sCosmoemTeachableLearnset),
+    [SPECIES_SOLGALEO] = TEACHABLE_LEARNSET(sSolgaleoTeachableLearnset),
+    [SPECIES_LUNALA] = TEACHABLE_LEARNSET(sLunalaTeachableLearnset),
+    [SPECIES_NIHILEGO] = TEACHABLE_LEARNSET(sNihilegoTeachableLearnset),
+    [SPECIES_BUZZWOLE] = TEACHABLE_LEARNSET(sBuzzwoleTeachableLearnset),
+    [SPECIES_PHEROMOSA] = TEACHABLE_LEARNSET(sPheromosaTeachableLearnset),
+    [SPECIES_XURKITREE] = TEACHABLE_LEARNSET(sXurkitreeTeachableLearnset),
+    [SPECIES_CELESTEELA] = TEACHABLE_LEARNSET(sCelesteelaTeachableLearnset),
+    [SPECIES_KARTANA] = TEACHABLE_LEARNSET(sKartanaTeachableLearnset),
+    [SPECIES_GUZZLORD] = TEACHABLE_LEARNSET(sGuzzlordTeachableLearnset),
+    [SPECIES_NECROZMA] = TEACHABLE_LEARNSET(sNecrozmaTeachableLearnset),
+    [SPECIES_MAGEARNA] = TEACHABLE_LEARNSET(sMagearnaTeachableLearnset),
+    [SPECIES_MARSHADOW] = TEACHABLE_LEARNSET(sMarshadowTeachableLearnset),
+    [SPECIES_POIPOLE] = TEACHABLE_LEARNSET(sPoipoleTeachableLearnset),
+    [SPECIES_NAGANADEL] = TEACHABLE_LEARNSET(sNaganadelTeachableLearnset),
+    [SPECIES_STAKATAKA] = TEACHABLE_LEARNSET(sStakatakaTeachableLearnset),
+    [SPECIES_BLACEPHALON] = TEACHABLE_LEARNSET(sBlacephalonTeachableLearnset),
+    [SPECIES_ZERAORA] = TEACHABLE_LEARNSET(sZeraoraTeachableLearnset),
+    [SPECIES_MELTAN] = TEACHABLE_LEARNSET(sMeltanTeachableLearnset),
+    [SPECIES_MELMETAL] = TEACHABLE_LEARNSET(sMelmetalTeachableLearnset),
 #endif
 #if P_GEN_8_POKEMON == TRUE
-    [SPECIES_GROOKEY] = sGrookeyTeachableLearnset,
-    [SPECIES_THWACKEY] = sThwackeyTeachableLearnset,
-    [SPECIES_RILLABOOM] = sRillaboomTeachableLearnset,
-    [SPECIES_SCORBUNNY] = sScorbunnyTeachableLearnset,
-    [SPECIES_RABOOT] = sRabootTeachableLearnset,
-    [SPECIES_CINDERACE] = sCinderaceTeachableLearnset,
-    [SPECIES_SOBBLE] = sSobbleTeachableLearnset,
-    [SPECIES_DRIZZILE] = sDrizzileTeachableLearnset,
-    [SPECIES_INTELEON] = sInteleonTeachableLearnset,
-    [SPECIES_SKWOVET] = sSkwovetTeachableLearnset,
-    [SPECIES_GREEDENT] = sGreedentTeachableLearnset,
-    [SPECIES_ROOKIDEE] = sRookideeTeachableLearnset,
-    [SPECIES_CORVISQUIRE] = sCorvisquireTeachableLearnset,
-    [SPECIES_CORVIKNIGHT] = sCorviknightTeachableLearnset,
-    [SPECIES_BLIPBUG] = sBlipbugTeachableLearnset,
-    [SPECIES_DOTTLER] = sDottlerTeachableLearnset,
-    [SPECIES_ORBEETLE] = sOrbeetleTeachableLearnset,
-    [SPECIES_NICKIT] = sNickitTeachableLearnset,
-    [SPECIES_THIEVUL] = sThievulTeachableLearnset,
-    [SPECIES_GOSSIFLEUR] = sGossifleurTeachableLearnset,
-    [SPECIES_ELDEGOSS] = sEldegossTeachableLearnset,
-    [SPECIES_WOOLOO] = sWoolooTeachableLearnset,
-    [SPECIES_DUBWOOL] = sDubwoolTeachableLearnset,
-    [SPECIES_CHEWTLE] = sChewtleTeachableLearnset,
-    [SPECIES_DREDNAW] = sDrednawTeachableLearnset,
-    [SPECIES_YAMPER] = sYamperTeachableLearnset,
-    [SPECIES_BOLTUND] = sBoltundTeachableLearnset,
-    [SPECIES_ROLYCOLY] = sRolycolyTeachableLearnset,
-    [SPECIES_CARKOL] = sCarkolTeachableLearnset,
-    [SPECIES_COALOSSAL] = sCoalossalTeachableLearnset,
-    [SPECIES_APPLIN] = sApplinTeachableLearnset,
-    [SPECIES_FLAPPLE] = sFlappleTeachableLearnset,
-    [SPECIES_APPLETUN] = sAppletunTeachableLearnset,
-    [SPECIES_SILICOBRA] = sSilicobraTeachableLearnset,
-    [SPECIES_SANDACONDA] = sSandacondaTeachableLearnset,
-    [SPECIES_CRAMORANT] = sCramorantTeachableLearnset,
-    [SPECIES_ARROKUDA] = sArrokudaTeachableLearnset,
-    [SPECIES_BARRASKEWDA] = sBarraskewdaTeachableLearnset,
-    [SPECIES_TOXEL] = sToxelTeachableLearnset,
-    [SPECIES_TOXTRICITY] = sToxtricityTeachableLearnset,
-    [SPECIES_SIZZLIPEDE] = sSizzlipedeTeachableLearnset,
-    [SPECIES_CENTISKORCH] = sCentiskorchTeachableLearnset,
-    [SPECIES_CLOBBOPUS] = sClobbopusTeachableLearnset,
-    [SPECIES_GRAPPLOCT] = sGrapploctTeachableLearnset,
-    [SPECIES_SINISTEA] = sSinisteaTeachableLearnset,
-    [SPECIES_POLTEAGEIST] = sPolteageistTeachableLearnset,
-    [SPECIES_HATENNA] = sHatennaTeachableLearnset,
-    [SPECIES_HATTREM] = sHattremTeachableLearnset,
-    [SPECIES_HATTERENE] = sHattereneTeachableLearnset,
-    [SPECIES_IMPIDIMP] = sImpidimpTeachableLearnset,
-    [SPECIES_MORGREM] = sMorgremTeachableLearnset,
-    [SPECIES_GRIMMSNARL] = sGrimmsnarlTeachableLearnset,
-    [SPECIES_OBSTAGOON] = sObstagoonTeachableLearnset,
-    [SPECIES_PERRSERKER] = sPerrserkerTeachableLearnset,
-    [SPECIES_CURSOLA] = sCursolaTeachableLearnset,
-    [SPECIES_SIRFETCHD] = sSirfetchdTeachableLearnset,
-    [SPECIES_MR_RIME] = sMrRimeTeachableLearnset,
-    [SPECIES_RUNERIGUS] = sRunerigusTeachableLearnset,
-    [SPECIES_MILCERY] = sMilceryTeachableLearnset,
-    [SPECIES_ALCREMIE] = sAlcremieTeachableLearnset,
-    [SPECIES_FALINKS] = sFalinksTeachableLearnset,
-    [SPECIES_PINCURCHIN] = sPincurchinTeachableLearnset,
-    [SPECIES_SNOM] = sSnomTeachableLearnset,
-    [SPECIES_FROSMOTH] = sFrosmothTeachableLearnset,
-    [SPECIES_STONJOURNER] = sStonjournerTeachableLearnset,
-    [SPECIES_EISCUE] = sEiscueTeachableLearnset,
-    [SPECIES_INDEEDEE] = sIndeedeeTeachableLearnset,
-    [SPECIES_MORPEKO] = sMorpekoTeachableLearnset,
-    [SPECIES_CUFANT] = sCufantTeachableLearnset,
-    [SPECIES_COPPERAJAH] = sCopperajahTeachableLearnset,
-    [SPECIES_DRACOZOLT] = sDracozoltTeachableLearnset,
-    [SPECIES_ARCTOZOLT] = sArctozoltTeachableLearnset,
-    [SPECIES_DRACOVISH] = sDracovishTeachableLearnset,
-    [SPECIES_ARCTOVISH] = sArctovishTeachableLearnset,
-    [SPECIES_DURALUDON] = sDuraludonTeachableLearnset,
-    [SPECIES_DREEPY] = sDreepyTeachableLearnset,
-    [SPECIES_DRAKLOAK] = sDrakloakTeachableLearnset,
-    [SPECIES_DRAGAPULT] = sDragapultTeachableLearnset,
-    [SPECIES_ZACIAN] = sZacianTeachableLearnset,
-    [SPECIES_ZAMAZENTA] = sZamazentaTeachableLearnset,
-    [SPECIES_ETERNATUS] = sEternatusTeachableLearnset,
-    [SPECIES_KUBFU] = sKubfuTeachableLearnset,
-    [SPECIES_URSHIFU] = sUrshifuTeachableLearnset,
-    [SPECIES_ZARUDE] = sZarudeTeachableLearnset,
-    [SPECIES_REGIELEKI] = sRegielekiTeachableLearnset,
-    [SPECIES_REGIDRAGO] = sRegidragoTeachableLearnset,
-    [SPECIES_GLASTRIER] = sGlastrierTeachableLearnset,
-    [SPECIES_SPECTRIER] = sSpectrierTeachableLearnset,
-    [SPECIES_CALYREX] = sCalyrexTeachableLearnset,
-    [SPECIES_WYRDEER] = sWyrdeerTeachableLearnset,
-    [SPECIES_KLEAVOR] = sKleavorTeachableLearnset,
-    [SPECIES_URSALUNA] = sUrsalunaTeachableLearnset,
-    [SPECIES_BASCULEGION] = sBasculegionTeachableLearnset,
-    [SPECIES_SNEASLER] = sSneaslerTeachableLearnset,
-    [SPECIES_OVERQWIL] = sOverqwilTeachableLearnset,
-    [SPECIES_ENAMORUS] = sEnamorusTeachableLearnset,
+    [SPECIES_GROOKEY] = TEACHABLE_LEARNSET(sGrookeyTeachableLearnset),
+    [SPECIES_THWACKEY] = TEACHABLE_LEARNSET(sThwackeyTeachableLearnset),
+    [SPECIES_RILLABOOM] = TEACHABLE_LEARNSET(sRillaboomTeachableLearnset),
+    [SPECIES_SCORBUNNY] = TEACHABLE_LEARNSET(sScorbunnyTeachableLearnset),
+    [SPECIES_RABOOT] = TEACHABLE_LEARNSET(sRabootTeachableLearnset),
+    [SPECIES_CINDERACE] = TEACHABLE_LEARNSET(sCinderaceTeachableLearnset),
+    [SPECIES_SOBBLE] = TEACHABLE_LEARNSET(sSobbleTeachableLearnset),
+    [SPECIES_DRIZZILE] = TEACHABLE_LEARNSET(sDrizzileTeachableLearnset),
+    [SPECIES_INTELEON] = TEACHABLE_LEARNSET(sInteleonTeachableLearnset),
+    [SPECIES_SKWOVET] = TEACHABLE_LEARNSET(sSkwovetTeachableLearnset),
+    [SPECIES_GREEDENT] = TEACHABLE_LEARNSET(sGreedentTeachableLearnset),
+    [SPECIES_ROOKIDEE] = TEACHABLE_LEARNSET(sRookideeTeachableLearnset),
+    [SPECIES_CORVISQUIRE] = TEACHABLE_LEARNSET(sCorvisquireTeachableLearnset),
+    [SPECIES_CORVIKNIGHT] = TEACHABLE_LEARNSET(sCorviknightTeachableLearnset),
+    [SPECIES_BLIPBUG] = TEACHABLE_LEARNSET(sBlipbugTeachableLearnset),
+    [SPECIES_DOTTLER] = TEACHABLE_LEARNSET(sDottlerTeachableLearnset),
+    [SPECIES_ORBEETLE] = TEACHABLE_LEARNSET(sOrbeetleTeachableLearnset),
+    [SPECIES_NICKIT] = TEACHABLE_LEARNSET(sNickitTeachableLearnset),
+    [SPECIES_THIEVUL] = TEACHABLE_LEARNSET(sThievulTeachableLearnset),
+    [SPECIES_GOSSIFLEUR] = TEACHABLE_LEARNSET(sGossifleurTeachableLearnset),
+    [SPECIES_ELDEGOSS] = TEACHABLE_LEARNSET(sEldegossTeachableLearnset),
+    [SPECIES_WOOLOO] = TEACHABLE_LEARNSET(sWoolooTeachableLearnset),
+    [SPECIES_DUBWOOL] = TEACHABLE_LEARNSET(sDubwoolTeachableLearnset),
+    [SPECIES_CHEWTLE] = TEACHABLE_LEARNSET(sChewtleTeachableLearnset),
+    [SPECIES_DREDNAW] = TEACHABLE_LEARNSET(sDrednawTeachableLearnset),
+    [SPECIES_YAMPER] = TEACHABLE_LEARNSET(sYamperTeachableLearnset),
+    [SPECIES_BOLTUND] = TEACHABLE_LEARNSET(sBoltundTeachableLearnset),
+    [SPECIES_ROLYCOLY] = TEACHABLE_LEARNSET(sRolycolyTeachableLearnset),
+    [SPECIES_CARKOL] = TEACHABLE_LEARNSET(sCarkolTeachableLearnset),
+    [SPECIES_COALOSSAL] = TEACHABLE_LEARNSET(sCoalossalTeachableLearnset),
+    [SPECIES_APPLIN] = TEACHABLE_LEARNSET(sApplinTeachableLearnset),
+    [SPECIES_FLAPPLE] = TEACHABLE_LEARNSET(sFlappleTeachableLearnset),
+    [SPECIES_APPLETUN] = TEACHABLE_LEARNSET(sAppletunTeachableLearnset),
+    [SPECIES_SILICOBRA] = TEACHABLE_LEARNSET(sSilicobraTeachableLearnset),
+    [SPECIES_SANDACONDA] = TEACHABLE_LEARNSET(sSandacondaTeachableLearnset),
+    [SPECIES_CRAMORANT] = TEACHABLE_LEARNSET(sCramorantTeachableLearnset),
+    [SPECIES_ARROKUDA] = TEACHABLE_LEARNSET(sArrokudaTeachableLearnset),
+    [SPECIES_BARRASKEWDA] = TEACHABLE_LEARNSET(sBarraskewdaTeachableLearnset),
+    [SPECIES_TOXEL] = TEACHABLE_LEARNSET(sToxelTeachableLearnset),
+    [SPECIES_TOXTRICITY] = TEACHABLE_LEARNSET(sToxtricityTeachableLearnset),
+    [SPECIES_SIZZLIPEDE] = TEACHABLE_LEARNSET(sSizzlipedeTeachableLearnset),
+    [SPECIES_CENTISKORCH] = TEACHABLE_LEARNSET(sCentiskorchTeachableLearnset),
+    [SPECIES_CLOBBOPUS] = TEACHABLE_LEARNSET(sClobbopusTeachableLearnset),
+    [SPECIES_GRAPPLOCT] = TEACHABLE_LEARNSET(sGrapploctTeachableLearnset),
+    [SPECIES_SINISTEA] = TEACHABLE_LEARNSET(sSinisteaTeachableLearnset),
+    [SPECIES_POLTEAGEIST] = TEACHABLE_LEARNSET(sPolteageistTeachableLearnset),
+    [SPECIES_HATENNA] = TEACHABLE_LEARNSET(sHatennaTeachableLearnset),
+    [SPECIES_HATTREM] = TEACHABLE_LEARNSET(sHattremTeachableLearnset),
+    [SPECIES_HATTERENE] = TEACHABLE_LEARNSET(sHattereneTeachableLearnset),
+    [SPECIES_IMPIDIMP] = TEACHABLE_LEARNSET(sImpidimpTeachableLearnset),
+    [SPECIES_MORGREM] = TEACHABLE_LEARNSET(sMorgremTeachableLearnset),
+    [SPECIES_GRIMMSNARL] = TEACHABLE_LEARNSET(sGrimmsnarlTeachableLearnset),
+    [SPECIES_OBSTAGOON] = TEACHABLE_LEARNSET(sObstagoonTeachableLearnset),
+    [SPECIES_PERRSERKER] = TEACHABLE_LEARNSET(sPerrserkerTeachableLearnset),
+    [SPECIES_CURSOLA] = TEACHABLE_LEARNSET(sCursolaTeachableLearnset),
+    [SPECIES_SIRFETCHD] = TEACHABLE_LEARNSET(sSirfetchdTeachableLearnset),
+    [SPECIES_MR_RIME] = TEACHABLE_LEARNSET(sMrRimeTeachableLearnset),
+    [SPECIES_RUNERIGUS] = TEACHABLE_LEARNSET(sRunerigusTeachableLearnset),
+    [SPECIES_MILCERY] = TEACHABLE_LEARNSET(sMilceryTeachableLearnset),
+    [SPECIES_ALCREMIE] = TEACHABLE_LEARNSET(sAlcremieTeachableLearnset),
+    [SPECIES_FALINKS] = TEACHABLE_LEARNSET(sFalinksTeachableLearnset),
+    [SPECIES_PINCURCHIN] = TEACHABLE_LEARNSET(sPincurchinTeachableLearnset),
+    [SPECIES_SNOM] = TEACHABLE_LEARNSET(sSnomTeachableLearnset),
+    [SPECIES_FROSMOTH] = TEACHABLE_LEARNSET(sFrosmothTeachableLearnset),
+    [SPECIES_STONJOURNER] = TEACHABLE_LEARNSET(sStonjournerTeachableLearnset),
+    [SPECIES_EISCUE] = TEACHABLE_LEARNSET(sEiscueTeachableLearnset),
+    [SPECIES_INDEEDEE] = TEACHABLE_LEARNSET(sIndeedeeTeachableLearnset),
+    [SPECIES_MORPEKO] = TEACHABLE_LEARNSET(sMorpekoTeachableLearnset),
+    [SPECIES_CUFANT] = TEACHABLE_LEARNSET(sCufantTeachableLearnset),
+    [SPECIES_COPPERAJAH] = TEACHABLE_LEARNSET(sCopperajahTeachableLearnset),
+    [SPECIES_DRACOZOLT] = TEACHABLE_LEARNSET(sDracozoltTeachableLearnset),
+    [SPECIES_ARCTOZOLT] = TEACHABLE_LEARNSET(sArctozoltTeachableLearnset),
+    [SPECIES_DRACOVISH] = TEACHABLE_LEARNSET(sDracovishTeachableLearnset),
+    [SPECIES_ARCTOVISH] = TEACHABLE_LEARNSET(sArctovishTeachableLearnset),
+    [SPECIES_DURALUDON] = TEACHABLE_LEARNSET(sDuraludonTeachableLearnset),
+    [SPECIES_DREEPY] = TEACHABLE_LEARNSET(sDreepyTeachableLearnset),
+    [SPECIES_DRAKLOAK] = TEACHABLE_LEARNSET(sDrakloakTeachableLearnset),
+    [SPECIES_DRAGAPULT] = TEACHABLE_LEARNSET(sDragapultTeachableLearnset),
+    [SPECIES_ZACIAN] = TEACHABLE_LEARNSET(sZacianTeachableLearnset),
+    [SPECIES_ZAMAZENTA] = TEACHABLE_LEARNSET(sZamazentaTeachableLearnset),
+    [SPECIES_ETERNATUS] = TEACHABLE_LEARNSET(sEternatusTeachableLearnset),
+    [SPECIES_KUBFU] = TEACHABLE_LEARNSET(sKubfuTeachableLearnset),
+    [SPECIES_URSHIFU] = TEACHABLE_LEARNSET(sUrshifuTeachableLearnset),
+    [SPECIES_ZARUDE] = TEACHABLE_LEARNSET(sZarudeTeachableLearnset),
+    [SPECIES_REGIELEKI] = TEACHABLE_LEARNSET(sRegielekiTeachableLearnset),
+    [SPECIES_REGIDRAGO] = TEACHABLE_LEARNSET(sRegidragoTeachableLearnset),
+    [SPECIES_GLASTRIER] = TEACHABLE_LEARNSET(sGlastrierTeachableLearnset),
+    [SPECIES_SPECTRIER] = TEACHABLE_LEARNSET(sSpectrierTeachableLearnset),
+    [SPECIES_CALYREX] = TEACHABLE_LEARNSET(sCalyrexTeachableLearnset),
+    [SPECIES_WYRDEER] = TEACHABLE_LEARNSET(sWyrdeerTeachableLearnset),
+    [SPECIES_KLEAVOR] = TEACHABLE_LEARNSET(sKleavorTeachableLearnset),
+    [SPECIES_URSALUNA] = TEACHABLE_LEARNSET(sUrsalunaTeachableLearnset),
+    [SPECIES_BASCULEGION] = TEACHABLE_LEARNSET(sBasculegionTeachableLearnset),
+    [SPECIES_SNEASLER] = TEACHABLE_LEARNSET(sSneaslerTeachableLearnset),
+    [SPECIES_OVERQWIL] = TEACHABLE_LEARNSET(sOverqwilTeachableLearnset),
+    [SPECIES_ENAMORUS] = TEACHABLE_LEARNSET(sEnamorusTeachableLearnset),
 #endif
     // Megas
-    [SPECIES_VENUSAUR_MEGA] = sVenusaurTeachableLearnset,
-    [SPECIES_CHARIZARD_MEGA_X] = sCharizardTeachableLearnset,
-    [SPECIES_CHARIZARD_MEGA_Y] = sCharizardTeachableLearnset,
-    [SPECIES_BLASTOISE_MEGA] = sBlastoiseTeachableLearnset,
-    [SPECIES_BEEDRILL_MEGA] = sBeedrillTeachableLearnset,
-    [SPECIES_PIDGEOT_MEGA] = sPidgeotTeachableLearnset,
-    [SPECIES_ALAKAZAM_MEGA] = sAlakazamTeachableLearnset,
-    [SPECIES_SLOWBRO_MEGA] = sSlowbroTeachableLearnset,
-    [SPECIES_GENGAR_MEGA] = sGengarTeachableLearnset,
-    [SPECIES_KANGASKHAN_MEGA] = sKangaskhanTeachableLearnset,
-    [SPECIES_PINSIR_MEGA] = sPinsirTeachableLearnset,
-    [SPECIES_GYARADOS_MEGA] = sGyaradosTeachableLearnset,
-    [SPECIES_AERODACTYL_MEGA] = sAerodactylTeachableLearnset,
-    [SPECIES_MEWTWO_MEGA_X] = sMewtwoTeachableLearnset,
-    [SPECIES_MEWTWO_MEGA_Y] = sMewtwoTeachableLearnset,
-    [SPECIES_AMPHAROS_MEGA] = sAmpharosTeachableLearnset,
-    [SPECIES_STEELIX_MEGA] = sSteelixTeachableLearnset,
-    [SPECIES_SCIZOR_MEGA] = sScizorTeachableLearnset,
-    [SPECIES_HERACROSS_MEGA] = sHeracrossTeachableLearnset,
-    [SPECIES_HOUNDOOM_MEGA] = sHoundoomTeachableLearnset,
-    [SPECIES_TYRANITAR_MEGA] = sTyranitarTeachableLearnset,
-    [SPECIES_SCEPTILE_MEGA] = sSceptileTeachableLearnset,
-    [SPECIES_BLAZIKEN_MEGA] = sBlazikenTeachableLearnset,
-    [SPECIES_SWAMPERT_MEGA] = sSwampertTeachableLearnset,
-    [SPECIES_GARDEVOIR_MEGA] = sGardevoirTeachableLearnset,
-    [SPECIES_SABLEYE_MEGA] = sSableyeTeachableLearnset,
-    [SPECIES_MAWILE_MEGA] = sMawileTeachableLearnset,
-    [SPECIES_AGGRON_MEGA] = sAggronTeachableLearnset,
-    [SPECIES_MEDICHAM_MEGA] = sMedichamTeachableLearnset,
-    [SPECIES_MANECTRIC_MEGA] = sManectricTeachableLearnset,
-    [SPECIES_SHARPEDO_MEGA] = sSharpedoTeachableLearnset,
-    [SPECIES_CAMERUPT_MEGA] = sCameruptTeachableLearnset,
-    [SPECIES_ALTARIA_MEGA] = sAltariaTeachableLearnset,
-    [SPECIES_BANETTE_MEGA] = sBanetteTeachableLearnset,
-    [SPECIES_ABSOL_MEGA] = sAbsolTeachableLearnset,
-    [SPECIES_GLALIE_MEGA] = sGlalieTeachableLearnset,
-    [SPECIES_SALAMENCE_MEGA] = sSalamenceTeachableLearnset,
-    [SPECIES_METAGROSS_MEGA] = sMetagrossTeachableLearnset,
-    [SPECIES_LATIAS_MEGA] = sLatiasTeachableLearnset,
-    [SPECIES_LATIOS_MEGA] = sLatiosTeachableLearnset,
+    [SPECIES_VENUSAUR_MEGA] = TEACHABLE_LEARNSET(sVenusaurTeachableLearnset),
+    [SPECIES_CHARIZARD_MEGA_X] = TEACHABLE_LEARNSET(sCharizardTeachableLearnset),
+    [SPECIES_CHARIZARD_MEGA_Y] = TEACHABLE_LEARNSET(sCharizardTeachableLearnset),
+    [SPECIES_BLASTOISE_MEGA] = TEACHABLE_LEARNSET(sBlastoiseTeachableLearnset),
+    [SPECIES_BEEDRILL_MEGA] = TEACHABLE_LEARNSET(sBeedrillTeachableLearnset),
+    [SPECIES_PIDGEOT_MEGA] = TEACHABLE_LEARNSET(sPidgeotTeachableLearnset),
+    [SPECIES_ALAKAZAM_MEGA] = TEACHABLE_LEARNSET(sAlakazamTeachableLearnset),
+    [SPECIES_SLOWBRO_MEGA] = TEACHABLE_LEARNSET(sSlowbroTeachableLearnset),
+    [SPECIES_GENGAR_MEGA] = TEACHABLE_LEARNSET(sGengarTeachableLearnset),
+    [SPECIES_KANGASKHAN_MEGA] = TEACHABLE_LEARNSET(sKangaskhanTeachableLearnset),
+    [SPECIES_PINSIR_MEGA] = TEACHABLE_LEARNSET(sPinsirTeachableLearnset),
+    [SPECIES_GYARADOS_MEGA] = TEACHABLE_LEARNSET(sGyaradosTeachableLearnset),
+    [SPECIES_AERODACTYL_MEGA] = TEACHABLE_LEARNSET(sAerodactylTeachableLearnset),
+    [SPECIES_MEWTWO_MEGA_X] = TEACHABLE_LEARNSET(sMewtwoTeachableLearnset),
+    [SPECIES_MEWTWO_MEGA_Y] = TEACHABLE_LEARNSET(sMewtwoTeachableLearnset),
+    [SPECIES_AMPHAROS_MEGA] = TEACHABLE_LEARNSET(sAmpharosTeachableLearnset),
+    [SPECIES_STEELIX_MEGA] = TEACHABLE_LEARNSET(sSteelixTeachableLearnset),
+    [SPECIES_SCIZOR_MEGA] = TEACHABLE_LEARNSET(sScizorTeachableLearnset),
+    [SPECIES_HERACROSS_MEGA] = TEACHABLE_LEARNSET(sHeracrossTeachableLearnset),
+    [SPECIES_HOUNDOOM_MEGA] = TEACHABLE_LEARNSET(sHoundoomTeachableLearnset),
+    [SPECIES_TYRANITAR_MEGA] = TEACHABLE_LEARNSET(sTyranitarTeachableLearnset),
+    [SPECIES_SCEPTILE_MEGA] = TEACHABLE_LEARNSET(sSceptileTeachableLearnset),
+    [SPECIES_BLAZIKEN_MEGA] = TEACHABLE_LEARNSET(sBlazikenTeachableLearnset),
+    [SPECIES_SWAMPERT_MEGA] = TEACHABLE_LEARNSET(sSwampertTeachableLearnset),
+    [SPECIES_GARDEVOIR_MEGA] = TEACHABLE_LEARNSET(sGardevoirTeachableLearnset),
+    [SPECIES_SABLEYE_MEGA] = TEACHABLE_LEARNSET(sSableyeTeachableLearnset),
+    [SPECIES_MAWILE_MEGA] = TEACHABLE_LEARNSET(sMawileTeachableLearnset),
+    [SPECIES_AGGRON_MEGA] = TEACHABLE_LEARNSET(sAggronTeachableLearnset),
+    [SPECIES_MEDICHAM_MEGA] = TEACHABLE_LEARNSET(sMedichamTeachableLearnset),
+    [SPECIES_MANECTRIC_MEGA] = TEACHABLE_LEARNSET(sManectricTeachableLearnset),
+    [SPECIES_SHARPEDO_MEGA] = TEACHABLE_LEARNSET(sSharpedoTeachableLearnset),
+    [SPECIES_CAMERUPT_MEGA] = TEACHABLE_LEARNSET(sCameruptTeachableLearnset),
+    [SPECIES_ALTARIA_MEGA] = TEACHABLE_LEARNSET(sAltariaTeachableLearnset),
+    [SPECIES_BANETTE_MEGA] = TEACHABLE_LEARNSET(sBanetteTeachableLearnset),
+    [SPECIES_ABSOL_MEGA] = TEACHABLE_LEARNSET(sAbsolTeachableLearnset),
+    [SPECIES_GLALIE_MEGA] = TEACHABLE_LEARNSET(sGlalieTeachableLearnset),
+    [SPECIES_SALAMENCE_MEGA] = TEACHABLE_LEARNSET(sSalamenceTeachableLearnset),
+    [SPECIES_METAGROSS_MEGA] = TEACHABLE_LEARNSET(sMetagrossTeachableLearnset),
+    [SPECIES_LATIAS_MEGA] = TEACHABLE_LEARNSET(sLatiasTeachableLearnset),
+    [SPECIES_LATIOS_MEGA] = TEACHABLE_LEARNSET(sLatiosTeachableLearnset),
 #if P_GEN_4_POKEMON == TRUE
-    [SPECIES_LOPUNNY_MEGA] = sLopunnyTeachableLearnset,
-    [SPECIES_GARCHOMP_MEGA] = sGarchompTeachableLearnset,
-    [SPECIES_LUCARIO_MEGA] = sLucarioTeachableLearnset,
-    [SPECIES_ABOMASNOW_MEGA] = sAbomasnowTeachableLearnset,
-    [SPECIES_GALLADE_MEGA] = sGalladeTeachableLearnset,
+    [SPECIES_LOPUNNY_MEGA] = TEACHABLE_LEARNSET(sLopunnyTeachableLearnset),
+    [SPECIES_GARCHOMP_MEGA] = TEACHABLE_LEARNSET(sGarchompTeachableLearnset),
+    [SPECIES_LUCARIO_MEGA] = TEACHABLE_LEARNSET(sLucarioTeachableLearnset),
+    [SPECIES_ABOMASNOW_MEGA] = TEACHABLE_LEARNSET(sAbomasnowTeachableLearnset),
+    [SPECIES_GALLADE_MEGA] = TEACHABLE_LEARNSET(sGalladeTeachableLearnset),
 #endif
 #if P_GEN_5_POKEMON == TRUE
-    [SPECIES_AUDINO_MEGA] = sAudinoTeachableLearnset,
+    [SPECIES_AUDINO_MEGA] = TEACHABLE_LEARNSET(sAudinoTeachableLearnset),
 #endif
 #if P_GEN_6_POKEMON == TRUE
-    [SPECIES_DIANCIE_MEGA] = sDiancieTeachableLearnset,
+    [SPECIES_DIANCIE_MEGA] = TEACHABLE_LEARNSET(sDiancieTeachableLearnset),
 #endif
     // Special Mega + Primals
-    [SPECIES_RAYQUAZA_MEGA] = sRayquazaTeachableLearnset,
-    [SPECIES_KYOGRE_PRIMAL] = sKyogreTeachableLearnset,
-    [SPECIES_GROUDON_PRIMAL] = sGroudonTeachableLearnset,
+    [SPECIES_RAYQUAZA_MEGA] = TEACHABLE_LEARNSET(sRayquazaTeachableLearnset),
+    [SPECIES_KYOGRE_PRIMAL] = TEACHABLE_LEARNSET(sKyogreTeachableLearnset),
+    [SPECIES_GROUDON_PRIMAL] = TEACHABLE_LEARNSET(sGroudonTeachableLearnset),
     // Alolan Forms
-    [SPECIES_RATTATA_ALOLAN] = sRattataAlolanTeachableLearnset,
-    [SPECIES_RATICATE_ALOLAN] = sRaticateAlolanTeachableLearnset,
-    [SPECIES_RAICHU_ALOLAN] = sRaichuAlolanTeachableLearnset,
-    [SPECIES_SANDSHREW_ALOLAN] = sSandshrewAlolanTeachableLearnset,
-    [SPECIES_SANDSLASH_ALOLAN] = sSandslashAlolanTeachableLearnset,
-    [SPECIES_VULPIX_ALOLAN] = sVulpixAlolanTeachableLearnset,
-    [SPECIES_NINETALES_ALOLAN] = sNinetalesAlolanTeachableLearnset,
-    [SPECIES_DIGLETT_ALOLAN] = sDiglettAlolanTeachableLearnset,
-    [SPECIES_DUGTRIO_ALOLAN] = sDugtrioAlolanTeachableLearnset,
-    [SPECIES_MEOWTH_ALOLAN] = sMeowthAlolanTeachableLearnset,
-    [SPECIES_PERSIAN_ALOLAN] = sPersianAlolanTeachableLearnset,
-    [SPECIES_GEODUDE_ALOLAN] = sGeodudeAlolanTeachableLearnset,
-    [SPECIES_GRAVELER_ALOLAN] = sGravelerAlolanTeachableLearnset,
-    [SPECIES_GOLEM_ALOLAN] = sGolemAlolanTeachableLearnset,
-    [SPECIES_GRIMER_ALOLAN] = sGrimerAlolanTeachableLearnset,
-    [SPECIES_MUK_ALOLAN] = sMukAlolanTeachableLearnset,
-    [SPECIES_EXEGGUTOR_ALOLAN] = sExeggutorAlolanTeachableLearnset,
-    [SPECIES_MAROWAK_ALOLAN] = sMarowakAlolanTeachableLearnset,
+    [SPECIES_RATTATA_ALOLAN] = TEACHABLE_LEARNSET(sRattataAlolanTeachableLearnset),
+    [SPECIES_RATICATE_ALOLAN] = TEACHABLE_LEARNSET(sRaticateAlolanTeachableLearnset),
+    [SPECIES_RAICHU_ALOLAN] = TEACHABLE_LEARNSET(sRaichuAlolanTeachableLearnset),
+    [SPECIES_SANDSHREW_ALOLAN] = TEACHABLE_LEARNSET(sSandshrewAlolanTeachableLearnset),
+    [SPECIES_SANDSLASH_ALOLAN] = TEACHABLE_LEARNSET(sSandslashAlolanTeachableLearnset),
+    [SPECIES_VULPIX_ALOLAN] = TEACHABLE_LEARNSET(sVulpixAlolanTeachableLearnset),
+    [SPECIES_NINETALES_ALOLAN] = TEACHABLE_LEARNSET(sNinetalesAlolanTeachableLearnset),
+    [SPECIES_DIGLETT_ALOLAN] = TEACHABLE_LEARNSET(sDiglettAlolanTeachableLearnset),
+    [SPECIES_DUGTRIO_ALOLAN] = TEACHABLE_LEARNSET(sDugtrioAlolanTeachableLearnset),
+    [SPECIES_MEOWTH_ALOLAN] = TEACHABLE_LEARNSET(sMeowthAlolanTeachableLearnset),
+    [SPECIES_PERSIAN_ALOLAN] = TEACHABLE_LEARNSET(sPersianAlolanTeachableLearnset),
+    [SPECIES_GEODUDE_ALOLAN] = TEACHABLE_LEARNSET(sGeodudeAlolanTeachableLearnset),
+    [SPECIES_GRAVELER_ALOLAN] = TEACHABLE_LEARNSET(sGravelerAlolanTeachableLearnset),
+    [SPECIES_GOLEM_ALOLAN] = TEACHABLE_LEARNSET(sGolemAlolanTeachableLearnset),
+    [SPECIES_GRIMER_ALOLAN] = TEACHABLE_LEARNSET(sGrimerAlolanTeachableLearnset),
+    [SPECIES_MUK_ALOLAN] = TEACHABLE_LEARNSET(sMukAlolanTeachableLearnset),
+    [SPECIES_EXEGGUTOR_ALOLAN] = TEACHABLE_LEARNSET(sExeggutorAlolanTeachableLearnset),
+    [SPECIES_MAROWAK_ALOLAN] = TEACHABLE_LEARNSET(sMarowakAlolanTeachableLearnset),
     // Galarian Forms
-    [SPECIES_MEOWTH_GALARIAN] = sMeowthGalarianTeachableLearnset,
-    [SPECIES_PONYTA_GALARIAN] = sPonytaGalarianTeachableLearnset,
-    [SPECIES_RAPIDASH_GALARIAN] = sRapidashGalarianTeachableLearnset,
-    [SPECIES_SLOWPOKE_GALARIAN] = sSlowpokeGalarianTeachableLearnset,
-    [SPECIES_SLOWBRO_GALARIAN] = sSlowbroGalarianTeachableLearnset,
-    [SPECIES_FARFETCHD_GALARIAN] = sFarfetchdGalarianTeachableLearnset,
-    [SPECIES_WEEZING_GALARIAN] = sWeezingGalarianTeachableLearnset,
-    [SPECIES_MR_MIME_GALARIAN] = sMrMimeGalarianTeachableLearnset,
-    [SPECIES_ARTICUNO_GALARIAN] = sArticunoGalarianTeachableLearnset,
-    [SPECIES_ZAPDOS_GALARIAN] = sZapdosGalarianTeachableLearnset,
-    [SPECIES_MOLTRES_GALARIAN] = sMoltresGalarianTeachableLearnset,
-    [SPECIES_SLOWKING_GALARIAN] = sSlowkingGalarianTeachableLearnset,
-    [SPECIES_CORSOLA_GALARIAN] = sCorsolaGalarianTeachableLearnset,
-    [SPECIES_ZIGZAGOON_GALARIAN] = sZigzagoonGalarianTeachableLearnset,
-    [SPECIES_LINOONE_GALARIAN] = sLinooneGalarianTeachableLearnset,
+    [SPECIES_MEOWTH_GALARIAN] = TEACHABLE_LEARNSET(sMeowthGalarianTeachableLearnset),
+    [SPECIES_PONYTA_GALARIAN] = TEACHABLE_LEARNSET(sPonytaGalarianTeachableLearnset),
+    [SPECIES_RAPIDASH_GALARIAN] = TEACHABLE_LEARNSET(sRapidashGalarianTeachableLearnset),
+    [SPECIES_SLOWPOKE_GALARIAN] = TEACHABLE_LEARNSET(sSlowpokeGalarianTeachableLearnset),
+    [SPECIES_SLOWBRO_GALARIAN] = TEACHABLE_LEARNSET(sSlowbroGalarianTeachableLearnset),
+    [SPECIES_FARFETCHD_GALARIAN] = TEACHABLE_LEARNSET(sFarfetchdGalarianTeachableLearnset),
+    [SPECIES_WEEZING_GALARIAN] = TEACHABLE_LEARNSET(sWeezingGalarianTeachableLearnset),
+    [SPECIES_MR_MIME_GALARIAN] = TEACHABLE_LEARNSET(sMrMimeGalarianTeachableLearnset),
+    [SPECIES_ARTICUNO_GALARIAN] = TEACHABLE_LEARNSET(sArticunoGalarianTeachableLearnset),
+    [SPECIES_ZAPDOS_GALARIAN] = TEACHABLE_LEARNSET(sZapdosGalarianTeachableLearnset),
+    [SPECIES_MOLTRES_GALARIAN] = TEACHABLE_LEARNSET(sMoltresGalarianTeachableLearnset),
+    [SPECIES_SLOWKING_GALARIAN] = TEACHABLE_LEARNSET(sSlowkingGalarianTeachableLearnset),
+    [SPECIES_CORSOLA_GALARIAN] = TEACHABLE_LEARNSET(sCorsolaGalarianTeachableLearnset),
+    [SPECIES_ZIGZAGOON_GALARIAN] = TEACHABLE_LEARNSET(sZigzagoonGalarianTeachableLearnset),
+    [SPECIES_LINOONE_GALARIAN] = TEACHABLE_LEARNSET(sLinooneGalarianTeachableLearnset),
 #if P_GEN_5_POKEMON == TRUE
-    [SPECIES_DARUMAKA_GALARIAN] = sDarumakaGalarianTeachableLearnset,
-    [SPECIES_DARMANITAN_GALARIAN] = sDarmanitanGalarianTeachableLearnset,
-    [SPECIES_YAMASK_GALARIAN] = sYamaskGalarianTeachableLearnset,
-    [SPECIES_STUNFISK_GALARIAN] = sStunfiskGalarianTeachableLearnset,
+    [SPECIES_DARUMAKA_GALARIAN] = TEACHABLE_LEARNSET(sDarumakaGalarianTeachableLearnset),
+    [SPECIES_DARMANITAN_GALARIAN] = TEACHABLE_LEARNSET(sDarmanitanGalarianTeachableLearnset),
+    [SPECIES_YAMASK_GALARIAN] = TEACHABLE_LEARNSET(sYamaskGalarianTeachableLearnset),
+    [SPECIES_STUNFISK_GALARIAN] = TEACHABLE_LEARNSET(sStunfiskGalarianTeachableLearnset),
 #endif
     // Hisuian Forms
-    [SPECIES_GROWLITHE_HISUIAN] = sGrowlitheHisuianTeachableLearnset,
-    [SPECIES_ARCANINE_HISUIAN] = sArcanineHisuianTeachableLearnset,
-    [SPECIES_VOLTORB_HISUIAN] = sVoltorbHisuianTeachableLearnset,
-    [SPECIES_ELECTRODE_HISUIAN] = sElectrodeHisuianTeachableLearnset,
-    [SPECIES_TYPHLOSION_HISUIAN] = sTyphlosionHisuianTeachableLearnset,
-    [SPECIES_QWILFISH_HISUIAN] = sQwilfishHisuianTeachableLearnset,
-    [SPECIES_SNEASEL_HISUIAN] = sSneaselHisuianTeachableLearnset,
+    [SPECIES_GROWLITHE_HISUIAN] = TEACHABLE_LEARNSET(sGrowlitheHisuianTeachableLearnset),
+    [SPECIES_ARCANINE_HISUIAN] = TEACHABLE_LEARNSET(sArcanineHisuianTeachableLearnset),
+    [SPECIES_VOLTORB_HISUIAN] = TEACHABLE_LEARNSET(sVoltorbHisuianTeachableLearnset),
+    [SPECIES_ELECTRODE_HISUIAN] = TEACHABLE_LEARNSET(sElectrodeHisuianTeachableLearnset),
+    [SPECIES_TYPHLOSION_HISUIAN] = TEACHABLE_LEARNSET(sTyphlosionHisuianTeachableLearnset),
+    [SPECIES_QWILFISH_HISUIAN] = TEACHABLE_LEARNSET(sQwilfishHisuianTeachableLearnset),
+    [SPECIES_SNEASEL_HISUIAN] = TEACHABLE_LEARNSET(sSneaselHisuianTeachableLearnset),
 #if P_GEN_5_POKEMON == TRUE
-    [SPECIES_SAMUROTT_HISUIAN] = sSamurottHisuianTeachableLearnset,
-    [SPECIES_LILLIGANT_HISUIAN] = sLilligantHisuianTeachableLearnset,
-    [SPECIES_ZORUA_HISUIAN] = sZoruaHisuianTeachableLearnset,
-    [SPECIES_ZOROARK_HISUIAN] = sZoroarkHisuianTeachableLearnset,
-    [SPECIES_BRAVIARY_HISUIAN] = sBraviaryHisuianTeachableLearnset,
+    [SPECIES_SAMUROTT_HISUIAN] = TEACHABLE_LEARNSET(sSamurottHisuianTeachableLearnset),
+    [SPECIES_LILLIGANT_HISUIAN] = TEACHABLE_LEARNSET(sLilligantHisuianTeachableLearnset),
+    [SPECIES_ZORUA_HISUIAN] = TEACHABLE_LEARNSET(sZoruaHisuianTeachableLearnset),
+    [SPECIES_ZOROARK_HISUIAN] = TEACHABLE_LEARNSET(sZoroarkHisuianTeachableLearnset),
+    [SPECIES_BRAVIARY_HISUIAN] = TEACHABLE_LEARNSET(sBraviaryHisuianTeachableLearnset),
 #endif
 #if P_GEN_6_POKEMON == TRUE
-    [SPECIES_SLIGGOO_HISUIAN] = sSliggooHisuianTeachableLearnset,
-    [SPECIES_GOODRA_HISUIAN] = sGoodraHisuianTeachableLearnset,
-    [SPECIES_AVALUGG_HISUIAN] = sAvaluggHisuianTeachableLearnset,
+    [SPECIES_SLIGGOO_HISUIAN] = TEACHABLE_LEARNSET(sSliggooHisuianTeachableLearnset),
+    [SPECIES_GOODRA_HISUIAN] = TEACHABLE_LEARNSET(sGoodraHisuianTeachableLearnset),
+    [SPECIES_AVALUGG_HISUIAN] = TEACHABLE_LEARNSET(sAvaluggHisuianTeachableLearnset),
 #endif
 #if P_GEN_7_POKEMON == TRUE
-    [SPECIES_DECIDUEYE_HISUIAN] = sDecidueyeHisuianTeachableLearnset,
+    [SPECIES_DECIDUEYE_HISUIAN] = TEACHABLE_LEARNSET(sDecidueyeHisuianTeachableLearnset),
 #endif
     // Misc Forms
     // Cosplay Pikachu
-    [SPECIES_PIKACHU_COSPLAY] = sPikachuTeachableLearnset,
-    [SPECIES_PIKACHU_ROCK_STAR] = sPikachuTeachableLearnset,
-    [SPECIES_PIKACHU_BELLE] = sPikachuTeachableLearnset,
-    [SPECIES_PIKACHU_POP_STAR] = sPikachuTeachableLearnset,
-    [SPECIES_PIKACHU_PH_D] = sPikachuTeachableLearnset,
-    [SPECIES_PIKACHU_LIBRE] = sPikachuTeachableLearnset,
+    [SPECIES_PIKACHU_COSPLAY] = TEACHABLE_LEARNSET(sPikachuTeachableLearnset),
+    [SPECIES_PIKACHU_ROCK_STAR] = TEACHABLE_LEARNSET(sPikachuTeachableLearnset),
+    [SPECIES_PIKACHU_BELLE] = TEACHABLE_LEARNSET(sPikachuTeachableLearnset),
+    [SPECIES_PIKACHU_POP_STAR] = TEACHABLE_LEARNSET(sPikachuTeachableLearnset),
+    [SPECIES_PIKACHU_PH_D] = TEACHABLE_LEARNSET(sPikachuTeachableLearnset),
+    [SPECIES_PIKACHU_LIBRE] = TEACHABLE_LEARNSET(sPikachuTeachableLearnset),
     // Cap Pikachu
-    [SPECIES_PIKACHU_ORIGINAL_CAP] = sPikachuTeachableLearnset,
-    [SPECIES_PIKACHU_HOENN_CAP] = sPikachuTeachableLearnset,
-    [SPECIES_PIKACHU_SINNOH_CAP] = sPikachuTeachableLearnset,
-    [SPECIES_PIKACHU_UNOVA_CAP] = sPikachuTeachableLearnset,
-    [SPECIES_PIKACHU_KALOS_CAP] = sPikachuTeachableLearnset,
-    [SPECIES_PIKACHU_ALOLA_CAP] = sPikachuTeachableLearnset,
-    [SPECIES_PIKACHU_PARTNER_CAP] = sPikachuTeachableLearnset,
-    [SPECIES_PIKACHU_WORLD_CAP] = sPikachuTeachableLearnset,
+    [SPECIES_PIKACHU_ORIGINAL_CAP] = TEACHABLE_LEARNSET(sPikachuTeachableLearnset),
+    [SPECIES_PIKACHU_HOENN_CAP] = TEACHABLE_LEARNSET(sPikachuTeachableLearnset),
+    [SPECIES_PIKACHU_SINNOH_CAP] = TEACHABLE_LEARNSET(sPikachuTeachableLearnset),
+    [SPECIES_PIKACHU_UNOVA_CAP] = TEACHABLE_LEARNSET(sPikachuTeachableLearnset),
+    [SPECIES_PIKACHU_KALOS_CAP] = TEACHABLE_LEARNSET(sPikachuTeachableLearnset),
+    [SPECIES_PIKACHU_ALOLA_CAP] = TEACHABLE_LEARNSET(sPikachuTeachableLearnset),
+    [SPECIES_PIKACHU_PARTNER_CAP] = TEACHABLE_LEARNSET(sPikachuTeachableLearnset),
+    [SPECIES_PIKACHU_WORLD_CAP] = TEACHABLE_LEARNSET(sPikachuTeachableLearnset),
     // Pichu
-    [SPECIES_PICHU_SPIKY_EARED] = sPichuTeachableLearnset,
+    [SPECIES_PICHU_SPIKY_EARED] = TEACHABLE_LEARNSET(sPichuTeachableLearnset),
     // Unown
-    [SPECIES_UNOWN_B] = sUnownTeachableLearnset,
-    [SPECIES_UNOWN_C] = sUnownTeachableLearnset,
-    [SPECIES_UNOWN_D] = sUnownTeachableLearnset,
-    [SPECIES_UNOWN_E] = sUnownTeachableLearnset,
-    [SPECIES_UNOWN_F] = sUnownTeachableLearnset,
-    [SPECIES_UNOWN_G] = sUnownTeachableLearnset,
-    [SPECIES_UNOWN_H] = sUnownTeachableLearnset,
-    [SPECIES_UNOWN_I] = sUnownTeachableLearnset,
-    [SPECIES_UNOWN_J] = sUnownTeachableLearnset,
-    [SPECIES_UNOWN_K] = sUnownTeachableLearnset,
-    [SPECIES_UNOWN_L] = sUnownTeachableLearnset,
-    [SPECIES_UNOWN_M] = sUnownTeachableLearnset,
-    [SPECIES_UNOWN_N] = sUnownTeachableLearnset,
-    [SPECIES_UNOWN_O] = sUnownTeachableLearnset,
-    [SPECIES_UNOWN_P] = sUnownTeachableLearnset,
-    [SPECIES_UNOWN_Q] = sUnownTeachableLearnset,
-    [SPECIES_UNOWN_R] = sUnownTeachableLearnset,
-    [SPECIES_UNOWN_S] = sUnownTeachableLearnset,
-    [SPECIES_UNOWN_T] = sUnownTeachableLearnset,
-    [SPECIES_UNOWN_U] = sUnownTeachableLearnset,
-    [SPECIES_UNOWN_V] = sUnownTeachableLearnset,
-    [SPECIES_UNOWN_W] = sUnownTeachableLearnset,
-    [SPECIES_UNOWN_X] = sUnownTeachableLearnset,
-    [SPECIES_UNOWN_Y] = sUnownTeachableLearnset,
-    [SPECIES_UNOWN_Z] = sUnownTeachableLearnset,
-    [SPECIES_UNOWN_EMARK] = sUnownTeachableLearnset,
-    [SPECIES_UNOWN_QMARK] = sUnownTeachableLearnset,
+    [SPECIES_UNOWN_B] = TEACHABLE_LEARNSET(sUnownTeachableLearnset),
+    [SPECIES_UNOWN_C] = TEACHABLE_LEARNSET(sUnownTeachableLearnset),
+    [SPECIES_UNOWN_D] = TEACHABLE_LEARNSET(sUnownTeachableLearnset),
+    [SPECIES_UNOWN_E] = TEACHABLE_LEARNSET(sUnownTeachableLearnset),
+    [SPECIES_UNOWN_F] = TEACHABLE_LEARNSET(sUnownTeachableLearnset),
+    [SPECIES_UNOWN_G] = TEACHABLE_LEARNSET(sUnownTeachableLearnset),
+    [SPECIES_UNOWN_H] = TEACHABLE_LEARNSET(sUnownTeachableLearnset),
+    [SPECIES_UNOWN_I] = TEACHABLE_LEARNSET(sUnownTeachableLearnset),
+    [SPECIES_UNOWN_J] = TEACHABLE_LEARNSET(sUnownTeachableLearnset),
+    [SPECIES_UNOWN_K] = TEACHABLE_LEARNSET(sUnownTeachableLearnset),
+    [SPECIES_UNOWN_L] = TEACHABLE_LEARNSET(sUnownTeachableLearnset),
+    [SPECIES_UNOWN_M] = TEACHABLE_LEARNSET(sUnownTeachableLearnset),
+    [SPECIES_UNOWN_N] = TEACHABLE_LEARNSET(sUnownTeachableLearnset),
+    [SPECIES_UNOWN_O] = TEACHABLE_LEARNSET(sUnownTeachableLearnset),
+    [SPECIES_UNOWN_P] = TEACHABLE_LEARNSET(sUnownTeachableLearnset),
+    [SPECIES_UNOWN_Q] = TEACHABLE_LEARNSET(sUnownTeachableLearnset),
+    [SPECIES_UNOWN_R] = TEACHABLE_LEARNSET(sUnownTeachableLearnset),
+    [SPECIES_UNOWN_S] = TEACHABLE_LEARNSET(sUnownTeachableLearnset),
+    [SPECIES_UNOWN_T] = TEACHABLE_LEARNSET(sUnownTeachableLearnset),
+    [SPECIES_UNOWN_U] = TEACHABLE_LEARNSET(sUnownTeachableLearnset),
+    [SPECIES_UNOWN_V] = TEACHABLE_LEARNSET(sUnownTeachableLearnset),
+    [SPECIES_UNOWN_W] = TEACHABLE_LEARNSET(sUnownTeachableLearnset),
+    [SPECIES_UNOWN_X] = TEACHABLE_LEARNSET(sUnownTeachableLearnset),
+    [SPECIES_UNOWN_Y] = TEACHABLE_LEARNSET(sUnownTeachableLearnset),
+    [SPECIES_UNOWN_Z] = TEACHABLE_LEARNSET(sUnownTeachableLearnset),
+    [SPECIES_UNOWN_EMARK] = TEACHABLE_LEARNSET(sUnownTeachableLearnset),
+    [SPECIES_UNOWN_QMARK] = TEACHABLE_LEARNSET(sUnownTeachableLearnset),
     // Castform
-    [SPECIES_CASTFORM_SUNNY] = sCastformTeachableLearnset,
-    [SPECIES_CASTFORM_RAINY] = sCastformTeachableLearnset,
-    [SPECIES_CASTFORM_SNOWY] = sCastformTeachableLearnset,
+    [SPECIES_CASTFORM_SUNNY] = TEACHABLE_LEARNSET(sCastformTeachableLearnset),
+    [SPECIES_CASTFORM_RAINY] = TEACHABLE_LEARNSET(sCastformTeachableLearnset),
+    [SPECIES_CASTFORM_SNOWY] = TEACHABLE_LEARNSET(sCastformTeachableLearnset),
     // Deoxys
-    [SPECIES_DEOXYS_ATTACK] = sDeoxysAttackTeachableLearnset,
-    [SPECIES_DEOXYS_DEFENSE] = sDeoxysDefenseTeachableLearnset,
-    [SPECIES_DEOXYS_SPEED] = sDeoxysSpeedTeachableLearnset,
+    [SPECIES_DEOXYS_ATTACK] = TEACHABLE_LEARNSET(sDeoxysAttackTeachableLearnset),
+    [SPECIES_DEOXYS_DEFENSE] = TEACHABLE_LEARNSET(sDeoxysDefenseTeachableLearnset),
+    [SPECIES_DEOXYS_SPEED] = TEACHABLE_LEARNSET(sDeoxysSpeedTeachableLearnset),
 #if P_GEN_4_POKEMON == TRUE
     // Burmy
-    [SPECIES_BURMY_SANDY_CLOAK] = sBurmyTeachableLearnset,
-    [SPECIES_BURMY_TRASH_CLOAK] = sBurmyTeachableLearnset,
+    [SPECIES_BURMY_SANDY_CLOAK] = TEACHABLE_LEARNSET(sBurmyTeachableLearnset),
+    [SPECIES_BURMY_TRASH_CLOAK] = TEACHABLE_LEARNSET(sBurmyTeachableLearnset),
     // Wormadam
-    [SPECIES_WORMADAM_SANDY_CLOAK] = sWormadamSandyCloakTeachableLearnset,
-    [SPECIES_WORMADAM_TRASH_CLOAK] = sWormadamTrashCloakTeachableLearnset,
+    [SPECIES_WORMADAM_SANDY_CLOAK] = TEACHABLE_LEARNSET(sWormadamSandyCloakTeachableLearnset),
+    [SPECIES_WORMADAM_TRASH_CLOAK] = TEACHABLE_LEARNSET(sWormadamTrashCloakTeachableLearnset),
     // Cherrim
-    [SPECIES_CHERRIM_SUNSHINE] = sCherrimTeachableLearnset,
+    [SPECIES_CHERRIM_SUNSHINE] = TEACHABLE_LEARNSET(sCherrimTeachableLearnset),
     // Shellos
-    [SPECIES_SHELLOS_EAST_SEA] = sShellosTeachableLearnset,
+    [SPECIES_SHELLOS_EAST_SEA] = TEACHABLE_LEARNSET(sShellosTeachableLearnset),
     // Gastrodon
-    [SPECIES_GASTRODON_EAST_SEA] = sGastrodonTeachableLearnset,
+    [SPECIES_GASTRODON_EAST_SEA] = TEACHABLE_LEARNSET(sGastrodonTeachableLearnset),
     // Rotom
-    [SPECIES_ROTOM_HEAT] = sRotomTeachableLearnset,
-    [SPECIES_ROTOM_WASH] = sRotomTeachableLearnset,
-    [SPECIES_ROTOM_FROST] = sRotomTeachableLearnset,
-    [SPECIES_ROTOM_FAN] = sRotomTeachableLearnset,
-    [SPECIES_ROTOM_MOW] = sRotomTeachableLearnset,
+    [SPECIES_ROTOM_HEAT] = TEACHABLE_LEARNSET(sRotomTeachableLearnset),
+    [SPECIES_ROTOM_WASH] = TEACHABLE_LEARNSET(sRotomTeachableLearnset),
+    [SPECIES_ROTOM_FROST] = TEACHABLE_LEARNSET(sRotomTeachableLearnset),
+    [SPECIES_ROTOM_FAN] = TEACHABLE_LEARNSET(sRotomTeachableLearnset),
+    [SPECIES_ROTOM_MOW] = TEACHABLE_LEARNSET(sRotomTeachableLearnset),
     // Origin Forme
-    [SPECIES_DIALGA_ORIGIN] = sDialgaTeachableLearnset,
-    [SPECIES_PALKIA_ORIGIN] = sPalkiaTeachableLearnset,
-    [SPECIES_GIRATINA_ORIGIN] = sGiratinaTeachableLearnset,
+    [SPECIES_DIALGA_ORIGIN] = TEACHABLE_LEARNSET(sDialgaTeachableLearnset),
+    [SPECIES_PALKIA_ORIGIN] = TEACHABLE_LEARNSET(sPalkiaTeachableLearnset),
+    [SPECIES_GIRATINA_ORIGIN] = TEACHABLE_LEARNSET(sGiratinaTeachableLearnset),
     // Shaymin
-    [SPECIES_SHAYMIN_SKY] = sShayminSkyTeachableLearnset,
+    [SPECIES_SHAYMIN_SKY] = TEACHABLE_LEARNSET(sShayminSkyTeachableLearnset),
     // Arceus
-    [SPECIES_ARCEUS_FIGHTING] = sArceusTeachableLearnset,
-    [SPECIES_ARCEUS_FLYING] = sArceusTeachableLearnset,
-    [SPECIES_ARCEUS_POISON] = sArceusTeachableLearnset,
-    [SPECIES_ARCEUS_GROUND] = sArceusTeachableLearnset,
-    [SPECIES_ARCEUS_ROCK] = sArceusTeachableLearnset,
-    [SPECIES_ARCEUS_BUG] = sArceusTeachableLearnset,
-    [SPECIES_ARCEUS_GHOST] = sArceusTeachableLearnset,
-    [SPECIES_ARCEUS_STEEL] = sArceusTeachableLearnset,
-    [SPECIES_ARCEUS_FIRE] = sArceusTeachableLearnset,
-    [SPECIES_ARCEUS_WATER] = sArceusTeachableLearnset,
-    [SPECIES_ARCEUS_GRASS] = sArceusTeachableLearnset,
-    [SPECIES_ARCEUS_ELECTRIC] = sArceusTeachableLearnset,
-    [SPECIES_ARCEUS_PSYCHIC] = sArceusTeachableLearnset,
-    [SPECIES_ARCEUS_ICE] = sArceusTeachableLearnset,
-    [SPECIES_ARCEUS_DRAGON] = sArceusTeachableLearnset,
-    [SPECIES_ARCEUS_DARK] = sArceusTeachableLearnset,
-    [SPECIES_ARCEUS_FAIRY] = sArceusTeachableLearnset,
+    [SPECIES_ARCEUS_FIGHTING] = TEACHABLE_LEARNSET(sArceusTeachableLearnset),
+    [SPECIES_ARCEUS_FLYING] = TEACHABLE_LEARNSET(sArceusTeachableLearnset),
+    [SPECIES_ARCEUS_POISON] = TEACHABLE_LEARNSET(sArceusTeachableLearnset),
+    [SPECIES_ARCEUS_GROUND] = TEACHABLE_LEARNSET(sArceusTeachableLearnset),
+    [SPECIES_ARCEUS_ROCK] = TEACHABLE_LEARNSET(sArceusTeachableLearnset),
+    [SPECIES_ARCEUS_BUG] = TEACHABLE_LEARNSET(sArceusTeachableLearnset),
+    [SPECIES_ARCEUS_GHOST] = TEACHABLE_LEARNSET(sArceusTeachableLearnset),
+    [SPECIES_ARCEUS_STEEL] = TEACHABLE_LEARNSET(sArceusTeachableLearnset),
+    [SPECIES_ARCEUS_FIRE] = TEACHABLE_LEARNSET(sArceusTeachableLearnset),
+    [SPECIES_ARCEUS_WATER] = TEACHABLE_LEARNSET(sArceusTeachableLearnset),
+    [SPECIES_ARCEUS_GRASS] = TEACHABLE_LEARNSET(sArceusTeachableLearnset),
+    [SPECIES_ARCEUS_ELECTRIC] = TEACHABLE_LEARNSET(sArceusTeachableLearnset),
+    [SPECIES_ARCEUS_PSYCHIC] = TEACHABLE_LEARNSET(sArceusTeachableLearnset),
+    [SPECIES_ARCEUS_ICE] = TEACHABLE_LEARNSET(sArceusTeachableLearnset),
+    [SPECIES_ARCEUS_DRAGON] = TEACHABLE_LEARNSET(sArceusTeachableLearnset),
+    [SPECIES_ARCEUS_DARK] = TEACHABLE_LEARNSET(sArceusTeachableLearnset),
+    [SPECIES_ARCEUS_FAIRY] = TEACHABLE_LEARNSET(sArceusTeachableLearnset),
 #endif
 #if P_GEN_5_POKEMON == TRUE
     // Basculin
-    [SPECIES_BASCULIN_BLUE_STRIPED] = sBasculinTeachableLearnset,
-    [SPECIES_BASCULIN_WHITE_STRIPED] = sBasculinTeachableLearnset,
+    [SPECIES_BASCULIN_BLUE_STRIPED] = TEACHABLE_LEARNSET(sBasculinTeachableLearnset),
+    [SPECIES_BASCULIN_WHITE_STRIPED] = TEACHABLE_LEARNSET(sBasculinTeachableLearnset),
     // Darmanitan
-    [SPECIES_DARMANITAN_ZEN_MODE] = sDarmanitanTeachableLearnset,
-    [SPECIES_DARMANITAN_ZEN_MODE_GALARIAN] = sDarmanitanGalarianTeachableLearnset,
+    [SPECIES_DARMANITAN_ZEN_MODE] = TEACHABLE_LEARNSET(sDarmanitanTeachableLearnset),
+    [SPECIES_DARMANITAN_ZEN_MODE_GALARIAN] = TEACHABLE_LEARNSET(sDarmanitanGalarianTeachableLearnset),
     // Deerling
-    [SPECIES_DEERLING_SUMMER] = sDeerlingTeachableLearnset,
-    [SPECIES_DEERLING_AUTUMN] = sDeerlingTeachableLearnset,
-    [SPECIES_DEERLING_WINTER] = sDeerlingTeachableLearnset,
+    [SPECIES_DEERLING_SUMMER] = TEACHABLE_LEARNSET(sDeerlingTeachableLearnset),
+    [SPECIES_DEERLING_AUTUMN] = TEACHABLE_LEARNSET(sDeerlingTeachableLearnset),
+    [SPECIES_DEERLING_WINTER] = TEACHABLE_LEARNSET(sDeerlingTeachableLearnset),
     // Sawsbuck
-    [SPECIES_SAWSBUCK_SUMMER] = sSawsbuckTeachableLearnset,
-    [SPECIES_SAWSBUCK_AUTUMN] = sSawsbuckTeachableLearnset,
-    [SPECIES_SAWSBUCK_WINTER] = sSawsbuckTeachableLearnset,
+    [SPECIES_SAWSBUCK_SUMMER] = TEACHABLE_LEARNSET(sSawsbuckTeachableLearnset),
+    [SPECIES_SAWSBUCK_AUTUMN] = TEACHABLE_LEARNSET(sSawsbuckTeachableLearnset),
+    [SPECIES_SAWSBUCK_WINTER] = TEACHABLE_LEARNSET(sSawsbuckTeachableLearnset),
     // Therian Forms
-    [SPECIES_TORNADUS_THERIAN] = sTornadusTeachableLearnset,
-    [SPECIES_THUNDURUS_THERIAN] = sThundurusTeachableLearnset,
-    [SPECIES_LANDORUS_THERIAN] = sLandorusTeachableLearnset,
+    [SPECIES_TORNADUS_THERIAN] = TEACHABLE_LEARNSET(sTornadusTeachableLearnset),
+    [SPECIES_THUNDURUS_THERIAN] = TEACHABLE_LEARNSET(sThundurusTeachableLearnset),
+    [SPECIES_LANDORUS_THERIAN] = TEACHABLE_LEARNSET(sLandorusTeachableLearnset),
     // Kyurem
-    [SPECIES_KYUREM_WHITE] = sKyuremTeachableLearnset,
-    [SPECIES_KYUREM_BLACK] = sKyuremTeachableLearnset,
+    [SPECIES_KYUREM_WHITE] = TEACHABLE_LEARNSET(sKyuremTeachableLearnset),
+    [SPECIES_KYUREM_BLACK] = TEACHABLE_LEARNSET(sKyuremTeachableLearnset),
     // Keldeo
-    [SPECIES_KELDEO_RESOLUTE] = sKeldeoTeachableLearnset,
+    [SPECIES_KELDEO_RESOLUTE] = TEACHABLE_LEARNSET(sKeldeoTeachableLearnset),
     // Meloetta
-    [SPECIES_MELOETTA_PIROUETTE] = sMeloettaTeachableLearnset,
+    [SPECIES_MELOETTA_PIROUETTE] = TEACHABLE_LEARNSET(sMeloettaTeachableLearnset),
     // Genesect
-    [SPECIES_GENESECT_DOUSE_DRIVE] = sGenesectTeachableLearnset,
-    [SPECIES_GENESECT_SHOCK_DRIVE] = sGenesectTeachableLearnset,
-    [SPECIES_GENESECT_BURN_DRIVE] = sGenesectTeachableLearnset,
-    [SPECIES_GENESECT_CHILL_DRIVE] = sGenesectTeachableLearnset,
+    [SPECIES_GENESECT_DOUSE_DRIVE] = TEACHABLE_LEARNSET(sGenesectTeachableLearnset),
+    [SPECIES_GENESECT_SHOCK_DRIVE] = TEACHABLE_LEARNSET(sGenesectTeachableLearnset),
+    [SPECIES_GENESECT_BURN_DRIVE] = TEACHABLE_LEARNSET(sGenesectTeachableLearnset),
+    [SPECIES_GENESECT_CHILL_DRIVE] = TEACHABLE_LEARNSET(sGenesectTeachableLearnset),
 #endif
 #if P_GEN_6_POKEMON == TRUE
     // Greninja
-    [SPECIES_GRENINJA_BATTLE_BOND] = sGreninjaTeachableLearnset,
-    [SPECIES_GRENINJA_ASH] = sGreninjaTeachableLearnset,
+    [SPECIES_GRENINJA_BATTLE_BOND] = TEACHABLE_LEARNSET(sGreninjaTeachableLearnset),
+    [SPECIES_GRENINJA_ASH] = TEACHABLE_LEARNSET(sGreninjaTeachableLearnset),
     // Vivillon
-    [SPECIES_VIVILLON_POLAR] = sVivillonTeachableLearnset,
-    [SPECIES_VIVILLON_TUNDRA] = sVivillonTeachableLearnset,
-    [SPECIES_VIVILLON_CONTINENTAL] = sVivillonTeachableLearnset,
-    [SPECIES_VIVILLON_GARDEN] = sVivillonTeachableLearnset,
-    [SPECIES_VIVILLON_ELEGANT] = sVivillonTeachableLearnset,
-    [SPECIES_VIVILLON_MEADOW] = sVivillonTeachableLearnset,
-    [SPECIES_VIVILLON_MODERN] = sVivillonTeachableLearnset,
-    [SPECIES_VIVILLON_MARINE] = sVivillonTeachableLearnset,
-    [SPECIES_VIVILLON_ARCHIPELAGO] = sVivillonTeachableLearnset,
-    [SPECIES_VIVILLON_HIGH_PLAINS] = sVivillonTeachableLearnset,
-    [SPECIES_VIVILLON_SANDSTORM] = sVivillonTeachableLearnset,
-    [SPECIES_VIVILLON_RIVER] = sVivillonTeachableLearnset,
-    [SPECIES_VIVILLON_MONSOON] = sVivillonTeachableLearnset,
-    [SPECIES_VIVILLON_SAVANNA] = sVivillonTeachableLearnset,
-    [SPECIES_VIVILLON_SUN] = sVivillonTeachableLearnset,
-    [SPECIES_VIVILLON_OCEAN] = sVivillonTeachableLearnset,
-    [SPECIES_VIVILLON_JUNGLE] = sVivillonTeachableLearnset,
-    [SPECIES_VIVILLON_FANCY] = sVivillonTeachableLearnset,
-    [SPECIES_VIVILLON_POKE_BALL] = sVivillonTeachableLearnset,
+    [SPECIES_VIVILLON_POLAR] = TEACHABLE_LEARNSET(sVivillonTeachableLearnset),
+    [SPECIES_VIVILLON_TUNDRA] = TEACHABLE_LEARNSET(sVivillonTeachableLearnset),
+    [SPECIES_VIVILLON_CONTINENTAL] = TEACHABLE_LEARNSET(sVivillonTeachableLearnset),
+    [SPECIES_VIVILLON_GARDEN] = TEACHABLE_LEARNSET(sVivillonTeachableLearnset),
+    [SPECIES_VIVILLON_ELEGANT] = TEACHABLE_LEARNSET(sVivillonTeachableLearnset),
+    [SPECIES_VIVILLON_MEADOW] = TEACHABLE_LEARNSET(sVivillonTeachableLearnset),
+    [SPECIES_VIVILLON_MODERN] = TEACHABLE_LEARNSET(sVivillonTeachableLearnset),
+    [SPECIES_VIVILLON_MARINE] = TEACHABLE_LEARNSET(sVivillonTeachableLearnset),
+    [SPECIES_VIVILLON_ARCHIPELAGO] = TEACHABLE_LEARNSET(sVivillonTeachableLearnset),
+    [SPECIES_VIVILLON_HIGH_PLAINS] = TEACHABLE_LEARNSET(sVivillonTeachableLearnset),
+    [SPECIES_VIVILLON_SANDSTORM] = TEACHABLE_LEARNSET(sVivillonTeachableLearnset),
+    [SPECIES_VIVILLON_RIVER] = TEACHABLE_LEARNSET(sVivillonTeachableLearnset),
+    [SPECIES_VIVILLON_MONSOON] = TEACHABLE_LEARNSET(sVivillonTeachableLearnset),
+    [SPECIES_VIVILLON_SAVANNA] = TEACHABLE_LEARNSET(sVivillonTeachableLearnset),
+    [SPECIES_VIVILLON_SUN] = TEACHABLE_LEARNSET(sVivillonTeachableLearnset),
+    [SPECIES_VIVILLON_OCEAN] = TEACHABLE_LEARNSET(sVivillonTeachableLearnset),
+    [SPECIES_VIVILLON_JUNGLE] = TEACHABLE_LEARNSET(sVivillonTeachableLearnset),
+    [SPECIES_VIVILLON_FANCY] = TEACHABLE_LEARNSET(sVivillonTeachableLearnset),
+    [SPECIES_VIVILLON_POKE_BALL] = TEACHABLE_LEARNSET(sVivillonTeachableLearnset),
     // Flabébé
-    [SPECIES_FLABEBE_YELLOW_FLOWER] = sFlabebeTeachableLearnset,
-    [SPECIES_FLABEBE_ORANGE_FLOWER] = sFlabebeTeachableLearnset,
-    [SPECIES_FLABEBE_BLUE_FLOWER] = sFlabebeTeachableLearnset,
-    [SPECIES_FLABEBE_WHITE_FLOWER] = sFlabebeTeachableLearnset,
+    [SPECIES_FLABEBE_YELLOW_FLOWER] = TEACHABLE_LEARNSET(sFlabebeTeachableLearnset),
+    [SPECIES_FLABEBE_ORANGE_FLOWER] = TEACHABLE_LEARNSET(sFlabebeTeachableLearnset),
+    [SPECIES_FLABEBE_BLUE_FLOWER] = TEACHABLE_LEARNSET(sFlabebeTeachableLearnset),
+    [SPECIES_FLABEBE_WHITE_FLOWER] = TEACHABLE_LEARNSET(sFlabebeTeachableLearnset),
     // Floette
-    [SPECIES_FLOETTE_YELLOW_FLOWER] = sFloetteTeachableLearnset,
-    [SPECIES_FLOETTE_ORANGE_FLOWER] = sFloetteTeachableLearnset,
-    [SPECIES_FLOETTE_BLUE_FLOWER] = sFloetteTeachableLearnset,
-    [SPECIES_FLOETTE_WHITE_FLOWER] = sFloetteTeachableLearnset,
-    [SPECIES_FLOETTE_ETERNAL_FLOWER] = sFloetteEternalFlowerTeachableLearnset,
+    [SPECIES_FLOETTE_YELLOW_FLOWER] = TEACHABLE_LEARNSET(sFloetteTeachableLearnset),
+    [SPECIES_FLOETTE_ORANGE_FLOWER] = TEACHABLE_LEARNSET(sFloetteTeachableLearnset),
+    [SPECIES_FLOETTE_BLUE_FLOWER] = TEACHABLE_LEARNSET(sFloetteTeachableLearnset),
+    [SPECIES_FLOETTE_WHITE_FLOWER] = TEACHABLE_LEARNSET(sFloetteTeachableLearnset),
+    [SPECIES_FLOETTE_ETERNAL_FLOWER] = TEACHABLE_LEARNSET(sFloetteEternalFlowerTeachableLearnset),
     // Florges
-    [SPECIES_FLORGES_YELLOW_FLOWER] = sFlorgesTeachableLearnset,
-    [SPECIES_FLORGES_ORANGE_FLOWER] = sFlorgesTeachableLearnset,
-    [SPECIES_FLORGES_BLUE_FLOWER] = sFlorgesTeachableLearnset,
-    [SPECIES_FLORGES_WHITE_FLOWER] = sFlorgesTeachableLearnset,
+    [SPECIES_FLORGES_YELLOW_FLOWER] = TEACHABLE_LEARNSET(sFlorgesTeachableLearnset),
+    [SPECIES_FLORGES_ORANGE_FLOWER] = TEACHABLE_LEARNSET(sFlorgesTeachableLearnset),
+    [SPECIES_FLORGES_BLUE_FLOWER] = TEACHABLE_LEARNSET(sFlorgesTeachableLearnset),
+    [SPECIES_FLORGES_WHITE_FLOWER] = TEACHABLE_LEARNSET(sFlorgesTeachableLearnset),
     //Furfrou
-    [SPECIES_FURFROU_HEART_TRIM] = sFurfrouTeachableLearnset,
-    [SPECIES_FURFROU_STAR_TRIM] = sFurfrouTeachableLearnset,
-    [SPECIES_FURFROU_DIAMOND_TRIM] = sFurfrouTeachableLearnset,
-    [SPECIES_FURFROU_DEBUTANTE_TRIM] = sFurfrouTeachableLearnset,
-    [SPECIES_FURFROU_MATRON_TRIM] = sFurfrouTeachableLearnset,
-    [SPECIES_FURFROU_DANDY_TRIM] = sFurfrouTeachableLearnset,
-    [SPECIES_FURFROU_LA_REINE_TRIM] = sFurfrouTeachableLearnset,
-    [SPECIES_FURFROU_KABUKI_TRIM] = sFurfrouTeachableLearnset,
-    [SPECIES_FURFROU_PHARAOH_TRIM] = sFurfrouTeachableLearnset,
+    [SPECIES_FURFROU_HEART_TRIM] = TEACHABLE_LEARNSET(sFurfrouTeachableLearnset),
+    [SPECIES_FURFROU_STAR_TRIM] = TEACHABLE_LEARNSET(sFurfrouTeachableLearnset),
+    [SPECIES_FURFROU_DIAMOND_TRIM] = TEACHABLE_LEARNSET(sFurfrouTeachableLearnset),
+    [SPECIES_FURFROU_DEBUTANTE_TRIM] = TEACHABLE_LEARNSET(sFurfrouTeachableLearnset),
+    [SPECIES_FURFROU_MATRON_TRIM] = TEACHABLE_LEARNSET(sFurfrouTeachableLearnset),
+    [SPECIES_FURFROU_DANDY_TRIM] = TEACHABLE_LEARNSET(sFurfrouTeachableLearnset),
+    [SPECIES_FURFROU_LA_REINE_TRIM] = TEACHABLE_LEARNSET(sFurfrouTeachableLearnset),
+    [SPECIES_FURFROU_KABUKI_TRIM] = TEACHABLE_LEARNSET(sFurfrouTeachableLearnset),
+    [SPECIES_FURFROU_PHARAOH_TRIM] = TEACHABLE_LEARNSET(sFurfrouTeachableLearnset),
     // Meowstic
-    [SPECIES_MEOWSTIC_FEMALE] = sMeowsticFemaleTeachableLearnset,
+    [SPECIES_MEOWSTIC_FEMALE] = TEACHABLE_LEARNSET(sMeowsticFemaleTeachableLearnset),
     // Aegislash
-    [SPECIES_AEGISLASH_BLADE] = sAegislashTeachableLearnset,
+    [SPECIES_AEGISLASH_BLADE] = TEACHABLE_LEARNSET(sAegislashTeachableLearnset),
     // Pumpkaboo
-    [SPECIES_PUMPKABOO_SMALL] = sPumpkabooTeachableLearnset,
-    [SPECIES_PUMPKABOO_LARGE] = sPumpkabooTeachableLearnset,
-    [SPECIES_PUMPKABOO_SUPER] = sPumpkabooTeachableLearnset,
+    [SPECIES_PUMPKABOO_SMALL] = TEACHABLE_LEARNSET(sPumpkabooTeachableLearnset),
+    [SPECIES_PUMPKABOO_LARGE] = TEACHABLE_LEARNSET(sPumpkabooTeachableLearnset),
+    [SPECIES_PUMPKABOO_SUPER] = TEACHABLE_LEARNSET(sPumpkabooTeachableLearnset),
     // Gourgeist
-    [SPECIES_GOURGEIST_SMALL] = sGourgeistTeachableLearnset,
-    [SPECIES_GOURGEIST_LARGE] = sGourgeistTeachableLearnset,
-    [SPECIES_GOURGEIST_SUPER] = sGourgeistTeachableLearnset,
+    [SPECIES_GOURGEIST_SMALL] = TEACHABLE_LEARNSET(sGourgeistTeachableLearnset),
+    [SPECIES_GOURGEIST_LARGE] = TEACHABLE_LEARNSET(sGourgeistTeachableLearnset),
+    [SPECIES_GOURGEIST_SUPER] = TEACHABLE_LEARNSET(sGourgeistTeachableLearnset),
     // Xerneas
-    [SPECIES_XERNEAS_ACTIVE] = sXerneasTeachableLearnset,
+    [SPECIES_XERNEAS_ACTIVE] = TEACHABLE_LEARNSET(sXerneasTeachableLearnset),
     // Zygarde
-    [SPECIES_ZYGARDE_10] = sZygardeTeachableLearnset,
-    [SPECIES_ZYGARDE_10_POWER_CONSTRUCT] = sZygardeTeachableLearnset,
-    [SPECIES_ZYGARDE_50_POWER_CONSTRUCT] = sZygardeTeachableLearnset,
-    [SPECIES_ZYGARDE_COMPLETE] = sZygardeTeachableLearnset,
+    [SPECIES_ZYGARDE_10] = TEACHABLE_LEARNSET(sZygardeTeachableLearnset),
+    [SPECIES_ZYGARDE_10_POWER_CONSTRUCT] = TEACHABLE_LEARNSET(sZygardeTeachableLearnset),
+    [SPECIES_ZYGARDE_50_POWER_CONSTRUCT] = TEACHABLE_LEARNSET(sZygardeTeachableLearnset),
+    [SPECIES_ZYGARDE_COMPLETE] = TEACHABLE_LEARNSET(sZygardeTeachableLearnset),
     // Hoopa
-    [SPECIES_HOOPA_UNBOUND] = sHoopaUnboundTeachableLearnset,
+    [SPECIES_HOOPA_UNBOUND] = TEACHABLE_LEARNSET(sHoopaUnboundTeachableLearnset),
 #endif
 #if P_GEN_7_POKEMON == TRUE
     // Oricorio
-    [SPECIES_ORICORIO_POM_POM] = sOricorioTeachableLearnset,
-    [SPECIES_ORICORIO_PAU] = sOricorioTeachableLearnset,
-    [SPECIES_ORICORIO_SENSU] = sOricorioTeachableLearnset,
+    [SPECIES_ORICORIO_POM_POM] = TEACHABLE_LEARNSET(sOricorioTeachableLearnset),
+    [SPECIES_ORICORIO_PAU] = TEACHABLE_LEARNSET(sOricorioTeachableLearnset),
+    [SPECIES_ORICORIO_SENSU] = TEACHABLE_LEARNSET(sOricorioTeachableLearnset),
     // Rockruff
-    [SPECIES_ROCKRUFF_OWN_TEMPO] = sRockruffTeachableLearnset,
+    [SPECIES_ROCKRUFF_OWN_TEMPO] = TEACHABLE_LEARNSET(sRockruffTeachableLearnset),
     // Lycanroc
-    [SPECIES_LYCANROC_MIDNIGHT] = sLycanrocMidnightTeachableLearnset,
-    [SPECIES_LYCANROC_DUSK] = sLycanrocDuskTeachableLearnset,
+    [SPECIES_LYCANROC_MIDNIGHT] = TEACHABLE_LEARNSET(sLycanrocMidnightTeachableLearnset),
+    [SPECIES_LYCANROC_DUSK] = TEACHABLE_LEARNSET(sLycanrocDuskTeachableLearnset),
     // Wishiwashi
-    [SPECIES_WISHIWASHI_SCHOOL] = sWishiwashiTeachableLearnset,
+    [SPECIES_WISHIWASHI_SCHOOL] = TEACHABLE_LEARNSET(sWishiwashiTeachableLearnset),
     // Silvally
-    [SPECIES_SILVALLY_FIGHTING] = sSilvallyTeachableLearnset,
-    [SPECIES_SILVALLY_FLYING] = sSilvallyTeachableLearnset,
-    [SPECIES_SILVALLY_POISON] = sSilvallyTeachableLearnset,
-    [SPECIES_SILVALLY_GROUND] = sSilvallyTeachableLearnset,
-    [SPECIES_SILVALLY_ROCK] = sSilvallyTeachableLearnset,
-    [SPECIES_SILVALLY_BUG] = sSilvallyTeachableLearnset,
-    [SPECIES_SILVALLY_GHOST] = sSilvallyTeachableLearnset,
-    [SPECIES_SILVALLY_STEEL] = sSilvallyTeachableLearnset,
-    [SPECIES_SILVALLY_FIRE] = sSilvallyTeachableLearnset,
-    [SPECIES_SILVALLY_WATER] = sSilvallyTeachableLearnset,
-    [SPECIES_SILVALLY_GRASS] = sSilvallyTeachableLearnset,
-    [SPECIES_SILVALLY_ELECTRIC] = sSilvallyTeachableLearnset,
-    [SPECIES_SILVALLY_PSYCHIC] = sSilvallyTeachableLearnset,
-    [SPECIES_SILVALLY_ICE] = sSilvallyTeachableLearnset,
-    [SPECIES_SILVALLY_DRAGON] = sSilvallyTeachableLearnset,
-    [SPECIES_SILVALLY_DARK] = sSilvallyTeachableLearnset,
-    [SPECIES_SILVALLY_FAIRY] = sSilvallyTeachableLearnset,
+    [SPECIES_SILVALLY_FIGHTING] = TEACHABLE_LEARNSET(sSilvallyTeachableLearnset),
+    [SPECIES_SILVALLY_FLYING] = TEACHABLE_LEARNSET(sSilvallyTeachableLearnset),
+    [SPECIES_SILVALLY_POISON] = TEACHABLE_LEARNSET(sSilvallyTeachableLearnset),
+    [SPECIES_SILVALLY_GROUND] = TEACHABLE_LEARNSET(sSilvallyTeachableLearnset),
+    [SPECIES_SILVALLY_ROCK] = TEACHABLE_LEARNSET(sSilvallyTeachableLearnset),
+    [SPECIES_SILVALLY_BUG] = TEACHABLE_LEARNSET(sSilvallyTeachableLearnset),
+    [SPECIES_SILVALLY_GHOST] = TEACHABLE_LEARNSET(sSilvallyTeachableLearnset),
+    [SPECIES_SILVALLY_STEEL] = TEACHABLE_LEARNSET(sSilvallyTeachableLearnset),
+    [SPECIES_SILVALLY_FIRE] = TEACHABLE_LEARNSET(sSilvallyTeachableLearnset),
+    [SPECIES_SILVALLY_WATER] = TEACHABLE_LEARNSET(sSilvallyTeachableLearnset),
+    [SPECIES_SILVALLY_GRASS] = TEACHABLE_LEARNSET(sSilvallyTeachableLearnset),
+    [SPECIES_SILVALLY_ELECTRIC] = TEACHABLE_LEARNSET(sSilvallyTeachableLearnset),
+    [SPECIES_SILVALLY_PSYCHIC] = TEACHABLE_LEARNSET(sSilvallyTeachableLearnset),
+    [SPECIES_SILVALLY_ICE] = TEACHABLE_LEARNSET(sSilvallyTeachableLearnset),
+    [SPECIES_SILVALLY_DRAGON] = TEACHABLE_LEARNSET(sSilvallyTeachableLearnset),
+    [SPECIES_SILVALLY_DARK] = TEACHABLE_LEARNSET(sSilvallyTeachableLearnset),
+    [SPECIES_SILVALLY_FAIRY] = TEACHABLE_LEARNSET(sSilvallyTeachableLearnset),
     // Minior
-    [SPECIES_MINIOR_METEOR_ORANGE] = sMiniorTeachableLearnset,
-    [SPECIES_MINIOR_METEOR_YELLOW] = sMiniorTeachableLearnset,
-    [SPECIES_MINIOR_METEOR_GREEN] = sMiniorTeachableLearnset,
-    [SPECIES_MINIOR_METEOR_BLUE] = sMiniorTeachableLearnset,
-    [SPECIES_MINIOR_METEOR_INDIGO] = sMiniorTeachableLearnset,
-    [SPECIES_MINIOR_METEOR_VIOLET] = sMiniorTeachableLearnset,
-    [SPECIES_MINIOR_CORE_RED] = sMiniorTeachableLearnset,
-    [SPECIES_MINIOR_CORE_ORANGE] = sMiniorTeachableLearnset,
-    [SPECIES_MINIOR_CORE_YELLOW] = sMiniorTeachableLearnset,
-    [SPECIES_MINIOR_CORE_GREEN] = sMiniorTeachableLearnset,
-    [SPECIES_MINIOR_CORE_BLUE] = sMiniorTeachableLearnset,
-    [SPECIES_MINIOR_CORE_INDIGO] = sMiniorTeachableLearnset,
-    [SPECIES_MINIOR_CORE_VIOLET] = sMiniorTeachableLearnset,
+    [SPECIES_MINIOR_METEOR_ORANGE] = TEACHABLE_LEARNSET(sMiniorTeachableLearnset),
+    [SPECIES_MINIOR_METEOR_YELLOW] = TEACHABLE_LEARNSET(sMiniorTeachableLearnset),
+    [SPECIES_MINIOR_METEOR_GREEN] = TEACHABLE_LEARNSET(sMiniorTeachableLearnset),
+    [SPECIES_MINIOR_METEOR_BLUE] = TEACHABLE_LEARNSET(sMiniorTeachableLearnset),
+    [SPECIES_MINIOR_METEOR_INDIGO] = TEACHABLE_LEARNSET(sMiniorTeachableLearnset),
+    [SPECIES_MINIOR_METEOR_VIOLET] = TEACHABLE_LEARNSET(sMiniorTeachableLearnset),
+    [SPECIES_MINIOR_CORE_RED] = TEACHABLE_LEARNSET(sMiniorTeachableLearnset),
+    [SPECIES_MINIOR_CORE_ORANGE] = TEACHABLE_LEARNSET(sMiniorTeachableLearnset),
+    [SPECIES_MINIOR_CORE_YELLOW] = TEACHABLE_LEARNSET(sMiniorTeachableLearnset),
+    [SPECIES_MINIOR_CORE_GREEN] = TEACHABLE_LEARNSET(sMiniorTeachableLearnset),
+    [SPECIES_MINIOR_CORE_BLUE] = TEACHABLE_LEARNSET(sMiniorTeachableLearnset),
+    [SPECIES_MINIOR_CORE_INDIGO] = TEACHABLE_LEARNSET(sMiniorTeachableLearnset),
+    [SPECIES_MINIOR_CORE_VIOLET] = TEACHABLE_LEARNSET(sMiniorTeachableLearnset),
     // Mimikyu
-    [SPECIES_MIMIKYU_BUSTED] = sMimikyuTeachableLearnset,
+    [SPECIES_MIMIKYU_BUSTED] = TEACHABLE_LEARNSET(sMimikyuTeachableLearnset),
     // Necrozma
-    [SPECIES_NECROZMA_DUSK_MANE] = sNecrozmaTeachableLearnset,
-    [SPECIES_NECROZMA_DAWN_WINGS] = sNecrozmaTeachableLearnset,
-    [SPECIES_NECROZMA_ULTRA] = sNecrozmaTeachableLearnset,
+    [SPECIES_NECROZMA_DUSK_MANE] = TEACHABLE_LEARNSET(sNecrozmaTeachableLearnset),
+    [SPECIES_NECROZMA_DAWN_WINGS] = TEACHABLE_LEARNSET(sNecrozmaTeachableLearnset),
+    [SPECIES_NECROZMA_ULTRA] = TEACHABLE_LEARNSET(sNecrozmaTeachableLearnset),
     // Magearna
-    [SPECIES_MAGEARNA_ORIGINAL_COLOR] = sMagearnaTeachableLearnset,
+    [SPECIES_MAGEARNA_ORIGINAL_COLOR] = TEACHABLE_LEARNSET(sMagearnaTeachableLearnset),
 #endif
 #if P_GEN_8_POKEMON == TRUE
     // Cramorant
-    [SPECIES_CRAMORANT_GULPING] = sCramorantTeachableLearnset,
-    [SPECIES_CRAMORANT_GORGING] = sCramorantTeachableLearnset,
+    [SPECIES_CRAMORANT_GULPING] = TEACHABLE_LEARNSET(sCramorantTeachableLearnset),
+    [SPECIES_CRAMORANT_GORGING] = TEACHABLE_LEARNSET(sCramorantTeachableLearnset),
     // Toxtricity
-    [SPECIES_TOXTRICITY_LOW_KEY] = sToxtricityLowKeyTeachableLearnset,
+    [SPECIES_TOXTRICITY_LOW_KEY] = TEACHABLE_LEARNSET(sToxtricityLowKeyTeachableLearnset),
     // Sinistea
-    [SPECIES_SINISTEA_ANTIQUE] = sSinisteaTeachableLearnset,
+    [SPECIES_SINISTEA_ANTIQUE] = TEACHABLE_LEARNSET(sSinisteaTeachableLearnset),
     // Polteageist
-    [SPECIES_POLTEAGEIST_ANTIQUE] = sPolteageistTeachableLearnset,
+    [SPECIES_POLTEAGEIST_ANTIQUE] = TEACHABLE_LEARNSET(sPolteageistTeachableLearnset),
     // Alcremie
-    [SPECIES_ALCREMIE_RUBY_CREAM] = sAlcremieTeachableLearnset,
-    [SPECIES_ALCREMIE_MATCHA_CREAM] = sAlcremieTeachableLearnset,
-    [SPECIES_ALCREMIE_MINT_CREAM] = sAlcremieTeachableLearnset,
-    [SPECIES_ALCREMIE_LEMON_CREAM] = sAlcremieTeachableLearnset,
-    [SPECIES_ALCREMIE_SALTED_CREAM] = sAlcremieTeachableLearnset,
-    [SPECIES_ALCREMIE_RUBY_SWIRL] = sAlcremieTeachableLearnset,
-    [SPECIES_ALCREMIE_CARAMEL_SWIRL] = sAlcremieTeachableLearnset,
-    [SPECIES_ALCREMIE_RAINBOW_SWIRL] = sAlcremieTeachableLearnset,
+    [SPECIES_ALCREMIE_RUBY_CREAM] = TEACHABLE_LEARNSET(sAlcremieTeachableLearnset),
+    [SPECIES_ALCREMIE_MATCHA_CREAM] = TEACHABLE_LEARNSET(sAlcremieTeachableLearnset),
+    [SPECIES_ALCREMIE_MINT_CREAM] = TEACHABLE_LEARNSET(sAlcremieTeachableLearnset),
+    [SPECIES_ALCREMIE_LEMON_CREAM] = TEACHABLE_LEARNSET(sAlcremieTeachableLearnset),
+    [SPECIES_ALCREMIE_SALTED_CREAM] = TEACHABLE_LEARNSET(sAlcremieTeachableLearnset),
+    [SPECIES_ALCREMIE_RUBY_SWIRL] = TEACHABLE_LEARNSET(sAlcremieTeachableLearnset),
+    [SPECIES_ALCREMIE_CARAMEL_SWIRL] = TEACHABLE_LEARNSET(sAlcremieTeachableLearnset),
+    [SPECIES_ALCREMIE_RAINBOW_SWIRL] = TEACHABLE_LEARNSET(sAlcremieTeachableLearnset),
     // Eiscue
-    [SPECIES_EISCUE_NOICE_FACE] = sEiscueTeachableLearnset,
+    [SPECIES_EISCUE_NOICE_FACE] = TEACHABLE_LEARNSET(sEiscueTeachableLearnset),
     // Indeedee
-    [SPECIES_INDEEDEE_FEMALE] = sIndeedeeFemaleTeachableLearnset,
+    [SPECIES_INDEEDEE_FEMALE] = TEACHABLE_LEARNSET(sIndeedeeFemaleTeachableLearnset),
     // Morpeko
-    [SPECIES_MORPEKO_HANGRY] = sMorpekoTeachableLearnset,
+    [SPECIES_MORPEKO_HANGRY] = TEACHABLE_LEARNSET(sMorpekoTeachableLearnset),
     // Zacian
-    [SPECIES_ZACIAN_CROWNED_SWORD] = sZacianTeachableLearnset,
+    [SPECIES_ZACIAN_CROWNED_SWORD] = TEACHABLE_LEARNSET(sZacianTeachableLearnset),
     // Zamazenta
-    [SPECIES_ZAMAZENTA_CROWNED_SHIELD] = sZamazentaTeachableLearnset,
+    [SPECIES_ZAMAZENTA_CROWNED_SHIELD] = TEACHABLE_LEARNSET(sZamazentaTeachableLearnset),
     // Eternatus
-    [SPECIES_ETERNATUS_ETERNAMAX] = sEternatusTeachableLearnset,
+    [SPECIES_ETERNATUS_ETERNAMAX] = TEACHABLE_LEARNSET(sEternatusTeachableLearnset),
     // Urshifu
-    [SPECIES_URSHIFU_RAPID_STRIKE_STYLE] = sUrshifuRapidStrikeStyleTeachableLearnset,
+    [SPECIES_URSHIFU_RAPID_STRIKE_STYLE] = TEACHABLE_LEARNSET(sUrshifuRapidStrikeStyleTeachableLearnset),
     // Zarude
-    [SPECIES_ZARUDE_DADA] = sZarudeTeachableLearnset,
+    [SPECIES_ZARUDE_DADA] = TEACHABLE_LEARNSET(sZarudeTeachableLearnset),
     // Calyrex
-    [SPECIES_CALYREX_ICE_RIDER] = sCalyrexIceRiderTeachableLearnset,
-    [SPECIES_CALYREX_SHADOW_RIDER] = sCalyrexShadowRiderTeachableLearnset,
+    [SPECIES_CALYREX_ICE_RIDER] = TEACHABLE_LEARNSET(sCalyrexIceRiderTeachableLearnset),
+    [SPECIES_CALYREX_SHADOW_RIDER] = TEACHABLE_LEARNSET(sCalyrexShadowRiderTeachableLearnset),
     // Enamorus
-    [SPECIES_ENAMORUS_THERIAN] = sEnamorusTeachableLearnset,
-    [SPECIES_BASCULEGION_FEMALE] = sBasculegionTeachableLearnset,
+    [SPECIES_ENAMORUS_THERIAN] = TEACHABLE_LEARNSET(sEnamorusTeachableLearnset),
+    [SPECIES_BASCULEGION_FEMALE] = TEACHABLE_LEARNSET(sBasculegionTeachableLearnset),
 #endif
 };
@@ -747,31 +747,15 @@ static void InheritAbility(struct Pokemon *egg, struct BoxPokemon *father, struc
 // the given array.
 static u8 GetEggMoves(struct Pokemon *pokemon, u16 *eggMoves)
 {
-    u16 eggMoveIdx;
     u16 numEggMoves;
-    u16 species;
-    u16 i;
-
-    numEggMoves = 0;
-    eggMoveIdx = 0;
-    species = GetMonData(pokemon, MON_DATA_SPECIES);
-    for (i = 0; i < ARRAY_COUNT(gEggMoves) - 1; i++)
-    {
-        if (gEggMoves[i] == species + EGG_MOVES_SPECIES_OFFSET)
-        {
-            eggMoveIdx = i + 1;
-            break;
-        }
-    }
+    u16 species = GetMonData(pokemon, MON_DATA_SPECIES);
+    const u16 *learnset = gEggMoveLearnsets[species];
 
-    for (i = 0; i < EGG_MOVES_ARRAY_COUNT; i++)
-    {
-        if (gEggMoves[eggMoveIdx + i] > EGG_MOVES_SPECIES_OFFSET)
-            break;
+    if (learnset == NULL)
+        return 0;
 
-        eggMoves[i] = gEggMoves[eggMoveIdx + i];
-        numEggMoves++;
-    }
+    for (numEggMoves = 0; numEggMoves < EGG_MOVES_ARRAY_COUNT && learnset[numEggMoves] != MOVE_UNAVAILABLE; numEggMoves++)
+        eggMoves[numEggMoves] = learnset[numEggMoves];
 
     return numEggMoves;
 }
@@ -18,11 +18,194 @@ void LZDecompressVram(const u32 *src, void *dest)
     LZ77UnCompVram(src, dest);
 }
 
+// Recently decompressed data is kept in an EWRAM arena keyed by its compressed source,
+// so assets that are loaded again (e.g. the map tilesets when returning to the field)
+// are copied instead of decompressed. Only data in ROM is cached, since it can't change.
+// The least recently used entries are evicted when the arena or entry table is full.
+#if OW_DECOMPRESSION_CACHE_SIZE != 0
+
+#define DECOMPRESSION_CACHE_ENTRIES 16
+#define ALIGN_DECOMPRESSION_SIZE(size) (((size) + 3) & ~3)
+
+struct DecompressionCacheEntry
+{
+    const u32 *src;
+    u32 offset;
+    u32 size;
+    u32 lastUsed;
+};
+
+struct DecompressionCache
+{
+    struct DecompressionCacheEntry entries[DECOMPRESSION_CACHE_ENTRIES];
+    u32 clock;
+    struct DecompressionCacheStats stats;
+};
+
+static EWRAM_DATA struct DecompressionCache sDecompressionCache = {0};
+static EWRAM_DATA ALIGNED(4) u8 sDecompressionCacheData[OW_DECOMPRESSION_CACHE_SIZE] = {0};
+
+static bool32 IsCacheableCompressedData(const u32 *src)
+{
+    return (u32)src >= ROM_START && GetDecompressedDataSize(src) <= OW_DECOMPRESSION_CACHE_SIZE;
+}
+
+static struct DecompressionCacheEntry *FindDecompressionCacheEntry(const u32 *src)
+{
+    u32 i;
+
+    for (i = 0; i < DECOMPRESSION_CACHE_ENTRIES; i++)
+    {
+        if (sDecompressionCache.entries[i].src == src)
+            return &sDecompressionCache.entries[i];
+    }
+    return NULL;
+}
+
+static void EvictLeastRecentlyUsedDecompression(void)
+{
+    struct DecompressionCacheEntry *oldest = NULL;
+    u32 i;
+
+    for (i = 0; i < DECOMPRESSION_CACHE_ENTRIES; i++)
+    {
+        struct DecompressionCacheEntry *entry = &sDecompressionCache.entries[i];
+        if (entry->src != NULL && (oldest == NULL || entry->lastUsed < oldest->lastUsed))
+            oldest = entry;
+    }
+    sDecompressionCache.stats.bytesUsed -= ALIGN_DECOMPRESSION_SIZE(oldest->size);
+    sDecompressionCache.stats.evictions++;
+    oldest->src = NULL;
+}
+
+// Moves the remaining entries to the start of the arena, in arena order, so the free space is contiguous.
+// Returns the offset of the free space.
+static u32 CompactDecompressionCache(void)
+{
+    u32 end = 0;
+
+    while (TRUE)
+    {
+        struct DecompressionCacheEntry *next = NULL;
+        u32 i;
+
+        for (i = 0; i < DECOMPRESSION_CACHE_ENTRIES; i++)
+        {
+            struct DecompressionCacheEntry *entry = &sDecompressionCache.entries[i];
+            if (entry->src != NULL && entry->offset >= end && (next == NULL || entry->offset < next->offset))
+                next = entry;
+        }
+        if (next == NULL)
+            break;
+        if (next->offset != end)
+        {
+            memmove(&sDecompressionCacheData[end], &sDecompressionCacheData[next->offset], next->size);
+            next->offset = end;
+        }
+        end += ALIGN_DECOMPRESSION_SIZE(next->size);
+    }
+    return end;
+}
+
+bool32 TryCopyCachedDecompressedData(const u32 *src, void *dest)
+{
+    struct DecompressionCacheEntry *entry = FindDecompressionCacheEntry(src);
+
+    if (entry == NULL)
+    {
+        sDecompressionCache.stats.misses++;
+        return FALSE;
+    }
+    memcpy(dest, &sDecompressionCacheData[entry->offset], entry->size);
+    entry->lastUsed = ++sDecompressionCache.clock;
+    sDecompressionCache.stats.hits++;
+    return TRUE;
+}
+
+void AddDecompressedDataToCache(const u32 *src, const void *data)
+{
+    struct DecompressionCacheEntry *entry;
+    u32 size;
+
+    if (!IsCacheableCompressedData(src) || FindDecompressionCacheEntry(src) != NULL)
+        return;
+
+    size = GetDecompressedDataSize(src);
+    while (TRUE)
+    {
+        entry = FindDecompressionCacheEntry(NULL);
+        if (entry != NULL && sDecompressionCache.stats.bytesUsed + ALIGN_DECOMPRESSION_SIZE(size) <= OW_DECOMPRESSION_CACHE_SIZE)
+            break;
+        EvictLeastRecentlyUsedDecompression();
+    }
+
+    entry->offset = CompactDecompressionCache();
+    entry->src = src;
+    entry->size = size;
+    entry->lastUsed = ++sDecompressionCache.clock;
+    memcpy(&sDecompressionCacheData[entry->offset], data, size);
+    sDecompressionCache.stats.bytesUsed += ALIGN_DECOMPRESSION_SIZE(size);
+}
+
+void LZDecompressWramCached(const u32 *src, void *dest)
+{
+    if (!IsCacheableCompressedData(src))
+    {
+        LZ77UnCompWram(src, dest);
+    }
+    else if (!TryCopyCachedDecompressedData(src, dest))
+    {
+        LZ77UnCompWram(src, dest);
+        AddDecompressedDataToCache(src, dest);
+    }
+}
+
+void ClearDecompressionCache(void)
+{
+    u32 i;
+
+    for (i = 0; i < DECOMPRESSION_CACHE_ENTRIES; i++)
+        sDecompressionCache.entries[i].src = NULL;
+    sDecompressionCache.stats.bytesUsed = 0;
+}
+
+void GetDecompressionCacheStats(struct DecompressionCacheStats *stats)
+{
+    *stats = sDecompressionCache.stats;
+}
+
+#else
+
+bool32 TryCopyCachedDecompressedData(const u32 *src, void *dest)
+{
+    return FALSE;
+}
+
+void AddDecompressedDataToCache(const u32 *src, const void *data)
+{
+}
+
+void LZDecompressWramCached(const u32 *src, void *dest)
+{
+    LZ77UnCompWram(src, dest);
+}
+
+void ClearDecompressionCache(void)
+{
+}
+
+void GetDecompressionCacheStats(struct DecompressionCacheStats *stats)
+{
+    memset(stats, 0, sizeof(*stats));
+}
+
+#endif // OW_DECOMPRESSION_CACHE_SIZE
+
 u16 LoadCompressedSpriteSheet(const struct CompressedSpriteSheet *src)
 {
     struct SpriteSheet dest;
 
-    LZ77UnCompWram(src->data, gDecompressionBuffer);
+    LZDecompressWramCached(src->data, gDecompressionBuffer);
     dest.data = gDecompressionBuffer;
     dest.size = src->size;
     dest.tag = src->tag;
@@ -44,7 +227,7 @@ void LoadCompressedSpritePalette(const struct CompressedSpritePalette *src)
 {
     struct SpritePalette dest;
 
-    LZ77UnCompWram(src->data, gDecompressionBuffer);
+    LZDecompressWramCached(src->data, gDecompressionBuffer);
     dest.data = (void *) gDecompressionBuffer;
     dest.tag = src->tag;
     LoadSpritePalette(&dest);
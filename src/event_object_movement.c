@@ -80,6 +80,17 @@ static EWRAM_DATA u8 sCurrentReflectionType = 0;
 static EWRAM_DATA u16 sCurrentSpecialObjectPaletteTag = 0;
 static EWRAM_DATA struct LockedAnimObjectEvents *sLockedAnimObjectEvents = {0};
 
+// Coarse spatial index of the object events. Each bucket is a bitmask of the object events whose current or
+// previous coords hash to it, so position lookups only look at those objects (the coords are still compared).
+// Anything that changes an object event's coords must call UpdateObjectEventSpatialIndex afterwards.
+#define OBJ_EVENT_BUCKET_COUNT 64
+#define OBJ_EVENT_BUCKET(x, y) (((x) & 7) | (((y) & 7) << 3))
+
+STATIC_ASSERT(OBJECT_EVENTS_COUNT <= 32, ObjectEventSpatialIndexFitsInBitmask);
+
+static EWRAM_DATA u32 sObjectEventBuckets[OBJ_EVENT_BUCKET_COUNT] = {0};
+static EWRAM_DATA u8 sObjectEventBucketIds[OBJECT_EVENTS_COUNT][2] = {0};
+
 static void MoveCoordsInDirection(u32, s16 *, s16 *, s16, s16);
 static bool8 ObjectEventExecSingleMovementAction(struct ObjectEvent *, struct Sprite *);
 static void SetMovementDelay(struct Sprite *, s16);
@@ -1178,6 +1189,31 @@ static void ClearAllObjectEvents(void)
 
     for (i = 0; i < OBJECT_EVENTS_COUNT; i++)
         ClearObjectEvent(&gObjectEvents[i]);
+    RebuildObjectEventSpatialIndex();
+}
+
+void UpdateObjectEventSpatialIndex(struct ObjectEvent *objectEvent)
+{
+    u32 objectEventId = objectEvent - gObjectEvents;
+    u32 bit = 1 << objectEventId;
+    u8 *bucketIds = sObjectEventBucketIds[objectEventId];
+
+    sObjectEventBuckets[bucketIds[0]] &= ~bit;
+    sObjectEventBuckets[bucketIds[1]] &= ~bit;
+    bucketIds[0] = OBJ_EVENT_BUCKET(objectEvent->currentCoords.x, objectEvent->currentCoords.y);
+    bucketIds[1] = OBJ_EVENT_BUCKET(objectEvent->previousCoords.x, objectEvent->previousCoords.y);
+    sObjectEventBuckets[bucketIds[0]] |= bit;
+    sObjectEventBuckets[bucketIds[1]] |= bit;
+}
+
+void RebuildObjectEventSpatialIndex(void)
+{
+    u8 i;
+
+    for (i = 0; i < OBJ_EVENT_BUCKET_COUNT; i++)
+        sObjectEventBuckets[i] = 0;
+    for (i = 0; i < OBJECT_EVENTS_COUNT; i++)
+        UpdateObjectEventSpatialIndex(&gObjectEvents[i]);
 }
 
 void ResetObjectEvents(void)
@@ -1235,13 +1271,15 @@ bool8 TryGetObjectEventIdByLocalIdAndMap(u8 localId, u8 mapNum, u8 mapGroupId, u
 u8 GetObjectEventIdByXY(s16 x, s16 y)
 {
     u8 i;
-    for (i = 0; i < OBJECT_EVENTS_COUNT; i++)
+    u32 candidates = sObjectEventBuckets[OBJ_EVENT_BUCKET(x, y)];
+
+    for (i = 0; candidates != 0; i++, candidates >>= 1)
     {
-        if (gObjectEvents[i].active && gObjectEvents[i].currentCoords.x == x && gObjectEvents[i].currentCoords.y == y)
-            break;
+        if ((candidates & 1) && gObjectEvents[i].active && gObjectEvents[i].currentCoords.x == x && gObjectEvents[i].currentCoords.y == y)
+            return i;
     }
 
-    return i;
+    return OBJECT_EVENTS_COUNT;
 }
 
 static u8 GetObjectEventIdByLocalIdAndMapInternal(u8 localId, u8 mapNum, u8 mapGroupId)
@@ -1294,6 +1332,7 @@ static u8 InitObjectEventStateFromTemplate(const struct ObjectEventTemplate *tem
     objectEvent->currentCoords.y = y;
     objectEvent->previousCoords.x = x;
     objectEvent->previousCoords.y = y;
+    UpdateObjectEventSpatialIndex(objectEvent);
     objectEvent->currentElevation = template->elevation;
     objectEvent->previousElevation = template->elevation;
     objectEvent->rangeX = template->movementRangeX;
@@ -2098,6 +2137,7 @@ static void IncrementObjectEventCoords(struct ObjectEvent *objectEvent, s16 x, s
     objectEvent->previousCoords.y = objectEvent->currentCoords.y;
     objectEvent->currentCoords.x += x;
     objectEvent->currentCoords.y += y;
+    UpdateObjectEventSpatialIndex(objectEvent);
 }
 
 void ShiftObjectEventCoords(struct ObjectEvent *objectEvent, s16 x, s16 y)
@@ -2106,6 +2146,7 @@ void ShiftObjectEventCoords(struct ObjectEvent *objectEvent, s16 x, s16 y)
     objectEvent->previousCoords.y = objectEvent->currentCoords.y;
     objectEvent->currentCoords.x = x;
     objectEvent->currentCoords.y = y;
+    UpdateObjectEventSpatialIndex(objectEvent);
 }
 
 static void SetObjectEventCoords(struct ObjectEvent *objectEvent, s16 x, s16 y)
@@ -2114,6 +2155,7 @@ static void SetObjectEventCoords(struct ObjectEvent *objectEvent, s16 x, s16 y)
     objectEvent->previousCoords.y = y;
     objectEvent->currentCoords.x = x;
     objectEvent->currentCoords.y = y;
+    UpdateObjectEventSpatialIndex(objectEvent);
 }
 
 void MoveObjectEventToMapCoords(struct ObjectEvent *objectEvent, s16 x, s16 y)
@@ -2172,16 +2214,18 @@ void UpdateObjectEventCoordsForCameraUpdate(void)
                 gObjectEvents[i].previousCoords.y -= dy;
             }
         }
+        RebuildObjectEventSpatialIndex();
     }
 }
 
 u8 GetObjectEventIdByPosition(u16 x, u16 y, u8 elevation)
 {
     u8 i;
+    u32 candidates = sObjectEventBuckets[OBJ_EVENT_BUCKET(x, y)];
 
-    for (i = 0; i < OBJECT_EVENTS_COUNT; i++)
+    for (i = 0; candidates != 0; i++, candidates >>= 1)
     {
-        if (gObjectEvents[i].active)
+        if ((candidates & 1) && gObjectEvents[i].active)
         {
             if (gObjectEvents[i].currentCoords.x == x
              && gObjectEvents[i].currentCoords.y == y
@@ -4726,11 +4770,12 @@ static bool8 DoesObjectCollideWithObjectAt(struct ObjectEvent *objectEvent, s16
 {
     u8 i;
     struct ObjectEvent *curObject;
+    u32 candidates = sObjectEventBuckets[OBJ_EVENT_BUCKET(x, y)];
 
-    for (i = 0; i < OBJECT_EVENTS_COUNT; i++)
+    for (i = 0; candidates != 0; i++, candidates >>= 1)
     {
         curObject = &gObjectEvents[i];
-        if (curObject->active && curObject != objectEvent)
+        if ((candidates & 1) && curObject->active && curObject != objectEvent)
         {
             if ((curObject->currentCoords.x == x && curObject->currentCoords.y == y) || (curObject->previousCoords.x == x && curObject->previousCoords.y == y))
             {
@@ -1,5 +1,6 @@
 #include "global.h"
 #include "berry.h"
+#include "bg.h"
 #include "bike.h"
 #include "field_camera.h"
 #include "field_player_avatar.h"
@@ -34,6 +35,8 @@ static void DrawMetatile(s32, const u16 *, u16);
 static void CameraPanningCB_PanAhead(void);
 
 static struct FieldCameraOffset sFieldCameraOffset;
+// Rows of the overworld tilemap buffers (BG1-3) changed since they were last copied to VRAM.
+static u32 sDirtyTilemapRows;
 static s16 sHorizontalCameraPan;
 static s16 sVerticalCameraPan;
 static bool8 sBikeCameraPanFlag;
@@ -302,9 +305,33 @@ static void DrawMetatile(s32 metatileLayerType, const u16 *tiles, u16 offset)
         gOverworldTilemapBuffer_Bg1[offset + 0x21] = tiles[7];
         break;
     }
-    ScheduleBgCopyTilemapToVram(1);
-    ScheduleBgCopyTilemapToVram(2);
-    ScheduleBgCopyTilemapToVram(3);
+    // A metatile covers two tilemap rows.
+    sDirtyTilemapRows |= (1 << (offset / 32)) | (1 << ((offset / 32 + 1) % 32));
+}
+
+// Queues the changed rows of the overworld tilemaps for copying to VRAM, one DMA
+// request per run of consecutive rows, instead of copying the whole tilemaps.
+void CopyDirtyFieldTilemapRowsToVram(void)
+{
+    u32 rows = sDirtyTilemapRows;
+    u32 row = 0;
+    u32 count;
+
+    sDirtyTilemapRows = 0;
+    if (gOverworldTilemapBuffer_Bg1 == NULL || gOverworldTilemapBuffer_Bg2 == NULL || gOverworldTilemapBuffer_Bg3 == NULL)
+        return;
+
+    while (rows != 0)
+    {
+        for (; !(rows & 1); rows >>= 1)
+            row++;
+        for (count = 0; rows & 1; rows >>= 1)
+            count++;
+        LoadBgTilemap(1, &gOverworldTilemapBuffer_Bg1[row * 32], count * 32 * sizeof(u16), row * 32);
+        LoadBgTilemap(2, &gOverworldTilemapBuffer_Bg2[row * 32], count * 32 * sizeof(u16), row * 32);
+        LoadBgTilemap(3, &gOverworldTilemapBuffer_Bg3[row * 32], count * 32 * sizeof(u16), row * 32);
+        row += count;
+    }
 }
 
 static s32 MapPosToBgTilemapOffset(struct FieldCameraOffset *cameraOffset, s32 x, s32 y)
@@ -883,12 +883,47 @@ static bool8 TryDoorWarp(struct MapPosition *position, u16 metatileBehavior, u8
     return FALSE;
 }
 
+// Binary searches a map event table sorted by position (see MapEvents) for the first event on the given tile.
+// All the event structs start with their x and y coords. Returns the position in the sorted table, which is
+// count if there are no events on the tile.
+static u32 FindFirstEventByPosition(const u8 *eventsByPosition, u32 count, const void *events, u32 eventSize, s16 x, s16 y)
+{
+    u32 low = 0;
+    u32 high = count;
+
+    while (low < high)
+    {
+        u32 mid = (low + high) / 2;
+        const s16 *coords = (const s16 *)((const u8 *)events + eventsByPosition[mid] * eventSize);
+
+        if (coords[1] < y || (coords[1] == y && coords[0] < x))
+            low = mid + 1;
+        else
+            high = mid;
+    }
+    return low;
+}
+
 static s8 GetWarpEventAtPosition(struct MapHeader *mapHeader, u16 x, u16 y, u8 elevation)
 {
     s32 i;
     const struct WarpEvent *warpEvent = mapHeader->events->warps;
+    const u8 *warpsByPosition = mapHeader->events->warpsByPosition;
     u8 warpCount = mapHeader->events->warpCount;
 
+    if (warpsByPosition != NULL)
+    {
+        for (i = FindFirstEventByPosition(warpsByPosition, warpCount, warpEvent, sizeof(*warpEvent), x, y); i < warpCount; i++)
+        {
+            warpEvent = &mapHeader->events->warps[warpsByPosition[i]];
+            if ((u16)warpEvent->x != x || (u16)warpEvent->y != y)
+                break;
+            if (warpEvent->elevation == elevation || warpEvent->elevation == 0)
+                return warpsByPosition[i];
+        }
+        return WARP_ID_NONE;
+    }
+
     for (i = 0; i < warpCount; i++, warpEvent++)
     {
         if ((u16)warpEvent->x == x && (u16)warpEvent->y == y)
@@ -926,8 +961,27 @@ static const u8 *GetCoordEventScriptAtPosition(struct MapHeader *mapHeader, u16
 {
     s32 i;
     const struct CoordEvent *coordEvents = mapHeader->events->coordEvents;
+    const u8 *coordEventsByPosition = mapHeader->events->coordEventsByPosition;
     u8 coordEventCount = mapHeader->events->coordEventCount;
 
+    if (coordEventsByPosition != NULL)
+    {
+        for (i = FindFirstEventByPosition(coordEventsByPosition, coordEventCount, coordEvents, sizeof(*coordEvents), x, y); i < coordEventCount; i++)
+        {
+            const struct CoordEvent *coordEvent = &coordEvents[coordEventsByPosition[i]];
+
+            if ((u16)coordEvent->x != x || (u16)coordEvent->y != y)
+                break;
+            if (coordEvent->elevation == elevation || coordEvent->elevation == 0)
+            {
+                const u8 *script = TryRunCoordEventScript(coordEvent);
+                if (script != NULL)
+                    return script;
+            }
+        }
+        return NULL;
+    }
+
     for (i = 0; i < coordEventCount; i++)
     {
         if ((u16)coordEvents[i].x == x && (u16)coordEvents[i].y == y)
@@ -952,8 +1006,23 @@ static const struct BgEvent *GetBackgroundEventAtPosition(struct MapHeader *mapH
 {
     u8 i;
     const struct BgEvent *bgEvents = mapHeader->events->bgEvents;
+    const u8 *bgEventsByPosition = mapHeader->events->bgEventsByPosition;
     u8 bgEventCount = mapHeader->events->bgEventCount;
 
+    if (bgEventsByPosition != NULL)
+    {
+        for (i = FindFirstEventByPosition(bgEventsByPosition, bgEventCount, bgEvents, sizeof(*bgEvents), x, y); i < bgEventCount; i++)
+        {
+            const struct BgEvent *bgEvent = &bgEvents[bgEventsByPosition[i]];
+
+            if (bgEvent->x != x || bgEvent->y != y)
+                break;
+            if (bgEvent->elevation == elevation || bgEvent->elevation == 0)
+                return bgEvent;
+        }
+        return NULL;
+    }
+
     for (i = 0; i < bgEventCount; i++)
     {
         if ((u16)bgEvents[i].x == x && (u16)bgEvents[i].y == y)
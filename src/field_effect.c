@@ -962,6 +962,7 @@ void MultiplyInvertedPaletteRGBComponents(u16 i, u8 r, u8 g, u8 b)
     color |= (curBlue  << 10);
 
     gPlttBufferFaded[i] = color;
+    MarkPlttBufferDirty(i, sizeof(u16));
 }
 
 // r, g, b are between 0 and 16
@@ -983,6 +984,7 @@ void MultiplyPaletteRGBComponents(u16 i, u8 r, u8 g, u8 b)
     color |= (curBlue  << 10);
 
     gPlttBufferFaded[i] = color;
+    MarkPlttBufferDirty(i, sizeof(u16));
 }
 
 // Task data for Task_PokecenterHeal and Task_HallOfFameRecord
@@ -3240,39 +3242,34 @@ static void FlyOutFieldEffect_BirdSwoopDown(struct Task *task)
         task->tState++;
         PlaySE(SE_M_FLY);
         StartFlyBirdSwoopDown(task->tBirdSpriteId);
+        DelayTask(FindTaskIdByFunc(Task_FlyOut), 8);
     }
 }
 
 static void FlyOutFieldEffect_JumpOnBird(struct Task *task)
 {
-    if ((++task->tTimer) >= 8)
+    struct ObjectEvent *objectEvent = &gObjectEvents[gPlayerAvatar.objectEventId];
+    ObjectEventSetGraphicsId(objectEvent, GetPlayerAvatarGraphicsIdByStateId(PLAYER_AVATAR_STATE_SURFING));
+    StartSpriteAnim(&gSprites[objectEvent->spriteId], ANIM_GET_ON_OFF_POKEMON_WEST);
+    objectEvent->inanimate = TRUE;
+    ObjectEventSetHeldMovement(objectEvent, MOVEMENT_ACTION_JUMP_IN_PLACE_LEFT);
+    if (task->tAvatarFlags & PLAYER_AVATAR_FLAG_SURFING)
     {
-        struct ObjectEvent *objectEvent = &gObjectEvents[gPlayerAvatar.objectEventId];
-        ObjectEventSetGraphicsId(objectEvent, GetPlayerAvatarGraphicsIdByStateId(PLAYER_AVATAR_STATE_SURFING));
-        StartSpriteAnim(&gSprites[objectEvent->spriteId], ANIM_GET_ON_OFF_POKEMON_WEST);
-        objectEvent->inanimate = TRUE;
-        ObjectEventSetHeldMovement(objectEvent, MOVEMENT_ACTION_JUMP_IN_PLACE_LEFT);
-        if (task->tAvatarFlags & PLAYER_AVATAR_FLAG_SURFING)
-        {
-            DestroySprite(&gSprites[objectEvent->fieldEffectSpriteId]);
-        }
-        task->tState++;
-        task->tTimer = 0;
+        DestroySprite(&gSprites[objectEvent->fieldEffectSpriteId]);
     }
+    task->tState++;
+    DelayTask(FindTaskIdByFunc(Task_FlyOut), 10);
 }
 
 static void FlyOutFieldEffect_FlyOffWithBird(struct Task *task)
 {
-    if ((++task->tTimer) >= 10)
-    {
-        struct ObjectEvent *objectEvent = &gObjectEvents[gPlayerAvatar.objectEventId];
-        ObjectEventClearHeldMovementIfActive(objectEvent);
-        objectEvent->inanimate = FALSE;
-        objectEvent->hasShadow = FALSE;
-        SetFlyBirdPlayerSpriteId(task->tBirdSpriteId, objectEvent->spriteId);
-        CameraObjectReset2();
-        task->tState++;
-    }
+    struct ObjectEvent *objectEvent = &gObjectEvents[gPlayerAvatar.objectEventId];
+    ObjectEventClearHeldMovementIfActive(objectEvent);
+    objectEvent->inanimate = FALSE;
+    objectEvent->hasShadow = FALSE;
+    SetFlyBirdPlayerSpriteId(task->tBirdSpriteId, objectEvent->spriteId);
+    CameraObjectReset2();
+    task->tState++;
 }
 
 static void FlyOutFieldEffect_WaitFlyOff(struct Task *task)
@@ -3476,7 +3473,7 @@ static void FlyInFieldEffect_BirdSwoopDown(struct Task *task)
     if (!ObjectEventIsMovementOverridden(objectEvent) || ObjectEventClearHeldMovementIfFinished(objectEvent))
     {
         task->tState++;
-        task->tTimer = 17;
+        DelayTask(FindTaskIdByFunc(Task_FlyIn), 17);
         task->tAvatarFlags = gPlayerAvatar.flags;
         gPlayerAvatar.preventStep = TRUE;
         SetPlayerAvatarStateMask(PLAYER_AVATAR_FLAG_ON_FOOT);
@@ -3499,18 +3496,15 @@ static void FlyInFieldEffect_FlyInWithBird(struct Task *task)
 {
     struct ObjectEvent *objectEvent;
     struct Sprite *sprite;
-    if (task->tTimer == 0 || (--task->tTimer) == 0)
-    {
-        objectEvent = &gObjectEvents[gPlayerAvatar.objectEventId];
-        sprite = &gSprites[objectEvent->spriteId];
-        SetFlyBirdPlayerSpriteId(task->tBirdSpriteId, MAX_SPRITES);
-        sprite->x += sprite->x2;
-        sprite->y += sprite->y2;
-        sprite->x2 = 0;
-        sprite->y2 = 0;
-        task->tState++;
-        task->tTimer = 0;
-    }
+    objectEvent = &gObjectEvents[gPlayerAvatar.objectEventId];
+    sprite = &gSprites[objectEvent->spriteId];
+    SetFlyBirdPlayerSpriteId(task->tBirdSpriteId, MAX_SPRITES);
+    sprite->x += sprite->x2;
+    sprite->y += sprite->y2;
+    sprite->x2 = 0;
+    sprite->y2 = 0;
+    task->tState++;
+    task->tTimer = 0;
 }
 
 static void FlyInFieldEffect_JumpOffBird(struct Task *task)
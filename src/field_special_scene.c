@@ -265,6 +265,7 @@ void ExecuteTruckSequence(void)
     DrawWholeMapView();
     LockPlayerFieldControls();
     CpuFastFill(0, gPlttBufferFaded, 0x400);
+    MarkPlttBufferRowsDirty(PALETTES_ALL);
     CreateTask(Task_HandleTruckSequence, 0xA);
 }
 
@@ -33,6 +33,16 @@ struct RGBColor
     u16 b:5;
 };
 
+// Remapped palettes for one color map index, so that weather flashing back
+// and forth between the same maps (e.g. lightning) doesn't remap them again.
+struct ColorMapCacheEntry
+{
+    u32 lastUsed;
+    u32 validPalettes;
+    s8 colorMapIndex; // 0 if unused, since that index doesn't remap anything
+    u16 colors[32][16];
+};
+
 struct WeatherCallbacks
 {
     void (*initVars)(void);
@@ -44,8 +54,8 @@ struct WeatherCallbacks
 
 // This file's functions.
 static bool8 LightenSpritePaletteInFog(u8);
-static void BuildColorMaps(void);
 static void UpdateWeatherColorMap(void);
+static void ClearColorMapCache(void);
 static void ApplyColorMap(u8 startPalIndex, u8 numPalettes, s8 colorMapIndex);
 static void ApplyColorMapWithBlend(u8 startPalIndex, u8 numPalettes, s8 colorMapIndex, u8 blendCoeff, u16 blendColor);
 static void ApplySunnyColorMapWithBlend(s8 colorMapIndex, u8 blendCoeff, u16 blendColor);
@@ -68,6 +78,13 @@ EWRAM_DATA static u8 sFieldEffectPaletteColorMapTypes[32] = {0};
 
 static const u8 *sPaletteColorMapTypes;
 
+#if OW_WEATHER_COLOR_MAP_CACHE_SLOTS != 0
+static EWRAM_DATA struct ColorMapCacheEntry sColorMapCache[OW_WEATHER_COLOR_MAP_CACHE_SLOTS] = {0};
+// The unfaded palettes the cached results were computed from.
+static EWRAM_DATA u16 sColorMapCacheSources[32][16] = {0};
+static EWRAM_DATA u32 sColorMapCacheClock = 0;
+#endif
+
 // The sunny weather effect uses a precalculated color lookup table. Presumably this
 // is because the underlying color shift calculation is slow.
 static const u16 sSunnyWeatherColors[][0x1000] = {
@@ -148,6 +165,60 @@ static const u8 sBasePaletteColorMapTypes[32] =
     COLOR_MAP_DARK_CONTRAST,
 };
 
+// Color maps used for directly transforming palette colors in weather
+// effects. The maps are a spectrum of brightness + contrast mappings, and
+// transitioning between them creates effects like lightning.
+// The first three maps are simple brightness modifiers which are
+// progressively darker (only in the darkened table). For shadows (color
+// values < 12) the remaining maps brighten at a significantly lower rate than
+// for midtones and highlights, which hit exactly 31 at the last map. This
+// creates the high contrast effect used in the thunderstorm weather.
+static const u8 sDarkenedContrastColorMaps[NUM_WEATHER_COLOR_MAPS][32] =
+{
+    { 0,  0,  1,  2,  3,  4,  5,  6,  7,  8,  9, 10, 11, 12, 13, 14, 15, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29},
+    { 0,  0,  1,  2,  3,  4,  5,  6,  7,  7,  8,  9, 10, 11, 12, 13, 14, 14, 15, 16, 17, 18, 19, 20, 21, 21, 22, 23, 24, 25, 26, 27},
+    { 0,  0,  1,  2,  3,  4,  4,  5,  6,  7,  8,  8,  9, 10, 11, 12, 13, 13, 14, 15, 16, 17, 17, 18, 19, 20, 21, 21, 22, 23, 24, 25},
+    { 0,  1,  2,  3,  4,  4,  5,  6,  7,  8,  8,  9, 11, 11, 12, 13, 14, 14, 15, 16, 17, 17, 18, 19, 20, 20, 21, 22, 23, 24, 24, 25},
+    { 1,  2,  3,  3,  4,  5,  6,  6,  7,  8,  9,  9, 12, 13, 13, 14, 15, 15, 16, 17, 18, 18, 19, 20, 20, 21, 22, 23, 23, 24, 25, 25},
+    { 1,  2,  3,  4,  4,  5,  6,  7,  7,  8,  9, 10, 13, 14, 15, 15, 16, 17, 17, 18, 19, 19, 20, 20, 21, 22, 22, 23, 24, 24, 25, 26},
+    { 1,  2,  3,  4,  4,  5,  6,  7,  7,  8,  9, 10, 15, 15, 16, 16, 17, 18, 18, 19, 19, 20, 21, 21, 22, 22, 23, 24, 24, 25, 26, 26},
+    { 1,  2,  3,  4,  4,  5,  6,  7,  7,  8,  9, 10, 16, 16, 17, 18, 18, 19, 19, 20, 20, 21, 21, 22, 23, 23, 24, 24, 25, 25, 26, 27},
+    { 1,  2,  3,  4,  4,  5,  6,  7,  8,  8,  9, 10, 17, 18, 18, 19, 19, 20, 20, 21, 21, 22, 22, 23, 23, 24, 24, 25, 25, 26, 26, 27},
+    { 1,  2,  3,  4,  4,  5,  6,  7,  8,  8,  9, 10, 19, 19, 19, 20, 20, 21, 21, 22, 22, 23, 23, 24, 24, 24, 25, 25, 26, 26, 27, 27},
+    { 1,  2,  3,  4,  4,  5,  6,  7,  8,  8,  9, 10, 20, 20, 21, 21, 22, 22, 22, 23, 23, 24, 24, 24, 25, 25, 26, 26, 26, 27, 27, 28},
+    { 1,  2,  3,  4,  4,  5,  6,  7,  8,  8,  9, 10, 21, 22, 22, 22, 23, 23, 23, 24, 24, 24, 25, 25, 25, 26, 26, 27, 27, 27, 28, 28},
+    { 1,  2,  3,  4,  4,  5,  6,  7,  8,  8,  9, 10, 23, 23, 23, 23, 24, 24, 24, 25, 25, 25, 26, 26, 26, 26, 27, 27, 27, 28, 28, 28},
+    { 1,  2,  3,  4,  4,  5,  6,  7,  8,  8,  9, 10, 24, 24, 24, 25, 25, 25, 25, 26, 26, 26, 26, 27, 27, 27, 27, 28, 28, 28, 28, 29},
+    { 1,  2,  3,  4,  4,  5,  6,  7,  8,  8,  9, 10, 25, 25, 26, 26, 26, 26, 26, 27, 27, 27, 27, 27, 28, 28, 28, 28, 28, 29, 29, 29},
+    { 1,  2,  3,  4,  4,  5,  6,  7,  8,  8,  9, 10, 27, 27, 27, 27, 27, 27, 27, 28, 28, 28, 28, 28, 28, 28, 29, 29, 29, 29, 29, 29},
+    { 1,  2,  3,  4,  4,  5,  6,  7,  8,  8,  9, 10, 28, 28, 28, 28, 28, 28, 28, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 30, 30, 30},
+    { 1,  2,  3,  4,  4,  5,  6,  7,  8,  8,  9, 10, 29, 29, 29, 29, 29, 29, 29, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30},
+    { 1,  2,  3,  4,  4,  5,  6,  7,  8,  8,  9, 10, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31},
+};
+
+static const u8 sContrastColorMaps[NUM_WEATHER_COLOR_MAPS][32] =
+{
+    { 0,  1,  2,  3,  4,  5,  6,  7,  8,  9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31},
+    { 0,  1,  2,  3,  4,  5,  6,  7,  8,  9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31},
+    { 0,  1,  2,  3,  4,  5,  6,  7,  8,  9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31},
+    { 0,  1,  2,  3,  4,  5,  6,  7,  8,  9, 10, 11, 13, 14, 15, 16, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31},
+    { 1,  2,  3,  4,  5,  6,  7,  8,  9, 10, 10, 11, 14, 15, 16, 17, 17, 18, 19, 20, 21, 22, 23, 24, 24, 25, 26, 27, 28, 29, 30, 31},
+    { 1,  2,  3,  4,  5,  6,  7,  8,  9, 10, 11, 12, 15, 16, 17, 18, 18, 19, 20, 21, 22, 22, 23, 24, 25, 26, 26, 27, 28, 29, 30, 31},
+    { 1,  2,  3,  4,  5,  6,  7,  8,  9, 10, 11, 12, 16, 17, 18, 19, 19, 20, 21, 22, 22, 23, 24, 25, 25, 26, 27, 28, 28, 29, 30, 31},
+    { 1,  2,  3,  4,  5,  6,  7,  8,  9, 10, 11, 12, 17, 18, 19, 20, 20, 21, 22, 22, 23, 24, 24, 25, 26, 26, 27, 28, 28, 29, 30, 31},
+    { 1,  2,  3,  4,  5,  6,  7,  8,  9, 10, 11, 12, 19, 19, 20, 21, 21, 22, 22, 23, 24, 24, 25, 26, 26, 27, 27, 28, 29, 29, 30, 31},
+    { 1,  2,  3,  4,  5,  6,  7,  8,  9, 10, 11, 12, 20, 20, 21, 22, 22, 23, 23, 24, 24, 25, 25, 26, 27, 27, 28, 28, 29, 29, 30, 31},
+    { 1,  2,  3,  4,  5,  6,  7,  8,  9, 10, 11, 12, 21, 22, 22, 23, 23, 24, 24, 25, 25, 26, 26, 27, 27, 28, 28, 29, 29, 30, 30, 31},
+    { 1,  2,  3,  4,  5,  6,  7,  8,  9, 10, 11, 12, 22, 23, 23, 24, 24, 24, 25, 25, 26, 26, 27, 27, 27, 28, 28, 29, 29, 30, 30, 31},
+    { 1,  2,  3,  4,  5,  6,  7,  8,  9, 10, 11, 12, 23, 24, 24, 25, 25, 25, 26, 26, 26, 27, 27, 28, 28, 28, 29, 29, 29, 30, 30, 31},
+    { 1,  2,  3,  4,  5,  6,  7,  8,  9, 10, 11, 12, 25, 25, 25, 26, 26, 26, 26, 27, 27, 27, 28, 28, 28, 29, 29, 29, 30, 30, 30, 31},
+    { 1,  2,  3,  4,  5,  6,  7,  8,  9, 10, 11, 12, 26, 26, 26, 27, 27, 27, 27, 28, 28, 28, 28, 29, 29, 29, 29, 30, 30, 30, 30, 31},
+    { 1,  2,  3,  4,  5,  6,  7,  8,  9, 10, 11, 12, 27, 27, 27, 28, 28, 28, 28, 28, 28, 29, 29, 29, 29, 29, 30, 30, 30, 30, 30, 31},
+    { 1,  2,  3,  4,  5,  6,  7,  8,  9, 10, 11, 12, 28, 28, 28, 29, 29, 29, 29, 29, 29, 29, 29, 30, 30, 30, 30, 30, 30, 30, 30, 31},
+    { 1,  2,  3,  4,  5,  6,  7,  8,  9, 10, 11, 12, 29, 29, 29, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 31},
+    { 1,  2,  3,  4,  5,  6,  7,  8,  9, 10, 11, 12, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31},
+};
+
 const u16 gFogPalette[] = INCBIN_U16("graphics/weather/fog.gbapal");
 
 static u8 GetRandomAbnormalWeather(void);
@@ -157,8 +228,9 @@ void StartWeather(void)
     {
         u8 index = AllocSpritePalette(PALTAG_WEATHER);
         CpuCopy32(gFogPalette, &gPlttBufferUnfaded[0x100 + index * 16], 32);
-        BuildColorMaps();
+        sPaletteColorMapTypes = sBasePaletteColorMapTypes;
         gWeatherPtr->contrastColorMapSpritePalIndex = index;
+        ClearColorMapCache();
         gWeatherPtr->weatherPicSpritePalIndex = AllocSpritePalette(PALTAG_WEATHER_2);
         gWeatherPtr->rainSpriteCount = 0;
         gWeatherPtr->rainSpriteVisibleCounter = 0;
@@ -297,88 +369,6 @@ static u8 None_Finish(void)
     return 0;
 }
 
-// Builds two tables that contain color maps, used for directly transforming
-// palette colors in weather effects. The colors maps are a spectrum of
-// brightness + contrast mappings. By transitioning between the maps, weather
-// effects like lightning are created.
-// It's unclear why the two tables aren't declared as const arrays, since
-// this function always builds the same two tables.
-static void BuildColorMaps(void)
-{
-    u16 i;
-    u8 (*colorMaps)[32];
-    u16 colorVal;
-    u16 curBrightness;
-    u16 brightnessDelta;
-    u16 colorMapIndex;
-    u16 baseBrightness;
-    u32 remainingBrightness;
-    s16 diff;
-
-    sPaletteColorMapTypes = sBasePaletteColorMapTypes;
-    for (i = 0; i < 2; i++)
-    {
-        if (i == 0)
-            colorMaps = gWeatherPtr->darkenedContrastColorMaps;
-        else
-            colorMaps = gWeatherPtr->contrastColorMaps;
-
-        for (colorVal = 0; colorVal < 32; colorVal++)
-        {
-            curBrightness = colorVal << 8;
-            if (i == 0)
-                brightnessDelta = (colorVal << 8) / 16;
-            else
-                brightnessDelta = 0;
-
-            // First three color mappings are simple brightness modifiers which are
-            // progressively darker, according to brightnessDelta.
-            for (colorMapIndex = 0; colorMapIndex < 3; colorMapIndex++)
-            {
-                curBrightness -= brightnessDelta;
-                colorMaps[colorMapIndex][colorVal] = curBrightness >> 8;
-            }
-
-            baseBrightness = curBrightness;
-            remainingBrightness = 0x1f00 - curBrightness;
-            if ((0x1f00 - curBrightness) < 0)
-                remainingBrightness += 0xf;
-
-            brightnessDelta = remainingBrightness / (NUM_WEATHER_COLOR_MAPS - 3);
-            if (colorVal < 12)
-            {
-                // For shadows (color values < 12), the remaining color mappings are
-                // brightness modifiers, which are increased at a significantly lower rate
-                // than the midtones and highlights (color values >= 12). This creates a
-                // high contrast effect, used in the thunderstorm weather.
-                for (; colorMapIndex < NUM_WEATHER_COLOR_MAPS; colorMapIndex++)
-                {
-                    curBrightness += brightnessDelta;
-                    diff = curBrightness - baseBrightness;
-                    if (diff > 0)
-                        curBrightness -= diff / 2;
-                    colorMaps[colorMapIndex][colorVal] = curBrightness >> 8;
-                    if (colorMaps[colorMapIndex][colorVal] > 31)
-                        colorMaps[colorMapIndex][colorVal] = 31;
-                }
-            }
-            else
-            {
-                // For midtones and highlights (color values >= 12), the remaining
-                // color mappings are simple brightness modifiers which are
-                // progressively brighter, hitting exactly 31 at the last mapping.
-                for (; colorMapIndex < NUM_WEATHER_COLOR_MAPS; colorMapIndex++)
-                {
-                    curBrightness += brightnessDelta;
-                    colorMaps[colorMapIndex][colorVal] = curBrightness >> 8;
-                    if (colorMaps[colorMapIndex][colorVal] > 31)
-                        colorMaps[colorMapIndex][colorVal] = 31;
-                }
-            }
-        }
-    }
-}
-
 // When the weather is changing, it gradually updates the palettes
 // towards the desired color map.
 static void UpdateWeatherColorMap(void)
@@ -508,15 +498,93 @@ static bool8 FadeInScreen_FogHorizontal(void)
 static void DoNothing(void)
 { }
 
+static void ClearColorMapCache(void)
+{
+#if OW_WEATHER_COLOR_MAP_CACHE_SLOTS != 0
+    memset(sColorMapCache, 0, sizeof(sColorMapCache));
+    sColorMapCacheClock = 0;
+#endif
+}
+
+// Returns the cache entry for colorMapIndex, evicting the least recently
+// used entry if there is none.
+static struct ColorMapCacheEntry *GetColorMapCacheEntry(s8 colorMapIndex)
+{
+#if OW_WEATHER_COLOR_MAP_CACHE_SLOTS != 0
+    u32 i;
+    struct ColorMapCacheEntry *entry = &sColorMapCache[0];
+
+    for (i = 0; i < OW_WEATHER_COLOR_MAP_CACHE_SLOTS; i++)
+    {
+        if (sColorMapCache[i].colorMapIndex == colorMapIndex)
+        {
+            entry = &sColorMapCache[i];
+            break;
+        }
+        if (sColorMapCache[i].lastUsed < entry->lastUsed)
+            entry = &sColorMapCache[i];
+    }
+    if (entry->colorMapIndex != colorMapIndex)
+    {
+        entry->colorMapIndex = colorMapIndex;
+        entry->validPalettes = 0;
+    }
+    entry->lastUsed = ++sColorMapCacheClock;
+    return entry;
+#else
+    return NULL;
+#endif
+}
+
+// Copies the cached result for the palette into gPlttBufferFaded, if the
+// palette hasn't changed since it was cached.
+static bool32 TryApplyCachedColorMap(struct ColorMapCacheEntry *entry, u16 palIndex)
+{
+#if OW_WEATHER_COLOR_MAP_CACHE_SLOTS != 0
+    u32 i;
+    const u32 *src = (const u32 *)&gPlttBufferUnfaded[PLTT_ID(palIndex)];
+    u32 *cachedSrc = (u32 *)sColorMapCacheSources[palIndex];
+
+    for (i = 0; i < PLTT_SIZE_4BPP / sizeof(u32); i++)
+    {
+        if (src[i] != cachedSrc[i])
+        {
+            // The palette was reloaded, so every result cached for it is stale.
+            CpuFastCopy(src, cachedSrc, PLTT_SIZE_4BPP);
+            for (i = 0; i < OW_WEATHER_COLOR_MAP_CACHE_SLOTS; i++)
+                sColorMapCache[i].validPalettes &= ~(1u << palIndex);
+            return FALSE;
+        }
+    }
+    if (!(entry->validPalettes & (1u << palIndex)))
+        return FALSE;
+    CpuFastCopy(entry->colors[palIndex], &gPlttBufferFaded[PLTT_ID(palIndex)], PLTT_SIZE_4BPP);
+    return TRUE;
+#else
+    return FALSE;
+#endif
+}
+
+static void CacheColorMapResult(struct ColorMapCacheEntry *entry, u16 palIndex)
+{
+#if OW_WEATHER_COLOR_MAP_CACHE_SLOTS != 0
+    CpuFastCopy(&gPlttBufferFaded[PLTT_ID(palIndex)], entry->colors[palIndex], PLTT_SIZE_4BPP);
+    entry->validPalettes |= 1u << palIndex;
+#endif
+}
+
 static void ApplyColorMap(u8 startPalIndex, u8 numPalettes, s8 colorMapIndex)
 {
     u16 curPalIndex;
     u16 palOffset;
-    u8 *colorMap;
+    const u8 *colorMap;
     u16 i;
+    struct ColorMapCacheEntry *cacheEntry;
 
+    MarkPlttBufferDirty(PLTT_ID(startPalIndex), numPalettes * PLTT_SIZE_4BPP);
     if (colorMapIndex > 0)
     {
+        cacheEntry = GetColorMapCacheEntry(colorMapIndex);
         colorMapIndex--;
         palOffset = startPalIndex * 16;
         numPalettes += startPalIndex;
@@ -531,14 +599,18 @@ static void ApplyColorMap(u8 startPalIndex, u8 numPalettes, s8 colorMapIndex)
                 CpuFastCopy(gPlttBufferUnfaded + palOffset, gPlttBufferFaded + palOffset, 16 * sizeof(u16));
                 palOffset += 16;
             }
+            else if (TryApplyCachedColorMap(cacheEntry, curPalIndex))
+            {
+                palOffset += 16;
+            }
             else
             {
                 u8 r, g, b;
 
                 if (sPaletteColorMapTypes[curPalIndex] == COLOR_MAP_CONTRAST || curPalIndex - 16 == gWeatherPtr->contrastColorMapSpritePalIndex)
-                    colorMap = gWeatherPtr->contrastColorMaps[colorMapIndex];
+                    colorMap = sContrastColorMaps[colorMapIndex];
                 else
-                    colorMap = gWeatherPtr->darkenedContrastColorMaps[colorMapIndex];
+                    colorMap = sDarkenedContrastColorMaps[colorMapIndex];
 
                 for (i = 0; i < 16; i++)
                 {
@@ -549,6 +621,7 @@ static void ApplyColorMap(u8 startPalIndex, u8 numPalettes, s8 colorMapIndex)
                     b = colorMap[baseColor.b];
                     gPlttBufferFaded[palOffset++] = RGB2(r, g, b);
                 }
+                CacheColorMapResult(cacheEntry, curPalIndex);
             }
 
             curPalIndex++;
@@ -557,6 +630,7 @@ static void ApplyColorMap(u8 startPalIndex, u8 numPalettes, s8 colorMapIndex)
     else if (colorMapIndex < 0)
     {
         // A negative gammIndex value means that the blending will come from the special sunny weather's palette tables.
+        cacheEntry = GetColorMapCacheEntry(colorMapIndex);
         colorMapIndex = -colorMapIndex - 1;
         palOffset = startPalIndex * 16;
         numPalettes += startPalIndex;
@@ -570,6 +644,10 @@ static void ApplyColorMap(u8 startPalIndex, u8 numPalettes, s8 colorMapIndex)
                 CpuFastCopy(gPlttBufferUnfaded + palOffset, gPlttBufferFaded + palOffset, 16 * sizeof(u16));
                 palOffset += 16;
             }
+            else if (TryApplyCachedColorMap(cacheEntry, curPalIndex))
+            {
+                palOffset += 16;
+            }
             else
             {
                 for (i = 0; i < 16; i++)
@@ -577,6 +655,7 @@ static void ApplyColorMap(u8 startPalIndex, u8 numPalettes, s8 colorMapIndex)
                     gPlttBufferFaded[palOffset] = sSunnyWeatherColors[colorMapIndex][SUNNY_COLOR_INDEX(gPlttBufferUnfaded[palOffset])];
                     palOffset++;
                 }
+                CacheColorMapResult(cacheEntry, curPalIndex);
             }
 
             curPalIndex++;
@@ -589,6 +668,8 @@ static void ApplyColorMap(u8 startPalIndex, u8 numPalettes, s8 colorMapIndex)
     }
 }
 
+
+
 static void ApplyColorMapWithBlend(u8 startPalIndex, u8 numPalettes, s8 colorMapIndex, u8 blendCoeff, u16 blendColor)
 {
     u16 palOffset;
@@ -599,6 +680,7 @@ static void ApplyColorMapWithBlend(u8 startPalIndex, u8 numPalettes, s8 colorMap
     u8 gBlend = color.g;
     u8 bBlend = color.b;
 
+    MarkPlttBufferDirty(PLTT_ID(startPalIndex), numPalettes * PLTT_SIZE_4BPP);
     palOffset = BG_PLTT_ID(startPalIndex);
     numPalettes += startPalIndex;
     colorMapIndex--;
@@ -614,12 +696,12 @@ static void ApplyColorMapWithBlend(u8 startPalIndex, u8 numPalettes, s8 colorMap
         }
         else
         {
-            u8 *colorMap;
+            const u8 *colorMap;
 
             if (sPaletteColorMapTypes[curPalIndex] == COLOR_MAP_DARK_CONTRAST)
-                colorMap = gWeatherPtr->darkenedContrastColorMaps[colorMapIndex];
+                colorMap = sDarkenedContrastColorMaps[colorMapIndex];
             else
-                colorMap = gWeatherPtr->contrastColorMaps[colorMapIndex];
+                colorMap = sContrastColorMaps[colorMapIndex];
 
             for (i = 0; i < 16; i++)
             {
@@ -656,6 +738,7 @@ static void ApplySunnyColorMapWithBlend(s8 colorMapIndex, u8 blendCoeff, u16 ble
     gBlend = color.g;
     bBlend = color.b;
     palOffset = 0;
+    MarkPlttBufferRowsDirty(PALETTES_ALL);
     for (curPalIndex = 0; curPalIndex < 32; curPalIndex++)
     {
         if (sPaletteColorMapTypes[curPalIndex] == COLOR_MAP_NONE)
@@ -709,6 +792,7 @@ static void ApplyFogBlend(u8 blendCoeff, u16 blendColor)
     gBlend = color.g;
     bBlend = color.b;
 
+    MarkPlttBufferRowsDirty(PALETTES_OBJECTS);
     for (curPalIndex = 16; curPalIndex < 32; curPalIndex++)
     {
         if (LightenSpritePaletteInFog(curPalIndex))
@@ -877,6 +961,7 @@ void UpdateSpritePaletteWithWeather(u8 spritePaletteIndex)
             paletteIndex *= 16;
             for (i = 0; i < 16; i++)
                 gPlttBufferFaded[paletteIndex + i] = gWeatherPtr->fadeDestColor;
+            MarkPlttBufferDirty(paletteIndex, PLTT_SIZE_4BPP);
         }
         break;
     case WEATHER_PAL_STATE_SCREEN_FADING_OUT:
@@ -1,9 +1,11 @@
 #include "global.h"
 #include "battle_pyramid.h"
 #include "bg.h"
+#include "decompress.h"
 #include "fieldmap.h"
 #include "fldeff.h"
 #include "fldeff_misc.h"
+#include "malloc.h"
 #include "frontier_util.h"
 #include "menu.h"
 #include "mirage_tower.h"
@@ -31,6 +33,27 @@ EWRAM_DATA struct Camera gCamera = {0};
 EWRAM_DATA static struct ConnectionFlags sMapConnectionFlags = {0};
 EWRAM_DATA static u32 sFiller = 0; // without this, the next file won't align properly
 
+// Tilesets are streamed to VRAM during map loads in chunks of this many bytes per step,
+// so a warp doesn't stall on decompressing and copying both tilesets at once.
+#define TILESET_STREAM_CHUNK_SIZE 0x1000
+
+struct TilesetStream
+{
+    bool8 active;
+    u8 lzFlags;
+    u8 lzFlagsLeft;
+    u16 offset;
+    const u8 *src;
+    const u32 *tilesToCache;
+    u8 *buffer;
+    u32 size;
+    u32 decompressedSize;
+    u32 decompressed;
+    u32 uploaded;
+};
+
+EWRAM_DATA static struct TilesetStream sTilesetStream = {0};
+
 struct BackupMapLayout gBackupMapLayout;
 
 static const struct ConnectionFlags sDummyConnectionFlags = {0};
@@ -860,6 +883,125 @@ static void CopyTilesetToVramUsingHeap(struct Tileset const *tileset, u16 numTil
     }
 }
 
+// Decompresses up to TILESET_STREAM_CHUNK_SIZE more bytes of an LZ77 compressed tileset.
+// The LZ77 state is kept in the stream, so decompression can stop and resume at any block.
+static void DecompressTilesetChunk(struct TilesetStream *stream)
+{
+    u8 *dest = stream->buffer;
+    u32 pos = stream->decompressed;
+    u32 end = min(pos + TILESET_STREAM_CHUNK_SIZE, stream->decompressedSize);
+
+    while (pos < end)
+    {
+        if (stream->lzFlagsLeft == 0)
+        {
+            stream->lzFlags = *stream->src++;
+            stream->lzFlagsLeft = 8;
+        }
+        if (stream->lzFlags & 0x80)
+        {
+            u32 length = (stream->src[0] >> 4) + 3;
+            u32 disp = (((stream->src[0] & 0xF) << 8) | stream->src[1]) + 1;
+
+            stream->src += 2;
+            if (length > stream->decompressedSize - pos)
+                length = stream->decompressedSize - pos;
+            for (; length != 0; length--, pos++)
+                dest[pos] = dest[pos - disp];
+        }
+        else
+        {
+            dest[pos++] = *stream->src++;
+        }
+        stream->lzFlags <<= 1;
+        stream->lzFlagsLeft--;
+    }
+    stream->decompressed = pos;
+}
+
+// Does one step of copying a tileset to VRAM. Compressed tilesets are decompressed to the heap
+// a chunk at a time, and every finished chunk is queued for the DMA3 manager to upload.
+// Returns TRUE once the whole tileset has been copied.
+static bool32 StreamTilesetToVram(struct Tileset const *tileset, u16 numTiles, u16 offset)
+{
+    struct TilesetStream *stream = &sTilesetStream;
+    u32 size;
+
+    if (tileset == NULL)
+        return TRUE;
+
+    if (!stream->active)
+    {
+        stream->active = TRUE;
+        stream->offset = offset;
+        stream->size = numTiles * TILE_SIZE_4BPP;
+        stream->uploaded = 0;
+        stream->buffer = NULL;
+        stream->tilesToCache = NULL;
+        if (!tileset->isCompressed)
+        {
+            stream->src = (const u8 *)tileset->tiles;
+            stream->decompressed = stream->decompressedSize = stream->size;
+        }
+        else
+        {
+            stream->src = (const u8 *)tileset->tiles + 4;
+            stream->decompressedSize = GetDecompressedDataSize(tileset->tiles);
+            stream->decompressed = 0;
+            stream->lzFlagsLeft = 0;
+            stream->buffer = Alloc(stream->decompressedSize);
+            if (stream->buffer == NULL)
+            {
+                // Fall back to loading it all at once.
+                stream->active = FALSE;
+                CopyTilesetToVramUsingHeap(tileset, numTiles, offset);
+                return TRUE;
+            }
+            if (stream->size > stream->decompressedSize)
+                stream->size = stream->decompressedSize;
+            if (TryCopyCachedDecompressedData(tileset->tiles, stream->buffer))
+                stream->decompressed = stream->decompressedSize;
+            else
+                stream->tilesToCache = tileset->tiles;
+        }
+    }
+
+    if (stream->uploaded < stream->size)
+    {
+        const u8 *tiles = stream->src;
+        u32 ready = stream->size;
+
+        if (stream->buffer != NULL)
+        {
+            DecompressTilesetChunk(stream);
+            tiles = stream->buffer;
+            // Only upload whole tiles until the end of the data is reached.
+            if (stream->decompressed < stream->decompressedSize)
+                ready = min(ready, stream->decompressed & ~(TILE_SIZE_4BPP - 1));
+        }
+
+        size = min(ready - stream->uploaded, TILESET_STREAM_CHUNK_SIZE);
+        if (size != 0)
+        {
+            LoadBgTiles(2, tiles + stream->uploaded, size, stream->offset + stream->uploaded / TILE_SIZE_4BPP);
+            stream->uploaded += size;
+        }
+        return FALSE;
+    }
+
+    // The buffer can only be freed once the DMA3 manager is done reading it.
+    if (stream->buffer != NULL)
+    {
+        if (IsDma3ManagerBusyWithBgCopy())
+            return FALSE;
+        if (stream->tilesToCache != NULL)
+            AddDecompressedDataToCache(stream->tilesToCache, stream->buffer);
+        FREE_AND_SET_NULL(stream->buffer);
+    }
+    stream->active = FALSE;
+    return TRUE;
+}
+
 // Below two are dummied functions from FRLG, used to tint the overworld palettes for the Quest Log
 static void ApplyGlobalTintToPaletteEntries(u16 offset, u16 size)
 {
@@ -906,6 +1048,23 @@ void CopySecondaryTilesetToVram(struct MapLayout const *mapLayout)
     CopyTilesetToVram(mapLayout->secondaryTileset, NUM_TILES_TOTAL - NUM_TILES_IN_PRIMARY, NUM_TILES_IN_PRIMARY);
 }
 
+bool32 StreamPrimaryTilesetToVram(struct MapLayout const *mapLayout)
+{
+    return StreamTilesetToVram(mapLayout->primaryTileset, NUM_TILES_IN_PRIMARY, 0);
+}
+
+bool32 StreamSecondaryTilesetToVram(struct MapLayout const *mapLayout)
+{
+    return StreamTilesetToVram(mapLayout->secondaryTileset, NUM_TILES_TOTAL - NUM_TILES_IN_PRIMARY, NUM_TILES_IN_PRIMARY);
+}
+
+// Returns TRUE while a tileset stream still has chunks to queue, as opposed to
+// waiting for the DMA3 manager to finish the ones it queued.
+bool32 IsTilesetStreamUploading(void)
+{
+    return sTilesetStream.active && sTilesetStream.uploaded < sTilesetStream.size;
+}
+
 void CopySecondaryTilesetToVramUsingHeap(struct MapLayout const *mapLayout)
 {
     CopyTilesetToVramUsingHeap(mapLayout->secondaryTileset, NUM_TILES_TOTAL - NUM_TILES_IN_PRIMARY, NUM_TILES_IN_PRIMARY);
@@ -425,6 +425,7 @@ static void Task_ComputerScreenCloseEffect(u8 taskId)
     {
     case 0:
         gPlttBufferFaded[0] = 0;
+        MarkPlttBufferDirty(0, sizeof(u16));
         break;
     case 1:
         task->tWinLeft = 0;
@@ -0,0 +1,145 @@
+#include "global.h"
+#include "frame_profiler.h"
+#include "test_runner.h"
+
+#if DEBUG_FRAME_PROFILER
+
+// Timer 1 is otherwise only used by the naming screen to seed the trainer ID,
+// so the profiler starts it whenever it finds it stopped. While it runs with
+// someone else's settings the profiler skips those frames instead.
+// One tick is 64 cycles, which makes a whole frame about 4389 ticks.
+#define PROFILER_TIMER_CONTROL (TIMER_ENABLE | TIMER_64CLK)
+#define PROFILER_CYCLES_PER_TICK 64
+
+static const char *const sProfilerPhaseNames[PROFILE_PHASE_COUNT] =
+{
+    [PROFILE_PHASE_FRAME]           = "frame",
+    [PROFILE_PHASE_MAIN_CALLBACKS]  = "callbacks",
+    [PROFILE_PHASE_TASKS]           = "tasks",
+    [PROFILE_PHASE_ANIMATE_SPRITES] = "sprites",
+    [PROFILE_PHASE_BUILD_OAM]       = "oam",
+    [PROFILE_PHASE_VBLANK_INTR]     = "vblank",
+    [PROFILE_PHASE_DMA3]            = "dma3",
+    [PROFILE_PHASE_PLTT_TRANSFER]   = "pltt",
+    [PROFILE_PHASE_SOUND]           = "sound",
+};
+
+static u16 sPhaseStart[PROFILE_PHASE_COUNT];
+static u32 sPhaseTicks[PROFILE_PHASE_COUNT];
+static u32 sPhaseMinCycles[PROFILE_PHASE_COUNT];
+static u32 sPhaseMaxCycles[PROFILE_PHASE_COUNT];
+static u32 sPhaseTotalCycles[PROFILE_PHASE_COUNT];
+static u32 sProfiledFrames;
+static bool8 sProfilerRunning;
+
+#ifndef NDEBUG
+static void ReportFrameProfiler(void);
+#endif
+
+void BeginProfilerPhase(enum FrameProfilerPhase phase)
+{
+    sPhaseStart[phase] = REG_TM1CNT_L;
+}
+
+void EndProfilerPhase(enum FrameProfilerPhase phase)
+{
+    sPhaseTicks[phase] += (u16)(REG_TM1CNT_L - sPhaseStart[phase]);
+}
+
+// Called once per frame, right after the main loop's WaitForVBlank.
+void EndProfilerFrame(void)
+{
+    u32 i;
+
+    if (REG_TM1CNT_H != PROFILER_TIMER_CONTROL)
+    {
+        sProfilerRunning = FALSE;
+        if (REG_TM1CNT_H & TIMER_ENABLE)
+        {
+            for (i = 0; i < PROFILE_PHASE_COUNT; i++)
+                sPhaseTicks[i] = 0;
+            return;
+        }
+        REG_TM1CNT_L = 0;
+        REG_TM1CNT_H = PROFILER_TIMER_CONTROL;
+    }
+
+    EndProfilerPhase(PROFILE_PHASE_FRAME);
+    BeginProfilerPhase(PROFILE_PHASE_FRAME);
+
+    // The first frame after (re)starting the timer has meaningless timestamps.
+    if (!sProfilerRunning)
+    {
+        for (i = 0; i < PROFILE_PHASE_COUNT; i++)
+            sPhaseTicks[i] = 0;
+        sProfilerRunning = TRUE;
+        return;
+    }
+
+    for (i = 0; i < PROFILE_PHASE_COUNT; i++)
+    {
+        u32 cycles = sPhaseTicks[i] * PROFILER_CYCLES_PER_TICK;
+
+        if (sProfiledFrames == 0 || cycles < sPhaseMinCycles[i])
+            sPhaseMinCycles[i] = cycles;
+        if (cycles > sPhaseMaxCycles[i])
+            sPhaseMaxCycles[i] = cycles;
+        sPhaseTotalCycles[i] += cycles;
+        sPhaseTicks[i] = 0;
+    }
+    sProfiledFrames++;
+
+    if (!gTestRunnerEnabled && sProfiledFrames >= DEBUG_FRAME_PROFILER_FRAMES)
+    {
+    #ifndef NDEBUG
+        ReportFrameProfiler();
+    #endif
+        ResetFrameProfiler();
+    }
+}
+
+void ResetFrameProfiler(void)
+{
+    u32 i;
+
+    for (i = 0; i < PROFILE_PHASE_COUNT; i++)
+    {
+        sPhaseMinCycles[i] = 0;
+        sPhaseMaxCycles[i] = 0;
+        sPhaseTotalCycles[i] = 0;
+    }
+    sProfiledFrames = 0;
+}
+
+void GetFrameProfilerStats(enum FrameProfilerPhase phase, struct FrameProfilerStats *stats)
+{
+    stats->frames = sProfiledFrames;
+    stats->minCycles = sPhaseMinCycles[phase];
+    stats->maxCycles = sPhaseMaxCycles[phase];
+    if (sProfiledFrames != 0)
+        stats->avgCycles = sPhaseTotalCycles[phase] / sProfiledFrames;
+    else
+        stats->avgCycles = 0;
+}
+
+const char *GetFrameProfilerPhaseName(enum FrameProfilerPhase phase)
+{
+    return sProfilerPhaseNames[phase];
+}
+
+#ifndef NDEBUG
+static void ReportFrameProfiler(void)
+{
+    u32 i;
+    struct FrameProfilerStats stats;
+
+    DebugPrintf("frame profile over %d frames (cycles min/avg/max):", sProfiledFrames);
+    for (i = 0; i < PROFILE_PHASE_COUNT; i++)
+    {
+        GetFrameProfilerStats(i, &stats);
+        DebugPrintf("  %s: %d/%d/%d", sProfilerPhaseNames[i], stats.minCycles, stats.avgCycles, stats.maxCycles);
+    }
+}
+#endif
+
+#endif // DEBUG_FRAME_PROFILER
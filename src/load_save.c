@@ -12,6 +12,7 @@
 #include "trainer_hill.h"
 #include "gba/flash_internal.h"
 #include "decoration_inventory.h"
+#include "event_object_movement.h"
 #include "agb_flash.h"
 
 static void ApplyNewEncryptionKeyToAllEncryptedData(u32 encryptionKey);
@@ -191,6 +192,7 @@ void LoadObjectEvents(void)
 
     for (i = 0; i < OBJECT_EVENTS_COUNT; i++)
         gObjectEvents[i] = gSaveBlock1Ptr->objectEvents[i];
+    RebuildObjectEventSpatialIndex();
 }
 
 void CopyPartyAndObjectsToSave(void)
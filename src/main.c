@@ -9,9 +9,11 @@
 #include "rtc.h"
 #include "scanline_effect.h"
 #include "overworld.h"
+#include "palette.h"
 #include "play_time.h"
 #include "random.h"
 #include "dma3.h"
+#include "frame_profiler.h"
 #include "gba/flash_internal.h"
 #include "load_save.h"
 #include "gpu_regs.h"
@@ -22,6 +24,7 @@
 #include "text.h"
 #include "intro.h"
 #include "main.h"
+#include "test_runner.h"
 #include "trainer_hill.h"
 #include "constants/rgb.h"
 
@@ -149,6 +152,7 @@ void AgbMainLoop(void)
             DoSoftReset();
         }
 
+        PROFILE_BEGIN(PROFILE_PHASE_MAIN_CALLBACKS);
         if (Overworld_SendKeysToLinkIsRunning() == TRUE)
         {
             gLinkTransferringData = TRUE;
@@ -169,10 +173,12 @@ void AgbMainLoop(void)
                 gLinkTransferringData = FALSE;
             }
         }
+        PROFILE_END(PROFILE_PHASE_MAIN_CALLBACKS);
 
         PlayTimeCounter_Update();
         MapMusicMain();
         WaitForVBlank();
+        PROFILE_END_FRAME();
     }
 }
 
@@ -258,6 +264,10 @@ void InitKeys(void)
 static void ReadKeys(void)
 {
     u16 keyInput = REG_KEYINPUT ^ KEYS_MASK;
+
+    if (gTestRunnerEnabled)
+        keyInput = TestRunner_Benchmark_KeyInput(keyInput);
+
     gMain.newKeysRaw = keyInput & ~gMain.heldKeysRaw;
     gMain.newKeys = gMain.newKeysRaw;
     gMain.newAndRepeatedKeys = gMain.newKeysRaw;
@@ -322,6 +332,7 @@ void InitIntrHandlers(void)
 void SetVBlankCallback(IntrCallback callback)
 {
     gMain.vblankCallback = callback;
+    SetPlttBufferDirtyRowTracking(FALSE);
 }
 
 void SetHBlankCallback(IntrCallback callback)
@@ -347,6 +358,8 @@ void SetSerialCallback(IntrCallback callback)
 
 static void VBlankIntr(void)
 {
+    PROFILE_BEGIN(PROFILE_PHASE_VBLANK_INTR);
+
     if (gWirelessCommType != 0)
         RfuVSync();
     else if (gLinkVSyncDisabled == FALSE)
@@ -363,11 +376,15 @@ static void VBlankIntr(void)
     gMain.vblankCounter2++;
 
     CopyBufferedValuesToGpuRegs();
+    PROFILE_BEGIN(PROFILE_PHASE_DMA3);
     ProcessDma3Requests();
+    PROFILE_END(PROFILE_PHASE_DMA3);
 
     gPcmDmaCounter = gSoundInfo.pcmDmaCounter;
 
+    PROFILE_BEGIN(PROFILE_PHASE_SOUND);
     m4aSoundMain();
+    PROFILE_END(PROFILE_PHASE_SOUND);
     TryReceiveLinkBattleData();
 
     if (!gMain.inBattle || !(gBattleTypeFlags & (BATTLE_TYPE_LINK | BATTLE_TYPE_FRONTIER | BATTLE_TYPE_RECORDED)))
@@ -377,6 +394,8 @@ static void VBlankIntr(void)
 
     INTR_CHECK |= INTR_FLAG_VBLANK;
     gMain.intrCheck |= INTR_FLAG_VBLANK;
+
+    PROFILE_END(PROFILE_PHASE_VBLANK_INTR);
 }
 
 void InitFlashTimer(void)
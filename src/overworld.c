@@ -1499,6 +1499,7 @@ static void OverworldBasic(void)
     BuildOamBuffer();
     UpdatePaletteFade();
     UpdateTilesetAnimations();
+    CopyDirtyFieldTilemapRowsToVram();
     DoScheduledBgTilemapCopiesToVram();
 }
 
@@ -1606,12 +1607,42 @@ void CB2_LoadMap(void)
     gMain.savedCallback = CB2_LoadMap2;
 }
 
+// Scanlines of a frame that CB2_LoadMap2 may spend on load steps, out of the
+// SCANLINES_PER_FRAME a frame takes. The rest is left for the interrupts.
+#define SCANLINES_PER_FRAME 228
+#define MAP_LOAD_SCANLINE_BUDGET 200
+
+static bool32 IsMapLoadFrameBudgetUsed(u32 startVBlank, u32 startScanline)
+{
+    u32 scanline = REG_VCOUNT & 0xFF;
+
+    if (gMain.vblankCounter1 != startVBlank)
+        return TRUE;
+    return (scanline + SCANLINES_PER_FRAME - startScanline) % SCANLINES_PER_FRAME >= MAP_LOAD_SCANLINE_BUDGET;
+}
+
+// Runs as many map load steps as fit in the frame. Only steps that wait for
+// something done once per frame, like the DMA3 manager uploading tileset chunks
+// in VBlank, carry the load over to the next frame.
 static void CB2_LoadMap2(void)
 {
-    DoMapLoadLoop(&gMain.state);
-    SetFieldVBlankCallback();
-    SetMainCallback1(CB1_Overworld);
-    SetMainCallback2(CB2_Overworld);
+    u32 startVBlank = gMain.vblankCounter1;
+    u32 startScanline = REG_VCOUNT & 0xFF;
+    u8 prevState;
+
+    do
+    {
+        prevState = gMain.state;
+        if (LoadMapInStepsLocal(&gMain.state, FALSE))
+        {
+            SetFieldVBlankCallback();
+            SetMainCallback1(CB1_Overworld);
+            SetMainCallback2(CB2_Overworld);
+            return;
+        }
+        if (gMain.state == prevState && !IsTilesetStreamUploading())
+            break;
+    } while (!IsMapLoadFrameBudgetUsed(startVBlank, startScanline));
 }
 
 void CB2_ReturnToFieldContestHall(void)
@@ -1803,9 +1834,12 @@ static void FieldClearVBlankHBlankCallbacks(void)
     SetHBlankCallback(NULL);
 }
 
+// Every field palette writer marks the rows it changes, so VBlankCB_Field
+// only has to upload those.
 static void SetFieldVBlankCallback(void)
 {
     SetVBlankCallback(VBlankCB_Field);
+    SetPlttBufferDirtyRowTracking(TRUE);
 }
 
 static void VBlankCB_Field(void)
@@ -1947,12 +1981,12 @@ static bool32 LoadMapInStepsLocal(u8 *state, bool32 a2)
         (*state)++;
         break;
     case 6:
-        CopyPrimaryTilesetToVram(gMapHeader.mapLayout);
-        (*state)++;
+        if (StreamPrimaryTilesetToVram(gMapHeader.mapLayout))
+            (*state)++;
         break;
     case 7:
-        CopySecondaryTilesetToVram(gMapHeader.mapLayout);
-        (*state)++;
+        if (StreamSecondaryTilesetToVram(gMapHeader.mapLayout))
+            (*state)++;
         break;
     case 8:
         if (FreeTempTileDataBuffersIfPossible() != TRUE)
@@ -2989,6 +3023,7 @@ static void InitLinkPlayerObjectEventPos(struct ObjectEvent *objEvent, s16 x, s1
     objEvent->currentCoords.y = y;
     objEvent->previousCoords.x = x;
     objEvent->previousCoords.y = y;
+    UpdateObjectEventSpatialIndex(objEvent);
     SetSpritePosToMapCoords(x, y, &objEvent->initialCoords.x, &objEvent->initialCoords.y);
     objEvent->initialCoords.x += 8;
     ObjectEventUpdateElevation(objEvent);
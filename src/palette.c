@@ -2,6 +2,7 @@
 #include "palette.h"
 #include "util.h"
 #include "decompress.h"
+#include "frame_profiler.h"
 #include "gpu_regs.h"
 #include "task.h"
 #include "constants/rgb.h"
@@ -18,6 +19,9 @@ enum
 
 #define NUM_PALETTE_STRUCTS 16
 
+// gPlttBufferFaded is uploaded one 16-color row (palette) at a time.
+#define PLTT_ROW_COUNT (PLTT_BUFFER_SIZE / 16)
+
 struct PaletteStructTemplate
 {
     u16 id;
@@ -64,6 +68,8 @@ static EWRAM_DATA struct PaletteStruct sPaletteStructs[NUM_PALETTE_STRUCTS] = {0
 EWRAM_DATA struct PaletteFadeControl gPaletteFade = {0};
 static EWRAM_DATA u32 sFiller = 0;
 static EWRAM_DATA u32 sPlttBufferTransferPending = 0;
+static EWRAM_DATA u32 sPlttBufferDirtyRows = 0;
+static EWRAM_DATA bool8 sPlttBufferTrackDirtyRows = FALSE;
 EWRAM_DATA u8 gPaletteDecompressionBuffer[PLTT_DECOMP_BUFFER_SIZE] = {0};
 
 static const struct PaletteStructTemplate sDummyPaletteStructTemplate = {
@@ -86,31 +92,82 @@ void LoadCompressedPalette(const u32 *src, u16 offset, u16 size)
     LZDecompressWram(src, gPaletteDecompressionBuffer);
     CpuCopy16(gPaletteDecompressionBuffer, &gPlttBufferUnfaded[offset], size);
     CpuCopy16(gPaletteDecompressionBuffer, &gPlttBufferFaded[offset], size);
+    MarkPlttBufferDirty(offset, size);
 }
 
 void LoadPalette(const void *src, u16 offset, u16 size)
 {
     CpuCopy16(src, &gPlttBufferUnfaded[offset], size);
     CpuCopy16(src, &gPlttBufferFaded[offset], size);
+    MarkPlttBufferDirty(offset, size);
 }
 
 void FillPalette(u16 value, u16 offset, u16 size)
 {
     CpuFill16(value, &gPlttBufferUnfaded[offset], size);
     CpuFill16(value, &gPlttBufferFaded[offset], size);
+    MarkPlttBufferDirty(offset, size);
+}
+
+// Marks the 16-color rows covering size bytes of gPlttBufferFaded
+// starting at color offset so the next TransferPlttBuffer uploads them.
+void MarkPlttBufferDirty(u16 offset, u16 size)
+{
+    u32 first, last;
+
+    if (size == 0 || offset >= PLTT_BUFFER_SIZE)
+        return;
+    first = offset / 16;
+    last = min((offset + (size - 1) / 2) / 16, PLTT_ROW_COUNT - 1);
+    sPlttBufferDirtyRows |= (PALETTES_ALL >> (PLTT_ROW_COUNT - 1 - last + first)) << first;
+}
+
+// Marks whole 16-color rows of gPlttBufferFaded, one bit per palette.
+void MarkPlttBufferRowsDirty(u32 selectedPalettes)
+{
+    sPlttBufferDirtyRows |= selectedPalettes;
+}
+
+// Only callbacks whose palette writers all mark their rows may enable
+// tracking. While it is disabled, TransferPlttBuffer uploads every row.
+void SetPlttBufferDirtyRowTracking(bool32 enabled)
+{
+    sPlttBufferTrackDirtyRows = enabled;
+    sPlttBufferDirtyRows = PALETTES_ALL;
 }
 
 void TransferPlttBuffer(void)
 {
+    PROFILE_BEGIN(PROFILE_PHASE_PLTT_TRANSFER);
     if (!gPaletteFade.bufferTransferDisabled)
     {
-        void *src = gPlttBufferFaded;
-        void *dest = (void *)PLTT;
-        DmaCopy16(3, src, dest, PLTT_SIZE);
+        u32 dirtyRows = sPlttBufferTrackDirtyRows ? sPlttBufferDirtyRows : PALETTES_ALL;
+        u32 row = 0;
+
+        // Upload each run of consecutive dirty rows with a single DMA.
+        while (dirtyRows != 0)
+        {
+            u32 count = 0;
+
+            while (!(dirtyRows & 1))
+            {
+                dirtyRows >>= 1;
+                row++;
+            }
+            while (dirtyRows & 1)
+            {
+                dirtyRows >>= 1;
+                count++;
+            }
+            DmaCopy16(3, &gPlttBufferFaded[row * 16], (void *)(PLTT + row * PLTT_SIZE_4BPP), count * PLTT_SIZE_4BPP);
+            row += count;
+        }
+        sPlttBufferDirtyRows = 0;
         sPlttBufferTransferPending = FALSE;
         if (gPaletteFade.mode == HARDWARE_FADE && gPaletteFade.active)
             UpdateBlendRegisters();
     }
+    PROFILE_END(PROFILE_PHASE_PLTT_TRANSFER);
 }
 
 u8 UpdatePaletteFade(void)
@@ -153,6 +210,7 @@ static void ReadPlttIntoBuffers(void)
         gPlttBufferUnfaded[i] = pltt[i];
         gPlttBufferFaded[i] = pltt[i];
     }
+    MarkPlttBufferRowsDirty(PALETTES_ALL);
 }
 
 bool8 BeginNormalPaletteFade(u32 selectedPalettes, s8 delay, u8 startY, u8 targetY, u16 blendColor)
@@ -266,6 +324,7 @@ static void PaletteStruct_Copy(struct PaletteStruct *palStruct, u32 *unkFlags)
         }
     }
 
+    MarkPlttBufferDirty(palStruct->baseDestOffset, palStruct->template->size * 2);
     palStruct->destOffset = palStruct->baseDestOffset;
     palStruct->countdown1 = palStruct->template->time1;
     palStruct->srcIndex++;
@@ -309,6 +368,7 @@ static void PaletteStruct_Blend(struct PaletteStruct *palStruct, u32 *unkFlags)
 
                     for (i = 0; i < palStruct->template->size; i++)
                         gPlttBufferFaded[palStruct->baseDestOffset + i] = palStruct->template->src[srcOffset + i];
+                    MarkPlttBufferDirty(palStruct->baseDestOffset, palStruct->template->size * 2);
                 }
             }
         }
@@ -410,7 +470,6 @@ static u8 PaletteStruct_GetPalNum(u16 id)
 static u8 UpdateNormalPaletteFade(void)
 {
     u16 paletteOffset;
-    u16 selectedPalettes;
 
     if (!gPaletteFade.active)
         return PALETTE_FADE_STATUS_DONE;
@@ -431,28 +490,23 @@ static u8 UpdateNormalPaletteFade(void)
             gPaletteFade.delayCounter = 0;
         }
 
-        paletteOffset = 0;
-
+        // All 32 palettes are blended on the first of the two frames a fade
+        // step takes, so that BG and OBJ palettes never show different steps.
+        // The second frame only keeps the original timing of the fade.
         if (!gPaletteFade.objPaletteToggle)
         {
-            selectedPalettes = gPaletteFade_selectedPalettes;
-        }
-        else
-        {
-            selectedPalettes = gPaletteFade_selectedPalettes >> 16;
-            paletteOffset = 256;
-        }
+            u32 palettes = gPaletteFade_selectedPalettes;
 
-        while (selectedPalettes)
-        {
-            if (selectedPalettes & 1)
-                BlendPalette(
-                    paletteOffset,
-                    16,
-                    gPaletteFade.y,
-                    gPaletteFade.blendColor);
-            selectedPalettes >>= 1;
-            paletteOffset += 16;
+            for (paletteOffset = 0; palettes; paletteOffset += 16)
+            {
+                if (palettes & 1)
+                    BlendPalette(
+                        paletteOffset,
+                        16,
+                        gPaletteFade.y,
+                        gPaletteFade.blendColor);
+                palettes >>= 1;
+            }
         }
 
         gPaletteFade.objPaletteToggle ^= 1;
@@ -497,6 +551,7 @@ void InvertPlttBuffer(u32 selectedPalettes)
 {
     u16 paletteOffset = 0;
 
+    MarkPlttBufferRowsDirty(selectedPalettes);
     while (selectedPalettes)
     {
         if (selectedPalettes & 1)
@@ -514,6 +569,7 @@ void TintPlttBuffer(u32 selectedPalettes, s8 r, s8 g, s8 b)
 {
     u16 paletteOffset = 0;
 
+    MarkPlttBufferRowsDirty(selectedPalettes);
     while (selectedPalettes)
     {
         if (selectedPalettes & 1)
@@ -536,6 +592,7 @@ void UnfadePlttBuffer(u32 selectedPalettes)
 {
     u16 paletteOffset = 0;
 
+    MarkPlttBufferRowsDirty(selectedPalettes);
     while (selectedPalettes)
     {
         if (selectedPalettes & 1)
@@ -563,10 +620,16 @@ static void BeginFastPaletteFadeInternal(u8 submode)
     gPaletteFade.mode = FAST_FADE;
 
     if (submode == FAST_FADE_IN_FROM_BLACK)
+    {
         CpuFill16(RGB_BLACK, gPlttBufferFaded, PLTT_SIZE);
+        MarkPlttBufferRowsDirty(PALETTES_ALL);
+    }
 
     if (submode == FAST_FADE_IN_FROM_WHITE)
+    {
         CpuFill16(RGB_WHITE, gPlttBufferFaded, PLTT_SIZE);
+        MarkPlttBufferRowsDirty(PALETTES_ALL);
+    }
 
     UpdatePaletteFade();
 }
@@ -594,11 +657,13 @@ static u8 UpdateFastPaletteFade(void)
     {
         paletteOffsetStart = 256;
         paletteOffsetEnd = 512;
+        MarkPlttBufferRowsDirty(PALETTES_OBJECTS);
     }
     else
     {
         paletteOffsetStart = 0;
         paletteOffsetEnd = 256;
+        MarkPlttBufferRowsDirty(PALETTES_BG);
     }
 
     switch (gPaletteFade_submode)
@@ -719,6 +784,7 @@ static u8 UpdateFastPaletteFade(void)
             CpuFill32(0x00000000, gPlttBufferFaded, PLTT_SIZE);
             break;
         }
+        MarkPlttBufferRowsDirty(PALETTES_ALL);
 
         gPaletteFade.mode = NORMAL_FADE;
         gPaletteFade.softwareFadeFinishing = TRUE;
@@ -848,6 +914,7 @@ void BlendPalettesUnfaded(u32 selectedPalettes, u8 coeff, u16 color)
     void *src = gPlttBufferUnfaded;
     void *dest = gPlttBufferFaded;
     DmaCopy32(3, src, dest, PLTT_SIZE);
+    MarkPlttBufferRowsDirty(PALETTES_ALL);
     BlendPalettes(selectedPalettes, coeff, color);
 }
 
@@ -946,7 +1013,6 @@ void TintPalette_CustomTone(u16 *palette, u16 count, u16 rTone, u16 gTone, u16 b
 #define tCoeffTarget data[1]
 #define tCoeffDelta  data[2]
 #define tDelay       data[3]
-#define tDelayTimer  data[4]
 #define tPalettes    5 // data[5] and data[6], set/get via Set/GetWordTaskArg
 #define tColor       data[7]
 #define tId          data[8]
@@ -979,7 +1045,13 @@ void BlendPalettesGradually(u32 selectedPalettes, s8 delay, u8 coeff, u8 coeffTa
     SetWordTaskArg(taskId, tPalettes, selectedPalettes);
     gTasks[taskId].tColor = color;
     gTasks[taskId].tId = id;
-    gTasks[taskId].func(taskId);
+
+    // Blend once every tDelay + 1 frames, starting tDelay frames from now.
+    SetTaskPeriod(taskId, gTasks[taskId].tDelay + 1);
+    if (gTasks[taskId].tDelay == 0)
+        gTasks[taskId].func(taskId);
+    else
+        DelayTask(taskId, gTasks[taskId].tDelay);
 }
 
 // Unused
@@ -1019,28 +1091,24 @@ static void Task_BlendPalettesGradually(u8 taskId)
     data = gTasks[taskId].data;
     palettes = GetWordTaskArg(taskId, tPalettes);
 
-    if (++tDelayTimer > tDelay)
+    BlendPalettes(palettes, tCoeff, tColor);
+    target = tCoeffTarget;
+    if (tCoeff == target)
     {
-        tDelayTimer = 0;
-        BlendPalettes(palettes, tCoeff, tColor);
-        target = tCoeffTarget;
-        if (tCoeff == target)
+        DestroyTask(taskId);
+    }
+    else
+    {
+        tCoeff += tCoeffDelta;
+        if (tCoeffDelta >= 0)
         {
-            DestroyTask(taskId);
+            if (tCoeff < target)
+                return;
         }
-        else
+        else if (tCoeff > target)
         {
-            tCoeff += tCoeffDelta;
-            if (tCoeffDelta >= 0)
-            {
-                if (tCoeff < target)
-                    return;
-            }
-            else if (tCoeff > target)
-            {
-                return;
-            }
-            tCoeff = target;
+            return;
         }
+        tCoeff = target;
     }
 }
@@ -112,6 +112,7 @@ static EWRAM_DATA struct PokedexView *sPokedexView = NULL;
 static EWRAM_DATA u16 sLastSelectedPokemon = 0;
 static EWRAM_DATA u8 sPokeBallRotation = 0;
 static EWRAM_DATA struct PokedexListItem *sPokedexListItem = NULL;
+static EWRAM_DATA struct PokedexSearchIndex *sPokedexSearchIndex = NULL;
 
 // This is written to, but never read.
 u8 gUnusedPokedexU8;
@@ -196,6 +197,19 @@ struct PokedexView
     u8 unkArr3[8]; // Cleared, never read
 };
 
+#define DEX_BITSET_WORDS ((NATIONAL_DEX_COUNT + 31) / 32)
+
+// One bit per National Dex number (bit n - 1 for number n), laid out like
+// the dexSeen/dexCaught flags so those can be combined with them directly.
+struct PokedexSearchIndex
+{
+    u32 hoennDex[DEX_BITSET_WORDS];
+    u32 nameGroup[NAME_YZ + 1][DEX_BITSET_WORDS];
+    u32 bodyColor[BODY_COLOR_PINK + 1][DEX_BITSET_WORDS];
+    u32 type[NUMBER_OF_MON_TYPES][DEX_BITSET_WORDS];
+    u32 monoType[DEX_BITSET_WORDS];
+};
+
 // this file's functions
 static void CB2_Pokedex(void);
 static void Task_OpenPokedexMainPage(u8);
@@ -1853,6 +1867,7 @@ static void Task_ClosePokedex(u8 taskId)
         SetMainCallback2(CB2_ReturnToFieldWithOpenMenu);
         m4aMPlayVolumeControl(&gMPlayInfo_BGM, TRACKS_ALL, 0x100);
         Free(sPokedexView);
+        TRY_FREE_AND_SET_NULL(sPokedexSearchIndex);
     }
 }
 
@@ -4616,105 +4631,127 @@ static u16 CreateSizeScreenTrainerPic(u16 species, s16 x, s16 y, s8 paletteSlot)
     return CreateTrainerPicSprite(species, TRUE, x, y, paletteSlot, TAG_NONE);
 }
 
-static int DoPokedexSearch(u8 dexMode, u8 order, u8 abcGroup, u8 bodyColor, u8 type1, u8 type2)
-{
-    u16 species;
-    u16 i;
-    u16 resultsCount;
-    u8 types[2];
+#define DEX_BIT_SET(bits, nationalNum)  ((bits)[((nationalNum) - 1) / 32] |= 1u << (((nationalNum) - 1) % 32))
+#define DEX_BIT_TEST(bits, nationalNum) ((bits)[((nationalNum) - 1) / 32] & (1u << (((nationalNum) - 1) % 32)))
 
-    CreatePokedexList(dexMode, order);
+// Built once per visit to the Pokédex, the first time a search is made.
+static void BuildPokedexSearchIndex(void)
+{
+    u32 nationalNum, group;
 
-    for (i = 0, resultsCount = 0; i < NATIONAL_DEX_COUNT; i++)
+    sPokedexSearchIndex = AllocZeroed(sizeof(*sPokedexSearchIndex));
+    for (nationalNum = 1; nationalNum <= NATIONAL_DEX_COUNT; nationalNum++)
     {
-        if (sPokedexView->pokedexList[i].seen)
+        u32 species = NationalPokedexNumToSpecies(nationalNum);
+        u32 firstLetter = gSpeciesNames[species][0];
+        const struct SpeciesInfo *info = &gSpeciesInfo[species];
+
+        if (NationalToHoennOrder(nationalNum) != 0)
+            DEX_BIT_SET(sPokedexSearchIndex->hoennDex, nationalNum);
+
+        for (group = NAME_ABC; group <= NAME_YZ; group++)
         {
-            sPokedexView->pokedexList[resultsCount] = sPokedexView->pokedexList[i];
-            resultsCount++;
+            if (LETTER_IN_RANGE_UPPER(firstLetter, group) || LETTER_IN_RANGE_LOWER(firstLetter, group))
+                DEX_BIT_SET(sPokedexSearchIndex->nameGroup[group], nationalNum);
         }
-    }
-    sPokedexView->pokemonListCount = resultsCount;
 
-    // Search by name
-    if (abcGroup != 0xFF)
-    {
-        for (i = 0, resultsCount = 0; i < sPokedexView->pokemonListCount; i++)
-        {
-            u8 firstLetter;
+        if (info->bodyColor <= BODY_COLOR_PINK)
+            DEX_BIT_SET(sPokedexSearchIndex->bodyColor[info->bodyColor], nationalNum);
 
-            species = NationalPokedexNumToSpecies(sPokedexView->pokedexList[i].dexNum);
-            firstLetter = gSpeciesNames[species][0];
-            if (LETTER_IN_RANGE_UPPER(firstLetter, abcGroup) || LETTER_IN_RANGE_LOWER(firstLetter, abcGroup))
-            {
-                sPokedexView->pokedexList[resultsCount] = sPokedexView->pokedexList[i];
-                resultsCount++;
-            }
-        }
-        sPokedexView->pokemonListCount = resultsCount;
+        DEX_BIT_SET(sPokedexSearchIndex->type[info->types[0]], nationalNum);
+        DEX_BIT_SET(sPokedexSearchIndex->type[info->types[1]], nationalNum);
+        if (info->types[0] == info->types[1])
+            DEX_BIT_SET(sPokedexSearchIndex->monoType, nationalNum);
     }
+}
 
-    // Search by body color
-    if (bodyColor != 0xFF)
+static void AddPokedexSearchResult(u32 nationalNum, const u32 *matches, const u32 *caught)
+{
+    if (nationalNum != 0 && nationalNum <= NATIONAL_DEX_COUNT && DEX_BIT_TEST(matches, nationalNum))
     {
-        for (i = 0, resultsCount = 0; i < sPokedexView->pokemonListCount; i++)
-        {
-            species = NationalPokedexNumToSpecies(sPokedexView->pokedexList[i].dexNum);
+        sPokedexView->pokedexList[sPokedexView->pokemonListCount].dexNum = nationalNum;
+        sPokedexView->pokedexList[sPokedexView->pokemonListCount].seen = TRUE;
+        sPokedexView->pokedexList[sPokedexView->pokemonListCount].owned = DEX_BIT_TEST(caught, nationalNum) != 0;
+        sPokedexView->pokemonListCount++;
+    }
+}
 
-            if (bodyColor == gSpeciesInfo[species].bodyColor)
-            {
-                sPokedexView->pokedexList[resultsCount] = sPokedexView->pokedexList[i];
-                resultsCount++;
-            }
-        }
-        sPokedexView->pokemonListCount = resultsCount;
+static int DoPokedexSearch(u8 dexMode, u8 order, u8 abcGroup, u8 bodyColor, u8 type1, u8 type2)
+{
+    u32 seen[DEX_BITSET_WORDS] = {0};
+    u32 caught[DEX_BITSET_WORDS] = {0};
+    u32 matches[DEX_BITSET_WORDS];
+    bool32 isHoennDex = (dexMode != DEX_MODE_NATIONAL || !IsNationalPokedexEnabled());
+    s32 i;
+
+    if (sPokedexSearchIndex == NULL)
+        BuildPokedexSearchIndex();
+
+    memcpy(seen, gSaveBlock1Ptr->dexSeen, min(sizeof(seen), NUM_DEX_FLAG_BYTES));
+    memcpy(caught, gSaveBlock1Ptr->dexCaught, min(sizeof(caught), NUM_DEX_FLAG_BYTES));
+
+    if (type1 == TYPE_NONE)
+    {
+        type1 = type2;
+        type2 = TYPE_NONE;
     }
 
-    // Search by type
-    if (type1 != TYPE_NONE || type2 != TYPE_NONE)
+    for (i = 0; i < DEX_BITSET_WORDS; i++)
     {
-        if (type1 == TYPE_NONE)
-        {
-            type1 = type2;
-            type2 = TYPE_NONE;
-        }
+        matches[i] = seen[i];
+        if (isHoennDex)
+            matches[i] &= sPokedexSearchIndex->hoennDex[i];
+        // The size orders only list caught Pokémon
+        if (order >= ORDER_HEAVIEST)
+            matches[i] &= caught[i];
+        if (abcGroup != 0xFF)
+            matches[i] &= sPokedexSearchIndex->nameGroup[abcGroup][i];
+        if (bodyColor != 0xFF)
+            matches[i] &= sPokedexSearchIndex->bodyColor[bodyColor][i];
+        // Types are only known for caught Pokémon
+        if (type1 != TYPE_NONE)
+            matches[i] &= caught[i] & sPokedexSearchIndex->type[type1][i];
+        if (type2 == type1 && type2 != TYPE_NONE)
+            matches[i] &= sPokedexSearchIndex->monoType[i];
+        else if (type2 != TYPE_NONE)
+            matches[i] &= sPokedexSearchIndex->type[type2][i];
+    }
 
-        if (type2 == TYPE_NONE)
+    sPokedexView->pokemonListCount = 0;
+    switch (order)
+    {
+    case ORDER_NUMERICAL:
+        if (isHoennDex)
         {
-            for (i = 0, resultsCount = 0; i < sPokedexView->pokemonListCount; i++)
-            {
-                if (sPokedexView->pokedexList[i].owned)
-                {
-                    species = NationalPokedexNumToSpecies(sPokedexView->pokedexList[i].dexNum);
-
-                    types[0] = gSpeciesInfo[species].types[0];
-                    types[1] = gSpeciesInfo[species].types[1];
-                    if (types[0] == type1 || types[1] == type1)
-                    {
-                        sPokedexView->pokedexList[resultsCount] = sPokedexView->pokedexList[i];
-                        resultsCount++;
-                    }
-                }
-            }
+            for (i = 1; i < HOENN_DEX_COUNT; i++)
+                AddPokedexSearchResult(HoennToNationalOrder(i), matches, caught);
         }
         else
         {
-            for (i = 0, resultsCount = 0; i < sPokedexView->pokemonListCount; i++)
-            {
-                if (sPokedexView->pokedexList[i].owned)
-                {
-                    species = NationalPokedexNumToSpecies(sPokedexView->pokedexList[i].dexNum);
-
-                    types[0] = gSpeciesInfo[species].types[0];
-                    types[1] = gSpeciesInfo[species].types[1];
-                    if ((types[0] == type1 && types[1] == type2) || (types[0] == type2 && types[1] == type1))
-                    {
-                        sPokedexView->pokedexList[resultsCount] = sPokedexView->pokedexList[i];
-                        resultsCount++;
-                    }
-                }
-            }
+            for (i = 1; i <= NATIONAL_DEX_COUNT; i++)
+                AddPokedexSearchResult(i, matches, caught);
         }
-        sPokedexView->pokemonListCount = resultsCount;
+        break;
+    case ORDER_ALPHABETICAL:
+        for (i = 0; i < ARRAY_COUNT(gPokedexOrder_Alphabetical); i++)
+            AddPokedexSearchResult(gPokedexOrder_Alphabetical[i], matches, caught);
+        break;
+    case ORDER_HEAVIEST:
+        for (i = ARRAY_COUNT(gPokedexOrder_Weight) - 1; i >= 0; i--)
+            AddPokedexSearchResult(gPokedexOrder_Weight[i], matches, caught);
+        break;
+    case ORDER_LIGHTEST:
+        for (i = 0; i < ARRAY_COUNT(gPokedexOrder_Weight); i++)
+            AddPokedexSearchResult(gPokedexOrder_Weight[i], matches, caught);
+        break;
+    case ORDER_TALLEST:
+        for (i = ARRAY_COUNT(gPokedexOrder_Height) - 1; i >= 0; i--)
+            AddPokedexSearchResult(gPokedexOrder_Height[i], matches, caught);
+        break;
+    case ORDER_SMALLEST:
+        for (i = 0; i < ARRAY_COUNT(gPokedexOrder_Height); i++)
+            AddPokedexSearchResult(gPokedexOrder_Height[i], matches, caught);
+        break;
     }
 
     if (sPokedexView->pokemonListCount != 0)
@@ -4727,7 +4764,7 @@ static int DoPokedexSearch(u8 dexMode, u8 order, u8 abcGroup, u8 bodyColor, u8 t
         }
     }
 
-    return resultsCount;
+    return sPokedexView->pokemonListCount;
 }
 
 static u8 LoadSearchMenu(void)
@@ -50,16 +50,6 @@
           types of functions are likely located.
 */
 
-// PC main menu options
-enum {
-    OPTION_WITHDRAW,
-    OPTION_DEPOSIT,
-    OPTION_MOVE_MONS,
-    OPTION_MOVE_ITEMS,
-    OPTION_EXIT,
-    OPTIONS_COUNT
-};
-
 // IDs for messages to print with PrintMessage
 enum {
     MSG_EXIT_BOX,
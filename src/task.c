@@ -1,10 +1,71 @@
 #include "global.h"
 #include "task.h"
+#include "frame_profiler.h"
 
 struct Task gTasks[NUM_TASKS];
 
+#define NUM_TASK_PRIORITIES 256
+
+#define TIMER_WHEEL_LEVELS 4
+#define TIMER_WHEEL_SLOT_BITS 4
+#define TIMER_WHEEL_SLOTS (1 << TIMER_WHEEL_SLOT_BITS)
+
+STATIC_ASSERT(NUM_TASKS <= 32, NumTasksFitInTaskMasks);
+STATIC_ASSERT(TIMER_WHEEL_LEVELS * TIMER_WHEEL_SLOT_BITS == 16, TimerWheelCoversTimerTicks);
+
+// The task list is kept sorted by priority, with tasks of the same priority
+// in creation order. To insert without walking the list, the last task of
+// every priority in use is remembered, and a bitmap of the priorities in use
+// finds the closest lower priority when a priority has no tasks yet.
+// sQueuedTasks has a bit for every task in the list. All of these are only
+// meaningful for bits that are set, so the zeroed state means there are no
+// tasks, as it does for gTasks.
+// The tables are only touched when tasks are created, destroyed or delayed,
+// so they live in EWRAM and only the words RunTasks reads stay in IWRAM.
+static u32 sQueuedTasks;
+static u8 sFirstTaskId;
+static EWRAM_DATA u8 sLastTaskIdByPriority[NUM_TASK_PRIORITIES] = {0};
+static EWRAM_DATA u32 sUsedPriorities[NUM_TASK_PRIORITIES / 32] = {0};
+
+// Delayed tasks are taken out of the task list and kept in a hierarchical
+// timer wheel until they are due, so waiting costs nothing per frame.
+// Every level has a slot for each value of one hex digit of the wake time.
+// A task is put at the level of the highest digit where its wake time
+// differs from the current time, and moves down a level when the time
+// reaches the start of its slot.
+static u16 sTimerTicks;
+static u32 sDelayedTasks;
+static EWRAM_DATA u32 sTimerWheel[TIMER_WHEEL_LEVELS * TIMER_WHEEL_SLOTS] = {0};
+static EWRAM_DATA u16 sTaskWakeTicks[NUM_TASKS] = {0};
+static EWRAM_DATA u8 sTaskTimerSlots[NUM_TASKS] = {0};
+static EWRAM_DATA u16 sTaskPeriods[NUM_TASKS] = {0};
+static EWRAM_DATA TaskFunc sTaskPeriodFuncs[NUM_TASKS] = {0};
+
 static void InsertTask(u8 newTaskId);
-static u8 FindFirstActiveTask(void);
+static void RemoveTask(u8 taskId);
+
+static const u8 sHighestBitByDeBruijnIndex[32] =
+{
+    0, 9, 1, 10, 13, 21, 2, 29, 11, 14, 16, 18, 22, 25, 3, 30,
+    8, 12, 20, 28, 15, 17, 24, 7, 19, 27, 23, 6, 26, 5, 4, 31,
+};
+
+// value must not be 0.
+static inline u32 HighestSetBit(u32 value)
+{
+    value |= value >> 1;
+    value |= value >> 2;
+    value |= value >> 4;
+    value |= value >> 8;
+    value |= value >> 16;
+    return sHighestBitByDeBruijnIndex[(value * 0x07C4ACDD) >> 27];
+}
+
+// value must not be 0.
+static inline u32 LowestSetBit(u32 value)
+{
+    return HighestSetBit(value & -value);
+}
 
 void ResetTasks(void)
 {
@@ -22,114 +83,255 @@ void ResetTasks(void)
 
     gTasks[0].prev = HEAD_SENTINEL;
     gTasks[NUM_TASKS - 1].next = TAIL_SENTINEL;
+
+    sQueuedTasks = 0;
+    memset(sUsedPriorities, 0, sizeof(sUsedPriorities));
+    sDelayedTasks = 0;
+    memset(sTimerWheel, 0, sizeof(sTimerWheel));
 }
 
 u8 CreateTask(TaskFunc func, u8 priority)
 {
     u8 i;
+    u32 freeTasks = ~(sQueuedTasks | sDelayedTasks) & ((1u << (NUM_TASKS - 1) << 1) - 1);
 
-    for (i = 0; i < NUM_TASKS; i++)
+    if (freeTasks == 0)
+        return 0;
+
+    // Use the lowest free slot, since FindTaskIdByFunc and friends return
+    // the lowest matching id.
+    i = LowestSetBit(freeTasks);
+    gTasks[i].func = func;
+    gTasks[i].priority = priority;
+    InsertTask(i);
+    sTaskPeriods[i] = 0;
+    memset(gTasks[i].data, 0, sizeof(gTasks[i].data));
+    gTasks[i].isActive = TRUE;
+    return i;
+}
+
+// Returns the last task with a lower priority value than priority, or
+// HEAD_SENTINEL if there is none.
+static u8 FindLastTaskBeforePriority(u8 priority)
+{
+    s32 word = priority / 32;
+    u32 bits = sUsedPriorities[word] & ((1u << (priority % 32)) - 1);
+
+    while (bits == 0)
     {
-        if (!gTasks[i].isActive)
-        {
-            gTasks[i].func = func;
-            gTasks[i].priority = priority;
-            InsertTask(i);
-            memset(gTasks[i].data, 0, sizeof(gTasks[i].data));
-            gTasks[i].isActive = TRUE;
-            return i;
-        }
+        if (--word < 0)
+            return HEAD_SENTINEL;
+        bits = sUsedPriorities[word];
     }
 
-    return 0;
+    return sLastTaskIdByPriority[word * 32 + HighestSetBit(bits)];
 }
 
 static void InsertTask(u8 newTaskId)
 {
-    u8 taskId = FindFirstActiveTask();
+    u8 priority = gTasks[newTaskId].priority;
+    u8 prevTaskId;
 
-    if (taskId == NUM_TASKS)
+    if (sUsedPriorities[priority / 32] & (1u << (priority % 32)))
     {
-        // The new task is the only task.
-        gTasks[newTaskId].prev = HEAD_SENTINEL;
-        gTasks[newTaskId].next = TAIL_SENTINEL;
-        return;
+        prevTaskId = sLastTaskIdByPriority[priority];
+    }
+    else
+    {
+        prevTaskId = FindLastTaskBeforePriority(priority);
+        sUsedPriorities[priority / 32] |= 1u << (priority % 32);
     }
+    sLastTaskIdByPriority[priority] = newTaskId;
 
-    while (1)
+    gTasks[newTaskId].prev = prevTaskId;
+    if (prevTaskId == HEAD_SENTINEL)
     {
-        if (gTasks[newTaskId].priority < gTasks[taskId].priority)
+        // The new task goes before every other task.
+        gTasks[newTaskId].next = sQueuedTasks != 0 ? sFirstTaskId : TAIL_SENTINEL;
+        sFirstTaskId = newTaskId;
+    }
+    else
+    {
+        gTasks[newTaskId].next = gTasks[prevTaskId].next;
+        gTasks[prevTaskId].next = newTaskId;
+    }
+
+    if (gTasks[newTaskId].next != TAIL_SENTINEL)
+        gTasks[gTasks[newTaskId].next].prev = newTaskId;
+
+    sQueuedTasks |= 1u << newTaskId;
+}
+
+// The removed task's next is left alone, so that RunTasks can continue
+// from a task that destroys or delays itself.
+static void RemoveTask(u8 taskId)
+{
+    u8 priority = gTasks[taskId].priority;
+
+    sQueuedTasks &= ~(1u << taskId);
+
+    if (sLastTaskIdByPriority[priority] == taskId)
+    {
+        if (gTasks[taskId].prev != HEAD_SENTINEL && gTasks[gTasks[taskId].prev].priority == priority)
+        {
+            sLastTaskIdByPriority[priority] = gTasks[taskId].prev;
+        }
+        else
+        {
+            sUsedPriorities[priority / 32] &= ~(1u << (priority % 32));
+        }
+    }
+
+    if (gTasks[taskId].prev == HEAD_SENTINEL)
+    {
+        if (gTasks[taskId].next != TAIL_SENTINEL)
         {
-            // We've found a task with a higher priority value,
-            // so we insert the new task before it.
-            gTasks[newTaskId].prev = gTasks[taskId].prev;
-            gTasks[newTaskId].next = taskId;
-            if (gTasks[taskId].prev != HEAD_SENTINEL)
-                gTasks[gTasks[taskId].prev].next = newTaskId;
-            gTasks[taskId].prev = newTaskId;
-            return;
+            gTasks[gTasks[taskId].next].prev = HEAD_SENTINEL;
+            sFirstTaskId = gTasks[taskId].next;
         }
+    }
+    else
+    {
         if (gTasks[taskId].next == TAIL_SENTINEL)
         {
-            // We've reached the end.
-            gTasks[newTaskId].prev = taskId;
-            gTasks[newTaskId].next = gTasks[taskId].next;
-            gTasks[taskId].next = newTaskId;
-            return;
+            gTasks[gTasks[taskId].prev].next = TAIL_SENTINEL;
+        }
+        else
+        {
+            gTasks[gTasks[taskId].prev].next = gTasks[taskId].next;
+            gTasks[gTasks[taskId].next].prev = gTasks[taskId].prev;
         }
-        taskId = gTasks[taskId].next;
     }
 }
 
+static void RemoveTaskFromTimerWheel(u8 taskId)
+{
+    sTimerWheel[sTaskTimerSlots[taskId]] &= ~(1u << taskId);
+    sDelayedTasks &= ~(1u << taskId);
+}
+
 void DestroyTask(u8 taskId)
 {
     if (gTasks[taskId].isActive)
     {
         gTasks[taskId].isActive = FALSE;
 
-        if (gTasks[taskId].prev == HEAD_SENTINEL)
-        {
-            if (gTasks[taskId].next != TAIL_SENTINEL)
-                gTasks[gTasks[taskId].next].prev = HEAD_SENTINEL;
-        }
+        if (sDelayedTasks & (1u << taskId))
+            RemoveTaskFromTimerWheel(taskId);
         else
+            RemoveTask(taskId);
+    }
+}
+
+static void AddTaskToTimerWheel(u8 taskId)
+{
+    u16 wakeTicks = sTaskWakeTicks[taskId];
+    u16 diff = wakeTicks ^ sTimerTicks;
+    u32 level = diff != 0 ? HighestSetBit(diff) / TIMER_WHEEL_SLOT_BITS : 0;
+    u32 slot = level * TIMER_WHEEL_SLOTS + ((wakeTicks >> (level * TIMER_WHEEL_SLOT_BITS)) % TIMER_WHEEL_SLOTS);
+
+    sTimerWheel[slot] |= 1u << taskId;
+    sTaskTimerSlots[taskId] = slot;
+    sDelayedTasks |= 1u << taskId;
+}
+
+// Stops running the task until the frames-th call to RunTasks from now.
+// Delaying by 0 or 1 frames makes a delayed task run again on the next
+// frame. A task that was delayed runs after the other tasks with the same
+// priority.
+void DelayTask(u8 taskId, u16 frames)
+{
+    if (!gTasks[taskId].isActive)
+        return;
+
+    if (sDelayedTasks & (1u << taskId))
+        RemoveTaskFromTimerWheel(taskId);
+    else if (frames > 1)
+        RemoveTask(taskId);
+    else
+        return;
+
+    if (frames > 1)
+    {
+        sTaskWakeTicks[taskId] = sTimerTicks + frames;
+        AddTaskToTimerWheel(taskId);
+    }
+    else
+    {
+        InsertTask(taskId);
+    }
+}
+
+// Runs the task every frames frames, by delaying it each time RunTasks has
+// run it. A period of 0 or 1 runs it every frame. The period only applies to
+// the task's current func, it is cleared once the func changes, and a new
+// task created in the same slot starts without one.
+void SetTaskPeriod(u8 taskId, u16 frames)
+{
+    sTaskPeriods[taskId] = frames;
+    sTaskPeriodFuncs[taskId] = gTasks[taskId].func;
+}
+
+static void AdvanceTaskTimers(void)
+{
+    u32 level, slot, tasks, taskId;
+
+    sTimerTicks++;
+    if (sDelayedTasks == 0)
+        return;
+
+    // Move the tasks in every slot that starts now down the wheel, from
+    // the top so that they can fall through several levels at once.
+    for (level = TIMER_WHEEL_LEVELS - 1; level > 0; level--)
+    {
+        if (sTimerTicks & ((1 << (level * TIMER_WHEEL_SLOT_BITS)) - 1))
+            continue;
+
+        slot = level * TIMER_WHEEL_SLOTS + ((sTimerTicks >> (level * TIMER_WHEEL_SLOT_BITS)) % TIMER_WHEEL_SLOTS);
+        tasks = sTimerWheel[slot];
+        sTimerWheel[slot] = 0;
+        while (tasks != 0)
         {
-            if (gTasks[taskId].next == TAIL_SENTINEL)
-            {
-                gTasks[gTasks[taskId].prev].next = TAIL_SENTINEL;
-            }
-            else
-            {
-                gTasks[gTasks[taskId].prev].next = gTasks[taskId].next;
-                gTasks[gTasks[taskId].next].prev = gTasks[taskId].prev;
-            }
+            taskId = LowestSetBit(tasks);
+            tasks &= tasks - 1;
+            AddTaskToTimerWheel(taskId);
         }
     }
+
+    tasks = sTimerWheel[sTimerTicks % TIMER_WHEEL_SLOTS];
+    sTimerWheel[sTimerTicks % TIMER_WHEEL_SLOTS] = 0;
+    sDelayedTasks &= ~tasks;
+    while (tasks != 0)
+    {
+        taskId = LowestSetBit(tasks);
+        tasks &= tasks - 1;
+        InsertTask(taskId);
+    }
 }
 
 void RunTasks(void)
 {
-    u8 taskId = FindFirstActiveTask();
+    u8 taskId;
 
-    if (taskId != NUM_TASKS)
+    PROFILE_BEGIN(PROFILE_PHASE_TASKS);
+    AdvanceTaskTimers();
+    if (sQueuedTasks != 0)
     {
+        taskId = sFirstTaskId;
         do
         {
             gTasks[taskId].func(taskId);
+            if (sTaskPeriods[taskId] > 1 && (sQueuedTasks & (1u << taskId)))
+            {
+                if (gTasks[taskId].func == sTaskPeriodFuncs[taskId])
+                    DelayTask(taskId, sTaskPeriods[taskId]);
+                else
+                    sTaskPeriods[taskId] = 0;
+            }
             taskId = gTasks[taskId].next;
         } while (taskId != TAIL_SENTINEL);
     }
-}
-
-static u8 FindFirstActiveTask(void)
-{
-    u8 taskId;
-
-    for (taskId = 0; taskId < NUM_TASKS; taskId++)
-        if (gTasks[taskId].isActive == TRUE && gTasks[taskId].prev == HEAD_SENTINEL)
-            break;
-
-    return taskId;
+    PROFILE_END(PROFILE_PHASE_TASKS);
 }
 
 void TaskDummy(u8 taskId)
@@ -40,6 +40,12 @@ void TestRunner_Battle_AfterLastTurn(void)
 {
 }
 
+__attribute__((weak))
+u16 TestRunner_Benchmark_KeyInput(u16 keyInput)
+{
+    return keyInput;
+}
+
 __attribute__((weak))
 void BattleTest_CheckBattleRecordActionType(u32 battlerId, u32 recordIndex, u32 actionType)
 {
@@ -0,0 +1,44 @@
+#include "global.h"
+#include "option_menu.h"
+#include "pokedex.h"
+#include "pokemon_storage_system.h"
+#include "test_benchmark.h"
+
+// Warps and battle animations are not covered here: both need a loaded
+// save with a map or a battle already set up, which START_SCENE can't
+// provide on its own.
+
+static void CB2_EnterPokeStorage_MoveMons(void)
+{
+    EnterPokeStorage(OPTION_MOVE_MONS);
+}
+
+BENCHMARK("Benchmark: Option menu scrolling")
+{
+    START_SCENE(CB2_InitOptionMenu);
+    WARM_UP(30);
+    HOLD(DPAD_DOWN, 60);
+    PRESS(DPAD_RIGHT);
+    PRESS(DPAD_LEFT);
+    EXPECT_MAX_CYCLES(PROFILE_PHASE_MAIN_CALLBACKS, 200000);
+}
+
+BENCHMARK("Benchmark: Pokedex list scrolling")
+{
+    START_SCENE(CB2_OpenPokedex);
+    WARM_UP(60);
+    HOLD(DPAD_DOWN, 120);
+    HOLD(DPAD_UP, 60);
+    EXPECT_MAX_CYCLES(PROFILE_PHASE_MAIN_CALLBACKS, 200000);
+}
+
+BENCHMARK("Benchmark: PC box cursor movement")
+{
+    START_SCENE(CB2_EnterPokeStorage_MoveMons);
+    WARM_UP(90);
+    HOLD(DPAD_RIGHT, 60);
+    HOLD(DPAD_DOWN, 30);
+    PRESS(R_BUTTON);
+    WAIT(30);
+    EXPECT_MAX_CYCLES(PROFILE_PHASE_MAIN_CALLBACKS, 200000);
+}
@@ -0,0 +1,31 @@
+#include "global.h"
+#include "test.h"
+#include "palette.h"
+#include "util.h"
+#include "constants/rgb.h"
+
+static u16 BlendColorReference(u16 color, u16 blendColor, u32 coeff)
+{
+    s32 r = GET_R(color), g = GET_G(color), b = GET_B(color);
+
+    return RGB(r + (((GET_R(blendColor) - r) * (s32)coeff) >> 4),
+               g + (((GET_G(blendColor) - g) * (s32)coeff) >> 4),
+               b + (((GET_B(blendColor) - b) * (s32)coeff) >> 4));
+}
+
+TEST("BlendPalette matches the per-channel blend")
+{
+    u32 i, coeff;
+    u16 blendColor = RGB(3, 29, 17);
+
+    for (i = 0; i < 32; i++)
+        gPlttBufferUnfaded[i] = (i * 0x1357 + 0x2468) & 0x7FFF;
+
+    for (coeff = 0; coeff <= 16; coeff++)
+    {
+        // Start and end on odd entries to cover the unpaired colors.
+        BlendPalette(1, 30, coeff, blendColor);
+        for (i = 1; i < 31; i++)
+            EXPECT_EQ(gPlttBufferFaded[i], BlendColorReference(gPlttBufferUnfaded[i], blendColor, coeff));
+    }
+}
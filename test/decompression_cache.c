@@ -0,0 +1,52 @@
+#include "global.h"
+#include "test.h"
+#include "decompress.h"
+#include "graphics.h"
+#include "malloc.h"
+
+TEST("LZDecompressWramCached matches LZ77UnCompWram")
+{
+    struct DecompressionCacheStats before, after;
+    u32 size = GetDecompressedDataSize(gBattleTextboxTiles);
+    u8 *expected, *actual;
+
+    ASSUME(OW_DECOMPRESSION_CACHE_SIZE >= size);
+    expected = Alloc(size);
+    actual = Alloc(size);
+    ClearDecompressionCache();
+    LZ77UnCompWram(gBattleTextboxTiles, expected);
+    LZDecompressWramCached(gBattleTextboxTiles, actual);
+    EXPECT_EQ(memcmp(expected, actual, size), 0);
+
+    memset(actual, 0, size);
+    GetDecompressionCacheStats(&before);
+    LZDecompressWramCached(gBattleTextboxTiles, actual);
+    GetDecompressionCacheStats(&after);
+    EXPECT_EQ(after.hits, before.hits + 1);
+    EXPECT_EQ(memcmp(expected, actual, size), 0);
+
+    Free(expected);
+    Free(actual);
+}
+
+TEST("LZDecompressWramCached evicts the least recently used data")
+{
+    struct DecompressionCacheStats before, after;
+    u32 size = GetDecompressedDataSize(gBattleTextboxTiles);
+    u8 *buffer;
+
+    ASSUME(OW_DECOMPRESSION_CACHE_SIZE >= size);
+    ASSUME(OW_DECOMPRESSION_CACHE_SIZE < size + GetDecompressedDataSize(gBattleTextboxPalette));
+    buffer = Alloc(size);
+    ClearDecompressionCache();
+    LZDecompressWramCached(gBattleTextboxTiles, buffer);
+    GetDecompressionCacheStats(&before);
+    LZDecompressWramCached(gBattleTextboxPalette, buffer);
+    LZDecompressWramCached(gBattleTextboxTiles, buffer);
+    GetDecompressionCacheStats(&after);
+    EXPECT_EQ(after.evictions, before.evictions + 2);
+    EXPECT_EQ(after.misses, before.misses + 2);
+    EXPECT_EQ(after.hits, before.hits);
+
+    Free(buffer);
+}
@@ -0,0 +1,106 @@
+#include "global.h"
+#include "test.h"
+#include "dma3.h"
+
+static EWRAM_DATA u32 sSrc[32];
+static EWRAM_DATA u32 sDest[32];
+
+static void ResetDma3Buffers(void)
+{
+    u32 i;
+
+    for (i = 0; i < ARRAY_COUNT(sSrc); i++)
+        sSrc[i] = 0x01010101 * (i + 1);
+    memset(sDest, 0, sizeof(sDest));
+    ClearDma3Requests();
+}
+
+static void ProcessDma3RequestsNow(struct Dma3Stats *stats)
+{
+    // ProcessDma3Requests defers everything once VBlank is about to end.
+    while (REG_VCOUNT > 224)
+        ;
+    ProcessDma3Requests();
+    GetDma3Stats(stats);
+}
+
+TEST("RequestDma3Copy supersedes a queued request it covers")
+{
+    s16 first, second;
+    struct Dma3Stats stats;
+
+    ResetDma3Buffers();
+    first = RequestDma3Copy(&sSrc[0], &sDest[4], 16, 1);
+    second = RequestDma3Copy(&sSrc[8], &sDest[0], 64, 1);
+    EXPECT_EQ(first, second);
+
+    ProcessDma3RequestsNow(&stats);
+    EXPECT_EQ(stats.requestsSuperseded, 1);
+    EXPECT_EQ(stats.requestsSent, 1);
+    EXPECT_EQ(memcmp(&sDest[0], &sSrc[8], 64), 0);
+}
+
+TEST("RequestDma3Copy and RequestDma3Fill merge adjacent requests")
+{
+    u32 i;
+    s16 first, second;
+    struct Dma3Stats stats;
+
+    ResetDma3Buffers();
+    first = RequestDma3Copy(&sSrc[0], &sDest[0], 32, 1);
+    second = RequestDma3Copy(&sSrc[8], &sDest[8], 32, 1);
+    EXPECT_EQ(first, second);
+
+    // A fill in front of a queued fill.
+    first = RequestDma3Fill(0x12345678, &sDest[24], 32, 1);
+    second = RequestDma3Fill(0x12345678, &sDest[16], 32, 1);
+    EXPECT_EQ(first, second);
+
+    ProcessDma3RequestsNow(&stats);
+    EXPECT_EQ(stats.requestsMerged, 2);
+    EXPECT_EQ(stats.requestsSent, 2);
+    EXPECT_EQ(memcmp(&sDest[0], &sSrc[0], 64), 0);
+    for (i = 16; i < 32; i++)
+        EXPECT_EQ(sDest[i], 0x12345678);
+}
+
+TEST("Requests that can't be merged are queued separately")
+{
+    u32 i;
+    s16 first, second;
+    struct Dma3Stats stats;
+
+    ResetDma3Buffers();
+    // Different modes.
+    first = RequestDma3Copy(&sSrc[0], &sDest[0], 16, 1);
+    second = RequestDma3Copy(&sSrc[4], &sDest[4], 16, 0);
+    EXPECT_NE(first, second);
+
+    // Adjacent destinations, but not adjacent sources.
+    first = RequestDma3Copy(&sSrc[20], &sDest[8], 16, 0);
+    EXPECT_NE(first, second);
+
+    // Different fill values.
+    first = RequestDma3Fill(0x11111111, &sDest[16], 16, 1);
+    second = RequestDma3Fill(0x22222222, &sDest[20], 16, 1);
+    EXPECT_NE(first, second);
+
+    // Partly overlapping, so the second must still be written after the first.
+    first = RequestDma3Copy(&sSrc[0], &sDest[24], 16, 1);
+    second = RequestDma3Copy(&sSrc[28], &sDest[26], 16, 1);
+    EXPECT_NE(first, second);
+
+    ProcessDma3RequestsNow(&stats);
+    EXPECT_EQ(stats.requestsMerged, 0);
+    EXPECT_EQ(stats.requestsSuperseded, 0);
+    EXPECT_EQ(stats.requestsSent, 7);
+    EXPECT_EQ(memcmp(&sDest[0], &sSrc[0], 32), 0);
+    EXPECT_EQ(memcmp(&sDest[8], &sSrc[20], 16), 0);
+    for (i = 16; i < 20; i++)
+        EXPECT_EQ(sDest[i], 0x11111111);
+    for (i = 20; i < 24; i++)
+        EXPECT_EQ(sDest[i], 0x22222222);
+    EXPECT_EQ(sDest[24], sSrc[0]);
+    EXPECT_EQ(sDest[25], sSrc[1]);
+    EXPECT_EQ(memcmp(&sDest[26], &sSrc[28], 16), 0);
+}
@@ -0,0 +1,43 @@
+#include "global.h"
+#include "test.h"
+#include "field_weather.h"
+#include "palette.h"
+#include "sprite.h"
+#include "task.h"
+
+TEST("Cached weather color maps match freshly computed ones")
+{
+    u32 i;
+    u16 fresh[16], stale[16];
+
+    ResetTasks();
+    StartWeather();
+    for (i = 0; i < 16; i++)
+        gPlttBufferUnfaded[i] = RGB(i * 2, 31 - i * 2, i);
+
+    ApplyWeatherColorMapIfIdle(3);
+    memcpy(fresh, gPlttBufferFaded, sizeof(fresh));
+    EXPECT_NE(memcmp(fresh, gPlttBufferUnfaded, sizeof(fresh)), 0);
+
+    // The same color map again is served from the cache.
+    CpuFill16(0, gPlttBufferFaded, sizeof(fresh));
+    ApplyWeatherColorMapIfIdle(3);
+    EXPECT_EQ(memcmp(fresh, gPlttBufferFaded, sizeof(fresh)), 0);
+
+    // A reloaded palette must not be served from the cache.
+    memcpy(stale, fresh, sizeof(stale));
+    for (i = 0; i < 16; i++)
+        gPlttBufferUnfaded[i] = RGB(31 - i, i, i * 2);
+    ApplyWeatherColorMapIfIdle(3);
+    memcpy(fresh, gPlttBufferFaded, sizeof(fresh));
+    EXPECT_NE(memcmp(fresh, stale, sizeof(fresh)), 0);
+
+    // Another color map evicts the entry, so this one is computed again.
+    ApplyWeatherColorMapIfIdle(2);
+    ApplyWeatherColorMapIfIdle(3);
+    EXPECT_EQ(memcmp(fresh, gPlttBufferFaded, sizeof(fresh)), 0);
+
+    FreeSpritePaletteByTag(PALTAG_WEATHER);
+    FreeSpritePaletteByTag(PALTAG_WEATHER_2);
+    ResetTasks();
+}
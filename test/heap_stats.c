@@ -0,0 +1,62 @@
+#include "global.h"
+#include "test.h"
+#include "malloc.h"
+
+TEST("GetHeapStats tracks current and peak usage")
+{
+    struct HeapStats before, stats;
+    void *a, *b;
+
+    ASSUME(DEBUG_HEAP_STATS);
+    GetHeapStats(&before);
+    a = Alloc(0x100);
+    b = Alloc(0x200);
+    GetHeapStats(&stats);
+    EXPECT_EQ(stats.bytesAllocated, before.bytesAllocated + 0x300);
+    EXPECT_EQ(stats.allocs, before.allocs + 2);
+    EXPECT_EQ(stats.blocks, before.blocks + 2);
+
+    Free(a);
+    Free(b);
+    GetHeapStats(&stats);
+    EXPECT_EQ(stats.bytesAllocated, before.bytesAllocated);
+    EXPECT_GE(stats.peakBytesAllocated, before.bytesAllocated + 0x300);
+    EXPECT_EQ(stats.frees, before.frees + 2);
+    EXPECT_EQ(stats.largestFreeBlock, before.largestFreeBlock);
+}
+
+TEST("GetHeapStats reports fragmentation")
+{
+    struct HeapStats before, stats;
+    void *a, *b;
+
+    GetHeapStats(&before);
+    a = Alloc(0x100);
+    b = Alloc(0x100);
+    Free(a);
+    GetHeapStats(&stats);
+    EXPECT_EQ(stats.freeBlocks, before.freeBlocks + 1);
+    EXPECT_EQ(stats.largestFreeBlock, before.largestFreeBlock - 0x200 - 2 * sizeof(struct MemBlock));
+    Free(b);
+}
+
+TEST("GetHeapLocationStats counts allocations per location")
+{
+    u32 i, count;
+    const struct HeapLocationStats *locationStats;
+    void *a;
+
+    ASSUME(DEBUG_HEAP_STATS);
+    a = Alloc(0x40);
+    count = GetHeapLocationStats(&locationStats);
+    for (i = 0; i < count; i++)
+    {
+        if (locationStats[i].location == MemBlockLocation((const struct MemBlock *)((u8 *)a - sizeof(struct MemBlock))))
+            break;
+    }
+    EXPECT_LT(i, count);
+    EXPECT_EQ(locationStats[i].liveBlocks, 1);
+    EXPECT_EQ(locationStats[i].liveBytes, 0x40);
+    Free(a);
+    EXPECT_EQ(locationStats[i].liveBlocks, 0);
+}
@@ -0,0 +1,83 @@
+#include "global.h"
+#include "test.h"
+#include "event_object_movement.h"
+
+// Does what spawning does to an object event's coords, without its sprite.
+static void SpawnTestObjectEvent(u32 objectEventId, s16 x, s16 y)
+{
+    struct ObjectEvent *objectEvent = &gObjectEvents[objectEventId];
+
+    *objectEvent = (struct ObjectEvent){};
+    objectEvent->active = TRUE;
+    objectEvent->currentCoords.x = objectEvent->previousCoords.x = x;
+    objectEvent->currentCoords.y = objectEvent->previousCoords.y = y;
+    UpdateObjectEventSpatialIndex(objectEvent);
+}
+
+static void ClearTestObjectEvents(void)
+{
+    memset(gObjectEvents, 0, sizeof(gObjectEvents));
+    RebuildObjectEventSpatialIndex();
+}
+
+TEST("GetObjectEventIdByXY finds object events after they move")
+{
+    ClearTestObjectEvents();
+    // Both start in the same bucket, so only the coords tell them apart.
+    SpawnTestObjectEvent(0, 10, 10);
+    SpawnTestObjectEvent(1, 18, 10);
+    EXPECT_EQ(GetObjectEventIdByXY(10, 10), 0);
+    EXPECT_EQ(GetObjectEventIdByXY(18, 10), 1);
+
+    ShiftObjectEventCoords(&gObjectEvents[0], 11, 10);
+    EXPECT_EQ(GetObjectEventIdByXY(11, 10), 0);
+    EXPECT_EQ(GetObjectEventIdByXY(10, 10), OBJECT_EVENTS_COUNT);
+
+    ShiftStillObjectEventCoords(&gObjectEvents[0]);
+    EXPECT_EQ(GetObjectEventIdByXY(11, 10), 0);
+
+    ShiftObjectEventCoords(&gObjectEvents[1], 50, 61);
+    ShiftObjectEventCoords(&gObjectEvents[1], 51, 61);
+    EXPECT_EQ(GetObjectEventIdByXY(18, 10), OBJECT_EVENTS_COUNT);
+    EXPECT_EQ(GetObjectEventIdByXY(50, 61), OBJECT_EVENTS_COUNT);
+    EXPECT_EQ(GetObjectEventIdByXY(51, 61), 1);
+    ClearTestObjectEvents();
+}
+
+TEST("GetObjectEventIdByXY finds spawned object events and not despawned ones")
+{
+    ClearTestObjectEvents();
+    SpawnTestObjectEvent(2, 5, 5);
+    EXPECT_EQ(GetObjectEventIdByXY(5, 5), 2);
+
+    gObjectEvents[2].active = FALSE;
+    EXPECT_EQ(GetObjectEventIdByXY(5, 5), OBJECT_EVENTS_COUNT);
+
+    // The freed slot is reused somewhere else, and another object event
+    // spawns where it was.
+    SpawnTestObjectEvent(2, 30, 30);
+    SpawnTestObjectEvent(3, 5, 5);
+    EXPECT_EQ(GetObjectEventIdByXY(30, 30), 2);
+    EXPECT_EQ(GetObjectEventIdByXY(5, 5), 3);
+    ClearTestObjectEvents();
+}
+
+TEST("GetObjectEventIdByPosition finds object events after a rebuild")
+{
+    ClearTestObjectEvents();
+    SpawnTestObjectEvent(4, 20, 20);
+    SpawnTestObjectEvent(5, 21, 20);
+    gObjectEvents[5].currentElevation = 3;
+
+    // The camera moving shifts every object event at once.
+    gObjectEvents[4].currentCoords.x -= 4;
+    gObjectEvents[4].previousCoords.x -= 4;
+    gObjectEvents[5].currentCoords.x -= 4;
+    gObjectEvents[5].previousCoords.x -= 4;
+    RebuildObjectEventSpatialIndex();
+    EXPECT_EQ(GetObjectEventIdByPosition(16, 20, 0), 4);
+    EXPECT_EQ(GetObjectEventIdByPosition(17, 20, 3), 5);
+    EXPECT_EQ(GetObjectEventIdByPosition(17, 20, 4), OBJECT_EVENTS_COUNT);
+    EXPECT_EQ(GetObjectEventIdByPosition(20, 20, 0), OBJECT_EVENTS_COUNT);
+    ClearTestObjectEvents();
+}
@@ -0,0 +1,48 @@
+#include "global.h"
+#include "test.h"
+#include "palette.h"
+
+TEST("TransferPlttBuffer uploads rows marked dirty")
+{
+    u16 *pltt = (u16 *)PLTT;
+
+    gPaletteFade.bufferTransferDisabled = FALSE;
+    gPlttBufferFaded[3 * 16 + 5] = pltt[3 * 16 + 5] ^ 0x7FFF;
+    MarkPlttBufferDirty(3 * 16 + 5, 2);
+    TransferPlttBuffer();
+    EXPECT_EQ(pltt[3 * 16 + 5], gPlttBufferFaded[3 * 16 + 5]);
+}
+
+TEST("TransferPlttBuffer leaves rows that are not marked dirty")
+{
+    u16 *pltt = (u16 *)PLTT;
+    u16 color = pltt[4 * 16];
+
+    gPaletteFade.bufferTransferDisabled = FALSE;
+    SetPlttBufferDirtyRowTracking(TRUE);
+    TransferPlttBuffer();
+    gPlttBufferFaded[4 * 16] = color ^ 0x7FFF;
+    TransferPlttBuffer();
+    EXPECT_EQ(pltt[4 * 16], color);
+    SetPlttBufferDirtyRowTracking(FALSE);
+}
+
+TEST("TransferPlttBuffer uploads every row while tracking is disabled")
+{
+    u32 i;
+    u16 *pltt = (u16 *)PLTT;
+
+    gPaletteFade.bufferTransferDisabled = FALSE;
+    SetPlttBufferDirtyRowTracking(FALSE);
+    for (i = 0; i < 16; i++)
+    {
+        gPlttBufferFaded[16 + i] = pltt[16 + i] ^ 0x1F;
+        gPlttBufferFaded[17 * 16 + i] = pltt[17 * 16 + i] ^ 0x3E0;
+    }
+    TransferPlttBuffer();
+    for (i = 0; i < 16; i++)
+    {
+        EXPECT_EQ(pltt[16 + i], gPlttBufferFaded[16 + i]);
+        EXPECT_EQ(pltt[17 * 16 + i], gPlttBufferFaded[17 * 16 + i]);
+    }
+}
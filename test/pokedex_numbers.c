@@ -0,0 +1,25 @@
+#include "global.h"
+#include "test.h"
+#include "pokemon.h"
+#include "constants/pokedex.h"
+
+TEST("NationalPokedexNumToSpecies is the inverse of SpeciesToNationalPokedexNum")
+{
+    u32 nationalNum;
+
+    for (nationalNum = 1; nationalNum <= NATIONAL_DEX_COUNT; nationalNum++)
+        EXPECT_EQ(SpeciesToNationalPokedexNum(NationalPokedexNumToSpecies(nationalNum)), nationalNum);
+    EXPECT_EQ(NationalPokedexNumToSpecies(0), SPECIES_NONE);
+    EXPECT_EQ(NationalPokedexNumToSpecies(NATIONAL_DEX_COUNT + 1), SPECIES_NONE);
+}
+
+TEST("Hoenn and National Dex numbers convert back and forth")
+{
+    u32 hoennNum;
+
+    for (hoennNum = 1; hoennNum < HOENN_DEX_COUNT; hoennNum++)
+    {
+        EXPECT_EQ(SpeciesToHoennPokedexNum(HoennPokedexNumToSpecies(hoennNum)), hoennNum);
+        EXPECT_EQ(NationalToHoennOrder(HoennToNationalOrder(hoennNum)), hoennNum);
+    }
+}
@@ -0,0 +1,213 @@
+#include "global.h"
+#include "test.h"
+#include "test_benchmark.h"
+#include "task.h"
+
+static EWRAM_DATA u8 sRunOrder[NUM_TASKS];
+static EWRAM_DATA u8 sRunCount;
+
+static void Task_RecordRun(u8 taskId)
+{
+    sRunOrder[sRunCount++] = taskId;
+}
+
+static void Task_RecordRunAgain(u8 taskId)
+{
+    sRunOrder[sRunCount++] = taskId;
+}
+
+static void Task_RecordRunAndDestroy(u8 taskId)
+{
+    sRunOrder[sRunCount++] = taskId;
+    DestroyTask(taskId);
+}
+
+static void Task_Empty(u8 taskId)
+{
+}
+
+TEST("RunTasks runs tasks in priority order and FIFO within a priority")
+{
+    u8 a, b, c, d;
+
+    ResetTasks();
+    a = CreateTask(Task_RecordRun, 5);
+    b = CreateTask(Task_RecordRun, 1);
+    c = CreateTask(Task_RecordRun, 5);
+    d = CreateTask(Task_RecordRun, 0);
+    sRunCount = 0;
+    RunTasks();
+    EXPECT_EQ(sRunCount, 4);
+    EXPECT_EQ(sRunOrder[0], d);
+    EXPECT_EQ(sRunOrder[1], b);
+    EXPECT_EQ(sRunOrder[2], a);
+    EXPECT_EQ(sRunOrder[3], c);
+    ResetTasks();
+}
+
+TEST("CreateTask reuses the lowest free task id")
+{
+    u32 i;
+
+    ResetTasks();
+    for (i = 0; i < NUM_TASKS; i++)
+        EXPECT_EQ(CreateTask(Task_Empty, 0), i);
+    EXPECT_EQ(CreateTask(Task_Empty, 0), 0);
+    EXPECT_EQ(GetTaskCount(), NUM_TASKS);
+    DestroyTask(9);
+    DestroyTask(4);
+    EXPECT_EQ(CreateTask(Task_Empty, 0), 4);
+    EXPECT_EQ(CreateTask(Task_Empty, 0), 9);
+    ResetTasks();
+}
+
+TEST("Tasks can destroy themselves while RunTasks is running")
+{
+    u8 a, b, c;
+
+    ResetTasks();
+    a = CreateTask(Task_RecordRunAndDestroy, 0);
+    b = CreateTask(Task_RecordRun, 2);
+    c = CreateTask(Task_RecordRunAndDestroy, 2);
+    sRunCount = 0;
+    RunTasks();
+    EXPECT_EQ(sRunCount, 3);
+    EXPECT_EQ(sRunOrder[0], a);
+    EXPECT_EQ(sRunOrder[1], b);
+    EXPECT_EQ(sRunOrder[2], c);
+    EXPECT_EQ(GetTaskCount(), 1);
+
+    a = CreateTask(Task_RecordRun, 2);
+    sRunCount = 0;
+    RunTasks();
+    EXPECT_EQ(sRunCount, 2);
+    EXPECT_EQ(sRunOrder[0], b);
+    EXPECT_EQ(sRunOrder[1], a);
+    ResetTasks();
+}
+
+TEST("DelayTask skips the task until the delay has passed")
+{
+    u32 i;
+    u8 a, b, c;
+
+    ResetTasks();
+    a = CreateTask(Task_RecordRun, 0);
+    b = CreateTask(Task_RecordRun, 0);
+    c = CreateTask(Task_RecordRun, 0);
+    DelayTask(a, 3);
+    DelayTask(b, 300);
+    DelayTask(c, 1);
+    EXPECT(FuncIsActiveTask(Task_RecordRun));
+    EXPECT_EQ(GetTaskCount(), 3);
+
+    for (i = 1; i <= 300; i++)
+    {
+        sRunCount = 0;
+        RunTasks();
+        if (i == 3)
+        {
+            EXPECT_EQ(sRunCount, 2);
+            EXPECT_EQ(sRunOrder[0], c);
+            EXPECT_EQ(sRunOrder[1], a);
+        }
+        else if (i == 300)
+        {
+            EXPECT_EQ(sRunCount, 3);
+            EXPECT_EQ(sRunOrder[2], b);
+        }
+        else if (i < 3)
+        {
+            EXPECT_EQ(sRunCount, 1);
+            EXPECT_EQ(sRunOrder[0], c);
+        }
+        else
+        {
+            EXPECT_EQ(sRunCount, 2);
+        }
+    }
+    ResetTasks();
+}
+
+TEST("DestroyTask cancels a delay")
+{
+    u32 i;
+    u8 a;
+
+    ResetTasks();
+    a = CreateTask(Task_RecordRun, 0);
+    DelayTask(a, 2);
+    DestroyTask(a);
+    EXPECT_EQ(CreateTask(Task_RecordRun, 0), a);
+    sRunCount = 0;
+    for (i = 0; i < 4; i++)
+        RunTasks();
+    EXPECT_EQ(sRunCount, 4);
+    ResetTasks();
+}
+
+TEST("SetTaskPeriod runs the task every period frames")
+{
+    u32 i;
+    u8 a;
+
+    ResetTasks();
+    a = CreateTask(Task_RecordRun, 0);
+    SetTaskPeriod(a, 5);
+    sRunCount = 0;
+    for (i = 0; i < 11; i++)
+        RunTasks();
+    EXPECT_EQ(sRunCount, 3);
+    ResetTasks();
+}
+
+TEST("SetTaskPeriod is cleared when the task's func changes")
+{
+    u32 i;
+    u8 a;
+
+    ResetTasks();
+    a = CreateTask(Task_RecordRun, 0);
+    SetTaskPeriod(a, 5);
+    gTasks[a].func = Task_RecordRunAgain;
+    sRunCount = 0;
+    for (i = 0; i < 11; i++)
+        RunTasks();
+    EXPECT_EQ(sRunCount, 11);
+    ResetTasks();
+}
+
+// Every frame, each task destroys itself and takes a free slot again at
+// another priority, and every fourth one sleeps for a few frames, so the
+// list insertion and the timer wheel are both exercised.
+static void Task_Churn(u8 taskId)
+{
+    u8 priority = gTasks[taskId].priority;
+
+    DestroyTask(taskId);
+    taskId = CreateTask(Task_Churn, (priority + 7) % 5);
+    if (taskId % 4 == 0)
+        DelayTask(taskId, 2 + taskId);
+}
+
+static void CB2_TaskSchedulerScene(void)
+{
+    u32 i;
+
+    if (gMain.state == 0)
+    {
+        ResetTasks();
+        for (i = 0; i < NUM_TASKS; i++)
+            CreateTask(Task_Churn, i * 7 % 5);
+        gMain.state++;
+    }
+    RunTasks();
+}
+
+BENCHMARK("Benchmark: Task scheduler churn")
+{
+    START_SCENE(CB2_TaskSchedulerScene);
+    WARM_UP(1);
+    WAIT(120);
+    EXPECT_MAX_CYCLES(PROFILE_PHASE_TASKS, 20000);
+}
@@ -0,0 +1,21 @@
+#include "global.h"
+#include "test.h"
+#include "pokemon.h"
+#include "constants/moves.h"
+
+// CanLearnTeachableMove binary searches the learnsets.
+TEST("Teachable learnsets are sorted by move id")
+{
+    u32 species, i;
+
+    for (species = 0; species < NUM_SPECIES; species++)
+    {
+        const struct TeachableLearnset *learnset = &gTeachableLearnsets[species];
+
+        if (learnset->moves == NULL)
+            continue;
+        for (i = 1; i < learnset->count; i++)
+            EXPECT_LT(learnset->moves[i - 1], learnset->moves[i]);
+        EXPECT_EQ(learnset->moves[learnset->count], MOVE_UNAVAILABLE);
+    }
+}
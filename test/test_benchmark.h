@@ -0,0 +1,115 @@
+/* Embedded DSL for measuring the frame cost of real scenes.
+ *
+ * To run all the benchmarks use:
+ *     make check TESTS="Benchmark"
+ * The cycle counts need DEBUG_FRAME_PROFILER enabled in
+ * include/config/debug.h, otherwise only the heap usage is measured and
+ * EXPECT_MAX_CYCLES is not checked.
+ *
+ * A benchmark starts a scene by setting the main callback, then plays
+ * back a script of key inputs, one step per frame. All input from the
+ * hardware is ignored while a benchmark is running, so runs are
+ * reproducible. For example:
+ *
+ * BENCHMARK("Benchmark: Option menu scrolling")
+ * {
+ *     START_SCENE(CB2_InitOptionMenu);
+ *     WARM_UP(30);
+ *     HOLD(DPAD_DOWN, 60);
+ *     PRESS(DPAD_RIGHT);
+ *     EXPECT_MAX_CYCLES(PROFILE_PHASE_MAIN_CALLBACKS, 100000);
+ *     EXPECT_MAX_HEAP(0x4000);
+ * }
+ *
+ * Once the script has finished, the runner prints the min/avg/max cycles
+ * of every frame profiler phase and the peak heap usage of the measured
+ * frames, and then checks the expectations.
+ *
+ * START_SCENE(callback)
+ * Sets the main callback2 that opens the scene. callback1 and the
+ * interrupt callbacks are cleared, the scene is expected to set them.
+ *
+ * WARM_UP(frames)
+ * Runs frames without input and without measuring them, e.g. while the
+ * scene is loading. Must come before any measured step.
+ *
+ * WAIT(frames)
+ * Runs and measures frames without input.
+ *
+ * HOLD(keys, frames)
+ * Runs and measures frames while keys are held.
+ *
+ * PRESS(keys)
+ * Holds keys for one frame and then releases them for one frame.
+ *
+ * EXPECT_MAX_CYCLES(phase, cycles)
+ * Fails if any measured frame spent more than cycles in phase.
+ *
+ * EXPECT_MAX_HEAP(bytes)
+ * Fails if the scene had more than bytes allocated at the end of any
+ * measured frame. Allocations made before the scene started (e.g. by the
+ * runner) are not counted. */
+
+#ifndef GUARD_TEST_BENCHMARK_H
+#define GUARD_TEST_BENCHMARK_H
+
+#include "frame_profiler.h"
+#include "main.h"
+#include "test.h"
+
+#define MAX_BENCHMARK_STEPS 32
+
+struct BenchmarkStep
+{
+    u16 keys;
+    u16 frames;
+    bool8 measured;
+};
+
+struct BenchmarkTestRunnerState
+{
+    MainCallback scene;
+    struct BenchmarkStep steps[MAX_BENCHMARK_STEPS];
+    u8 stepsCount;
+    u8 runStep;
+    u16 runStepFrame;
+    bool8 running:1;
+    bool8 measuring:1;
+    u32 frames;
+    u32 checkProgressFrames;
+    u32 heapBaseline;
+    u32 heapPeak;
+    u32 maxCycles[PROFILE_PHASE_COUNT]; // 0 if not checked.
+    u16 maxCyclesSourceLine[PROFILE_PHASE_COUNT];
+    u32 maxHeap; // 0 if not checked.
+    u16 maxHeapSourceLine;
+};
+
+extern const struct TestRunner gBenchmarkTestRunner;
+extern struct BenchmarkTestRunnerState *gBenchmarkTestRunnerState;
+
+#define BENCHMARK(_name) \
+    static void CAT(Benchmark, __LINE__)(void); \
+    __attribute__((section(".tests"))) static const struct Test CAT(sTest, __LINE__) = \
+    { \
+        .name = _name, \
+        .filename = __FILE__, \
+        .runner = &gBenchmarkTestRunner, \
+        .data = (void *)CAT(Benchmark, __LINE__), \
+    }; \
+    static void CAT(Benchmark, __LINE__)(void)
+
+#define START_SCENE(callback) StartScene_(__LINE__, callback)
+#define WARM_UP(frames) BenchmarkStep_(__LINE__, 0, frames, FALSE)
+#define WAIT(frames) BenchmarkStep_(__LINE__, 0, frames, TRUE)
+#define HOLD(keys, frames) BenchmarkStep_(__LINE__, keys, frames, TRUE)
+#define PRESS(keys) do { HOLD(keys, 1); WAIT(1); } while (0)
+#define EXPECT_MAX_CYCLES(phase, cycles) ExpectMaxCycles_(__LINE__, phase, cycles)
+#define EXPECT_MAX_HEAP(bytes) ExpectMaxHeap_(__LINE__, bytes)
+
+void StartScene_(u32 sourceLine, MainCallback callback);
+void BenchmarkStep_(u32 sourceLine, u32 keys, u32 frames, bool32 measured);
+void ExpectMaxCycles_(u32 sourceLine, enum FrameProfilerPhase phase, u32 cycles);
+void ExpectMaxHeap_(u32 sourceLine, u32 bytes);
+
+#endif
@@ -175,6 +175,13 @@ void CB2_TestRunner(void)
             while (block != head);
         }
 
+        if (DEBUG_HEAP_STATS && gTestRunnerState.test->runner != &gAssumptionsRunner)
+        {
+            struct HeapStats stats;
+            GetHeapStats(&stats);
+            MgbaPrintf_("heap: %d bytes peak, %d allocs, %d failed, largest free block %d bytes", stats.peakBytesAllocated, stats.allocs, stats.failedAllocs, stats.largestFreeBlock);
+        }
+
         if (gTestRunnerState.test->runner == &gAssumptionsRunner)
         {
             if (gTestRunnerState.result != TEST_RESULT_PASS)
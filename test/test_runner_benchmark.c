@@ -0,0 +1,217 @@
+#include "global.h"
+#include "malloc.h"
+#include "scanline_effect.h"
+#include "sprite.h"
+#include "task.h"
+#include "test_benchmark.h"
+#include "window.h"
+
+#define STATE gBenchmarkTestRunnerState
+
+#define INVALID_IF(c, fmt, ...) do { if (c) Test_ExitWithResult(TEST_RESULT_INVALID, "%s:%d: " fmt, gTestRunnerState.test->filename, sourceLine, ##__VA_ARGS__); } while (0)
+
+EWRAM_DATA struct BenchmarkTestRunnerState *gBenchmarkTestRunnerState;
+
+void ReinitCallbacks(void);
+
+static void InvokeBenchmarkFunction(void *data)
+{
+    void (*function)(void) = data;
+    function();
+}
+
+static u32 HeapBytesAllocated(void)
+{
+    u32 bytes = 0;
+    const struct MemBlock *head = HeapHead();
+    const struct MemBlock *block = head;
+    do
+    {
+        if (block->allocated)
+            bytes += sizeof(struct MemBlock) + block->size;
+        block = block->next;
+    }
+    while (block != head);
+    return bytes;
+}
+
+static u32 BenchmarkTest_EstimateCost(void *data)
+{
+    u32 i, frames = 0;
+    STATE = AllocZeroed(sizeof(*STATE));
+    if (!STATE)
+        return 0;
+    InvokeBenchmarkFunction(data);
+    for (i = 0; i < STATE->stepsCount; i++)
+        frames += STATE->steps[i].frames;
+    FREE_AND_SET_NULL(STATE);
+    // A battle test trial is a few hundred frames.
+    return 1 + frames / 300;
+}
+
+static void BenchmarkTest_SetUp(void *data)
+{
+    STATE = AllocZeroed(sizeof(*STATE));
+    if (!STATE)
+        Test_ExitWithResult(TEST_RESULT_ERROR, "OOM: STATE = AllocZerod(%d)", sizeof(*STATE));
+    // The scene is abandoned wherever the script ends, so whatever it
+    // allocated is never freed.
+    Test_ExpectLeaks(TRUE);
+    InvokeBenchmarkFunction(data);
+}
+
+static void BenchmarkTest_Run(void *data)
+{
+    if (STATE->scene == NULL)
+        Test_ExitWithResult(TEST_RESULT_INVALID, "%s: BENCHMARK without START_SCENE", gTestRunnerState.test->filename);
+    if (STATE->stepsCount == 0 || !STATE->steps[STATE->stepsCount - 1].measured)
+        Test_ExitWithResult(TEST_RESULT_INVALID, "%s: BENCHMARK without measured steps", gTestRunnerState.test->filename);
+
+    STATE->heapBaseline = HeapBytesAllocated();
+    STATE->running = TRUE;
+    gMain.callback1 = NULL;
+    gMain.vblankCallback = NULL;
+    gMain.hblankCallback = NULL;
+    SetMainCallback2(STATE->scene);
+}
+
+static void FinishBenchmark(void)
+{
+#if DEBUG_FRAME_PROFILER
+    u32 i;
+    struct FrameProfilerStats stats;
+#endif
+
+    STATE->running = FALSE;
+    ReinitCallbacks();
+
+#if DEBUG_FRAME_PROFILER
+    for (i = 0; i < PROFILE_PHASE_COUNT; i++)
+    {
+        GetFrameProfilerStats(i, &stats);
+        MgbaPrintf_("%s: %d/%d/%d cycles (min/avg/max) over %d frames", GetFrameProfilerPhaseName(i), stats.minCycles, stats.avgCycles, stats.maxCycles, stats.frames);
+    }
+
+    for (i = 0; i < PROFILE_PHASE_COUNT; i++)
+    {
+        GetFrameProfilerStats(i, &stats);
+        if (STATE->maxCycles[i] != 0 && stats.maxCycles > STATE->maxCycles[i])
+        {
+            MgbaPrintf_("%s:%d: EXPECT_MAX_CYCLES(%s, %d) failed, max %d", gTestRunnerState.test->filename, STATE->maxCyclesSourceLine[i], GetFrameProfilerPhaseName(i), STATE->maxCycles[i], stats.maxCycles);
+            gTestRunnerState.result = TEST_RESULT_FAIL;
+        }
+    }
+#endif
+
+    MgbaPrintf_("heap: %d bytes peak", STATE->heapPeak);
+    if (STATE->maxHeap != 0 && STATE->heapPeak > STATE->maxHeap)
+    {
+        MgbaPrintf_("%s:%d: EXPECT_MAX_HEAP(%d) failed, peak %d", gTestRunnerState.test->filename, STATE->maxHeapSourceLine, STATE->maxHeap, STATE->heapPeak);
+        gTestRunnerState.result = TEST_RESULT_FAIL;
+    }
+}
+
+// Called from ReadKeys at the start of every frame. Replaces the hardware
+// key input with the benchmark's script.
+u16 TestRunner_Benchmark_KeyInput(u16 keyInput)
+{
+    const struct BenchmarkStep *step;
+
+    if (STATE == NULL || !STATE->running)
+        return keyInput;
+
+    // Sample the heap at the end of the previous frame.
+    if (STATE->measuring)
+    {
+        u32 bytes = HeapBytesAllocated() - STATE->heapBaseline;
+        if (bytes > STATE->heapPeak)
+            STATE->heapPeak = bytes;
+    }
+
+    while (STATE->runStep < STATE->stepsCount
+        && STATE->runStepFrame >= STATE->steps[STATE->runStep].frames)
+    {
+        STATE->runStep++;
+        STATE->runStepFrame = 0;
+    }
+
+    if (STATE->runStep == STATE->stepsCount)
+    {
+        FinishBenchmark();
+        return 0;
+    }
+
+    step = &STATE->steps[STATE->runStep];
+    if (step->measured && !STATE->measuring)
+    {
+    #if DEBUG_FRAME_PROFILER
+        ResetFrameProfiler();
+    #endif
+        STATE->heapPeak = 0;
+        STATE->measuring = TRUE;
+    }
+    STATE->runStepFrame++;
+    STATE->frames++;
+    return step->keys;
+}
+
+static void BenchmarkTest_TearDown(void *data)
+{
+    if (STATE)
+    {
+        // Stop whatever the scene was doing so that it doesn't leak into
+        // the next test.
+        ResetTasks();
+        ResetSpriteData();
+        FreeAllSpritePalettes();
+        ScanlineEffect_Stop();
+        FreeAllWindowBuffers();
+        FREE_AND_SET_NULL(STATE);
+    }
+}
+
+static bool32 BenchmarkTest_CheckProgress(void *data)
+{
+    bool32 madeProgress = STATE->checkProgressFrames < STATE->frames;
+    STATE->checkProgressFrames = STATE->frames;
+    return madeProgress;
+}
+
+const struct TestRunner gBenchmarkTestRunner =
+{
+    .estimateCost = BenchmarkTest_EstimateCost,
+    .setUp = BenchmarkTest_SetUp,
+    .run = BenchmarkTest_Run,
+    .tearDown = BenchmarkTest_TearDown,
+    .checkProgress = BenchmarkTest_CheckProgress,
+};
+
+void StartScene_(u32 sourceLine, MainCallback callback)
+{
+    INVALID_IF(STATE->scene != NULL, "START_SCENE already called");
+    STATE->scene = callback;
+}
+
+void BenchmarkStep_(u32 sourceLine, u32 keys, u32 frames, bool32 measured)
+{
+    INVALID_IF(STATE->stepsCount >= MAX_BENCHMARK_STEPS, "Too many steps");
+    INVALID_IF(frames == 0 || frames > UINT16_MAX, "Illegal frames: %d", frames);
+    INVALID_IF(!measured && STATE->stepsCount > 0 && STATE->steps[STATE->stepsCount - 1].measured, "WARM_UP after a measured step");
+    STATE->steps[STATE->stepsCount].keys = keys;
+    STATE->steps[STATE->stepsCount].frames = frames;
+    STATE->steps[STATE->stepsCount].measured = measured;
+    STATE->stepsCount++;
+}
+
+void ExpectMaxCycles_(u32 sourceLine, enum FrameProfilerPhase phase, u32 cycles)
+{
+    INVALID_IF(phase >= PROFILE_PHASE_COUNT, "Illegal phase: %d", phase);
+    STATE->maxCycles[phase] = cycles;
+    STATE->maxCyclesSourceLine[phase] = sourceLine;
+}
+
+void ExpectMaxHeap_(u32 sourceLine, u32 bytes)
+{
+    STATE->maxHeap = bytes;
+    STATE->maxHeapSourceLine = sourceLine;
+}
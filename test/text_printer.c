@@ -0,0 +1,94 @@
+#include "global.h"
+#include "test.h"
+#include "string_util.h"
+#include "text.h"
+#include "window.h"
+
+#define TEST_WINDOW_WIDTH 8
+#define TEST_WINDOW_HEIGHT 2
+#define TEST_WINDOW_SIZE (TEST_WINDOW_WIDTH * TEST_WINDOW_HEIGHT * TILE_SIZE_4BPP)
+
+static const struct WindowTemplate sTestWindowTemplates[] =
+{
+    {
+        .bg = 0,
+        .tilemapLeft = 0,
+        .tilemapTop = 0,
+        .width = TEST_WINDOW_WIDTH,
+        .height = TEST_WINDOW_HEIGHT,
+        .paletteNum = 15,
+        .baseBlock = 1,
+    },
+    DUMMY_WIN_TEMPLATE,
+};
+
+// Prints str into a cleared window without drawing it, and keeps the window's pixels in pixels.
+static void PrintToTestWindow(const u8 *str, u32 letterSpacing, u32 fgColor, u32 bgColor, u32 shadowColor, u8 *pixels)
+{
+    struct TextPrinterTemplate printer =
+    {
+        .currentChar = str,
+        .windowId = 0,
+        .fontId = FONT_NORMAL,
+        .letterSpacing = letterSpacing,
+        .fgColor = fgColor,
+        .bgColor = bgColor,
+        .shadowColor = shadowColor,
+    };
+
+    FillWindowPixelBuffer(0, PIXEL_FILL(bgColor));
+    AddTextPrinter(&printer, TEXT_SKIP_DRAW, NULL);
+    memcpy(pixels, gWindows[0].tileData, TEST_WINDOW_SIZE);
+}
+
+TEST("Text printed from the glyph cache matches freshly decompressed text")
+{
+    static const u8 sText[] = _("Glyph");
+    u8 text[sizeof(sText)];
+    u8 *expected = Alloc(TEST_WINDOW_SIZE);
+    u8 *actual = Alloc(TEST_WINDOW_SIZE);
+
+    // Only strings in ROM are prerendered, so a copy always goes through the glyphs.
+    StringCopy(text, sText);
+    SetDefaultFontsPointer();
+    InitWindows(sTestWindowTemplates);
+
+    // Cache entries are keyed by the colors too, so printing with another
+    // background color evicts the glyphs before each fresh print.
+    PrintToTestWindow(text, 0, TEXT_COLOR_DARK_GRAY, TEXT_COLOR_WHITE, TEXT_COLOR_LIGHT_GRAY, expected);
+    PrintToTestWindow(text, 0, TEXT_COLOR_DARK_GRAY, TEXT_COLOR_TRANSPARENT, TEXT_COLOR_LIGHT_GRAY, actual);
+    EXPECT_NE(memcmp(expected, actual, TEST_WINDOW_SIZE), 0);
+
+    PrintToTestWindow(text, 0, TEXT_COLOR_DARK_GRAY, TEXT_COLOR_WHITE, TEXT_COLOR_LIGHT_GRAY, expected);
+    PrintToTestWindow(text, 0, TEXT_COLOR_DARK_GRAY, TEXT_COLOR_WHITE, TEXT_COLOR_LIGHT_GRAY, actual);
+    EXPECT_EQ(memcmp(expected, actual, TEST_WINDOW_SIZE), 0);
+
+    FreeAllWindowBuffers();
+    Free(expected);
+    Free(actual);
+}
+
+TEST("Prerendered text is not reused for a different letter spacing")
+{
+    static const u8 sText[] = _("Label");
+    u8 *narrow = Alloc(TEST_WINDOW_SIZE);
+    u8 *wide = Alloc(TEST_WINDOW_SIZE);
+    u8 *again = Alloc(TEST_WINDOW_SIZE);
+
+    SetDefaultFontsPointer();
+    InitWindows(sTestWindowTemplates);
+
+    PrintToTestWindow(sText, 0, TEXT_COLOR_DARK_GRAY, TEXT_COLOR_WHITE, TEXT_COLOR_LIGHT_GRAY, narrow);
+    PrintToTestWindow(sText, 2, TEXT_COLOR_DARK_GRAY, TEXT_COLOR_WHITE, TEXT_COLOR_LIGHT_GRAY, wide);
+    EXPECT_NE(memcmp(narrow, wide, TEST_WINDOW_SIZE), 0);
+
+    PrintToTestWindow(sText, 2, TEXT_COLOR_DARK_GRAY, TEXT_COLOR_WHITE, TEXT_COLOR_LIGHT_GRAY, again);
+    EXPECT_EQ(memcmp(wide, again, TEST_WINDOW_SIZE), 0);
+    PrintToTestWindow(sText, 0, TEXT_COLOR_DARK_GRAY, TEXT_COLOR_WHITE, TEXT_COLOR_LIGHT_GRAY, again);
+    EXPECT_EQ(memcmp(narrow, again, TEST_WINDOW_SIZE), 0);
+
+    FreeAllWindowBuffers();
+    Free(narrow);
+    Free(wide);
+    Free(again);
+}
@@ -0,0 +1,39 @@
+#include "global.h"
+#include "test.h"
+#include "battle_util.h"
+#include "constants/abilities.h"
+#include "constants/moves.h"
+
+TEST("GetDualTypeModifier matches the per-type modifiers")
+{
+    u32 atkType, defType1, defType2;
+    for (atkType = 0; atkType < NUMBER_OF_MON_TYPES; atkType++)
+    {
+        for (defType1 = 0; defType1 < NUMBER_OF_MON_TYPES; defType1++)
+        {
+            for (defType2 = 0; defType2 < NUMBER_OF_MON_TYPES; defType2++)
+            {
+                u32 expected = GetTypeModifier(atkType, defType1);
+                if (defType2 != defType1)
+                    expected = UQ_4_12_TO_INT(expected * GetTypeModifier(atkType, defType2) + UQ_4_12_ROUND);
+                EXPECT_EQ(GetDualTypeModifier(atkType, defType1, defType2), expected);
+            }
+        }
+    }
+}
+
+TEST("CalcPartyTypeEffectivenessMultipliers matches CalcPartyMonTypeEffectivenessMultiplier")
+{
+    u32 i, move;
+    u16 modifiers[4];
+    static const u16 species[4] = { SPECIES_WOBBUFFET, SPECIES_GYARADOS, SPECIES_SHEDINJA, SPECIES_BRONZONG };
+    static const u16 abilities[4] = { ABILITY_SHADOW_TAG, ABILITY_INTIMIDATE, ABILITY_WONDER_GUARD, ABILITY_LEVITATE };
+    PARAMETRIZE { move = MOVE_TACKLE; }
+    PARAMETRIZE { move = MOVE_THUNDERBOLT; }
+    PARAMETRIZE { move = MOVE_EARTHQUAKE; }
+    PARAMETRIZE { move = MOVE_FREEZE_DRY; }
+    PARAMETRIZE { move = MOVE_SHADOW_BALL; }
+    CalcPartyTypeEffectivenessMultipliers(move, species, abilities, ARRAY_COUNT(species), modifiers);
+    for (i = 0; i < ARRAY_COUNT(species); i++)
+        EXPECT_EQ(modifiers[i], CalcPartyMonTypeEffectivenessMultiplier(move, species[i], abilities[i]));
+}
@@ -10,7 +10,7 @@ using std::string;
 using std::vector;
 
 #include <algorithm>
-using std::sort; using std::find;
+using std::sort; using std::stable_sort; using std::find;
 
 #include <map>
 using std::map;
@@ -187,6 +187,35 @@ string generate_map_connections_text(Json map_data) {
     return text.str();
 }
 
+// Emits the indices of the given events sorted by position (y, then x), so the game can binary search
+// for the events on a tile. Events sharing a tile keep their original order, which is their priority.
+// Returns "NULL" if any coordinate isn't a plain number, in which case the game scans the events instead.
+string generate_event_position_index_text(ostringstream &text, const Json &events, const string &label) {
+    vector<unsigned int> order;
+
+    for (unsigned int i = 0; i < events.array_items().size(); i++) {
+        const Json &event = events.array_items()[i];
+        if (!event["x"].is_number() || !event["y"].is_number())
+            return "NULL";
+        order.push_back(i);
+    }
+
+    stable_sort(order.begin(), order.end(), [&events](unsigned int a, unsigned int b) {
+        const Json &event_a = events.array_items()[a];
+        const Json &event_b = events.array_items()[b];
+        if (event_a["y"].int_value() != event_b["y"].int_value())
+            return event_a["y"].int_value() < event_b["y"].int_value();
+        return event_a["x"].int_value() < event_b["x"].int_value();
+    });
+
+    text << label << ":\n";
+    for (unsigned int i : order)
+        text << "\t.byte " << i << "\n";
+    text << "\t.align 2\n\n";
+
+    return label;
+}
+
 string generate_map_events_text(Json map_data) {
     if (map_data.object_items().find("shared_events_map") != map_data.object_items().end())
         return string("\n");
@@ -198,6 +227,7 @@ string generate_map_events_text(Json map_data) {
     text << "@\n@ DO NOT MODIFY THIS FILE! It is auto-generated from data/maps/" << mapName << "/map.json\n@\n\n";
 
     string objects_label, warps_label, coords_label, bgs_label;
+    string warps_index_label = "NULL", coords_index_label = "NULL", bgs_index_label = "NULL";
 
     if (map_data["object_events"].array_items().size() > 0) {
         objects_label = mapName + "_ObjectEvents";
@@ -248,6 +278,7 @@ string generate_map_events_text(Json map_data) {
                  << json_to_string(warp_event, "dest_map") << "\n";
         }
         text << "\n";
+        warps_index_label = generate_event_position_index_text(text, map_data["warp_events"], mapName + "_MapWarpsByPosition");
     } else {
         warps_label = "NULL";
     }
@@ -278,6 +309,7 @@ string generate_map_events_text(Json map_data) {
             }
         }
         text << "\n";
+        coords_index_label = generate_event_position_index_text(text, map_data["coord_events"], mapName + "_MapCoordEventsByPosition");
     } else {
         coords_label = "NULL";
     }
@@ -320,13 +352,15 @@ string generate_map_events_text(Json map_data) {
             }
         }
         text << "\n";
+        bgs_index_label = generate_event_position_index_text(text, map_data["bg_events"], mapName + "_MapBGEventsByPosition");
     } else {
         bgs_label = "NULL";
     }
 
     text << mapName << "_MapEvents::\n"
          << "\tmap_events " << objects_label << ", " << warps_label << ", "
-         << coords_label << ", " << bgs_label << "\n\n";
+         << coords_label << ", " << bgs_label << ", "
+         << warps_index_label << ", " << coords_index_label << ", " << bgs_index_label << "\n\n";
 
     return text.str();
 }